@@ -21,6 +21,7 @@
  */
 
 #include "srsran/gtpu/gtpu_config.h"
+#include "srsran/instrumentation/slot_watchdog.h"
 #include "srsran/support/cpu_features.h"
 #include "srsran/support/event_tracing.h"
 #include "srsran/support/signal_handling.h"
@@ -219,6 +220,10 @@ int main(int argc, char** argv)
     app_tracer.enable_tracer(du_cfg.log_cfg.tracing_filename, du_logger);
   }
 
+  if (du_cfg.log_cfg.slot_watchdog_threshold_us != 0) {
+    slot_watchdog.enable(std::chrono::microseconds(du_cfg.log_cfg.slot_watchdog_threshold_us));
+  }
+
   app_services::core_isolation_manager core_isolation_mngr;
   if (du_cfg.expert_execution_cfg.affinities.isolated_cpus) {
     if (!core_isolation_mngr.isolate_cores(*du_cfg.expert_execution_cfg.affinities.isolated_cpus)) {
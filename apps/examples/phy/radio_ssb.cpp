@@ -49,6 +49,7 @@
 #include "srsran/support/signal_handling.h"
 #include <atomic>
 #include <getopt.h>
+#include <mutex>
 #include <string>
 #include <unistd.h>
 #include <unordered_map>
@@ -20,6 +20,7 @@
  *
  */
 
+#include "srsran/instrumentation/slot_watchdog.h"
 #include "srsran/support/backtrace.h"
 #include "srsran/support/config_parsers.h"
 #include "srsran/support/cpu_features.h"
@@ -286,6 +287,10 @@ int main(int argc, char** argv)
     app_tracer.enable_tracer(gnb_cfg.log_cfg.tracing_filename, gnb_logger);
   }
 
+  if (gnb_cfg.log_cfg.slot_watchdog_threshold_us != 0) {
+    slot_watchdog.enable(std::chrono::microseconds(gnb_cfg.log_cfg.slot_watchdog_threshold_us));
+  }
+
   app_services::core_isolation_manager core_isolation_mngr;
   if (gnb_cfg.expert_execution_cfg.affinities.isolated_cpus) {
     if (!core_isolation_mngr.isolate_cores(*gnb_cfg.expert_execution_cfg.affinities.isolated_cpus)) {
@@ -42,6 +42,11 @@ struct logger_appconfig {
   int hex_max_size = 0;
   /// Set to a valid file path to enable tracing and write the trace to the file.
   std::string tracing_filename;
+  /// \brief Late slot threshold of the slot timing watchdog, in microseconds. Zero keeps the watchdog disabled.
+  ///
+  /// When enabled, per-slot timelines that exceed this threshold between the slot indication and the Open Fronthaul
+  /// transmission window, or that miss the transmission window, are dumped to the metrics logger.
+  unsigned slot_watchdog_threshold_us = 0;
 };
 
 } // namespace srsran
@@ -60,6 +60,12 @@ static void configure_cli11_log_args(CLI::App& app, logger_appconfig& log_params
       ->check(CLI::Range(0, 1024));
   add_option(app, "--tracing_filename", log_params.tracing_filename, "Set to a valid file path to enable tracing")
       ->always_capture_default();
+  add_option(app,
+             "--slot_watchdog_threshold_us",
+             log_params.slot_watchdog_threshold_us,
+             "Set to a non-zero late slot threshold in microseconds to enable the slot timing watchdog")
+      ->capture_default_str()
+      ->check(CLI::Number);
 
   // Post-parsing callback. This allows us to set the log level to "all" level, if no level is provided.
   app.callback([&]() {
@@ -38,4 +38,8 @@ void srsran::fill_logger_appconfig_in_yaml_schema(YAML::Node& node, const logger
   if (!config.tracing_filename.empty()) {
     log_node["tracing_filename"] = config.tracing_filename;
   }
+
+  if (config.slot_watchdog_threshold_us != 0) {
+    log_node["slot_watchdog_threshold_us"] = config.slot_watchdog_threshold_us;
+  }
 }
@@ -0,0 +1,75 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "metrics_shm_segment.h"
+#include "srsran/srslog/srslog.h"
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace srsran;
+using namespace app_services;
+
+metrics_shm_segment::metrics_shm_segment(const std::string& name_) : name(name_)
+{
+  srslog::basic_logger& logger = srslog::fetch_basic_logger("GNB");
+
+  int fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  if (fd < 0) {
+    logger.error("Failed to create metrics shared-memory segment \"{}\": {}", name, ::strerror(errno));
+    return;
+  }
+
+  if (::ftruncate(fd, sizeof(metrics_shm_layout)) != 0) {
+    logger.error("Failed to resize metrics shared-memory segment \"{}\": {}", name, ::strerror(errno));
+    ::close(fd);
+    ::shm_unlink(name.c_str());
+    return;
+  }
+
+  void* addr = ::mmap(nullptr, sizeof(metrics_shm_layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    logger.error("Failed to map metrics shared-memory segment \"{}\": {}", name, ::strerror(errno));
+    ::shm_unlink(name.c_str());
+    return;
+  }
+
+  // Zero-initialize all counters, then publish magic and version so that scrapers can validate the segment.
+  layout          = new (addr) metrics_shm_layout{};
+  layout->version = metrics_shm_layout::current_version;
+  layout->magic   = metrics_shm_layout::magic_value;
+
+  logger.info("Metrics shared-memory segment \"{}\" created ({} bytes)", name, sizeof(metrics_shm_layout));
+}
+
+metrics_shm_segment::~metrics_shm_segment()
+{
+  if (layout != nullptr) {
+    // Invalidate the magic so that scrapers stop trusting the contents before the segment disappears.
+    layout->magic = 0;
+    ::munmap(layout, sizeof(metrics_shm_layout));
+    ::shm_unlink(name.c_str());
+  }
+}
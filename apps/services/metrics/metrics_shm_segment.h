@@ -0,0 +1,153 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace srsran {
+namespace app_services {
+
+/// \brief Flat, versioned layout of the metrics shared-memory segment.
+///
+/// External monitoring agents open the segment read-only, mmap it and sample the counters at their own rate, without
+/// any involvement of the gNB process. Each section is guarded by its own sequence counter, following the seqlock
+/// protocol: the owning metrics consumer increments it to an odd value before updating the section and to an even
+/// value afterwards. A reader that observes an odd value, or different values before and after reading the section
+/// fields, must retry.
+struct metrics_shm_layout {
+  /// Expected value of the \c magic field ("SRSM").
+  static constexpr uint32_t magic_value = 0x5352534d;
+  /// Version of this layout. It must be bumped on any change to the fields below.
+  static constexpr uint32_t current_version = 1;
+
+  /// Magic number identifying a valid metrics segment.
+  uint32_t magic;
+  /// Layout version, so that scrapers can detect mismatches.
+  uint32_t version;
+
+  /// Scheduler metrics, aggregated over all cells and UEs of the DU.
+  struct sched_section {
+    /// Section sequence counter (odd while an update is in flight).
+    std::atomic<uint64_t> seq;
+    /// Number of scheduler metrics reports received.
+    uint64_t nof_reports;
+    /// Number of UEs in the last report.
+    uint64_t nof_ues;
+    /// Cumulative number of full DL slots.
+    uint64_t nof_dl_slots;
+    /// Cumulative number of full UL slots.
+    uint64_t nof_ul_slots;
+    /// Cumulative number of detected PRACH preambles.
+    uint64_t nof_prach_preambles;
+    /// Cumulative number of error indications.
+    uint64_t nof_error_indications;
+    /// Average slot decision latency of the last report, in microseconds.
+    uint64_t decision_latency_usec;
+    /// Sum of the UE DL bitrates of the last report, in kbps.
+    uint64_t dl_brate_kbps;
+    /// Sum of the UE UL bitrates of the last report, in kbps.
+    uint64_t ul_brate_kbps;
+    /// Cumulative number of successfully acknowledged DL transports.
+    uint64_t dl_nof_ok;
+    /// Cumulative number of unacknowledged DL transports.
+    uint64_t dl_nof_nok;
+    /// Cumulative number of successfully decoded UL transports.
+    uint64_t ul_nof_ok;
+    /// Cumulative number of failed UL transports.
+    uint64_t ul_nof_nok;
+  } sched;
+
+  /// RLC metrics, aggregated over all bearers of the DU.
+  struct rlc_section {
+    /// Section sequence counter (odd while an update is in flight).
+    std::atomic<uint64_t> seq;
+    /// Number of RLC metrics reports received.
+    uint64_t nof_reports;
+    /// Cumulative number of TX SDUs.
+    uint64_t tx_num_sdus;
+    /// Cumulative number of TX SDU bytes.
+    uint64_t tx_num_sdu_bytes;
+    /// Cumulative number of TX SDUs dropped due to full queues.
+    uint64_t tx_num_dropped_sdus;
+    /// Cumulative number of RX SDUs.
+    uint64_t rx_num_sdus;
+    /// Cumulative number of RX SDU bytes.
+    uint64_t rx_num_sdu_bytes;
+    /// Cumulative number of lost RX PDUs.
+    uint64_t rx_num_lost_pdus;
+    /// Cumulative number of malformed RX PDUs.
+    uint64_t rx_num_malformed_pdus;
+  } rlc;
+};
+
+static_assert(std::is_trivially_destructible_v<metrics_shm_layout>,
+              "The shared-memory layout must not require destruction");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Sequence counters must be lock-free in shared memory");
+
+/// \brief Owner of the POSIX shared-memory segment where metrics are exported.
+///
+/// The segment is created and mapped at construction, and unlinked at destruction. If the segment cannot be created,
+/// the object stays in a disabled state and updates become no-ops, so metrics reporting never fails because of the
+/// exporter.
+class metrics_shm_segment
+{
+public:
+  /// Creates and maps the shared-memory segment with the given name (e.g. "/srsran_metrics").
+  explicit metrics_shm_segment(const std::string& name_);
+  metrics_shm_segment(const metrics_shm_segment&)            = delete;
+  metrics_shm_segment& operator=(const metrics_shm_segment&) = delete;
+  ~metrics_shm_segment();
+
+  /// Returns true if the segment was successfully created and mapped.
+  bool is_open() const { return layout != nullptr; }
+
+  /// \brief Updates a section of the segment.
+  ///
+  /// Runs the given functor on the section between the seqlock begin/end increments. Each section must only be
+  /// updated from one execution context at a time. If the segment is not open, the update is dropped.
+  template <typename Section, typename UpdateFunc>
+  void update_section(Section metrics_shm_layout::*section, UpdateFunc&& update_func)
+  {
+    if (layout == nullptr) {
+      return;
+    }
+    Section& sec = layout->*section;
+    sec.seq.store(sec.seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    update_func(sec);
+    std::atomic_thread_fence(std::memory_order_release);
+    sec.seq.store(sec.seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+private:
+  /// Name of the segment, as passed to shm_open.
+  std::string name;
+  /// Mapped layout, or nullptr if the segment could not be created.
+  metrics_shm_layout* layout = nullptr;
+};
+
+} // namespace app_services
+} // namespace srsran
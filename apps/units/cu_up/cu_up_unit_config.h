@@ -72,6 +72,7 @@ struct cu_up_unit_config {
   unsigned gtpu_queue_size          = 2048;
   unsigned gtpu_reordering_timer_ms = 0;
   bool     warn_on_drop             = false;
+  uint16_t pdcp_crypto_parallelism  = 0;
   /// UPF configuration.
   cu_up_unit_upf_config upf_cfg;
   /// Metrics.
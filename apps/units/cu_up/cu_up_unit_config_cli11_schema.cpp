@@ -65,6 +65,11 @@ static void configure_cli11_cu_up_args(CLI::App& app, cu_up_unit_config& cu_up_p
              cu_up_params.warn_on_drop,
              "Log a warning for dropped packets in GTP-U, SDAP, PDCP and F1-U due to full queues")
       ->capture_default_str();
+  add_option(app,
+             "--pdcp_crypto_parallelism",
+             cu_up_params.pdcp_crypto_parallelism,
+             "Maximum number of PDCP DRB PDUs deciphered in parallel per bearer (0 or 1 to decipher inline)")
+      ->capture_default_str();
 }
 
 static void configure_cli11_log_args(CLI::App& app, cu_up_unit_logger_config& log_params)
@@ -65,8 +65,9 @@ static YAML::Node build_cu_up_section(const cu_up_unit_config& config)
 {
   YAML::Node node;
 
-  node["gtpu_queue_size"] = config.gtpu_queue_size;
-  node["warn_on_drop"]    = config.warn_on_drop;
+  node["gtpu_queue_size"]          = config.gtpu_queue_size;
+  node["warn_on_drop"]             = config.warn_on_drop;
+  node["pdcp_crypto_parallelism"]  = config.pdcp_crypto_parallelism;
 
   return node;
 }
@@ -679,6 +679,8 @@ struct du_high_unit_metrics_config {
     bool     json_enabled  = false;
   } rlc;
   bool enable_json_metrics = false;
+  /// Whether to export metrics counters to a shared-memory segment for external scrapers.
+  bool enable_shm_metrics = false;
   /// Scheduler report period in milliseconds.
   unsigned sched_report_period      = 1000;
   bool     autostart_stdout_metrics = false;
@@ -1497,6 +1497,12 @@ static void configure_cli11_metrics_args(CLI::App& app, du_high_unit_metrics_con
   add_option(app, "--enable_json_metrics", metrics_params.enable_json_metrics, "Enable JSON metrics reporting")
       ->always_capture_default();
 
+  add_option(app,
+             "--enable_shm_metrics",
+             metrics_params.enable_shm_metrics,
+             "Enable metrics export to a shared-memory segment for external scrapers")
+      ->always_capture_default();
+
   add_option(
       app, "--autostart_stdout_metrics", metrics_params.autostart_stdout_metrics, "Autostart stdout metrics reporting")
       ->capture_default_str();
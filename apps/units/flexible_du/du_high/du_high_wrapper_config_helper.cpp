@@ -78,7 +78,8 @@ build_scheduler_du_metrics(std::pair<std::vector<app_services::metrics_config>,
                            app_services::metrics_notifier&                                             metrics_notifier,
                            const du_high_unit_config&                                                  du_high_unit_cfg,
                            srslog::sink&                                                               json_sink,
-                           e2_du_metrics_notifier&                                                     e2_notifier)
+                           e2_du_metrics_notifier&                                                     e2_notifier,
+                           std::shared_ptr<app_services::metrics_shm_segment>                          shm_segment)
 {
   // Scheduler cell metrics.
   auto sched_cell_metrics_gen                     = std::make_unique<scheduler_metrics_producer_impl>(metrics_notifier);
@@ -112,20 +113,26 @@ build_scheduler_du_metrics(std::pair<std::vector<app_services::metrics_config>,
     sched_metrics_cfg.consumers.push_back(std::make_unique<scheduler_cell_metrics_consumer_e2>(e2_notifier));
   }
 
+  // Connect the shared-memory metrics exporter to DU Scheduler UE metrics.
+  if (shm_segment != nullptr) {
+    sched_metrics_cfg.consumers.push_back(std::make_unique<scheduler_cell_metrics_consumer_shm>(shm_segment));
+  }
+
   return out;
 }
 
-static rlc_metrics_notifier* build_rlc_du_metrics(std::vector<app_services::metrics_config>& metrics,
-                                                  app_services::metrics_notifier&            metrics_notifier,
-                                                  const du_high_unit_config&                 du_high_unit_cfg,
-                                                  srslog::sink&                              json_sink,
-                                                  e2_du_metrics_notifier&                    e2_notifier)
+static rlc_metrics_notifier* build_rlc_du_metrics(std::vector<app_services::metrics_config>&         metrics,
+                                                  app_services::metrics_notifier&                    metrics_notifier,
+                                                  const du_high_unit_config&                         du_high_unit_cfg,
+                                                  srslog::sink&                                      json_sink,
+                                                  e2_du_metrics_notifier&                            e2_notifier,
+                                                  std::shared_ptr<app_services::metrics_shm_segment> shm_segment)
 {
   rlc_metrics_notifier* out = nullptr;
 
   // RLC metrics.
   if (!du_high_unit_cfg.metrics.rlc.json_enabled && !du_high_unit_cfg.e2_cfg.enable_unit_e2 &&
-      du_high_unit_cfg.loggers.metrics_level != srslog::basic_levels::debug) {
+      shm_segment == nullptr && du_high_unit_cfg.loggers.metrics_level != srslog::basic_levels::debug) {
     return out;
   }
 
@@ -154,6 +161,10 @@ static rlc_metrics_notifier* build_rlc_du_metrics(std::vector<app_services::metr
     rlc_metrics_cfg.consumers.push_back(std::make_unique<rlc_metrics_consumer_e2>(e2_notifier));
   }
 
+  if (shm_segment != nullptr) {
+    rlc_metrics_cfg.consumers.push_back(std::make_unique<rlc_metrics_consumer_shm>(shm_segment));
+  }
+
   return out;
 }
 
@@ -203,17 +214,29 @@ srsran::fill_du_high_wrapper_config(srs_du::du_high_wrapper_config&  out_cfg,
   std::pair<std::vector<app_services::metrics_config>, std::vector<std::unique_ptr<app_services::application_command>>>
       du_services_cfg;
 
+  // Shared-memory metrics segment, sampled by external scrapers without involving this process.
+  std::shared_ptr<app_services::metrics_shm_segment> shm_segment;
+  if (du_high_unit_cfg.metrics.enable_shm_metrics) {
+    shm_segment = std::make_shared<app_services::metrics_shm_segment>(
+        fmt::format("/srsran_metrics_du{}", du_hi_cfg.ran.gnb_du_id));
+    if (!shm_segment->is_open()) {
+      shm_segment = nullptr;
+    }
+  }
+
   du_hi_cfg.sched_ue_metrics_notifier = build_scheduler_du_metrics(du_services_cfg,
                                                                    metrics_notifier,
                                                                    du_high_unit_cfg,
                                                                    json_sink,
-                                                                   e2_metric_connectors.get_e2_metric_notifier(du_idx));
+                                                                   e2_metric_connectors.get_e2_metric_notifier(du_idx),
+                                                                   shm_segment);
 
   du_hi_cfg.rlc_metrics_notif = build_rlc_du_metrics(du_services_cfg.first,
                                                      metrics_notifier,
                                                      du_high_unit_cfg,
                                                      json_sink,
-                                                     e2_metric_connectors.get_e2_metric_notifier(du_idx));
+                                                     e2_metric_connectors.get_e2_metric_notifier(du_idx),
+                                                     shm_segment);
 
   // Configure test mode
   if (du_high_unit_cfg.test_mode_cfg.test_ue.rnti != rnti_t::INVALID_RNTI) {
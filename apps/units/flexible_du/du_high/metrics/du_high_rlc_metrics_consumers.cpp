@@ -167,6 +167,23 @@ void rlc_metrics_consumer_log::handle_metric(const app_services::metrics_set& me
   logger.debug("{}", to_c_str(buffer));
 }
 
+void rlc_metrics_consumer_shm::handle_metric(const app_services::metrics_set& metric)
+{
+  const rlc_metrics& drb = static_cast<const rlc_metrics_impl&>(metric).get_metrics();
+
+  segment->update_section(&app_services::metrics_shm_layout::rlc,
+                          [&drb](app_services::metrics_shm_layout::rlc_section& sec) {
+                            ++sec.nof_reports;
+                            sec.tx_num_sdus += drb.tx.tx_high.num_sdus;
+                            sec.tx_num_sdu_bytes += drb.tx.tx_high.num_sdu_bytes;
+                            sec.tx_num_dropped_sdus += drb.tx.tx_high.num_dropped_sdus;
+                            sec.rx_num_sdus += drb.rx.num_sdus;
+                            sec.rx_num_sdu_bytes += drb.rx.num_sdu_bytes;
+                            sec.rx_num_lost_pdus += drb.rx.num_lost_pdus;
+                            sec.rx_num_malformed_pdus += drb.rx.num_malformed_pdus;
+                          });
+}
+
 void rlc_metrics_consumer_e2::handle_metric(const app_services::metrics_set& metric)
 {
   notifier.report_metrics(static_cast<const rlc_metrics_impl&>(metric).get_metrics());
@@ -22,9 +22,11 @@
 
 #pragma once
 
+#include "apps/services/metrics/metrics_shm_segment.h"
 #include "du_high_rlc_metrics.h"
 #include "srsran/srslog/log_channel.h"
 #include "srsran/srslog/logger.h"
+#include <memory>
 
 namespace srsran {
 
@@ -54,6 +56,22 @@ private:
   srslog::basic_logger& logger;
 };
 
+/// Consumer that exports the RLC metrics to the shared-memory metrics segment.
+class rlc_metrics_consumer_shm : public app_services::metrics_consumer
+{
+public:
+  explicit rlc_metrics_consumer_shm(std::shared_ptr<app_services::metrics_shm_segment> segment_) :
+    segment(std::move(segment_))
+  {
+  }
+
+  // See interface for documentation.
+  void handle_metric(const app_services::metrics_set& metric) override;
+
+private:
+  std::shared_ptr<app_services::metrics_shm_segment> segment;
+};
+
 /// Consumer for the E2 RLC metrics.
 class rlc_metrics_consumer_e2 : public app_services::metrics_consumer
 {
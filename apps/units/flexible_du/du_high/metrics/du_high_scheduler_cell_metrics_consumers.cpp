@@ -396,6 +396,42 @@ void scheduler_cell_metrics_consumer_log::handle_metric(const app_services::metr
   }
 }
 
+void scheduler_cell_metrics_consumer_shm::handle_metric(const app_services::metrics_set& metric)
+{
+  const scheduler_cell_metrics& metrics = static_cast<const scheduler_cell_metrics_impl&>(metric).get_metrics();
+
+  segment->update_section(&app_services::metrics_shm_layout::sched,
+                          [&metrics](app_services::metrics_shm_layout::sched_section& sec) {
+                            uint64_t dl_brate_kbps = 0;
+                            uint64_t ul_brate_kbps = 0;
+                            uint64_t dl_nof_ok     = 0;
+                            uint64_t dl_nof_nok    = 0;
+                            uint64_t ul_nof_ok     = 0;
+                            uint64_t ul_nof_nok    = 0;
+                            for (const auto& ue : metrics.ue_metrics) {
+                              dl_brate_kbps += static_cast<uint64_t>(ue.dl_brate_kbps);
+                              ul_brate_kbps += static_cast<uint64_t>(ue.ul_brate_kbps);
+                              dl_nof_ok += ue.dl_nof_ok;
+                              dl_nof_nok += ue.dl_nof_nok;
+                              ul_nof_ok += ue.ul_nof_ok;
+                              ul_nof_nok += ue.ul_nof_nok;
+                            }
+                            ++sec.nof_reports;
+                            sec.nof_ues = metrics.ue_metrics.size();
+                            sec.nof_dl_slots += metrics.nof_dl_slots;
+                            sec.nof_ul_slots += metrics.nof_ul_slots;
+                            sec.nof_prach_preambles += metrics.nof_prach_preambles;
+                            sec.nof_error_indications += metrics.nof_error_indications;
+                            sec.decision_latency_usec = metrics.average_decision_latency.count();
+                            sec.dl_brate_kbps         = dl_brate_kbps;
+                            sec.ul_brate_kbps         = ul_brate_kbps;
+                            sec.dl_nof_ok += dl_nof_ok;
+                            sec.dl_nof_nok += dl_nof_nok;
+                            sec.ul_nof_ok += ul_nof_ok;
+                            sec.ul_nof_nok += ul_nof_nok;
+                          });
+}
+
 void scheduler_cell_metrics_consumer_e2::handle_metric(const app_services::metrics_set& metric)
 {
   notifier.report_metrics(static_cast<const scheduler_cell_metrics_impl&>(metric).get_metrics());
@@ -48,6 +48,11 @@ struct du_low_unit_expert_upper_phy_config {
   /// -\c post_equalization: SINR is calculated using the post-equalization noise variances of the equalized RE.
   /// -\c evm: SINR is obtained from the EVM of the PUSCH symbols.
   std::string pusch_sinr_calc_method = "post_equalization";
+  /// \brief PUSCH EVM sampling period in PDUs.
+  ///
+  /// Measures the PUSCH EVM on one out of every \c pusch_evm_sample_period PDUs for monitoring purposes. Set to zero
+  /// to measure the EVM only when it is otherwise required (EVM-based SINR calculation or debug logging).
+  unsigned pusch_evm_sample_period = 0;
   /// \brief Request headroom size in slots.
   ///
   /// The request headroom size is the number of delayed slots that the upper physical layer will accept, ie, if the
@@ -61,6 +66,8 @@ struct du_low_unit_logger_config {
   srslog::basic_levels hal_level = srslog::basic_levels::warning;
   /// Set to true to log broadcasting messages and all PRACH opportunities.
   bool broadcast_enabled = false;
+  /// Log only one out of every N PUSCH PDUs (CRC failures are always logged). Set to one to log all PDUs.
+  unsigned pusch_log_sample_rate = 1;
   /// Maximum number of bytes to write when dumping hex arrays.
   int hex_max_size = 0;
   /// Set to a valid file path to print the received symbols.
@@ -124,6 +131,12 @@ struct du_low_unit_expert_threads_config {
   unsigned nof_ul_threads = 1;
   /// Number of threads for processing PDSCH, PDCCH, NZP CSI-RS and SSB. It is set to 1 by default.
   unsigned nof_dl_threads = 1;
+  /// \brief Auto tunes the thread counts from the measured host capability.
+  ///
+  /// When enabled, the application runs short micro-calibrations at start up and derives the number of downlink,
+  /// uplink and PUSCH decoder threads from the measured capability and the number of cells. Thread counts set
+  /// explicitly in the configuration are kept.
+  bool auto_tune_threads = false;
 };
 
 /// Expert configuration of the gNB app.
@@ -24,6 +24,7 @@
 #include "apps/services/logger/logger_appconfig_cli11_utils.h"
 #include "apps/units/flexible_du/support/cli11_cpu_affinities_parser_helper.h"
 #include "du_low_config.h"
+#include "du_low_thread_autotuner.h"
 #include "srsran/adt/expected.h"
 #include "srsran/support/cli11_utils.h"
 #include "srsran/support/config_parsers.h"
@@ -52,6 +53,12 @@ static void configure_cli11_log_args(CLI::App& app, du_low_unit_logger_config& l
              log_params.broadcast_enabled,
              "Enable logging in the physical and MAC layer of broadcast messages and all PRACH opportunities")
       ->always_capture_default();
+  add_option(app,
+             "--pusch_log_sample_rate",
+             log_params.pusch_log_sample_rate,
+             "Log only one out of every N PUSCH PDUs (PDUs that fail CRC are always logged). Set to 1 to log all PDUs")
+      ->capture_default_str()
+      ->check(CLI::PositiveNumber);
   app.add_option("--phy_rx_symbols_filename",
                  log_params.phy_rx_symbols_filename,
                  "Set to a valid file path to print the received symbols.")
@@ -142,6 +149,11 @@ static void configure_cli11_upper_phy_threads_args(CLI::App& app, du_low_unit_ex
   add_option(app, "--nof_dl_threads", config.nof_dl_threads, "Number of upper PHY threads to process downlink.")
       ->capture_default_str()
       ->check(CLI::Number);
+  add_option(app,
+             "--auto_tune_threads",
+             config.auto_tune_threads,
+             "Auto tunes the upper PHY thread counts from the measured host capability.")
+      ->capture_default_str();
 }
 
 static void configure_cli11_expert_execution_args(CLI::App& app, du_low_unit_expert_execution_config& config)
@@ -205,6 +217,12 @@ static void configure_cli11_expert_phy_args(CLI::App& app, du_low_unit_expert_up
              "PUSCH SINR calculation method: channel_estimator, post_equalization and evm.")
       ->capture_default_str()
       ->check(pusch_sinr_method_check);
+  add_option(app,
+             "--pusch_evm_sample_period",
+             expert_phy_params.pusch_evm_sample_period,
+             "PUSCH EVM sampling period in PDUs. Set to zero to measure the EVM only when it is otherwise required.")
+      ->capture_default_str()
+      ->check(CLI::Number);
   add_option(app,
              "--max_request_headroom_slots",
              expert_phy_params.nof_slots_request_headroom,
@@ -353,6 +371,15 @@ void srsran::autoderive_du_low_parameters_after_parsing(CLI::App&           app,
     upper.nof_pusch_decoder_threads          = 0;
     upper.nof_ul_threads                     = 1;
     upper.nof_dl_threads                     = 1;
+  } else if (parsed_cfg.expert_execution_cfg.threads.auto_tune_threads) {
+    // Auto tune the thread counts from the measured host capability, keeping any explicitly configured count.
+    CLI::App* upper_phy_threads_cmd =
+        app.get_subcommand("expert_execution")->get_subcommand("threads")->get_subcommand("upper_phy");
+    auto_tune_du_low_threads(parsed_cfg.expert_execution_cfg.threads,
+                             nof_cells,
+                             upper_phy_threads_cmd->count("--nof_dl_threads") != 0,
+                             upper_phy_threads_cmd->count("--nof_ul_threads") != 0,
+                             upper_phy_threads_cmd->count("--nof_pusch_decoder_threads") != 0);
   }
 
   if (parsed_cfg.expert_execution_cfg.cell_affinities.size() < nof_cells) {
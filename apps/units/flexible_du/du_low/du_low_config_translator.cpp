@@ -62,6 +62,9 @@ static void generate_du_low_config(srs_du::du_low_config&             out_config
     // Calculate the number of UL slots in a frame and in a PUSCH HARQ process lifetime.
     unsigned nof_ul_slots_in_harq_lifetime = expire_pusch_harq_timeout_slots;
     unsigned nof_ul_slots_per_frame        = nof_slots_per_frame;
+    // TDD pattern period and number of UL slots per period. Zero period for FDD.
+    unsigned tdd_period_slots = 0;
+    unsigned tdd_nof_ul_slots = 0;
     if (duplex == duplex_mode::TDD && cell.tdd_ul_dl_cfg_common.has_value()) {
       const tdd_ul_dl_pattern& pattern1     = cell.tdd_ul_dl_cfg_common->pattern1;
       unsigned                 period_slots = pattern1.dl_ul_tx_period_nof_slots;
@@ -73,6 +76,8 @@ static void generate_du_low_config(srs_du::du_low_config&             out_config
       }
       nof_ul_slots_per_frame        = divide_ceil(nof_slots_per_frame, period_slots) * nof_ul_slots;
       nof_ul_slots_in_harq_lifetime = divide_ceil(expire_pusch_harq_timeout_slots, period_slots) * nof_ul_slots;
+      tdd_period_slots              = period_slots;
+      tdd_nof_ul_slots              = nof_ul_slots;
     }
 
     // Deduce the maximum number of codeblocks that can be scheduled for PUSCH in one slot assuming:
@@ -102,6 +107,14 @@ static void generate_du_low_config(srs_du::du_low_config&             out_config
     }
     unsigned ul_pipeline_depth = std::max(dl_pipeline_depth, 8U);
 
+    // Number of uplink resource grids. The pool reuses grids in strict round-robin order and grids are only allocated
+    // on slots containing UL symbols, so in TDD the pool only needs to span the UL slots contained in the pipeline
+    // depth plus some headroom, instead of one grid per slot as in FDD.
+    unsigned nof_ul_rg = ul_pipeline_depth;
+    if (tdd_period_slots != 0) {
+      nof_ul_rg = std::min(ul_pipeline_depth, divide_ceil(ul_pipeline_depth, tdd_period_slots) * tdd_nof_ul_slots + 2);
+    }
+
     static constexpr unsigned prach_pipeline_depth = 1;
 
     const prach_configuration prach_cfg = prach_configuration_get(
@@ -124,6 +137,7 @@ static void generate_du_low_config(srs_du::du_low_config&             out_config
     upper_phy_cell.nof_slots_request_headroom = du_low.expert_phy_cfg.nof_slots_request_headroom;
     upper_phy_cell.log_level                  = du_low.loggers.phy_level;
     upper_phy_cell.enable_logging_broadcast   = du_low.loggers.broadcast_enabled;
+    upper_phy_cell.pusch_logging_sample_rate  = du_low.loggers.pusch_log_sample_rate;
     upper_phy_cell.rx_symbol_printer_filename = du_low.loggers.phy_rx_symbols_filename;
     upper_phy_cell.rx_symbol_printer_port     = du_low.loggers.phy_rx_symbols_port;
     upper_phy_cell.rx_symbol_printer_prach    = du_low.loggers.phy_rx_symbols_prach;
@@ -135,7 +149,8 @@ static void generate_du_low_config(srs_du::du_low_config&             out_config
     upper_phy_cell.ldpc_decoder_early_stop    = du_low.expert_phy_cfg.pusch_decoder_early_stop;
     upper_phy_cell.nof_dl_rg                  = dl_pipeline_depth + 2;
     upper_phy_cell.nof_dl_processors          = dl_pipeline_depth;
-    upper_phy_cell.nof_ul_rg                  = ul_pipeline_depth;
+    upper_phy_cell.nof_ul_rg                  = nof_ul_rg;
+    upper_phy_cell.nof_slots_ul_pdu_repository = ul_pipeline_depth;
     upper_phy_cell.max_ul_thread_concurrency  = du_low.expert_execution_cfg.threads.nof_ul_threads + 1;
     upper_phy_cell.max_pusch_concurrency      = max_pusch_concurrency;
     upper_phy_cell.nof_pusch_decoder_threads  = du_low.expert_execution_cfg.threads.nof_pusch_decoder_threads +
@@ -146,6 +161,7 @@ static void generate_du_low_config(srs_du::du_low_config&             out_config
     upper_phy_cell.is_prach_long_format       = is_long_preamble(prach_cfg.format);
     upper_phy_cell.pusch_sinr_calc_method =
         channel_state_information::sinr_type_from_string(du_low.expert_phy_cfg.pusch_sinr_calc_method);
+    upper_phy_cell.pusch_evm_sampling_period = du_low.expert_phy_cfg.pusch_evm_sample_period;
 
     upper_phy_cell.active_scs                                       = {};
     upper_phy_cell.active_scs[to_numerology_value(cell.scs_common)] = true;
@@ -30,6 +30,7 @@ static void fill_du_low_log_section(YAML::Node node, const du_low_unit_logger_co
   node["phy_level"]            = srslog::basic_level_to_string(config.phy_level);
   node["hex_max_size"]         = config.hex_max_size;
   node["broadcast_enabled"]    = config.broadcast_enabled;
+  node["pusch_log_sample_rate"] = config.pusch_log_sample_rate;
   node["phy_rx_symbols_prach"] = config.phy_rx_symbols_prach;
   if (!config.phy_rx_symbols_filename.empty()) {
     node["phy_rx_symbols_filename"] = config.phy_rx_symbols_filename;
@@ -49,6 +50,7 @@ static void fill_du_low_expert_execution_section(YAML::Node node, const du_low_u
     upper_node["nof_pusch_decoder_threads"] = config.threads.nof_pusch_decoder_threads;
     upper_node["nof_ul_threads"]            = config.threads.nof_ul_threads;
     upper_node["nof_dl_threads"]            = config.threads.nof_dl_threads;
+    upper_node["auto_tune_threads"]         = config.threads.auto_tune_threads;
   }
 
   auto cell_affinities_node = node["cell_affinities"];
@@ -80,6 +82,7 @@ static void fill_du_low_expert_section(YAML::Node node, const du_low_unit_expert
   node["pusch_dec_max_iterations"]    = config.pusch_decoder_max_iterations;
   node["pusch_dec_enable_early_stop"] = config.pusch_decoder_early_stop;
   node["pusch_sinr_calc_method"]      = config.pusch_sinr_calc_method;
+  node["pusch_evm_sample_period"]     = config.pusch_evm_sample_period;
   node["max_request_headroom_slots"]  = config.nof_slots_request_headroom;
 }
 
@@ -0,0 +1,197 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "du_low_thread_autotuner.h"
+#include "du_low_config.h"
+#include "srsran/adt/bit_buffer.h"
+#include "srsran/phy/upper/channel_coding/channel_coding_factories.h"
+#include "srsran/srsvec/copy.h"
+#include "srsran/support/cpu_architecture_info.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+using namespace srsran;
+
+/// LDPC decoding rate of one thread, in Mbps, on the reference machine the hand-tuned thread presets target.
+static constexpr double reference_ldpc_rate_Mbps = 250.0;
+
+/// Memory copy bandwidth, in GB/s, of the reference machine the hand-tuned thread presets target.
+static constexpr double reference_mem_bw_GBps = 20.0;
+
+/// Per-cell thread demand, in reference-machine threads, for each upper PHY task type.
+static constexpr double reference_dl_threads_per_cell        = 3.0;
+static constexpr double reference_ul_threads_per_cell        = 1.0;
+static constexpr double reference_pusch_dec_threads_per_cell = 1.0;
+
+/// \brief Measures the single-thread LDPC decoding rate.
+///
+/// Decodes the largest BG1 codeblock with random soft bits and a fixed number of min-sum iterations, mirroring the
+/// worst-case configuration of the LDPC decoder benchmark.
+///
+/// \return The measured decoding rate in Mbps, or zero if the measurement is not possible.
+static double measure_ldpc_decoding_rate_Mbps()
+{
+  static constexpr unsigned nof_warmup_rep   = 4;
+  static constexpr unsigned nof_measured_rep = 32;
+  static constexpr unsigned nof_iterations   = 6;
+
+  std::shared_ptr<ldpc_decoder_factory> decoder_factory = create_ldpc_decoder_factory_sw("auto");
+  if (!decoder_factory) {
+    return 0.0;
+  }
+  std::unique_ptr<ldpc_decoder> decoder = decoder_factory->create();
+  if (!decoder) {
+    return 0.0;
+  }
+
+  // Largest BG1 codeblock: 66 channel bits and 22 message bits per lifted node.
+  static constexpr unsigned lifting_size = 384;
+  static constexpr unsigned cb_length    = 66 * lifting_size;
+  static constexpr unsigned msg_length   = 22 * lifting_size;
+
+  // Generate a random codeblock.
+  std::mt19937                      rgen(0);
+  std::vector<log_likelihood_ratio> codeblock(cb_length);
+  std::generate(codeblock.begin(), codeblock.end(), [&rgen]() { return static_cast<int8_t>((rgen() & 1) * 20 - 10); });
+
+  dynamic_bit_buffer message(msg_length);
+
+  codeblock_metadata cfg_dec          = {};
+  cfg_dec.tb_common.lifting_size      = static_cast<ldpc::lifting_size_t>(lifting_size);
+  cfg_dec.tb_common.base_graph        = ldpc_base_graph_type::BG1;
+  cfg_dec.cb_specific.nof_crc_bits    = 16;
+  cfg_dec.cb_specific.nof_filler_bits = 0;
+
+  for (unsigned i_rep = 0; i_rep != nof_warmup_rep; ++i_rep) {
+    decoder->decode(message, codeblock, nullptr, {cfg_dec, {nof_iterations, 0.8}});
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i_rep = 0; i_rep != nof_measured_rep; ++i_rep) {
+    decoder->decode(message, codeblock, nullptr, {cfg_dec, {nof_iterations, 0.8}});
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+  if (elapsed.count() == 0) {
+    return 0.0;
+  }
+
+  return static_cast<double>(cb_length) * nof_measured_rep * 1e3 / static_cast<double>(elapsed.count());
+}
+
+/// \brief Measures the single-thread memory copy bandwidth.
+///
+/// Copies a buffer much larger than the last level cache a few times and reports the resulting read plus write
+/// traffic.
+///
+/// \return The measured bandwidth in GB/s, or zero if the measurement is not possible.
+static double measure_memory_bandwidth_GBps()
+{
+  static constexpr std::size_t buffer_size_bytes = 64UL << 20;
+  static constexpr unsigned    nof_passes        = 4;
+
+  std::vector<float> source(buffer_size_bytes / sizeof(float), 1.0F);
+  std::vector<float> destination(source.size());
+
+  // Warm up pass, also faults in the destination pages.
+  srsvec::copy(destination, source);
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i_pass = 0; i_pass != nof_passes; ++i_pass) {
+    srsvec::copy(destination, source);
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+  if (elapsed.count() == 0) {
+    return 0.0;
+  }
+
+  return static_cast<double>(2UL * buffer_size_bytes * nof_passes) / static_cast<double>(elapsed.count());
+}
+
+void srsran::auto_tune_du_low_threads(du_low_unit_expert_threads_config& threads,
+                                      unsigned                           nof_cells,
+                                      bool                               keep_nof_dl_threads,
+                                      bool                               keep_nof_ul_threads,
+                                      bool                               keep_nof_pusch_decoder_threads)
+{
+  double ldpc_rate_Mbps = measure_ldpc_decoding_rate_Mbps();
+  double mem_bw_GBps    = measure_memory_bandwidth_GBps();
+
+  // Capability of one thread of this host relative to the reference machine. The upper PHY mixes compute and
+  // memory-bound stages, so the capability is bounded by the weaker of the two measurements.
+  double capability = 1.0;
+  if (ldpc_rate_Mbps > 0.0) {
+    capability = ldpc_rate_Mbps / reference_ldpc_rate_Mbps;
+  }
+  if (mem_bw_GBps > 0.0) {
+    capability = std::min(capability, mem_bw_GBps / reference_mem_bw_GBps);
+  }
+  capability = std::clamp(capability, 0.25, 4.0);
+
+  unsigned nof_cpus = cpu_architecture_info::get().get_host_nof_available_cpus();
+
+  // CPUs that remain for the upper PHY after reserving for the RU, DU high and control plane workers.
+  unsigned nof_phy_cpus = (nof_cpus > 2U + nof_cells) ? (nof_cpus - 2U - nof_cells) : 1U;
+
+  // Number of threads required to serve all cells, given the measured per-thread capability.
+  auto derive = [&capability, &nof_cells](double ref_threads_per_cell) {
+    return std::max(1U, static_cast<unsigned>(std::ceil(ref_threads_per_cell * nof_cells / capability)));
+  };
+
+  if (!keep_nof_dl_threads) {
+    threads.nof_dl_threads = derive(reference_dl_threads_per_cell);
+  }
+  if (!keep_nof_ul_threads) {
+    threads.nof_ul_threads = derive(reference_ul_threads_per_cell);
+  }
+  if (!keep_nof_pusch_decoder_threads) {
+    threads.nof_pusch_decoder_threads = derive(reference_pusch_dec_threads_per_cell);
+  }
+
+  // Shrink the largest pools until the topology fits in the CPU budget. The PUSCH decoder pool may reach zero, which
+  // selects synchronous decoding.
+  while (threads.nof_dl_threads + threads.nof_ul_threads + threads.nof_pusch_decoder_threads > nof_phy_cpus) {
+    if ((threads.nof_dl_threads >= threads.nof_ul_threads) && (threads.nof_dl_threads > 1)) {
+      --threads.nof_dl_threads;
+    } else if (threads.nof_pusch_decoder_threads > 0) {
+      --threads.nof_pusch_decoder_threads;
+    } else if (threads.nof_ul_threads > 1) {
+      --threads.nof_ul_threads;
+    } else {
+      break;
+    }
+  }
+
+  fmt::print("DU low thread auto-tuning: LDPC decoding {:.0f} Mbps per thread, memory bandwidth {:.1f} GB/s, {} CPUs "
+             "available.\n",
+             ldpc_rate_Mbps,
+             mem_bw_GBps,
+             nof_cpus);
+  fmt::print("DU low thread auto-tuning: selected {} DL, {} UL and {} PUSCH decoder threads for {} cell(s).\n",
+             threads.nof_dl_threads,
+             threads.nof_ul_threads,
+             threads.nof_pusch_decoder_threads,
+             nof_cells);
+}
@@ -0,0 +1,46 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+namespace srsran {
+
+struct du_low_unit_expert_threads_config;
+
+/// \brief Auto tunes the upper PHY thread counts from the measured host capability.
+///
+/// Runs short micro-calibrations (LDPC decoding throughput and memory bandwidth) and derives the number of downlink,
+/// uplink and PUSCH decoder threads from the measured capability, the number of cells and the number of available
+/// CPUs. The selected topology is printed to the standard output for inspection.
+///
+/// \param[in,out] threads                        Thread configuration to tune.
+/// \param[in] nof_cells                          Number of cells served by the DU low.
+/// \param[in] keep_nof_dl_threads               Keeps the configured number of downlink threads when true.
+/// \param[in] keep_nof_ul_threads               Keeps the configured number of uplink threads when true.
+/// \param[in] keep_nof_pusch_decoder_threads    Keeps the configured number of PUSCH decoder threads when true.
+void auto_tune_du_low_threads(du_low_unit_expert_threads_config& threads,
+                              unsigned                           nof_cells,
+                              bool                               keep_nof_dl_threads,
+                              bool                               keep_nof_ul_threads,
+                              bool                               keep_nof_pusch_decoder_threads);
+
+} // namespace srsran
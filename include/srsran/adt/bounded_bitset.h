@@ -911,6 +911,53 @@ public:
     return result;
   }
 
+  /// \brief Counts the number of bits set to 1 within a bit index range, using word-level popcount.
+  /// \param[in] startpos Starting bit index of the range (included).
+  /// \param[in] endpos End bit index of the range (excluded).
+  /// \return Returns the number of bits set to 1 within the range.
+  size_t count(size_t startpos, size_t endpos) const
+  {
+    size_t result = 0;
+    find_first_word_(startpos, endpos, [this, &result](size_t word_idx, const word_t& mask) {
+      result += count_ones(buffer[word_idx] & mask);
+      return false;
+    });
+    return result;
+  }
+
+  /// \brief Finds the lowest position, within a range of bit indexes, where a run of \c run_length consecutive bits
+  /// equal to \c value starts.
+  ///
+  /// The search advances in word-sized steps through the lowest-bit search primitives, so sparse bitmaps are scanned
+  /// without visiting individual bits.
+  ///
+  /// \param[in] startpos Starting bit index for the search.
+  /// \param[in] endpos End bit index for the search.
+  /// \param[in] run_length Number of consecutive bits equal to \c value to find.
+  /// \param[in] value The bit value the run consists of, either true (1) or false (0).
+  /// \return Returns the bit index where the first fitting run starts, or -1 if no such run exists within the range.
+  int find_lowest_run(size_t startpos, size_t endpos, size_t run_length, bool value = true) const noexcept
+  {
+    assert_range_bounds_(startpos, endpos);
+    srsran_assert(run_length > 0, "The run length must be greater than zero.");
+
+    size_t pos = startpos;
+    while (pos + run_length <= endpos) {
+      int run_start = find_lowest(pos, endpos, value);
+      if ((run_start < 0) or (static_cast<size_t>(run_start) + run_length > endpos)) {
+        // No run starts low enough to fit in the range.
+        return -1;
+      }
+      int    run_end  = find_lowest(run_start + 1, endpos, not value);
+      size_t run_stop = (run_end < 0) ? endpos : static_cast<size_t>(run_end);
+      if (run_stop - static_cast<size_t>(run_start) >= run_length) {
+        return run_start;
+      }
+      pos = run_stop + 1;
+    }
+    return -1;
+  }
+
   /// \brief Compares two bitsets.
   /// \return Returns true if both bitsets are equal in size and values of bits.
   bool operator==(const bounded_bitset<N, LowestInfoBitIsMSB>& other) const noexcept
@@ -23,6 +23,10 @@
 #pragma once
 
 #include "srsran/adt/optional.h"
+#include "srsran/adt/span.h"
+#include <atomic>
+#include <cstdint>
+#include <utility>
 
 namespace srsran {
 
@@ -37,12 +41,30 @@ namespace srsran {
 /// mutex contention.
 enum class concurrent_queue_policy { lockfree_spsc, lockfree_mpmc, locking_mpmc, locking_mpsc };
 
-/// \brief Types of barriers used for blocking pushes/pops of elements. Three types:
+/// \brief Types of barriers used for blocking pushes/pops of elements. Supported types:
 /// - condition_variable: uses a condition variable to wake up producers and consumers.
 /// - sleep: spins on a sleep if the queue is full, in case of blocking push, and if the queue is empty in case of
 /// blocking pop.
 /// - non_blocking: no blocking mechanism is exposed.
-enum class concurrent_queue_wait_policy { condition_variable, sleep, non_blocking };
+/// - spin: busy-waits with a CPU pause hint, without ever yielding to the OS. Suited for sub-microsecond handoffs
+/// between pinned real-time threads, where the latency of a sleep or context switch is not affordable.
+/// - adaptive_sleep: busy-waits for a bounded number of attempts and falls back to sleeping afterwards. Suited for
+/// queues that are contended in bursts but idle most of the time, where pure spinning would waste power.
+enum class concurrent_queue_wait_policy { condition_variable, sleep, non_blocking, spin, adaptive_sleep };
+
+/// \brief Contention statistics of a queue blocking mechanism.
+///
+/// The counters help choosing the right wait policy for a queue: a high ratio of contended waits on a \c spin queue
+/// suggests moving to \c adaptive_sleep, while an \c adaptive_sleep queue that never sleeps can be downgraded to pure
+/// \c spin or upgraded in spin budget.
+struct concurrent_queue_wait_stats {
+  /// Total number of blocking push/pop operations.
+  uint64_t nof_waits = 0;
+  /// Number of blocking operations that found the queue full/empty and had to wait at least one attempt.
+  uint64_t nof_contended_waits = 0;
+  /// Number of blocking operations that exhausted the spin budget and slept.
+  uint64_t nof_sleeps = 0;
+};
 
 /// \brief Parameters used to construct a concurrent queue.
 struct concurrent_queue_params {
@@ -58,6 +80,49 @@ namespace detail {
 template <typename T, concurrent_queue_policy Policy, concurrent_queue_wait_policy BlockingPolicy>
 class queue_impl;
 
+/// Hints the CPU that the caller is in a busy-wait loop iteration.
+inline void hint_spin_pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+/// \brief Helper that accumulates the contention statistics of a queue blocking mechanism.
+///
+/// The counters are updated with relaxed atomics, so that concurrent producers and consumers of an MPMC queue can
+/// report their waits without synchronizing with each other.
+class wait_stats_tracker
+{
+public:
+  void report_wait(uint64_t nof_attempts, bool slept)
+  {
+    nof_waits.fetch_add(1, std::memory_order_relaxed);
+    if (nof_attempts != 0) {
+      nof_contended_waits.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (slept) {
+      nof_sleeps.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  concurrent_queue_wait_stats snapshot() const
+  {
+    concurrent_queue_wait_stats stats;
+    stats.nof_waits           = nof_waits.load(std::memory_order_relaxed);
+    stats.nof_contended_waits = nof_contended_waits.load(std::memory_order_relaxed);
+    stats.nof_sleeps          = nof_sleeps.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+private:
+  std::atomic<uint64_t> nof_waits{0};
+  std::atomic<uint64_t> nof_contended_waits{0};
+  std::atomic<uint64_t> nof_sleeps{0};
+};
+
 } // namespace detail
 
 /// \brief A concurrent queue that can be used to pass objects between threads. Different policies are supported:
@@ -107,6 +172,19 @@ public:
   /// If the queue is empty, the call returns false.
   bool try_pop(T& elem) { return queue.try_pop(elem); }
 
+  /// \brief Pops up to \c elems.size() elements from the queue in a non-blocking fashion, overwriting the elements
+  /// of \c elems in order.
+  ///
+  /// \return The number of elements popped, which is lower than \c elems.size() if the queue became empty.
+  size_t try_pop_bulk(span<T> elems)
+  {
+    size_t count = 0;
+    while ((count != elems.size()) and queue.try_pop(elems[count])) {
+      ++count;
+    }
+    return count;
+  }
+
   /// \brief Pops an element from the queue in a non-blocking fashion.
   ///
   /// If the queue is empty, the call returns an empty optional.
@@ -146,6 +224,13 @@ public:
   /// \brief Request any blocking function to be interrupted.
   void request_stop() { queue.request_stop(); }
 
+  /// \brief Contention statistics of the blocking mechanism. Only available for wait policies that track them.
+  template <typename Q = queue_type>
+  auto get_wait_statistics() const -> decltype(std::declval<const Q&>().get_wait_statistics())
+  {
+    return queue.get_wait_statistics();
+  }
+
 private:
   queue_type queue;
 };
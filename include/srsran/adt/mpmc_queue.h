@@ -117,5 +117,141 @@ private:
   std::atomic<bool>         running{true};
 };
 
+/// Specialization for lockfree MPMC that busy-spins with a CPU pause hint as the blocking mechanism.
+template <typename T>
+class queue_impl<T, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::spin>
+  : public queue_impl<T, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::non_blocking>
+{
+  using base_type = queue_impl<T, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::non_blocking>;
+
+public:
+  explicit queue_impl(size_t qsize) : base_type(qsize) {}
+
+  void request_stop() { running = false; }
+
+  template <typename U>
+  bool push_blocking(U&& elem)
+  {
+    uint64_t nof_attempts = 0;
+    while (running.load(std::memory_order_relaxed)) {
+      if (this->try_push(std::forward<U>(elem))) {
+        stats.report_wait(nof_attempts, false);
+        return true;
+      }
+      ++nof_attempts;
+      hint_spin_pause();
+    }
+    return false;
+  }
+
+  bool pop_blocking(T& elem)
+  {
+    uint64_t nof_attempts = 0;
+    while (running.load(std::memory_order_relaxed)) {
+      if (this->try_pop(elem)) {
+        stats.report_wait(nof_attempts, false);
+        return true;
+      }
+      ++nof_attempts;
+      hint_spin_pause();
+    }
+    return false;
+  }
+
+  template <typename PoppingFunc>
+  bool call_on_pop_blocking(PoppingFunc&& func)
+  {
+    T elem;
+    if (pop_blocking(elem)) {
+      func(elem);
+      return true;
+    }
+    return false;
+  }
+
+  concurrent_queue_wait_stats get_wait_statistics() const { return stats.snapshot(); }
+
+private:
+  std::atomic<bool>  running{true};
+  wait_stats_tracker stats;
+};
+
+/// \brief Specialization for lockfree MPMC that busy-spins for a bounded number of attempts and falls back to sleeping
+/// afterwards.
+template <typename T>
+class queue_impl<T, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::adaptive_sleep>
+  : public queue_impl<T, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::non_blocking>
+{
+  using base_type = queue_impl<T, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::non_blocking>;
+
+public:
+  explicit queue_impl(size_t                    qsize,
+                      uint32_t                  spin_budget_ = 1000,
+                      std::chrono::microseconds sleep_time_  = std::chrono::microseconds{100}) :
+    base_type(qsize), spin_budget(spin_budget_), sleep_time(sleep_time_)
+  {
+  }
+
+  void request_stop() { running = false; }
+
+  template <typename U>
+  bool push_blocking(U&& elem)
+  {
+    uint64_t nof_attempts = 0;
+    bool     slept        = false;
+    while (running.load(std::memory_order_relaxed)) {
+      if (this->try_push(std::forward<U>(elem))) {
+        stats.report_wait(nof_attempts, slept);
+        return true;
+      }
+      wait_one(nof_attempts, slept);
+    }
+    return false;
+  }
+
+  bool pop_blocking(T& elem)
+  {
+    uint64_t nof_attempts = 0;
+    bool     slept        = false;
+    while (running.load(std::memory_order_relaxed)) {
+      if (this->try_pop(elem)) {
+        stats.report_wait(nof_attempts, slept);
+        return true;
+      }
+      wait_one(nof_attempts, slept);
+    }
+    return false;
+  }
+
+  template <typename PoppingFunc>
+  bool call_on_pop_blocking(PoppingFunc&& func)
+  {
+    T elem;
+    if (pop_blocking(elem)) {
+      func(elem);
+      return true;
+    }
+    return false;
+  }
+
+  concurrent_queue_wait_stats get_wait_statistics() const { return stats.snapshot(); }
+
+private:
+  void wait_one(uint64_t& nof_attempts, bool& slept)
+  {
+    if (nof_attempts++ < spin_budget) {
+      hint_spin_pause();
+      return;
+    }
+    slept = true;
+    std::this_thread::sleep_for(sleep_time);
+  }
+
+  uint32_t                  spin_budget;
+  std::chrono::microseconds sleep_time;
+  std::atomic<bool>         running{true};
+  wait_stats_tracker        stats;
+};
+
 } // namespace detail
 } // namespace srsran
@@ -25,6 +25,7 @@
 #include "srsran/adt/concurrent_queue.h"
 #include "srsran/adt/detail/concurrent_queue_barrier.h"
 #include "srsran/adt/ring_buffer.h"
+#include <mutex>
 
 namespace srsran {
 
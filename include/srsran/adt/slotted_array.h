@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "bounded_bitset.h"
 #include "span.h"
 #include "tiny_optional.h"
 #include "srsran/support/srsran_assert.h"
@@ -35,11 +36,14 @@ namespace srsran {
 
 namespace detail {
 
-/// Iterator implementation for an array of optional types that automatically skips positions without a value.
-template <typename ArrayOfOpts>
+/// \brief Iterator implementation for an array of optional types that automatically skips positions without a value.
+///
+/// The iterator is driven by an occupancy bitmap kept in sync by the owning container, so that advancing to the next
+/// present element skips empty regions a word at a time, instead of probing every slot.
+template <typename ArrayOfOpts, typename OccupancyBitmap>
 class slotted_array_iter_impl
 {
-  using iterator_type = slotted_array_iter_impl<ArrayOfOpts>;
+  using iterator_type = slotted_array_iter_impl<ArrayOfOpts, OccupancyBitmap>;
 
 public:
   using iterator_category = std::forward_iterator_tag;
@@ -49,22 +53,26 @@ public:
   using pointer           = std::conditional_t<std::is_const<ArrayOfOpts>::value, const value_type, value_type>*;
 
   slotted_array_iter_impl() = default;
-  slotted_array_iter_impl(ArrayOfOpts& vec_, size_t idx_) : vec(&vec_), idx(idx_)
+  slotted_array_iter_impl(ArrayOfOpts& vec_, const OccupancyBitmap& occupied_, size_t idx_) :
+    vec(&vec_), occupied(&occupied_), idx(idx_)
   {
-    while (idx < vec->size() and not(*vec)[idx].has_value()) {
-      ++idx;
+    if (idx < vec->size()) {
+      int pos = occupied->find_lowest(idx, vec->size());
+      idx     = pos < 0 ? vec->size() : static_cast<size_t>(pos);
     }
   }
   template <typename U, std::enable_if_t<not std::is_same<ArrayOfOpts, U>::value, int> = 0>
-  slotted_array_iter_impl(const slotted_array_iter_impl<U>& other) : vec(other.vec), idx(other.idx)
+  slotted_array_iter_impl(const slotted_array_iter_impl<U, OccupancyBitmap>& other) :
+    vec(other.vec), occupied(other.occupied), idx(other.idx)
   {
   }
 
   template <typename U, std::enable_if_t<not std::is_same<ArrayOfOpts, U>::value, int> = 0>
-  slotted_array_iter_impl& operator=(const slotted_array_iter_impl<U>& other)
+  slotted_array_iter_impl& operator=(const slotted_array_iter_impl<U, OccupancyBitmap>& other)
   {
-    vec = other.vec;
-    idx = other.idx;
+    vec      = other.vec;
+    occupied = other.occupied;
+    idx      = other.idx;
     return *this;
   }
 
@@ -75,25 +83,25 @@ public:
 
   iterator_type& operator++()
   {
-    while (++idx < vec->size() and not(*vec)[idx].has_value()) {
-    }
+    int pos = idx + 1 < vec->size() ? occupied->find_lowest(idx + 1, vec->size()) : -1;
+    idx     = pos < 0 ? vec->size() : static_cast<size_t>(pos);
     return *this;
   }
 
   iterator_type& operator--()
   {
-    while (--idx < vec->size() and not(*vec)[idx].has_value()) {
-    }
+    int pos = occupied->find_highest(0, std::min(idx, vec->size()));
+    idx     = pos < 0 ? std::numeric_limits<size_t>::max() : static_cast<size_t>(pos);
     return *this;
   }
 
   template <typename U>
-  bool operator==(const slotted_array_iter_impl<U>& other) const
+  bool operator==(const slotted_array_iter_impl<U, OccupancyBitmap>& other) const
   {
     return idx == other.idx and vec == other.vec;
   }
   template <typename U>
-  bool operator!=(const slotted_array_iter_impl<U>& other) const
+  bool operator!=(const slotted_array_iter_impl<U, OccupancyBitmap>& other) const
   {
     return not(*this == other);
   }
@@ -101,11 +109,12 @@ public:
 private:
   template <typename Vec>
   friend class base_slotted_array_view;
-  template <typename U>
+  template <typename U, typename B>
   friend class slotted_array_iter_impl;
 
-  ArrayOfOpts* vec = nullptr;
-  size_t       idx = std::numeric_limits<size_t>::max();
+  ArrayOfOpts*           vec      = nullptr;
+  const OccupancyBitmap* occupied = nullptr;
+  size_t                 idx      = std::numeric_limits<size_t>::max();
 };
 
 /// Iterator implementation for a vector of optional types that automatically skips positions without a value.
@@ -200,8 +209,9 @@ struct cast_to_size_operator {
 /// - Stable - Pointer/References/Iterators remain valid throughout the object lifetime.
 /// - Memory overhead - The container creates an array/vector up-front of size \c N, even if its number of elements is
 /// still zero.
-/// - Fragmentation - The container has holes in its internal data storage for every absent indexes. This reduces
-/// the efficiency of operations like iteration in scenarios of high fragmentation.
+/// - Fragmentation - The container has holes in its internal data storage for every absent indexes. An internal
+/// occupancy bitmap lets the iterators skip runs of absent elements a word at a time, so iteration cost scales with
+/// the number of present elements rather than with \c N.
 /// The advantages of this container include:
 /// - O(1) complexity for index-based lookup, creation, removal (just one array indexing),
 /// - No allocations during element creation or deletion,
@@ -232,10 +242,10 @@ class slotted_array
 
 public:
   using value_type     = T;
-  using iterator       = detail::slotted_array_iter_impl<array_type>;
-  using const_iterator = detail::slotted_array_iter_impl<const array_type>;
+  using iterator       = detail::slotted_array_iter_impl<array_type, bounded_bitset<N>>;
+  using const_iterator = detail::slotted_array_iter_impl<const array_type, bounded_bitset<N>>;
 
-  slotted_array() { dimension_vec(vec); }
+  slotted_array() : occupied_slots(N) { dimension_vec(vec); }
 
   bool contains(size_t idx) const noexcept { return idx < vec.size() and vec[idx].has_value(); }
 
@@ -257,10 +267,10 @@ public:
   /// \brief Checks the number of elements stored in the container.
   constexpr size_t size() const noexcept { return nof_elems; }
 
-  iterator       begin() { return iterator{vec, 0}; }
-  iterator       end() { return iterator{vec, vec.size()}; }
-  const_iterator begin() const { return const_iterator{vec, 0}; }
-  const_iterator end() const { return const_iterator{vec, vec.size()}; }
+  iterator       begin() { return iterator{vec, occupied_slots, 0}; }
+  iterator       end() { return iterator{vec, occupied_slots, vec.size()}; }
+  const_iterator begin() const { return const_iterator{vec, occupied_slots, 0}; }
+  const_iterator end() const { return const_iterator{vec, occupied_slots, vec.size()}; }
 
   /// Insert element into the container if an element with the same index does not exist yet.
   /// \param idx Position of the constructed element in the array
@@ -276,6 +286,7 @@ public:
     }
     this->nof_elems++;
     this->vec[idx] = std::forward<U>(u);
+    this->occupied_slots.set(idx);
     return true;
   }
 
@@ -289,6 +300,7 @@ public:
     srsran_assert(idx < this->vec.size(), "Out-of-bounds access to array: {}>={}", idx, this->vec.size());
     this->nof_elems += this->contains(idx) ? 0 : 1;
     this->vec[idx].emplace(std::forward<Args>(args)...);
+    this->occupied_slots.set(idx);
     srsran_assert(this->vec[idx].has_value(), "Inserted object must be represent an optional with value");
   }
 
@@ -300,6 +312,7 @@ public:
     if (this->contains(idx)) {
       this->nof_elems--;
       this->vec[idx].reset();
+      this->occupied_slots.reset(idx);
       return true;
     }
     return false;
@@ -316,11 +329,12 @@ public:
     for (auto& e : this->vec) {
       e.reset();
     }
+    this->occupied_slots.reset();
   }
 
   /// Get iterator with index equal or higher than the provided index.
-  iterator       lower_bound(size_t idx) { return iterator{vec, idx}; }
-  const_iterator lower_bound(size_t idx) const { return const_iterator{vec, idx}; }
+  iterator       lower_bound(size_t idx) { return iterator{vec, occupied_slots, idx}; }
+  const_iterator lower_bound(size_t idx) const { return const_iterator{vec, occupied_slots, idx}; }
 
   /// Find first position that is empty
   size_t find_first_empty(size_t start_guess = 0) const
@@ -329,12 +343,8 @@ public:
     if (nof_elems == vec.size()) {
       return vec.size();
     }
-    for (size_t i = start_guess; i < vec.size(); ++i) {
-      if (not vec[i].has_value()) {
-        return i;
-      }
-    }
-    return vec.size();
+    int pos = occupied_slots.find_lowest(start_guess, vec.size(), false);
+    return pos < 0 ? vec.size() : static_cast<size_t>(pos);
   }
 
 private:
@@ -344,8 +354,9 @@ private:
     return it.idx;
   }
 
-  size_t     nof_elems = 0; ///< Number of present fields
-  array_type vec;           ///< Container to store optional elements
+  size_t            nof_elems = 0; ///< Number of present fields
+  array_type        vec;           ///< Container to store optional elements
+  bounded_bitset<N> occupied_slots; ///< Occupancy bitmap used to skip absent elements during iteration
 };
 
 /// \brief Container representing a vector of optional elements. It has the following characteristics:
@@ -220,6 +220,90 @@ private:
   std::array<uint8_t, sizeof(Type) * MAX_ELEMENTS> elements;
 };
 
+/// \brief Fixed tensor - the dimensions are fixed at compile time.
+///
+/// Unlike \ref static_tensor, the extents are part of the type. As the class is \c final and \ref
+/// get_dimensions_size() returns a reference to a \c constexpr array, the compiler can resolve all stride and offset
+/// arithmetic of the base class accessors at compile time when the tensor is accessed through its concrete type. Use
+/// it for quantities whose dimensions are known at configuration time (e.g. number of ports or layers).
+///
+/// \tparam Type    Type of data to store.
+/// \tparam EXTENTS Size of each of the tensor dimensions.
+template <typename Type, unsigned... EXTENTS>
+class fixed_tensor final : public tensor<sizeof...(EXTENTS), Type, unsigned>
+{
+public:
+  /// Number of dimensions.
+  static constexpr unsigned NDIMS = sizeof...(EXTENTS);
+  /// Holds the tensor dimensions.
+  using dimensions_size_type = std::array<unsigned, NDIMS>;
+  /// Compile-time tensor dimensions.
+  static constexpr dimensions_size_type extents = {EXTENTS...};
+  /// Total number of elements.
+  static constexpr unsigned nof_elements = (EXTENTS * ...);
+
+  /// Default constructor with all elements to zero.
+  fixed_tensor() = default;
+
+  /// \brief Resizes the tensor.
+  ///
+  /// The extents are fixed: an assertion is triggered if \c dimensions does not match them.
+  void resize(const dimensions_size_type& dimensions) override
+  {
+    srsran_assert(dimensions == extents,
+                  "The dimensions (i.e., {}) do not match the fixed tensor extents (i.e., {}).",
+                  span<const unsigned>(dimensions),
+                  span<const unsigned>(extents));
+  }
+
+  // See interface for documentation.
+  const dimensions_size_type& get_dimensions_size() const override { return extents; }
+
+  // See interface for documentation.
+  span<Type> get_data() override { return elements; }
+
+  // See interface for documentation.
+  span<const Type> get_data() const override { return elements; }
+
+private:
+  /// Tensor actual storage.
+  std::array<Type, nof_elements> elements = {};
+};
+
+/// \brief View of a two-dimensional tensor with its dimensions swapped.
+///
+/// The adapter does not rearrange data: accessing element <tt>(i, j)</tt> of the view reads element <tt>(j, i)</tt> of
+/// the underlying tensor. It allows writing a kernel once, templated on the tensor argument, and instantiating it for
+/// both layouts of the same data.
+///
+/// \tparam Type       Type of the stored data.
+/// \tparam Index_type Data type used for representing dimension indexes.
+template <typename Type, typename Index_type = unsigned>
+class transposed_tensor_view
+{
+public:
+  /// Constructs the view over a two-dimensional tensor.
+  explicit transposed_tensor_view(tensor<2, Type, Index_type>& tensor_) : original(tensor_) {}
+
+  /// Gets the reference to an element, with the indices swapped with respect to the underlying tensor.
+  Type& operator[](const std::array<unsigned, 2>& indices) { return original[{indices[1], indices[0]}]; }
+
+  /// Gets a read-only reference to an element, with the indices swapped with respect to the underlying tensor.
+  const Type& operator[](const std::array<unsigned, 2>& indices) const { return original[{indices[1], indices[0]}]; }
+
+  /// \brief Gets a specific dimension size.
+  /// \param[in] i_dimension View dimension.
+  /// \return The size of the underlying tensor dimension that the view maps to \c i_dimension.
+  unsigned get_dimension_size(Index_type i_dimension) const
+  {
+    return original.get_dimensions_size()[1U - static_cast<unsigned>(i_dimension)];
+  }
+
+private:
+  /// Underlying tensor.
+  tensor<2, Type, Index_type>& original;
+};
+
 /// \brief Dynamic tensor - the dimensions can be resized dynamically.
 /// \tparam NDIMS        Number of dimensions.
 /// \tparam Type         Type of data to store.
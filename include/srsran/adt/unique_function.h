@@ -23,6 +23,7 @@
 #pragma once
 
 #include "srsran/support/error_handling.h"
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
@@ -110,6 +111,13 @@ template <class Sig, size_t Capacity>
 struct is_unique_function<unique_function<Sig, Capacity>> : std::true_type {
 };
 
+/// Process-wide counter of unique_function constructions whose capture did not fit the small buffer.
+inline std::atomic<uint64_t>& get_heap_spill_counter()
+{
+  static std::atomic<uint64_t> counter{0};
+  return counter;
+}
+
 /// Metafunctions to enable different ctor implementations depending on whether the callback fits the small buffer
 template <typename T, size_t Cap, typename FunT = typename std::decay<T>::type>
 using enable_if_small_capture =
@@ -154,6 +162,7 @@ public:
     static const task_details::heap_table_t<FunT, R, Args...> heap_oper_table{};
     oper_ptr = &heap_oper_table;
     ptr      = static_cast<void*>(new FunT{std::forward<T>(function)});
+    task_details::get_heap_spill_counter().fetch_add(1, std::memory_order_relaxed);
   }
 
   unique_function(unique_function&& other) noexcept : oper_ptr(other.oper_ptr)
@@ -190,6 +199,17 @@ private:
 template <typename R, typename... Args, size_t Capacity, bool ForbidAlloc>
 const task_details::empty_table_t<R, Args...> unique_function<R(Args...), Capacity, ForbidAlloc>::empty_table{};
 
+/// \brief Number of unique_function constructions, since process start, whose capture exceeded the inline capacity
+/// and was moved to the heap.
+///
+/// Intended for diagnostics: a growing value on a loaded system means some task capture silently spilled and is
+/// allocating on a fast path. The offending instantiation can then be found by switching the relevant
+/// unique_function to ForbidAlloc, which turns the spill into a compile error.
+inline uint64_t unique_function_heap_spill_count()
+{
+  return task_details::get_heap_spill_counter().load(std::memory_order_relaxed);
+}
+
 constexpr size_t default_unique_task_buffer_size = 64;
 
 /// Generic moveable task
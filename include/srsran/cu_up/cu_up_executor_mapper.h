@@ -76,6 +76,12 @@ public:
   /// \brief Gets task executor that is used by the E2 CU-UP agent.
   virtual task_executor& e2_executor() = 0;
 
+  /// \brief Gets task executor used for GTP-U path management messages (echo request/response, error indication).
+  ///
+  /// The returned executor has a small dedicated queue that is separate from the user-plane tunnel queues, so a peer
+  /// flooding path management messages has them dropped early instead of adding latency to user-plane processing.
+  virtual task_executor& gtpu_path_mgmt_executor() = 0;
+
   /// \brief Instantiate executors for a created UE in the CU-UP.
   virtual std::unique_ptr<ue_executor_mapper> create_ue_executor_mapper() = 0;
 };
@@ -132,6 +132,39 @@ public:
                              const std::vector<asn1::e2sm::ue_id_c>&      ues,
                              const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
                              std::vector<asn1::e2sm::meas_record_item_c>& items) = 0;
+
+  /// Handle to a metric measurement getter, resolved once at subscription time.
+  using metric_handle_t = uint32_t;
+
+  /// Special metric handle value signalling that the metric could not be resolved.
+  static constexpr metric_handle_t INVALID_METRIC_HANDLE = 0xffffffffU;
+
+  /// \brief resolve a metric into a handle usable in the periodic report path
+  ///
+  /// Providers that implement this method allow report services to bind the metric getter at subscription time, so
+  /// that periodic report generation does not re-interpret the ASN.1 metric name on every granularity period.
+  /// \param[in] meas_type defines the metric to resolve
+  /// \return Returns a handle valid for \ref get_meas_data, or INVALID_METRIC_HANDLE if the metric is not supported
+  virtual metric_handle_t resolve_meas_type(const asn1::e2sm::meas_type_c& meas_type)
+  {
+    return INVALID_METRIC_HANDLE;
+  }
+
+  /// \brief collected measurements for a metric previously resolved with \ref resolve_meas_type
+  /// \param[in] metric_handle handle returned by \ref resolve_meas_type
+  /// \param[in] label_info_list defines labels for the metric
+  /// \param[in] ues if not empty, then measure meas_info_item for the listed UE IDs
+  /// \param[in] cell_global_id if present measure meas_info_item within the cell scope
+  /// \param[out] items contains measruement records (if ues is not empty, then one record for each UE)
+  /// \return Returns True if measurement collection was successful
+  virtual bool get_meas_data(metric_handle_t                              metric_handle,
+                             const asn1::e2sm::label_info_list_l          label_info_list,
+                             const std::vector<asn1::e2sm::ue_id_c>&      ues,
+                             const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
+                             std::vector<asn1::e2sm::meas_record_item_c>& items)
+  {
+    return false;
+  }
 };
 
 } // namespace srsran
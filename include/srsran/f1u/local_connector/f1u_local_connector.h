@@ -28,6 +28,7 @@
 #include "srsran/f1u/du/f1u_gateway.h"
 #include "srsran/srslog/srslog.h"
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 
 namespace srsran {
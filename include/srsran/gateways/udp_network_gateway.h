@@ -34,6 +34,7 @@ namespace srsran {
 
 struct udp_network_gateway_config : common_network_gateway_config {
   unsigned rx_max_mmsg              = 256;
+  unsigned tx_max_mmsg              = 32;
   float    pool_occupancy_threshold = 0.9;
 };
 
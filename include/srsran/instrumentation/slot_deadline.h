@@ -0,0 +1,85 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/ran/slot_point.h"
+#include <chrono>
+
+namespace srsran {
+
+/// \brief Slot processing deadline token.
+///
+/// Created at the timing boundary when a slot indication arrives, the token captures the slot start time together with
+/// the slot duration derived from the slot numerology. A stage holding the token can query the remaining budget to
+/// prioritize, shed or fast-path its work, instead of rediscovering lateness on its own.
+class slot_deadline
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  slot_deadline() = default;
+
+  /// Creates a deadline for the given slot, with the budget starting to run at the given time point.
+  explicit slot_deadline(slot_point slot_, clock::time_point start_ = clock::now()) :
+    sl(slot_), start(start_), budget(slot_duration(slot_))
+  {
+  }
+
+  /// Returns the duration of the given slot, derived from its numerology.
+  static constexpr std::chrono::nanoseconds slot_duration(slot_point slot)
+  {
+    return std::chrono::nanoseconds(std::chrono::nanoseconds(std::chrono::milliseconds(1)).count() /
+                                    slot.nof_slots_per_subframe());
+  }
+
+  /// Returns true if the token tracks a slot.
+  bool valid() const { return sl.valid(); }
+
+  /// Slot this deadline refers to.
+  slot_point slot() const { return sl; }
+
+  /// Time point at which the slot budget started to run.
+  clock::time_point start_time() const { return start; }
+
+  /// Total processing budget of the slot.
+  std::chrono::nanoseconds total_budget() const { return budget; }
+
+  /// Budget consumed at the given time point.
+  std::chrono::nanoseconds consumed(clock::time_point now = clock::now()) const
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now - start);
+  }
+
+  /// Budget left at the given time point. Negative once the deadline has expired.
+  std::chrono::nanoseconds remaining(clock::time_point now = clock::now()) const { return budget - consumed(now); }
+
+  /// Returns true if the deadline has expired at the given time point.
+  bool is_expired(clock::time_point now = clock::now()) const { return remaining(now) < std::chrono::nanoseconds(0); }
+
+private:
+  slot_point               sl;
+  clock::time_point        start = {};
+  std::chrono::nanoseconds budget{0};
+};
+
+} // namespace srsran
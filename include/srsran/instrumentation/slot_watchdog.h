@@ -0,0 +1,142 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/instrumentation/slot_deadline.h"
+#include "srsran/ran/slot_point.h"
+#include "srsran/srslog/srslog.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace srsran {
+
+/// Downlink slot pipeline stages correlated by the slot timing watchdog.
+enum class slot_watchdog_stage : unsigned {
+  /// Slot indication delivered to the MAC cell processor.
+  slot_indication = 0,
+  /// Scheduler produced the slot result.
+  scheduler_done,
+  /// MAC finished assembling and notifying all slot results.
+  mac_assembly_done,
+  /// Downlink request reached the Open Fronthaul transmission window check.
+  ofh_tx_window,
+  /// Number of tracked stages.
+  count
+};
+
+/// \brief Budget consumption statistics of one pipeline stage, accumulated over the closed slot timelines.
+struct slot_watchdog_stage_stats {
+  /// Number of closed slot timelines in which the stage was recorded.
+  uint64_t nof_slots = 0;
+  /// Cumulative time from the slot indication until the stage was reached, in nanoseconds.
+  uint64_t cum_consumed_ns = 0;
+  /// Maximum time from the slot indication until the stage was reached, in nanoseconds.
+  int64_t max_consumed_ns = 0;
+  /// Number of slots in which the stage was reached after the slot deadline had already expired.
+  uint64_t nof_deadline_overruns = 0;
+};
+
+/// \brief End-to-end slot timing watchdog.
+///
+/// Correlates timestamps taken at different stages of the downlink slot pipeline into a per-slot timeline stored in a
+/// lock-free ring. When the time elapsed between the slot indication and the Open Fronthaul transmission window check
+/// exceeds a configurable threshold, or when the transmission window is missed, the complete timeline is dumped to the
+/// logger so that the stage that consumed the slot budget can be identified.
+///
+/// The watchdog is disabled by default, in which case every recording point reduces to a single relaxed atomic load.
+class slot_timing_watchdog
+{
+public:
+  /// Enables the watchdog. Slots whose pipeline takes longer than the given threshold are dumped.
+  void enable(std::chrono::microseconds late_threshold);
+
+  /// Returns true if the watchdog is enabled, otherwise false.
+  bool is_enabled() const { return enabled.load(std::memory_order_relaxed); }
+
+  /// Records that the given stage of the pipeline was reached for the given slot.
+  void record(slot_point slot, slot_watchdog_stage stage)
+  {
+    if (is_enabled()) {
+      record_impl(slot, stage);
+    }
+  }
+
+  /// \brief Records the outcome of the Open Fronthaul transmission window check for the given slot.
+  ///
+  /// Closes the slot timeline and dumps it if the transmission window was missed or the late slot threshold was
+  /// exceeded.
+  void record_tx_window(slot_point slot, bool missed)
+  {
+    if (is_enabled()) {
+      record_tx_window_impl(slot, missed);
+    }
+  }
+
+  /// \brief Returns the budget consumption statistics accumulated for the given stage.
+  ///
+  /// The budget of each slot is its duration, as derived by \c slot_deadline from the slot numerology.
+  slot_watchdog_stage_stats get_stage_stats(slot_watchdog_stage stage) const;
+
+private:
+  /// Number of slot timelines kept in the ring. Must be a power of two.
+  static constexpr size_t ring_size = 64;
+  /// Number of tracked pipeline stages.
+  static constexpr unsigned nof_stages = static_cast<unsigned>(slot_watchdog_stage::count);
+  /// Slot tag of an unclaimed ring entry.
+  static constexpr uint32_t invalid_tag = std::numeric_limits<uint32_t>::max();
+
+  /// Per-slot timeline record. The slot tag validates that all timestamps belong to the same slot.
+  struct slot_timeline {
+    std::atomic<uint32_t>                        tag{invalid_tag};
+    std::array<std::atomic<int64_t>, nof_stages> stage_time_ns{};
+  };
+
+  /// Per-stage budget consumption counters, updated with relaxed atomics when a slot timeline is closed.
+  struct stage_stats_atomics {
+    std::atomic<uint64_t> nof_slots{0};
+    std::atomic<uint64_t> cum_consumed_ns{0};
+    std::atomic<int64_t>  max_consumed_ns{0};
+    std::atomic<uint64_t> nof_deadline_overruns{0};
+  };
+
+  void record_impl(slot_point slot, slot_watchdog_stage stage);
+  void record_tx_window_impl(slot_point slot, bool missed);
+  void update_stage_stats(const slot_timeline& timeline, slot_point slot);
+  void dump_timeline(const slot_timeline& timeline, slot_point slot, bool missed, int64_t elapsed_ns);
+
+  /// Returns the current monotonic time in nanoseconds.
+  static int64_t now_ns();
+
+  std::atomic<bool>                  enabled{false};
+  int64_t                            late_threshold_ns = 0;
+  srslog::basic_logger*              logger            = nullptr;
+  std::array<slot_timeline, ring_size>        ring;
+  std::array<stage_stats_atomics, nof_stages> stage_stats;
+};
+
+/// Slot timing watchdog service. Disabled unless the application enables it.
+extern slot_timing_watchdog slot_watchdog;
+
+} // namespace srsran
@@ -16,6 +16,26 @@ public:
   virtual void on_new_sdu(byte_buffer_slice sdu) = 0;
 };
 
+/// \brief Destination where upper layers write MAC Tx SDUs during a batched SDU pull.
+///
+/// For each SDU, the upper layer requests a buffer via \c begin_sdu, writes the SDU payload in-place, and commits the
+/// number of written bytes via \c commit_sdu, upon which MAC encodes the respective subheader.
+class mac_tx_sdu_writer
+{
+public:
+  virtual ~mac_tx_sdu_writer() = default;
+
+  /// \brief Requests a buffer where the next MAC SDU payload can be written in-place.
+  /// \param max_sdu_size Maximum SDU size the upper layer intends to write.
+  /// \return Buffer where the SDU payload can be written. Empty if the PDU under assembly has no space left.
+  virtual span<uint8_t> begin_sdu(unsigned max_sdu_size) = 0;
+
+  /// \brief Commits the SDU written in the buffer returned by the last \c begin_sdu call.
+  /// \param nof_bytes Number of bytes written to the buffer. Passing 0 discards the SDU.
+  /// \return Number of bytes consumed in the PDU under assembly (MAC subheader plus SDU).
+  virtual unsigned commit_sdu(unsigned nof_bytes) = 0;
+};
+
 /// This interface represents the entry point of a logical channel in the MAC layer.
 class mac_sdu_tx_builder
 {
@@ -27,6 +47,30 @@ public:
   /// \return Generated MAC SDU size.
   virtual size_t on_new_tx_sdu(span<uint8_t> mac_sdu_space) = 0;
 
+  /// \brief Called by MAC to generate a batch of MAC Tx SDUs for the respective logical channel in a single call.
+  /// Compared to repeated \c on_new_tx_sdu calls, this lets upper layers amortize per-call synchronization over the
+  /// whole batch.
+  /// \param writer Destination where the SDUs are written.
+  /// \return Total number of bytes consumed in the PDU under assembly.
+  virtual size_t on_new_tx_sdus(mac_tx_sdu_writer& writer)
+  {
+    // Default implementation pulls one SDU at a time.
+    size_t total_bytes = 0;
+    while (true) {
+      span<uint8_t> sdu_buf = writer.begin_sdu(std::numeric_limits<unsigned>::max());
+      if (sdu_buf.empty()) {
+        break;
+      }
+      size_t sdu_len = on_new_tx_sdu(sdu_buf);
+      if (sdu_len == 0) {
+        writer.commit_sdu(0);
+        break;
+      }
+      total_bytes += writer.commit_sdu(sdu_len);
+    }
+    return total_bytes;
+  }
+
   /// Called by MAC to obtain the DL BSR  for the respective logical channel.
   virtual unsigned on_buffer_state_update() = 0;
 };
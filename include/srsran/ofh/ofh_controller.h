@@ -38,6 +38,15 @@ public:
   /// \brief Stops the Open Fronthaul operation.
   /// \note Caller will be blocked until the controller is fully stopped.
   virtual void stop() = 0;
+
+  /// \brief Warm-suspends the Open Fronthaul operation.
+  ///
+  /// Unlike \c stop(), pausing keeps all resources (threads, sockets and buffer pools) allocated so that the
+  /// operation can be resumed in milliseconds. Incoming traffic is dropped while paused.
+  virtual void pause() = 0;
+
+  /// \brief Resumes a warm-suspended Open Fronthaul operation.
+  virtual void resume() = 0;
 };
 
 } // namespace ofh
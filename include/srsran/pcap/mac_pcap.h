@@ -69,6 +69,27 @@ struct mac_nr_context_info {
 
 enum class mac_pcap_type { udp, dlt };
 
+/// \brief Capture filter for MAC PCAP PDUs.
+///
+/// The default-constructed filter captures every PDU. The predicate sits in the per-PDU path before any copy is made,
+/// hence it reduces to one bitmask test and one range compare.
+struct mac_pcap_filter {
+  /// Bitmask of RNTI types to capture, where bit i enables the RNTI type with value i (e.g. bit 3 for PCAP_C_RNTI).
+  uint16_t rnti_type_mask = 0xffff;
+  /// Lower bound (inclusive) of the RNTI range to capture.
+  uint16_t rnti_min = 0;
+  /// Upper bound (inclusive) of the RNTI range to capture.
+  uint16_t rnti_max = 0xffff;
+
+  /// Checks whether a PDU with the given context shall be captured.
+  bool matches(const mac_nr_context_info& context) const
+  {
+    // Note: The subtraction folds the two range bounds into a single unsigned compare.
+    return ((rnti_type_mask >> context.rntiType) & 1U) != 0 and
+           static_cast<uint16_t>(context.rnti - rnti_min) <= static_cast<uint16_t>(rnti_max - rnti_min);
+  }
+};
+
 /// \brief Interface class for writing a MAC PCAP to a file.
 class mac_pcap
 {
@@ -81,9 +102,11 @@ public:
   virtual void push_pdu(const mac_nr_context_info& context, byte_buffer pdu)         = 0;
 };
 
-/// Creates a MAC pcap writer to a file.
-std::unique_ptr<mac_pcap>
-create_mac_pcap(const std::string& filename, mac_pcap_type pcap_type, task_executor& backend_exec);
+/// Creates a MAC pcap writer to a file. An optional capture filter restricts which PDUs are written.
+std::unique_ptr<mac_pcap> create_mac_pcap(const std::string& filename,
+                                          mac_pcap_type      pcap_type,
+                                          task_executor&     backend_exec,
+                                          mac_pcap_filter    filter = {});
 std::unique_ptr<mac_pcap> create_null_mac_pcap();
 
 /// Null sink for MAC pcap messages. This is useful in unit tests and when the application disables pcaps.
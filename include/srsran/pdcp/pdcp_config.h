@@ -138,7 +138,9 @@ struct pdcp_custom_config_tx : public pdcp_custom_config_base {
 };
 
 struct pdcp_custom_config_rx : public pdcp_custom_config_base {
-  // Empty
+  /// Maximum number of PDUs of a DRB that may be deciphered in parallel on the crypto executor. Values 0 and 1 keep
+  /// deciphering and integrity verification inline on the UE UL executor.
+  uint16_t max_nof_parallel_pdus = 0;
 };
 
 /// \brief Non-standard configurable parameters for PDCP
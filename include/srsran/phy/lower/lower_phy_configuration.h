@@ -69,6 +69,12 @@ enum class lower_phy_baseband_buffer_size_policy : unsigned {
   /// for the transmitter and \ref baseband_gateway::get_receiver_optimal_buffer_size for the receiver less than the
   /// number of samples per slot.
   optimal_slot,
+  /// \brief The buffer size matches the average number of samples per OFDM symbol.
+  ///
+  /// Symbol-sized buffers pipeline the baseband flow at symbol level: the modulation of a symbol overlaps the
+  /// transmission of the previous one, which reduces the processing deadline pressure at the cost of a higher task
+  /// scheduling overhead.
+  single_symbol,
 };
 
 /// Lower physical layer configuration.
@@ -143,6 +149,9 @@ inline lower_phy_baseband_buffer_size_policy to_buffer_size_policy(const std::st
   if (str == "single-packet") {
     return lower_phy_baseband_buffer_size_policy::single_packet;
   }
+  if (str == "single-symbol") {
+    return lower_phy_baseband_buffer_size_policy::single_symbol;
+  }
   if (str == "half-slot") {
     return lower_phy_baseband_buffer_size_policy::half_slot;
   }
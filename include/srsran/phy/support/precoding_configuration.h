@@ -130,12 +130,16 @@ public:
   /// Creates a precoding configuration with a single PRG spanning the entire signal bandwidth.
   static precoding_configuration make_wideband(const precoding_weight_matrix& precoding_matrix)
   {
-    // Create a precoding configuration with a single PRG spanning all the available BW.
-    precoding_configuration config(
-        precoding_matrix.get_nof_layers(), precoding_matrix.get_nof_ports(), 1, MAX_NOF_PRBS);
-
-    // Set the PRG weights.
-    config.set_prg_coefficients(precoding_matrix, 0);
+    srsran_assert(precoding_matrix.get_nof_layers() != 0, "The precoding matrix must not be empty.");
+
+    // Create a precoding configuration with a single PRG spanning all the available BW. The PRG weights are copied
+    // directly from the input matrix, skipping the zero-initialization performed by the dimensions-based constructor.
+    precoding_configuration config;
+    config.prg_size   = MAX_NOF_PRBS;
+    config.nof_prg    = 1;
+    config.nof_layers = precoding_matrix.get_nof_layers();
+    config.nof_ports  = precoding_matrix.get_nof_ports();
+    config.weights_list.push_back(precoding_matrix);
 
     return config;
   }
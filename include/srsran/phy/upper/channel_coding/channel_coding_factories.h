@@ -56,8 +56,32 @@ public:
   virtual std::unique_ptr<ldpc_decoder> create() = 0;
 };
 
+/// \brief Per-modulation LDPC decoder iteration budgets.
+///
+/// Optional cap on the maximum number of decoding iterations depending on the codeblock modulation. High modulation
+/// orders are only scheduled at high SNR, where the layered min-sum schedule typically converges within very few
+/// iterations, so their budget can be trimmed to save CPU without noticeably affecting the block error rate. The
+/// caller-provided maximum number of iterations still applies - the effective cap is the minimum of the two.
+struct ldpc_decoder_iteration_budgets {
+  /// Budget for BPSK, &pi;/2-BPSK and QPSK codeblocks.
+  unsigned qpsk = 6;
+  /// Budget for 16-QAM codeblocks.
+  unsigned qam16 = 6;
+  /// Budget for 64-QAM codeblocks.
+  unsigned qam64 = 4;
+  /// Budget for 256-QAM codeblocks.
+  unsigned qam256 = 3;
+};
+
 std::shared_ptr<ldpc_decoder_factory> create_ldpc_decoder_factory_sw(const std::string& dec_type);
 
+/// \brief Creates a software LDPC decoder factory applying per-modulation iteration budgets.
+///
+/// Same as create_ldpc_decoder_factory_sw(const std::string&), but the created decoders limit the maximum number of
+/// iterations according to the codeblock modulation (see \ref ldpc_decoder_iteration_budgets).
+std::shared_ptr<ldpc_decoder_factory> create_ldpc_decoder_factory_sw(const std::string&                    dec_type,
+                                                                     const ldpc_decoder_iteration_budgets& budgets);
+
 class ldpc_encoder_factory
 {
 public:
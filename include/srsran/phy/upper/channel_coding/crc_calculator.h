@@ -24,6 +24,7 @@
 
 #include "srsran/adt/bit_buffer.h"
 #include "srsran/adt/span.h"
+#include "srsran/support/srsran_assert.h"
 
 namespace srsran {
 
@@ -80,6 +81,25 @@ public:
   ///\return The resulting CRC checksum.
   virtual crc_calculator_checksum_t calculate(const bit_buffer& data) = 0;
 
+  ///\brief Calculates the checksums of a batch of bit buffers.
+  ///
+  /// Equivalent to calling \ref calculate once per input buffer. Implementations may overlap the computation of
+  /// several buffers to hide instruction latency.
+  ///
+  ///\param[out] checksums Resulting CRC checksums, one per input buffer.
+  ///\param[in]  data      Input data buffers.
+  ///\remark The sizes of \c checksums and \c data must be equal.
+  virtual void calculate_batch(span<crc_calculator_checksum_t> checksums, span<const bit_buffer> data)
+  {
+    srsran_assert(checksums.size() == data.size(),
+                  "The number of checksums (i.e., {}) must be equal to the number of buffers (i.e., {}).",
+                  checksums.size(),
+                  data.size());
+    for (unsigned i = 0, nof_buffers = data.size(); i != nof_buffers; ++i) {
+      checksums[i] = calculate(data[i]);
+    }
+  }
+
   ///\brief Returns the identifier of the generator polynomial.
   virtual crc_generator_poly get_generator_poly() const = 0;
 };
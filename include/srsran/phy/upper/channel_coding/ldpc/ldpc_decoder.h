@@ -72,6 +72,26 @@ public:
   /// failed CRC) and set all the output bits to one.
   virtual std::optional<unsigned>
   decode(bit_buffer& output, span<const log_likelihood_ratio> input, crc_calculator* crc, const configuration& cfg) = 0;
+
+  /// \brief Decodes a batch of codeblocks sharing the same configuration.
+  ///
+  /// All codeblocks must have the same length and use the same base graph, lifting size and algorithm parameters. By
+  /// decoding them in a single call, the decoder loads the Tanner graph and the related look-up tables only once,
+  /// amortizing the per-call setup cost across the entire batch.
+  ///
+  /// \param[out] stats   Per-codeblock decoding result, following the same convention as the return value of
+  ///                     \ref decode.
+  /// \param[out] outputs Reconstructed messages of information bits, one entry per codeblock.
+  /// \param[in]  inputs  Log-likelihood ratios of the codeblocks to be decoded.
+  /// \param[in]  crc     Pointer to a CRC calculator for early stopping. Set to \c nullptr for disabling early
+  ///                     stopping.
+  /// \param[in]  cfg     Decoder configuration, common to all codeblocks in the batch.
+  /// \remark The sizes of \c stats, \c outputs and \c inputs must be equal.
+  virtual void decode_batch(span<std::optional<unsigned>>                stats,
+                            span<bit_buffer>                             outputs,
+                            span<const span<const log_likelihood_ratio>> inputs,
+                            crc_calculator*                              crc,
+                            const configuration&                         cfg) = 0;
 };
 
 } // namespace srsran
@@ -96,7 +96,8 @@ create_pusch_demodulator_factory_sw(std::shared_ptr<channel_equalizer_factory>
                                     std::shared_ptr<pseudo_random_generator_factory> prg_factory,
                                     unsigned                                         max_nof_prb,
                                     bool                                             enable_evm          = false,
-                                    bool                                             enable_post_eq_sinr = false);
+                                    bool                                             enable_post_eq_sinr = false,
+                                    unsigned                                         evm_sampling_period = 1);
 
 class pusch_processor_factory
 {
@@ -104,7 +105,12 @@ public:
   virtual ~pusch_processor_factory()                              = default;
   virtual std::unique_ptr<pusch_processor>     create()           = 0;
   virtual std::unique_ptr<pusch_pdu_validator> create_validator() = 0;
-  virtual std::unique_ptr<pusch_processor>     create(srslog::basic_logger& logger);
+  /// \brief Creates a PUSCH processor that logs the processed PDUs.
+  /// \param[in] logger              Logger instance for logging.
+  /// \param[in] logging_sample_rate Logs one out of every \c logging_sample_rate PDUs at levels lower than debug
+  ///                                (set to one for logging all PDUs). PDUs whose transport block failed CRC are
+  ///                                always logged.
+  virtual std::unique_ptr<pusch_processor> create(srslog::basic_logger& logger, unsigned logging_sample_rate = 1);
 };
 
 struct pusch_processor_factory_sw_configuration {
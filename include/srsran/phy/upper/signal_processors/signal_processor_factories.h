@@ -94,10 +94,16 @@ class port_channel_estimator_factory
 {
 public:
   virtual ~port_channel_estimator_factory() = default;
+  /// \brief Creates a port channel estimator.
+  ///
+  /// A non-zero \c td_carryover_max_age enables the carry-over of channel estimates across consecutive slots: the
+  /// estimate of a single-layer transmission is smoothed with the one previously obtained over the same PRB
+  /// allocation, provided that the cached one is not older than the given number of estimation calls.
   virtual std::unique_ptr<port_channel_estimator>
   create(port_channel_estimator_fd_smoothing_strategy fd_smoothing_strategy =
              port_channel_estimator_fd_smoothing_strategy::filter,
-         bool complensate_cfo = true) = 0;
+         bool     complensate_cfo      = true,
+         unsigned td_carryover_max_age = 0) = 0;
 };
 
 std::shared_ptr<port_channel_estimator_factory>
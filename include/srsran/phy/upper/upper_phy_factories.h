@@ -67,9 +67,13 @@ public:
   /// \param[in] logger                Logger instance for logging.
   /// \param[in] log_all_opportunities Set to true for logging all PRACH opportunities. Otherwise, it logs only the
   ///                                  detected preambles.
+  /// \param[in] pusch_sample_rate     Logs one out of every \c pusch_sample_rate PUSCH PDUs at levels lower than
+  ///                                  debug (set to one for logging all PDUs). CRC failures are always logged.
   /// \return A unique pointer to the new uplink processor if successful or \c nullptr otherwise.
-  virtual std::unique_ptr<uplink_processor>
-  create(const uplink_processor_config& config, srslog::basic_logger& logger, bool log_all_opportunities) = 0;
+  virtual std::unique_ptr<uplink_processor> create(const uplink_processor_config& config,
+                                                   srslog::basic_logger&          logger,
+                                                   bool                           log_all_opportunities,
+                                                   unsigned                       pusch_sample_rate) = 0;
 
   /// \brief Creates an uplink PDU validator.
   /// \return A unique pointer to the new uplink PDU validator if successful or \c nullptr otherwise.
@@ -105,6 +109,12 @@ struct downlink_processor_config {
   upper_phy_rg_gateway* gateway;
   /// Task executor.
   task_executor* executor;
+  /// \brief Number of slots after the resource grid configuration in which processing of an enqueued PDU may still
+  /// start.
+  ///
+  /// PDU tasks that begin execution later than this are abandoned, as the grid is already late for transmission and
+  /// processing it would steal cycles from viable slots. Set to zero to disable the deadline check.
+  unsigned nof_slots_processing_deadline = 0;
 };
 
 /// Factory that allows to create downlink processors.
@@ -252,10 +262,21 @@ struct upper_phy_config {
   srslog::basic_levels log_level;
   /// Enable logging broadcast channels such as SSB, PDSCH and PDCCH channels with broadcast RNTIs.
   bool enable_logging_broadcast;
+  /// \brief PUSCH PDU logging sample rate.
+  ///
+  /// Logs one out of every \c pusch_logging_sample_rate PUSCH PDUs when the logging level is lower than debug. PDUs
+  /// whose transport block failed CRC are always logged. Set to one for logging all PDUs.
+  unsigned pusch_logging_sample_rate = 1;
   /// Logger maximum hexadecimal dump size. Set to zero for none.
   unsigned logger_max_hex_size;
   /// Selects the PUSCH SINR calculation method used for choosing the modulation and coding scheme.
   channel_state_information::sinr_type pusch_sinr_calc_method;
+  /// \brief PUSCH EVM sampling period in PDUs.
+  ///
+  /// Measures the PUSCH EVM on one out of every \c pusch_evm_sampling_period PDUs for monitoring purposes. Set to
+  /// zero to measure the EVM only when it is otherwise required. The period is ignored (every PDU is measured) when
+  /// the EVM feeds the reported CSI or when PDUs are logged with debug level.
+  unsigned pusch_evm_sampling_period = 0;
   /// Receive symbol printer. Leave empty to disable.
   std::string rx_symbol_printer_filename;
   /// Receive port the UL symbols are dumped from. Leave emtpy for all ports.
@@ -300,8 +321,14 @@ struct upper_phy_config {
   /// Number of downlink resource grids. Downlink resource grids minimum reuse time is \c dl_rg_expire_timeout_slots
   /// slots.
   unsigned nof_dl_rg;
-  /// Number of uplink resource grids. They are reused after \c nof_ul_rg slots.
+  /// \brief Number of uplink resource grids.
+  ///
+  /// Grids are reused in round-robin order after \c nof_ul_rg allocations. Since grids are only allocated on slots
+  /// containing UL symbols, in TDD the pool only needs to span the UL slots contained in the processing pipeline
+  /// depth.
   unsigned nof_ul_rg;
+  /// Number of slots the uplink PDU repository can accommodate.
+  unsigned nof_slots_ul_pdu_repository;
   /// Number of PRACH buffer.
   unsigned nof_prach_buffer;
   /// Maximum number of time-domain occasions.
@@ -146,6 +146,26 @@ public:
 /// This interface represents the data exit point of the transmitting side of a RLC entity.
 /// The lower layers will use this interface to pull a PDU from the RLC, or to
 /// query the current buffer state of the RLC bearer.
+/// \brief Destination where the RLC TX entity writes PDUs during a batched pull.
+///
+/// For each PDU, the RLC requests a TX buffer via \c begin_pdu, encodes the PDU in-place, and commits the number of
+/// written bytes via \c commit_pdu, upon which the lower layer encapsulates the PDU (e.g. encodes the MAC subheader).
+class rlc_pdu_writer
+{
+public:
+  virtual ~rlc_pdu_writer() = default;
+
+  /// \brief Requests a TX buffer where the next RLC PDU can be encoded in-place.
+  /// \param max_pdu_size Maximum PDU size the RLC entity intends to write.
+  /// \return Buffer where the PDU can be encoded. Empty if the lower layer has no space left.
+  virtual span<uint8_t> begin_pdu(unsigned max_pdu_size) = 0;
+
+  /// \brief Commits the PDU encoded in the buffer returned by the last \c begin_pdu call.
+  /// \param nof_bytes Number of bytes written to the buffer. Passing 0 discards the PDU.
+  /// \return Number of bytes consumed in the lower layer (PDU plus encapsulation overhead).
+  virtual unsigned commit_pdu(unsigned nof_bytes) = 0;
+};
+
 class rlc_tx_lower_layer_interface
 {
 public:
@@ -163,6 +183,13 @@ public:
   /// \return Number of bytes taken by the written RLC PDU.
   virtual size_t pull_pdu(span<uint8_t> rlc_pdu_buf) = 0;
 
+  /// \brief Pulls a batch of PDUs from the lower end of the RLC TX entity in a single call.
+  /// PDUs are written through \c writer until the lower layer has no space left or the TX buffer is empty. Compared
+  /// to repeated \c pull_pdu calls, this amortizes the per-call synchronization overhead over the whole batch.
+  /// \param writer Destination where the PDUs are encoded.
+  /// \return Total number of bytes consumed in the lower layer.
+  virtual size_t pull_pdus(rlc_pdu_writer& writer) = 0;
+
   /// \brief Get the buffer status information
   /// This function provides the current buffer state of the RLC TX entity.
   /// This is the gross total size required to fully flush the TX entity (potentially by multiple calls to pull_pdu).
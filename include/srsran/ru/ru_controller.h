@@ -56,6 +56,20 @@ public:
   /// \return \c true if the operation is successful, \c false otherwise.
   virtual bool set_rx_gain(unsigned port_id, double gain_dB) = 0;
 
+  /// \brief Warm-suspends the given sector.
+  ///
+  /// Unlike \c stop(), the sector resources stay allocated so that the sector can be resumed in milliseconds, making
+  /// it suitable for energy-saving cell sleep cycles.
+  ///
+  /// \param[in] sector_id Sector identifier.
+  /// \return \c true if the operation is successful, \c false if the RU does not support warm suspension.
+  virtual bool pause_sector(unsigned sector_id) { return false; }
+
+  /// \brief Resumes a warm-suspended sector.
+  /// \param[in] sector_id Sector identifier.
+  /// \return \c true if the operation is successful, \c false if the RU does not support warm suspension.
+  virtual bool resume_sector(unsigned sector_id) { return false; }
+
   /// Prints RU specific metrics once.
   virtual void print_metrics() = 0;
 };
@@ -44,10 +44,11 @@ struct log_entry_metadata {
   log_context                                         context;
   const char*                                         fmtstring;
   fmt::dynamic_format_arg_store<fmt::format_context>* store;
-  std::string                                         log_name;
-  char                                                log_tag;
-  std::shared_ptr<const std::string>                  log_label;
-  std::vector<uint8_t>                                hex_dump;
+  /// Name of the channel originating the entry. Interned: all entries of a channel share the same string instance.
+  std::shared_ptr<const std::string> log_name;
+  char                               log_tag;
+  std::shared_ptr<const std::string> log_label;
+  std::vector<uint8_t>               hex_dump;
 };
 
 } // namespace detail
@@ -98,6 +98,18 @@ public:
     return {true, std::move(Item)};
   }
 
+  /// Extracts elements from the front of the queue into the provided range,
+  /// acquiring the queue lock only once. Returns the number of extracted
+  /// elements, which is smaller than the range size when the queue gets empty.
+  unsigned try_pop_into(srsran::span<T> range)
+  {
+    m.lock();
+    unsigned count = queue.pop_into(range);
+    m.unlock();
+
+    return count;
+  }
+
   /// Capacity of the queue.
   size_t get_capacity() const { return capacity; }
 
@@ -88,7 +88,7 @@ public:
     log_id(std::move(id)),
     log_sink(s),
     backend(backend_),
-    log_name(std::move(config.name)),
+    log_name(std::make_shared<const std::string>(std::move(config.name))),
     log_tag(config.tag),
     should_print_context(config.should_print_context),
     ctx_value64(0),
@@ -465,7 +465,8 @@ private:
   const std::string     log_id;
   sink&                 log_sink;
   detail::log_backend&  backend;
-  const std::string     log_name;
+  /// Channel name shared by all entries of this channel, so that entries do not copy the string.
+  const std::shared_ptr<const std::string> log_name;
   const char            log_tag;
   const bool            should_print_context;
   std::atomic<uint64_t> ctx_value64;
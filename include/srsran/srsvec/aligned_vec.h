@@ -29,14 +29,14 @@ namespace srsvec {
 
 namespace detail {
 void* mem_alloc(std::size_t size);
-void  mem_free(void* ptr);
+void  mem_free(void* ptr, std::size_t size);
 } // namespace detail
 
 /// Type to store a dynamic amount of aligned contiguous elements.
 template <typename T>
 class aligned_vec : public span<T>
 {
-  void dealloc() { detail::mem_free(this->data()); }
+  void dealloc() { detail::mem_free(this->data(), sizeof(T) * this->size()); }
 
 public:
   aligned_vec<T>& operator=(aligned_vec<T>&& other)      = delete;
@@ -28,6 +28,16 @@
 namespace srsran {
 namespace srsvec {
 
+namespace detail {
+
+/// Copies \c nof_bytes bytes from \c src to \c dst using non-temporal stores where supported.
+void copy_nt_bytes(void* dst, const void* src, std::size_t nof_bytes);
+
+/// Sets \c nof_bytes bytes of \c dst to zero using non-temporal stores where supported.
+void zero_nt_bytes(void* dst, std::size_t nof_bytes);
+
+} // namespace detail
+
 template <typename T, typename U>
 void copy(T&& dst, const U& src)
 {
@@ -38,5 +48,22 @@ void copy(T&& dst, const U& src)
   std::copy(src.begin(), src.end(), dst.begin());
 }
 
+/// \brief Copies all elements of \c src into \c dst using non-temporal stores.
+///
+/// The written data bypasses the cache hierarchy, so a large destination buffer that will not be read back soon (e.g.
+/// a HARQ soft buffer) does not evict the working set of the calling thread. For buffers that are consumed shortly
+/// after, use \ref copy instead. Where non-temporal stores are not supported, it behaves as \ref copy.
+template <typename T, typename U>
+void copy_nt(T&& dst, const U& src)
+{
+  static_assert(is_span_compatible<T>::value, "Template type is not compatible with a span");
+  static_assert(is_span_compatible<U>::value, "Template type is not compatible with a span");
+  using DstType = typename std::remove_reference_t<T>::value_type;
+  static_assert(std::is_trivially_copyable<DstType>::value, "Non-temporal copy requires trivially copyable elements");
+  srsran_srsvec_assert_size(dst, src);
+
+  detail::copy_nt_bytes(dst.data(), src.data(), dst.size() * sizeof(DstType));
+}
+
 } // namespace srsvec
 } // namespace srsran
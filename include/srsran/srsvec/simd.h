@@ -2622,6 +2622,63 @@ inline void srsran_simd_b_storeu(int8_t* ptr, simd_b_t simdreg)
 #endif /* __AVX512F__ */
 }
 
+inline simd_b_t srsran_simd_b_set1(int8_t v)
+{
+#ifdef __AVX512F__
+  return _mm512_set1_epi8(v);
+#else /* __AVX512F__ */
+#ifdef __AVX2__
+  return _mm256_set1_epi8(v);
+#else /* __AVX2__ */
+#ifdef __SSE4_1__
+  return _mm_set1_epi8(v);
+#else /* __SSE4_1__ */
+#ifdef __ARM_NEON
+  return vdupq_n_s8(v);
+#endif /* __ARM_NEON */
+#endif /* __SSE4_1__ */
+#endif /* __AVX2__ */
+#endif /* __AVX512F__ */
+}
+
+inline simd_b_t srsran_simd_b_min(simd_b_t a, simd_b_t b)
+{
+#ifdef __AVX512F__
+  return _mm512_min_epi8(a, b);
+#else /* __AVX512F__ */
+#ifdef __AVX2__
+  return _mm256_min_epi8(a, b);
+#else /* __AVX2__ */
+#ifdef __SSE4_1__
+  return _mm_min_epi8(a, b);
+#else /* __SSE4_1__ */
+#ifdef __ARM_NEON
+  return vminq_s8(a, b);
+#endif /* __ARM_NEON */
+#endif /* __SSE4_1__ */
+#endif /* __AVX2__ */
+#endif /* __AVX512F__ */
+}
+
+inline simd_b_t srsran_simd_b_max(simd_b_t a, simd_b_t b)
+{
+#ifdef __AVX512F__
+  return _mm512_max_epi8(a, b);
+#else /* __AVX512F__ */
+#ifdef __AVX2__
+  return _mm256_max_epi8(a, b);
+#else /* __AVX2__ */
+#ifdef __SSE4_1__
+  return _mm_max_epi8(a, b);
+#else /* __SSE4_1__ */
+#ifdef __ARM_NEON
+  return vmaxq_s8(a, b);
+#endif /* __ARM_NEON */
+#endif /* __SSE4_1__ */
+#endif /* __AVX2__ */
+#endif /* __AVX512F__ */
+}
+
 inline simd_b_t srsran_simd_b_xor(simd_b_t a, simd_b_t b)
 {
 #ifdef __AVX512F__
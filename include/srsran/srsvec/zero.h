@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "srsran/srsvec/copy.h"
 #include "srsran/srsvec/type_traits.h"
 #include "srsran/srsvec/types.h"
 
@@ -39,5 +40,22 @@ void zero(T&& x)
   std::fill(x.begin(), x.end(), 0);
 }
 
+/// \brief Sets all elements of a sequence to zero using non-temporal stores.
+///
+/// The written data bypasses the cache hierarchy, so zeroing a large buffer that will not be read back soon does not
+/// evict the working set of the calling thread. For buffers that are consumed shortly after, use \ref zero instead.
+/// Where non-temporal stores are not supported, it behaves as \ref zero.
+///
+/// \tparam T Type of the sequence container, must be span-compatible.
+/// \param  x Sequence container.
+template <typename T>
+void zero_nt(T&& x)
+{
+  static_assert(is_span_compatible<T>::value, "Template type is not compatible with a span.");
+  using ElemType = typename std::remove_reference_t<T>::value_type;
+  static_assert(std::is_trivially_copyable<ElemType>::value, "Non-temporal zeroing requires trivially copyable elements");
+  detail::zero_nt_bytes(x.data(), x.size() * sizeof(ElemType));
+}
+
 } // namespace srsvec
 } // namespace srsran
@@ -0,0 +1,83 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/adt/span.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace srsran {
+
+/// \brief Opt-in detector of heap allocations in real-time code.
+///
+/// Threads (or scopes, via \c scoped_forbid_allocations) can be marked as allocation-forbidden. When the detector
+/// hooks are compiled in (\c ENABLE_ALLOC_MONITOR build option), any call to operator new from a forbidden context is
+/// recorded, together with a backtrace, in a lock-free ring that can be drained at runtime with
+/// \c pop_forbidden_alloc_events. The allocation itself still succeeds, so the detector only observes.
+///
+/// When the hooks are not compiled in, marking threads or scopes amounts to updating a thread-local counter and no
+/// event is ever produced.
+
+/// Maximum number of stack frames captured for a forbidden allocation event.
+constexpr unsigned forbidden_alloc_event_max_frames = 16;
+
+/// Describes a heap allocation performed from a context where allocations are forbidden.
+struct forbidden_alloc_event {
+  /// Requested allocation size in bytes.
+  std::size_t size;
+  /// Number of valid entries in \c frames.
+  unsigned nof_frames;
+  /// Return addresses of the allocating call stack, innermost first.
+  std::array<void*, forbidden_alloc_event_max_frames> frames;
+};
+
+/// \brief Marks the calling thread as allocation-forbidden. Calls nest: the thread becomes allocation-allowed again
+/// once \c mark_this_thread_allocations_allowed has been called as many times.
+void mark_this_thread_allocations_forbidden();
+
+/// Reverts one level of \c mark_this_thread_allocations_forbidden for the calling thread.
+void mark_this_thread_allocations_allowed();
+
+/// \brief Scope guard that forbids heap allocations in the calling thread for its lifetime.
+class scoped_forbid_allocations
+{
+public:
+  scoped_forbid_allocations() { mark_this_thread_allocations_forbidden(); }
+  ~scoped_forbid_allocations() { mark_this_thread_allocations_allowed(); }
+
+  scoped_forbid_allocations(const scoped_forbid_allocations&)            = delete;
+  scoped_forbid_allocations(scoped_forbid_allocations&&)                 = delete;
+  scoped_forbid_allocations& operator=(const scoped_forbid_allocations&) = delete;
+  scoped_forbid_allocations& operator=(scoped_forbid_allocations&&)      = delete;
+};
+
+/// Returns the total number of forbidden allocations detected since application start, including events that were
+/// overwritten in the ring before being read.
+uint64_t get_nof_forbidden_alloc_events();
+
+/// \brief Drains recorded forbidden allocation events into \c out.
+/// \return Number of events written to \c out.
+unsigned pop_forbidden_alloc_events(span<forbidden_alloc_event> out);
+
+} // namespace srsran
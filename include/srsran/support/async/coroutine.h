@@ -23,6 +23,7 @@
 #pragma once
 
 #include "awaiter_memory_storage.h"
+#include "srsran/support/async/detail/coro_frame_recycler.h"
 #include "srsran/support/async/detail/function_signature.h"
 #include "srsran/support/compiler.h"
 #include "srsran/support/srsran_assert.h"
@@ -198,6 +199,14 @@ struct coro_frame : public base_coro_frame<detail::promise_of<FunT>> {
     new (&task_storage) FunT(std::forward<Args>(args)...);
   }
 
+  /// Coroutine frames are allocated and freed through the thread-local frame recycler, so that repeated procedure
+  /// launches reuse previously released frames instead of hitting the global allocator.
+  void* operator new(std::size_t sz) { return coro_frame_recycler::get_thread_instance().allocate(sz); }
+  void  operator delete(void* p, std::size_t sz) noexcept
+  {
+    coro_frame_recycler::get_thread_instance().deallocate(p, sz);
+  }
+
   /// Resume coroutine from last suspended point
   void resume() final { (*get_impl())(*this); }
 
@@ -0,0 +1,143 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/adt/static_vector.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace srsran {
+namespace detail {
+
+/// \brief Thread-local recycler of coroutine frame memory.
+///
+/// Async procedures allocate one coroutine frame per launch, and a given application only instantiates a small set of
+/// coroutine types, each with a fixed frame size. Instead of going through the global allocator on every procedure
+/// start, freed frames are kept in thread-local free lists bucketed by power-of-two size class and handed back to
+/// subsequent launches, making the frame allocation cost constant in the steady state.
+///
+/// A frame may be released in a different thread than the one where it was allocated (e.g. when a procedure finishes
+/// in another execution context). In that case, the memory block simply migrates to the releasing thread's cache.
+class coro_frame_recycler
+{
+public:
+  coro_frame_recycler()                                      = default;
+  coro_frame_recycler(const coro_frame_recycler&)            = delete;
+  coro_frame_recycler& operator=(const coro_frame_recycler&) = delete;
+
+  ~coro_frame_recycler()
+  {
+    for (auto& free_list : free_lists) {
+      for (void* block : free_list) {
+        ::operator delete(block);
+      }
+    }
+  }
+
+  /// Statistics on the coroutine frame allocations served by this thread.
+  struct stats_t {
+    /// Total number of frame allocations.
+    uint64_t nof_allocs = 0;
+    /// Number of frame allocations that fell through to the global allocator.
+    uint64_t nof_heap_allocs = 0;
+    /// Total number of frame bytes requested.
+    uint64_t nof_alloc_bytes = 0;
+  };
+
+  /// Allocates memory for a coroutine frame of size \c sz, reusing a previously released frame when possible.
+  void* allocate(std::size_t sz)
+  {
+    ++stats.nof_allocs;
+    stats.nof_alloc_bytes += sz;
+    const std::size_t idx = size_class_index(sz);
+    if (idx < nof_size_classes) {
+      if (not free_lists[idx].empty()) {
+        void* block = free_lists[idx].back();
+        free_lists[idx].pop_back();
+        return block;
+      }
+      // Allocate the full size class, so that the block is reusable by any frame of the same class.
+      ++stats.nof_heap_allocs;
+      return ::operator new(size_class(idx));
+    }
+    ++stats.nof_heap_allocs;
+    return ::operator new(sz);
+  }
+
+  /// Releases the memory of a coroutine frame of size \c sz, caching it for reuse if there is space left.
+  void deallocate(void* block, std::size_t sz) noexcept
+  {
+    const std::size_t idx = size_class_index(sz);
+    if (idx < nof_size_classes and free_lists[idx].size() < max_cached_blocks) {
+      free_lists[idx].push_back(block);
+      return;
+    }
+    ::operator delete(block);
+  }
+
+  /// Retrieves the frame allocation statistics of the calling thread.
+  const stats_t& get_stats() const { return stats; }
+
+  /// Retrieves the recycler instance of the calling thread.
+  static coro_frame_recycler& get_thread_instance()
+  {
+    thread_local coro_frame_recycler instance;
+    return instance;
+  }
+
+private:
+  /// Smallest cached size class, in bytes.
+  static constexpr std::size_t min_block_size = 64;
+  /// Largest cached size class, in bytes. Larger frames fall back to the global allocator.
+  static constexpr std::size_t max_block_size = 8192;
+  /// Number of power-of-two size classes between \c min_block_size and \c max_block_size.
+  static constexpr std::size_t nof_size_classes = 8;
+  /// Maximum number of free blocks cached per size class.
+  static constexpr std::size_t max_cached_blocks = 64;
+
+  static_assert(min_block_size << (nof_size_classes - 1) == max_block_size, "Invalid size class parameters");
+
+  /// Number of bytes of the size class with index \c idx.
+  static constexpr std::size_t size_class(std::size_t idx) { return min_block_size << idx; }
+
+  /// \brief Index of the smallest size class that fits \c sz bytes.
+  ///
+  /// Returns \c nof_size_classes if \c sz exceeds \c max_block_size.
+  static std::size_t size_class_index(std::size_t sz)
+  {
+    std::size_t idx = 0;
+    while (idx < nof_size_classes and size_class(idx) < sz) {
+      ++idx;
+    }
+    return idx;
+  }
+
+  /// Per-size-class lists of free memory blocks.
+  std::array<static_vector<void*, max_cached_blocks>, nof_size_classes> free_lists;
+  /// Frame allocation statistics of this thread.
+  stats_t stats;
+};
+
+} // namespace detail
+} // namespace srsran
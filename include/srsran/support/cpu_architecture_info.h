@@ -48,6 +48,8 @@ class cpu_architecture_info
     std::vector<bounded_bitset<1024>> node_cpus;
     /// Lists of logical CPUs belonging to each physical CPU.
     std::vector<bounded_bitset<1024>> logical_cpu_lists;
+    /// Lists of CPUs sharing each last-level cache (LLC) domain, e.g. one per core complex on AMD EPYC.
+    std::vector<bounded_bitset<1024>> llc_cpu_lists;
   };
 
   /// Discovers CPU architecture at the application start-up.
@@ -88,6 +90,12 @@ public:
   /// Returns CPUs of the given NUMA node.
   bounded_bitset<1024> get_node_cpu_mask(unsigned node_id) const;
 
+  /// Get the number of last-level cache domains discovered in the given host.
+  size_t get_nof_llc_domains() const { return cpu_desc.llc_cpu_lists.size(); }
+
+  /// Returns CPUs sharing the given last-level cache domain.
+  bounded_bitset<1024> get_llc_cpu_mask(unsigned llc_id) const;
+
   /// Run calling thread and its children and allocate memory on the given NUMA node.
   bool run_on_numa_node(unsigned node_id) const;
 };
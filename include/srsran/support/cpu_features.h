@@ -66,6 +66,8 @@ enum class cpu_feature {
   neon,
   /// CPU supports carry-less multiplication instruction PMULL.
   pmull,
+  /// CPU supports the Scalable Vector Extension (SVE).
+  sve,
 #endif // __aarch64__
 };
 
@@ -101,6 +103,8 @@ constexpr const char* to_string(cpu_feature feature)
       return "neon";
     case cpu_feature::pmull:
       return "pmull";
+    case cpu_feature::sve:
+      return "sve";
 #endif // __aarch64__
   }
   return "invalid_cpu_feature";
@@ -144,6 +148,10 @@ inline bool cpu_supports_feature(cpu_feature feature)
 #endif // __ARM_NEON
     case cpu_feature::pmull:
       return getauxval(AT_HWCAP) & HWCAP_PMULL;
+#ifdef HWCAP_SVE
+    case cpu_feature::sve:
+      return getauxval(AT_HWCAP) & HWCAP_SVE;
+#endif // HWCAP_SVE
 #endif // __aarch64__
     default:
       return false;
@@ -40,6 +40,18 @@ using trace_clock    = std::chrono::steady_clock;
 using trace_point    = trace_clock::time_point;
 using trace_duration = std::chrono::microseconds;
 
+/// \brief Categories used to group trace events that are typically enabled/disabled together.
+/// \remark Each category maps to one bit of a global runtime bitmask, so tracers can check whether they are muted
+/// with a single relaxed atomic load.
+enum class trace_category : unsigned { common, l1, l2, up, ofh, ru };
+
+/// \brief Enable or disable at runtime the writing of trace events of the given category. All categories start
+/// enabled.
+void set_trace_category_enabled(trace_category cat, bool enabled);
+
+/// Check whether trace events of the given category are currently being written.
+bool is_trace_category_enabled(trace_category cat);
+
 /// Open a file to write trace events to.
 void open_trace_file(std::string_view trace_file_name = "/tmp/srsran_trace.json");
 
@@ -99,10 +111,16 @@ public:
 } // namespace detail
 
 /// \brief Class that writes trace events to a dedicated trace file.
+///
+/// Events are filtered in two tiers: instantiations with \c Enabled set to false are compiled out altogether, while
+/// enabled tracers can still be silenced at runtime via \ref set_trace_category_enabled.
 template <bool Enabled = true>
 class file_event_tracer
 {
 public:
+  constexpr file_event_tracer() = default;
+  constexpr explicit file_event_tracer(trace_category cat_) : cat(cat_) {}
+
   static trace_point now() { return trace_clock::now(); }
 
   void operator<<(const trace_event& event) const;
@@ -110,12 +128,22 @@ public:
   void operator<<(const trace_thres_event& event) const;
 
   void operator<<(const instant_trace_event& event) const;
+
+private:
+  /// Checks whether the tracer category is enabled at runtime.
+  bool is_enabled() const;
+
+  /// Category used to filter the written events at runtime.
+  trace_category cat = trace_category::common;
 };
 
 /// Specialization of file_event_tracer that does not write any events.
 template <>
 class file_event_tracer<false> : public detail::null_event_tracer
 {
+public:
+  constexpr file_event_tracer() = default;
+  constexpr explicit file_event_tracer(trace_category /**/) {}
 };
 
 /// Class that repurposes a log channel to write trace events.
@@ -86,25 +86,63 @@ private:
 ///
 /// The prioritization is achieved via multiple queues. The pop functions will always start with the highest priority
 /// queue until it is depleted, and then move to the second highest priority queue, and so on.
+///
+/// Tasks that are bound to a slot (e.g. FAPI slot indications, OFH symbol transmissions) can additionally carry a
+/// deadline. Deadline-tagged tasks that only get to run after their deadline has expired are discarded without being
+/// executed, so that no cycles are wasted computing results that arrive too late to be transmitted. A handler can be
+/// registered to account for or log such discarded tasks.
 class priority_task_queue
 {
 public:
+  /// Point in time after which a deadline-tagged task is no longer worth executing.
+  using task_deadline = std::chrono::steady_clock::time_point;
+
   priority_task_queue(span<const concurrent_queue_params> queues, std::chrono::microseconds wait_if_empty);
 
   /// Interrupt all blocking popping/pushing operations for this queue.
   void request_stop();
 
+  /// \brief Register a callback invoked, in the context of the popping thread, whenever a deadline-tagged task is
+  /// discarded because its deadline expired before the task got to run. Must be set before tasks start being popped.
+  void set_missed_deadline_handler(std::function<void(task_priority)> handler)
+  {
+    missed_deadline_handler = std::move(handler);
+  }
+
   /// Dispatch a task to be run. If the internal queue associated with the priority level is full, block caller.
   /// Return false, if the queue has been closed.
   bool push_blocking(task_priority prio, unique_task task);
 
+  /// \brief Dispatch a task to be run before the given deadline. If the task only gets to run after \c deadline, it is
+  /// discarded instead, and the missed deadline handler, if any, is called. If the internal queue associated with the
+  /// priority level is full, block caller.
+  /// Return false, if the queue has been closed.
+  bool push_blocking(task_priority prio, task_deadline deadline, unique_task task)
+  {
+    return push_blocking(prio, make_deadline_task(prio, deadline, std::move(task)));
+  }
+
   /// Dispatch a task to be run. If the internal queue associated with the priority level is full, drop the task and
   /// return false.
   SRSRAN_NODISCARD bool try_push(task_priority prio, unique_task task);
 
+  /// \brief Dispatch a task to be run before the given deadline. If the task only gets to run after \c deadline, it is
+  /// discarded instead, and the missed deadline handler, if any, is called. If the internal queue associated with the
+  /// priority level is full, drop the task and return false.
+  SRSRAN_NODISCARD bool try_push(task_priority prio, task_deadline deadline, unique_task task)
+  {
+    return try_push(prio, make_deadline_task(prio, deadline, std::move(task)));
+  }
+
   /// \brief Pop a pending task, considering its priority level. If the queues are empty, return false.
   SRSRAN_NODISCARD bool try_pop(unique_task& t);
 
+  /// \brief Pop up to \c tasks.size() pending tasks in a single scan over the priority levels.
+  ///
+  /// The batch is composed in priority order: the highest priority queue is drained first, and lower priority queues
+  /// are only visited once the higher ones are empty. Returns the number of tasks popped.
+  SRSRAN_NODISCARD unsigned try_pop_bulk(span<unique_task> tasks);
+
   /// \brief Pop a pending task, considering its priority level. If the queues are empty, this call blocks.
   /// If the queues are stopped, this function returns false.
   bool pop_blocking(unique_task& t);
@@ -122,10 +160,15 @@ private:
     return detail::enqueue_priority_to_queue_index(prio, queues.size());
   }
 
+  /// Wraps a task so that, when popped, it only runs if its deadline has not expired yet.
+  unique_task make_deadline_task(task_priority prio, task_deadline deadline, unique_task task);
+
   std::chrono::microseconds wait_on_empty;
 
   std::vector<any_task_concurrent_queue> queues;
 
+  std::function<void(task_priority)> missed_deadline_handler;
+
   std::atomic<bool> running{true};
 };
 
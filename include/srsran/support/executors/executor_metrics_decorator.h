@@ -0,0 +1,184 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/adt/bounded_bitset.h"
+#include "srsran/support/executors/task_executor.h"
+#include <atomic>
+#include <chrono>
+
+namespace srsran {
+
+/// \brief Lock-free recorder of the task latencies of a single executor.
+///
+/// Two latency distributions are tracked: the time tasks spend enqueued between dispatch and start of execution, and
+/// the time spent executing them. Samples are accumulated into logarithmic bins (bin \c i counts latencies in
+/// [2^i, 2^{i+1}) nanoseconds), so recording a sample amounts to a leading-zero count and three relaxed atomic
+/// updates. Timestamps are taken with \c steady_clock, which on Linux/x86 reads the TSC through the vDSO without
+/// entering the kernel.
+class executor_metrics_recorder
+{
+public:
+  /// Number of logarithmic bins of each latency histogram. The last bin accumulates all larger samples.
+  static constexpr unsigned nof_bins = 32;
+
+  /// Snapshot of one of the latency distributions accumulated by the recorder.
+  struct latency_snapshot {
+    /// Number of recorded samples.
+    uint64_t nof_samples = 0;
+    /// Average latency across the recorded samples.
+    std::chrono::nanoseconds average{0};
+    /// Maximum latency across the recorded samples.
+    std::chrono::nanoseconds maximum{0};
+    /// Histogram of latencies. Bin \c i counts samples in [2^i, 2^{i+1}) nanoseconds.
+    std::array<uint64_t, nof_bins> bins{};
+  };
+
+  /// Snapshot of all the metrics accumulated by the recorder.
+  struct metrics {
+    /// Distribution of the time between task dispatch and start of task execution.
+    latency_snapshot enqueue_latency;
+    /// Distribution of the time between start and completion of task execution.
+    latency_snapshot execution_latency;
+  };
+
+  /// Latency histogram that can be concurrently updated by several workers.
+  class latency_histogram
+  {
+  public:
+    /// Record a new latency sample.
+    void record(std::chrono::nanoseconds latency)
+    {
+      const uint64_t ns = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+      const unsigned bin =
+          std::min(nof_bins - 1U,
+                   63U - static_cast<unsigned>(detail::bitset_builtin_helper<uint64_t>::zero_msb_count(ns | 1U)));
+      bins[bin].fetch_add(1, std::memory_order_relaxed);
+      sum_ns.fetch_add(ns, std::memory_order_relaxed);
+      uint64_t prev_max = max_ns.load(std::memory_order_relaxed);
+      while (ns > prev_max and not max_ns.compare_exchange_weak(prev_max, ns, std::memory_order_relaxed)) {
+      }
+    }
+
+    /// Collect a snapshot of the histogram and reset the accumulated samples.
+    latency_snapshot collect()
+    {
+      latency_snapshot result;
+      for (unsigned i = 0; i != nof_bins; ++i) {
+        result.bins[i] = bins[i].exchange(0, std::memory_order_relaxed);
+        result.nof_samples += result.bins[i];
+      }
+      const uint64_t sum = sum_ns.exchange(0, std::memory_order_relaxed);
+      result.average     = std::chrono::nanoseconds{result.nof_samples > 0 ? sum / result.nof_samples : 0};
+      result.maximum     = std::chrono::nanoseconds{max_ns.exchange(0, std::memory_order_relaxed)};
+      return result;
+    }
+
+  private:
+    std::array<std::atomic<uint64_t>, nof_bins> bins{};
+    std::atomic<uint64_t>                       sum_ns{0};
+    std::atomic<uint64_t>                       max_ns{0};
+  };
+
+  /// Collect a snapshot of the metrics accumulated since the last call to this method.
+  metrics collect() { return metrics{enqueue_latency.collect(), execution_latency.collect()}; }
+
+  /// Distribution of the time between task dispatch and start of task execution.
+  latency_histogram enqueue_latency;
+  /// Distribution of the time between start and completion of task execution.
+  latency_histogram execution_latency;
+};
+
+/// \brief A task executor decorator that records the enqueue-to-start and start-to-finish latencies of the dispatched
+/// tasks in an \c executor_metrics_recorder.
+///
+/// The decorator is only instantiated for executors with metrics enabled, so executors without metrics pay no
+/// overhead at all.
+template <typename Exec>
+class executor_metrics_decorator final : public task_executor
+{
+public:
+  template <typename ExecType>
+  executor_metrics_decorator(ExecType&& exec_, executor_metrics_recorder& recorder_) :
+    exec(std::forward<ExecType>(exec_)), recorder(recorder_)
+  {
+  }
+
+  bool execute(unique_task task) override
+  {
+    auto enqueue_tp = std::chrono::steady_clock::now();
+    return get(exec).execute([this, task = std::move(task), enqueue_tp]() mutable {
+      auto start_tp = std::chrono::steady_clock::now();
+      recorder.enqueue_latency.record(start_tp - enqueue_tp);
+      task();
+      recorder.execution_latency.record(std::chrono::steady_clock::now() - start_tp);
+    });
+  }
+
+  bool defer(unique_task task) override
+  {
+    auto enqueue_tp = std::chrono::steady_clock::now();
+    return get(exec).defer([this, task = std::move(task), enqueue_tp]() mutable {
+      auto start_tp = std::chrono::steady_clock::now();
+      recorder.enqueue_latency.record(start_tp - enqueue_tp);
+      task();
+      recorder.execution_latency.record(std::chrono::steady_clock::now() - start_tp);
+    });
+  }
+
+private:
+  template <typename U>
+  U& get(U* u)
+  {
+    return *u;
+  }
+
+  template <typename U>
+  U& get(std::unique_ptr<U>& u)
+  {
+    return *u;
+  }
+
+  template <typename U>
+  U& get(U& u)
+  {
+    return u;
+  }
+
+  Exec                       exec;
+  executor_metrics_recorder& recorder;
+};
+
+template <typename Exec>
+executor_metrics_decorator<Exec> make_metrics_executor(Exec&& exec, executor_metrics_recorder& recorder)
+{
+  return executor_metrics_decorator<Exec>(std::forward<Exec>(exec), recorder);
+}
+
+template <typename Exec>
+std::unique_ptr<task_executor> make_metrics_executor_ptr(Exec&& exec, executor_metrics_recorder& recorder)
+{
+  return std::make_unique<executor_metrics_decorator<Exec>>(std::forward<Exec>(exec), recorder);
+}
+
+} // namespace srsran
@@ -25,6 +25,7 @@
 #include "unique_thread.h"
 #include "srsran/adt/concurrent_queue.h"
 #include "srsran/adt/optional.h"
+#include "srsran/support/executors/executor_metrics_decorator.h"
 #include "srsran/support/executors/task_executor.h"
 #include <unordered_map>
 #include <variant>
@@ -71,6 +72,9 @@ struct executor {
   /// \brief Whether to make an executor synchronous. If true, the executor will be blocking, until the pushed task is
   /// fully executed. This will have a negative impact on performance, but can be useful for debugging.
   bool synchronous = false;
+  /// \brief Whether to record latency metrics (enqueue-to-start and start-to-finish histograms) for this executor.
+  /// The accumulated metrics can be collected on demand via \c task_execution_manager::collect_executor_metrics.
+  bool report_metrics = false;
 
   executor(const std::string&         name_,
            const std::vector<strand>& strands_           = {},
@@ -130,6 +134,9 @@ struct worker_pool {
   std::vector<os_sched_affinity_bitmask> masks;
   /// Non null in case tracing of the worker executors is enabled.
   file_event_tracer<true>* tracer = nullptr;
+  /// \brief Whether the workers of the pool use separate task queues with work stealing, instead of a single shared
+  /// task queue. Only supported for non-prioritized pools with a single lockfree queue.
+  bool work_stealing = false;
 };
 
 /// Arguments for the creation of a priority multiqueue worker.
@@ -167,6 +174,10 @@ public:
 
   /// Executors instantiated in this execution context.
   virtual std::vector<std::pair<std::string, task_executor*>> executors() const = 0;
+
+  /// \brief Collect a snapshot of the latency metrics of the executors of this context that have metrics enabled,
+  /// resetting the accumulated samples.
+  virtual std::vector<std::pair<std::string, executor_metrics_recorder::metrics>> collect_metrics() = 0;
 };
 
 /// Create a single worker execution context.
@@ -197,6 +208,10 @@ public:
   /// Returns a table of all executors stored in the repository.
   SRSRAN_NODISCARD const executor_table& executors() const { return executor_list; }
 
+  /// \brief Collect a snapshot of the latency metrics of all executors with metrics enabled, across all execution
+  /// contexts, resetting the accumulated samples.
+  std::vector<std::pair<std::string, executor_metrics_recorder::metrics>> collect_executor_metrics();
+
 private:
   srslog::basic_logger& logger;
 
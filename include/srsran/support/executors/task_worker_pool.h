@@ -103,6 +103,33 @@ protected:
       queue;
 };
 
+/// Set of per-worker task queues used by the work-stealing worker pool. Kept in a separate base class so that the
+/// queues outlive the worker threads spawned by \c base_worker_pool.
+class base_work_stealing_task_queues
+{
+protected:
+  using worker_queue =
+      concurrent_queue<unique_task, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::sleep>;
+
+  base_work_stealing_task_queues(unsigned nof_queues, size_t qsize, std::chrono::microseconds wait_sleep_time) :
+    sleep_time(wait_sleep_time)
+  {
+    queues.reserve(nof_queues);
+    for (unsigned i = 0; i != nof_queues; ++i) {
+      queues.push_back(std::make_unique<worker_queue>(qsize, wait_sleep_time));
+    }
+  }
+
+  // One queue per worker of the pool.
+  std::vector<std::unique_ptr<worker_queue>> queues;
+  // Round-robin counter used to spread tasks pushed from outside the pool.
+  std::atomic<uint32_t> rr_count{0};
+  // Time a worker sleeps when it finds no pending task in any of the queues.
+  std::chrono::microseconds sleep_time;
+  // Whether the pool is accepting and processing new tasks.
+  std::atomic<bool> running{true};
+};
+
 } // namespace detail
 
 class priority_task_worker_pool : public detail::base_priority_task_queue, public detail::base_worker_pool
@@ -143,6 +170,25 @@ public:
     return queue.push_blocking(prio, std::move(task));
   }
 
+  /// \brief Push a new slot-bound task to be processed by the worker pool before the given deadline. If the task only
+  /// gets to run after the deadline, it is discarded without being executed. If the task queue is full, it skips the
+  /// task and returns false.
+  /// \param prio Priority of the dispatched task.
+  /// \param deadline Point in time after which the task is no longer worth executing.
+  /// \param task Task to be run in the thread pool.
+  /// \return True if task was successfully enqueued to be processed. False, if task queue is full.
+  SRSRAN_NODISCARD bool push_task(enqueue_priority prio, detail::priority_task_queue::task_deadline deadline, unique_task task)
+  {
+    return queue.try_push(prio, deadline, std::move(task));
+  }
+
+  /// \brief Register a callback invoked whenever a deadline-tagged task is discarded because its deadline expired
+  /// before the task got to run. Must be set before tasks start being pushed.
+  void set_missed_deadline_handler(std::function<void(enqueue_priority)> handler)
+  {
+    queue.set_missed_deadline_handler(std::move(handler));
+  }
+
   /// Stop task worker pool, if running.
   void stop();
 
@@ -204,6 +250,64 @@ public:
 extern template class task_worker_pool<concurrent_queue_policy::lockfree_mpmc>;
 extern template class task_worker_pool<concurrent_queue_policy::locking_mpmc>;
 
+/// \brief Pool of task workers where each worker owns a separate task queue and steals tasks from the queues of other
+/// workers when its own queue runs dry.
+///
+/// Unlike \c task_worker_pool, producers do not contend on a single shared queue head: tasks pushed from within the
+/// pool go to the queue of the calling worker, while tasks pushed from outside are spread round-robin across the
+/// per-worker queues. Stealing only happens on imbalance, which keeps cache-line bouncing between workers low when
+/// all of them are busy.
+class work_stealing_task_worker_pool : public detail::base_work_stealing_task_queues, public detail::base_worker_pool
+{
+public:
+  /// \brief Creates a work-stealing task worker pool.
+  /// \param worker_pool_name String with the name for the worker pool. Individual workers of the pool will be assigned
+  /// the name "<worker_pool_name>#<worker index>". E.g. for pool_name="Pool", the second worker will be called
+  /// "Pool#1".
+  /// \param nof_workers_ Number of workers of the worker pool.
+  /// \param qsize_ Size of each per-worker task queue.
+  /// \param wait_sleep_time Time each worker sleeps when neither its own queue nor the queues of other workers have
+  /// pending tasks.
+  /// \param prio Workers realtime thread priority.
+  /// \param cpu_masks A list of CPU indexes to which the threads of the worker pool get pinned to.
+  work_stealing_task_worker_pool(std::string                           worker_pool_name,
+                                 unsigned                              nof_workers_,
+                                 unsigned                              qsize_,
+                                 std::chrono::microseconds             wait_sleep_time = std::chrono::microseconds{100},
+                                 os_thread_realtime_priority           prio = os_thread_realtime_priority::no_realtime(),
+                                 span<const os_sched_affinity_bitmask> cpu_masks = {});
+  ~work_stealing_task_worker_pool();
+
+  /// \brief Push a new task to be processed by the worker pool. If the destination task queue is full, it skips the
+  /// task and returns false.
+  /// \param task Task to be run in the thread pool.
+  /// \return True if task was successfully enqueued to be processed. False, if task queue is full.
+  SRSRAN_NODISCARD bool push_task(unique_task task);
+
+  /// \brief Push a new task to be processed by the worker pool. If the destination task queue is full, blocks.
+  /// \param task Task to be run in the thread pool.
+  bool push_task_blocking(unique_task task);
+
+  /// Stop task worker pool, if running.
+  void stop();
+
+  /// \brief Number of tasks currently enqueued across all per-worker queues.
+  unsigned nof_pending_tasks() const;
+
+  /// \brief Maximum number of jobs that can be pending in a single per-worker queue.
+  size_t capacity() const { return queues.front()->capacity(); }
+
+  /// \brief Wait for all the currently enqueued tasks to complete. If more tasks get enqueued after this function call
+  /// those tasks are not accounted for in the waiting.
+  void wait_pending_tasks();
+
+private:
+  std::function<void()> create_worker_task(unsigned worker_idx);
+
+  /// Selects the queue to which a new task gets pushed.
+  unsigned next_queue_index();
+};
+
 template <concurrent_queue_policy QueuePolicy>
 class task_worker_pool_executor final : public task_executor
 {
@@ -241,6 +345,36 @@ std::unique_ptr<task_executor> make_task_worker_pool_executor_ptr(task_worker_po
   return std::make_unique<task_worker_pool_executor<QueuePolicy>>(worker);
 }
 
+/// \brief Task executor that pushes tasks to a \c work_stealing_task_worker_pool.
+class work_stealing_task_worker_pool_executor final : public task_executor
+{
+public:
+  work_stealing_task_worker_pool_executor() = default;
+  work_stealing_task_worker_pool_executor(work_stealing_task_worker_pool& worker_pool_) : worker_pool(&worker_pool_) {}
+
+  SRSRAN_NODISCARD bool execute(unique_task task) override { return worker_pool->push_task(std::move(task)); }
+
+  SRSRAN_NODISCARD bool defer(unique_task task) override { return worker_pool->push_task(std::move(task)); }
+
+  /// Determine whether the caller is in one of the threads of the worker pool.
+  bool can_run_task_inline() const { return worker_pool->is_in_thread_pool(); }
+
+private:
+  work_stealing_task_worker_pool* worker_pool = nullptr;
+};
+
+/// \brief Create task executor for \c work_stealing_task_worker_pool.
+inline auto make_work_stealing_task_worker_pool_executor(work_stealing_task_worker_pool& worker)
+{
+  return work_stealing_task_worker_pool_executor(worker);
+}
+
+/// \brief Create general task executor pointer for \c work_stealing_task_worker_pool.
+inline std::unique_ptr<task_executor> make_work_stealing_task_worker_pool_executor_ptr(work_stealing_task_worker_pool& worker)
+{
+  return std::make_unique<work_stealing_task_worker_pool_executor>(worker);
+}
+
 /// \brief Task executor that pushes tasks to worker pool with a given priority.
 class priority_task_worker_pool_executor final : public task_executor
 {
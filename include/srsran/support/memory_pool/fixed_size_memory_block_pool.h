@@ -30,6 +30,7 @@
 #include "memory_block_list.h"
 #include "srsran/adt/static_vector.h"
 #include "srsran/support/error_handling.h"
+#include "srsran/support/memory_pool/prefaulted_memory_arena.h"
 #include "srsran/support/srsran_assert.h"
 #include <mutex>
 #include <thread>
@@ -95,7 +96,8 @@ class fixed_size_memory_block_pool
     max_local_batches(
         std::max(std::min((size_t)MAX_LOCAL_BATCH_CAPACITY, static_cast<size_t>(nof_blocks / block_batch_size / 32U)),
                  static_cast<size_t>(2U))),
-    // Allocate the required memory for the given number of segments and segment size.
+    // Allocate the required memory for the given number of segments and segment size. The arena is huge-page backed
+    // (when available) and pre-faulted, so that block accesses take no page faults and fewer TLB misses.
     allocated_memory(mblock_size * nof_blocks),
     // Pre-reserve space in the central cache to hold all batches and avoid reallocations.
     central_mem_cache(nof_total_batches() + OVER_DIM_CENTRAL_CACHE)
@@ -349,7 +351,7 @@ private:
   const size_t nof_blocks;
   const size_t max_local_batches;
 
-  std::vector<uint8_t> allocated_memory;
+  prefaulted_memory_arena allocated_memory;
 
   moodycamel::ConcurrentQueue<free_memory_block_list> central_mem_cache;
 
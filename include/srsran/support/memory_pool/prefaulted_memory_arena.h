@@ -0,0 +1,72 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/support/error_handling.h"
+#include <cstdint>
+#include <cstring>
+#include <sys/mman.h>
+
+namespace srsran {
+
+/// \brief Contiguous memory arena that is huge-page backed (when available) and pre-faulted at construction.
+///
+/// The arena requests transparent huge pages via madvise(MADV_HUGEPAGE) to reduce TLB pressure when the memory is
+/// accessed on fast paths, and touches every page upfront so that no page faults are taken once the arena is in use.
+/// If huge pages are not available, the advice is silently ignored by the kernel and the arena degrades to regular
+/// pages, still pre-faulted.
+class prefaulted_memory_arena
+{
+  /// Size of a transparent huge page in most Linux configurations. Used only as alignment/rounding hint.
+  static constexpr size_t huge_page_size = 2UL * 1024 * 1024;
+
+public:
+  explicit prefaulted_memory_arena(size_t sz_) : sz(sz_)
+  {
+    // Round the mapping up to a whole number of huge pages, so that the whole arena is eligible for huge-page backing.
+    map_len    = ((sz + huge_page_size - 1) / huge_page_size) * huge_page_size;
+    void* addr = ::mmap(nullptr, map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    report_fatal_error_if_not(addr != MAP_FAILED, "Failed to allocate memory arena of {} bytes", map_len);
+    mem = static_cast<uint8_t*>(addr);
+
+    // Best effort: ask for transparent huge pages. Not fatal if the kernel does not support it.
+    ::madvise(mem, map_len, MADV_HUGEPAGE);
+
+    // Pre-fault all pages, so that no page faults (and no huge-page collapses) happen on the fast path.
+    std::memset(mem, 0, map_len);
+  }
+  prefaulted_memory_arena(const prefaulted_memory_arena&)            = delete;
+  prefaulted_memory_arena& operator=(const prefaulted_memory_arena&) = delete;
+  ~prefaulted_memory_arena() { ::munmap(mem, map_len); }
+
+  uint8_t*       data() { return mem; }
+  const uint8_t* data() const { return mem; }
+  size_t         size() const { return sz; }
+
+private:
+  size_t   sz;
+  size_t   map_len;
+  uint8_t* mem = nullptr;
+};
+
+} // namespace srsran
@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/support/memory_pool/linear_memory_allocator.h"
+#include "srsran/support/memory_pool/prefaulted_memory_arena.h"
+#include "srsran/support/srsran_assert.h"
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace srsran {
+
+/// \brief Bump arena for scratch memory whose lifetime ends at the next slot boundary.
+///
+/// The arena hands out memory via simple pointer bumps and reclaims all of it collectively when \c reset() is called at
+/// the slot boundary, so slot-scoped code can take variable-sized scratch buffers without paying for heap allocations
+/// on the critical path. Allocations are attributed to a \c client subsystem, and the arena keeps a high-water mark of
+/// the bytes each subsystem drew within a single slot, which can be used to validate the arena sizing.
+///
+/// \remark This class is not thread-safe. One arena should be used per cell and accessed only from the thread that
+/// processes the cell slot indications.
+class slot_arena
+{
+public:
+  /// Subsystems that draw slot-lifetime scratch from the arena, used to attribute memory usage.
+  enum class client : unsigned { scheduler, fapi, mac_assembly, other, count };
+
+  explicit slot_arena(std::size_t sz) : backing(sz), alloc(backing.data(), backing.size()) {}
+
+  /// \brief Standard allocator adaptor over the slot arena.
+  ///
+  /// Deallocation is a no-op; the memory is reclaimed collectively on the next \c slot_arena::reset(). This allows
+  /// standard containers (e.g. std::vector) to be used as slot-lifetime scratch, as long as they do not outlive the
+  /// slot boundary.
+  template <typename T>
+  class allocator
+  {
+  public:
+    using value_type = T;
+
+    allocator(slot_arena& arena_, client cl_) noexcept : arena(&arena_), cl(cl_) {}
+    template <typename U>
+    allocator(const allocator<U>& other) noexcept : arena(other.arena), cl(other.cl)
+    {
+    }
+
+    T*   allocate(std::size_t n) { return static_cast<T*>(arena->allocate(cl, n * sizeof(T), alignof(T))); }
+    void deallocate(T* /**/, std::size_t /**/) noexcept {}
+
+    template <typename U>
+    bool operator==(const allocator<U>& other) const noexcept
+    {
+      return arena == other.arena;
+    }
+    template <typename U>
+    bool operator!=(const allocator<U>& other) const noexcept
+    {
+      return arena != other.arena;
+    }
+
+  private:
+    template <typename U>
+    friend class allocator;
+
+    slot_arena* arena;
+    client      cl;
+  };
+
+  /// \brief Allocates \c sz bytes with alignment \c al on behalf of the given client subsystem.
+  ///
+  /// The returned memory stays valid until the next \c reset() call. No per-allocation deallocation exists.
+  void* allocate(client cl, std::size_t sz, std::size_t al) noexcept
+  {
+    srsran_assert(alloc.nof_bytes_left() >= sz + al,
+                  "Slot arena exhausted (requested={} left={} arena_size={})",
+                  sz,
+                  alloc.nof_bytes_left(),
+                  backing.size());
+    cur_bytes[static_cast<unsigned>(cl)] += sz;
+    return alloc.allocate(sz, al);
+  }
+
+  /// Creates an allocator adaptor that attributes its allocations to the given client subsystem.
+  template <typename T>
+  allocator<T> make_allocator(client cl) noexcept
+  {
+    return allocator<T>(*this, cl);
+  }
+
+  /// \brief Discards all allocations made since the last call and updates the per-client high-water marks.
+  ///
+  /// Must be called at each slot boundary, before any slot-scoped code allocates scratch for the new slot.
+  void reset()
+  {
+    for (unsigned i = 0, e = static_cast<unsigned>(client::count); i != e; ++i) {
+      hwm_bytes[i] = std::max(hwm_bytes[i], cur_bytes[i]);
+      cur_bytes[i] = 0;
+    }
+    alloc = linear_memory_allocator(backing.data(), backing.size());
+  }
+
+  /// Number of bytes held by the arena.
+  std::size_t size() const { return backing.size(); }
+
+  /// Number of bytes allocated since the last \c reset() call.
+  std::size_t nof_bytes_allocated() const { return alloc.nof_bytes_allocated(); }
+
+  /// Maximum number of bytes the given client subsystem drew within a single slot.
+  std::size_t high_watermark(client cl) const
+  {
+    return std::max(hwm_bytes[static_cast<unsigned>(cl)], cur_bytes[static_cast<unsigned>(cl)]);
+  }
+
+private:
+  static constexpr unsigned nof_clients = static_cast<unsigned>(client::count);
+
+  prefaulted_memory_arena backing;
+  linear_memory_allocator alloc;
+
+  /// Bytes drawn by each client subsystem within the current slot, and the respective high-water marks.
+  std::array<std::size_t, nof_clients> cur_bytes = {};
+  std::array<std::size_t, nof_clients> hwm_bytes = {};
+};
+
+/// Vector whose storage is slot-lifetime scratch taken from a \c slot_arena.
+template <typename T>
+using slot_arena_vector = std::vector<T, slot_arena::allocator<T>>;
+
+} // namespace srsran
@@ -29,7 +29,6 @@
 #include "srsran/support/srsran_assert.h"
 #include <chrono>
 #include <deque>
-#include <mutex>
 #include <utility>
 #include <variant>
 
@@ -114,6 +113,9 @@ class timer_manager
     void stop();
   };
 
+  /// Event sent by the front-end to the back-end, which is either a timer command or a new timer creation.
+  using timer_cmd = std::variant<cmd_t, std::unique_ptr<timer_frontend>>;
+
   /// Timer context used solely by the back-end side of the timer manager.
   struct timer_backend_context {
     cmd_id_t cmd_id  = 0;
@@ -152,6 +154,7 @@ private:
   friend class unique_timer;
 
   class unique_timer_pool;
+  class cmd_queue;
 
   /// \brief Create a new front-end context to be used by a newly created unique_timer.
   timer_frontend& create_frontend_timer(task_executor& exec);
@@ -159,6 +162,9 @@ private:
   /// Push a new timer command (start, stop, destroy) from the front-end execution context to the backend.
   void push_timer_command(cmd_t cmd);
 
+  /// Process a single timer command in the back-end side.
+  void handle_timer_command(const cmd_t& cmd);
+
   /// Create a new timer_handle object in the timer manager back-end side and associate it with the provided frontend
   /// timer.
   void create_timer_handle(std::unique_ptr<timer_frontend> timer);
@@ -214,10 +220,17 @@ private:
   /// The timeout handling will be re-triggered in the next slot.
   std::deque<std::pair<timer_id_t, cmd_id_t>> failed_to_trigger_timers;
 
-  /// Commands sent by the timer front-end to the backend.
-  std::mutex                                                        cmd_mutex;
-  std::vector<std::variant<cmd_t, std::unique_ptr<timer_frontend>>> pending_cmds;
-  std::vector<std::variant<cmd_t, std::unique_ptr<timer_frontend>>> cmds_to_process;
+  /// \brief Commands sent by the timer front-ends to the backend. The queue is lock-free on the producer side, so
+  /// that arming/disarming timers from hot paths (e.g. RLC/PDCP) does not contend on a mutex with other bearers.
+  std::unique_ptr<cmd_queue> pending_cmds;
+
+  /// Scratch buffer where the backend drains pending commands in batch on every tick.
+  std::vector<timer_cmd> cmds_to_process;
+
+  /// \brief Commands that arrived at the backend before the creation event of their respective timer. This can happen
+  /// because commands pushed from different threads may be dequeued out of order. They are re-processed on the next
+  /// tick.
+  std::vector<cmd_t> postponed_cmds;
 };
 
 /// \brief This class represents a timer which invokes a user-provided callback upon timer expiration. To setup a
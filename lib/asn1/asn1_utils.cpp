@@ -129,32 +129,81 @@ int bit_ref::distance() const
   return 8 * (static_cast<int>(writer.length()) - (offset == 0 ? 0 : 1)) + offset;
 }
 
+namespace {
+
+/// \brief Appends a range of bytes to a writer whose last byte is partially packed.
+///
+/// Consecutive input bytes are combined into whole output bytes and appended in bulk chunks, instead of packing the
+/// input bit by bit. The writer bit offset is unchanged, as whole bytes are appended.
+template <typename ByteRange>
+bool pack_bytes_unaligned(srsran::byte_buffer_writer& writer, uint32_t offset, const ByteRange& bytes)
+{
+  const uint32_t          rem = 8U - offset;
+  std::array<uint8_t, 64> chunk;
+  uint32_t                chunk_len = 0;
+  uint8_t                 prev      = 0;
+  bool                    first     = true;
+
+  for (uint8_t byte : bytes) {
+    if (first) {
+      // The first input byte fills the remainder of the current partially packed byte.
+      writer.back() += static_cast<uint8_t>(byte >> offset);
+      first = false;
+    } else {
+      chunk[chunk_len++] = static_cast<uint8_t>(prev << rem) | static_cast<uint8_t>(byte >> offset);
+      if (chunk_len == chunk.size()) {
+        if (not writer.append(span<const uint8_t>(chunk.data(), chunk_len))) {
+          return false;
+        }
+        chunk_len = 0;
+      }
+    }
+    prev = byte;
+  }
+
+  // Append the trailing partially packed byte holding the last offset bits.
+  chunk[chunk_len++] = static_cast<uint8_t>(prev << rem);
+  return writer.append(span<const uint8_t>(chunk.data(), chunk_len));
+}
+
+} // namespace
+
 SRSASN_CODE bit_ref::pack(uint64_t val, uint32_t n_bits)
 {
   srsran_assert(n_bits < 64, "Invalid number of bits passed to pack()");
-  while (n_bits > 0) {
-    if (offset == 0) {
-      if (not writer.append(0)) {
-        return SRSASN_ERROR;
-      }
-    }
-    uint64_t mask = ((1ul << n_bits) - 1ul); // bitmap of n_bits ones.
-    val           = val & mask;
-    if (static_cast<uint32_t>(8U - offset) > n_bits) {
-      // in case n_bits < number of bits left in current byte (ie, last iteration).
-      auto shifted_val = static_cast<uint8_t>(val << (8u - offset - n_bits));
-      writer.back() += shifted_val;
+  if (n_bits == 0) {
+    return SRSASN_SUCCESS;
+  }
+
+  // bitmap of n_bits ones.
+  val &= (1ul << n_bits) - 1ul;
+
+  // Fill the remainder of the current partially packed byte.
+  if (offset != 0) {
+    uint32_t space = 8U - offset;
+    if (n_bits < space) {
+      writer.back() += static_cast<uint8_t>(val << (space - n_bits));
       offset += n_bits;
-      n_bits = 0;
-    } else {
-      // in case, space in current byte is lower or equal to n_bits (ie, not the last iteration).
-      auto shifted_val = static_cast<uint8_t>(val >> (n_bits - 8u + offset));
-      writer.back() += shifted_val;
-      n_bits -= 8U - offset;
-      offset = 0;
+      return SRSASN_SUCCESS;
+    }
+    writer.back() += static_cast<uint8_t>(val >> (n_bits - space));
+    n_bits -= space;
+    offset = 0;
+    if (n_bits == 0) {
+      return SRSASN_SUCCESS;
     }
   }
-  return SRSASN_SUCCESS;
+
+  // Pack the remaining bits, most significant first, with a single bulk append instead of one append per byte.
+  std::array<uint8_t, 8> bytes;
+  uint32_t               nof_bytes = (n_bits + 7U) / 8U;
+  for (uint32_t i = 0; i != nof_bytes; ++i) {
+    uint32_t rem_bits = n_bits - 8U * i;
+    bytes[i]          = (rem_bits >= 8U) ? static_cast<uint8_t>(val >> (rem_bits - 8U))
+                                         : static_cast<uint8_t>(val << (8U - rem_bits));
+  }
+  offset = n_bits % 8U;
+  return writer.append(span<const uint8_t>(bytes.data(), nof_bytes)) ? SRSASN_SUCCESS : SRSASN_ERROR;
 }
 
 SRSASN_CODE bit_ref::pack_bytes(srsran::span<const uint8_t> bytes)
@@ -166,9 +215,7 @@ SRSASN_CODE bit_ref::pack_bytes(srsran::span<const uint8_t> bytes)
     // Aligned case
     HANDLE_CODE(writer.append(bytes) ? SRSASN_SUCCESS : SRSASN_ERROR_ENCODE_FAIL);
   } else {
-    for (uint8_t byte : bytes) {
-      HANDLE_CODE(pack(byte, 8U));
-    }
+    HANDLE_CODE(pack_bytes_unaligned(writer, offset, bytes) ? SRSASN_SUCCESS : SRSASN_ERROR_ENCODE_FAIL);
   }
   return SRSASN_SUCCESS;
 }
@@ -182,9 +229,7 @@ SRSASN_CODE bit_ref::pack_bytes(srsran::byte_buffer_view bytes)
     // Aligned case.
     HANDLE_CODE(writer.append(bytes) ? SRSASN_SUCCESS : SRSASN_ERROR_ENCODE_FAIL);
   } else {
-    for (uint8_t byte : bytes) {
-      HANDLE_CODE(pack(byte, 8U));
-    }
+    HANDLE_CODE(pack_bytes_unaligned(writer, offset, bytes) ? SRSASN_SUCCESS : SRSASN_ERROR_ENCODE_FAIL);
   }
   return SRSASN_SUCCESS;
 }
@@ -27,6 +27,7 @@
 #include "srsran/cu_cp/cu_cp_configuration.h"
 #include "srsran/ngap/ngap.h"
 #include "srsran/ran/plmn_identity.h"
+#include <mutex>
 #include <thread>
 
 using namespace srsran;
@@ -27,6 +27,7 @@
 #include "srsran/cu_cp/cu_cp.h"
 #include "srsran/ran/plmn_identity.h"
 #include <future>
+#include <mutex>
 
 namespace srsran {
 namespace srs_cu_cp {
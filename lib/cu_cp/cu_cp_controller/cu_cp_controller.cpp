@@ -23,6 +23,7 @@
 #include "cu_cp_controller.h"
 #include "../cu_up_processor/cu_up_processor_repository.h"
 #include "../du_processor/du_processor_repository.h"
+#include <mutex>
 #include <thread>
 
 using namespace srsran;
@@ -29,6 +29,7 @@
 #include "du_connection_manager.h"
 #include "node_connection_notifier.h"
 #include "srsran/cu_cp/cu_cp_configuration.h"
+#include <mutex>
 
 namespace srsran {
 namespace srs_cu_cp {
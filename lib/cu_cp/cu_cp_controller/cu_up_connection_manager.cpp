@@ -25,6 +25,7 @@
 #include "common_task_scheduler.h"
 #include "srsran/e1ap/common/e1ap_message.h"
 #include "srsran/support/executors/sync_task_executor.h"
+#include <mutex>
 #include <thread>
 
 using namespace srsran;
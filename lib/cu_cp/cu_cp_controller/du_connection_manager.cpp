@@ -24,6 +24,7 @@
 #include "../du_processor/du_processor_repository.h"
 #include "srsran/f1ap/f1ap_message.h"
 #include "srsran/support/executors/sync_task_executor.h"
+#include <mutex>
 #include <thread>
 
 using namespace srsran;
@@ -24,6 +24,7 @@
 #include "srsran/srslog/srslog.h"
 #include "srsran/support/executors/sync_task_executor.h"
 #include "srsran/support/srsran_assert.h"
+#include <mutex>
 #include <thread>
 
 using namespace srsran;
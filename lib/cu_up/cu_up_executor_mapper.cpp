@@ -210,7 +210,9 @@ class strand_based_cu_up_executor_mapper final : public cu_up_executor_mapper
 {
 public:
   strand_based_cu_up_executor_mapper(const strand_based_executor_config& config) :
-    cu_up_strand(&config.worker_pool_executor, config.default_task_queue_size), cu_up_exec_pool(create_strands(config))
+    cu_up_strand(&config.worker_pool_executor, config.default_task_queue_size),
+    path_mgmt_strand(&cu_up_strand, path_mgmt_queue_size),
+    cu_up_exec_pool(create_strands(config))
   {
   }
 
@@ -220,6 +222,8 @@ public:
 
   task_executor& e2_executor() override { return cu_up_strand; }
 
+  task_executor& gtpu_path_mgmt_executor() override { return path_mgmt_strand; }
+
   std::unique_ptr<ue_executor_mapper> create_ue_executor_mapper() override
   {
     return cu_up_exec_pool.create_ue_executor_mapper();
@@ -263,9 +267,18 @@ private:
         cu_up_strand, ue_dl_execs, ue_ul_execs, ue_ctrl_execs, config.worker_pool_executor};
   }
 
+  /// \brief Size of the GTP-U path management task queue.
+  ///
+  /// Path management messages are sporadic in normal operation, so the queue is kept small on purpose: a peer flooding
+  /// echo requests overflows this queue and gets its messages dropped, without occupying user-plane queue slots.
+  static constexpr unsigned path_mgmt_queue_size = 64;
+
   // Base strand that sequentializes accesses to the worker pool executor.
   cu_up_strand_type cu_up_strand;
 
+  // Dedicated strand for GTP-U path management messages (echo request/response, error indication).
+  io_dedicated_strand_type path_mgmt_strand;
+
   // IO executor with two modes
   std::variant<inline_task_executor, io_dedicated_strand_type> io_ul_strand;
   task_executor*                                               io_ul_exec;
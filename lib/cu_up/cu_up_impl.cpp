@@ -28,6 +28,7 @@
 #include "srsran/gtpu/gtpu_echo_factory.h"
 #include "srsran/gtpu/gtpu_teid_pool_factory.h"
 #include <future>
+#include <mutex>
 
 using namespace srsran;
 using namespace srs_cu_up;
@@ -56,16 +57,14 @@ cu_up::cu_up(const cu_up_configuration& config_) : cfg(config_), main_ctrl_loop(
   demux_msg.gtpu_pcap                   = cfg.gtpu_pcap;
   ngu_demux                             = create_gtpu_demux(demux_msg);
 
-  ctrl_exec_mapper = cfg.exec_mapper->create_ue_executor_mapper();
-  report_error_if_not(ctrl_exec_mapper != nullptr, "Could not create CU-UP executor for control TEID");
-
-  // Create GTP-U echo and register it at demux
+  // Create GTP-U echo and register it at demux. Path management messages are handled in a dedicated low-priority
+  // executor with a small queue, so they cannot add latency to user-plane TEID processing.
   gtpu_echo_creation_message ngu_echo_msg = {};
   ngu_echo_msg.gtpu_pcap                  = cfg.gtpu_pcap;
   ngu_echo_msg.tx_upper                   = &gtpu_gw_adapter;
   ngu_echo                                = create_gtpu_echo(ngu_echo_msg);
   ngu_demux->add_tunnel(
-      GTPU_PATH_MANAGEMENT_TEID, ctrl_exec_mapper->dl_pdu_executor(), ngu_echo->get_rx_upper_layer_interface());
+      GTPU_PATH_MANAGEMENT_TEID, cfg.exec_mapper->gtpu_path_mgmt_executor(), ngu_echo->get_rx_upper_layer_interface());
 
   // Connect GTP-U DEMUX to adapter.
   gw_data_gtpu_demux_adapter.connect_gtpu_demux(*ngu_demux);
@@ -34,6 +34,7 @@
 #include "srsran/gtpu/gtpu_teid_pool.h"
 #include "srsran/support/async/fifo_async_task_scheduler.h"
 #include <memory>
+#include <mutex>
 
 namespace srsran::srs_cu_up {
 
@@ -65,9 +66,6 @@ private:
   // logger
   srslog::basic_logger& logger = srslog::fetch_basic_logger("CU-UP", false);
 
-  // Holds DL executor for the control TEID.
-  std::unique_ptr<ue_executor_mapper> ctrl_exec_mapper;
-
   // Components
   std::atomic<bool>                    e1ap_connected = {false};
   std::unique_ptr<e1ap_interface>      e1ap;
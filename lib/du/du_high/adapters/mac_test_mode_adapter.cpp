@@ -28,6 +28,7 @@
 #include "srsran/scheduler/harq_id.h"
 #include "srsran/scheduler/resource_grid_util.h"
 #include <functional>
+#include <mutex>
 #include <utility>
 
 using namespace srsran;
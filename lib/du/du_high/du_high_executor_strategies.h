@@ -24,6 +24,7 @@
 
 #include "srsran/du/du_high/du_high_executor_mapper.h"
 #include "srsran/support/srsran_assert.h"
+#include <atomic>
 
 namespace srsran {
 namespace srs_du {
@@ -112,20 +113,20 @@ public:
 
     // Initialize executors in a round-robin fashion.
     for (unsigned i = 0; i != MAX_NOF_DU_UES; ++i) {
-      ue_idx_to_exec_index[i] = i % execs.size();
+      ue_idx_to_exec_index[i].store(i % execs.size(), std::memory_order_relaxed);
     }
   }
 
   void rebind_executors(du_ue_index_t ue_index, du_cell_index_t pcell_index) override
   {
     srsran_sanity_check(is_du_ue_index_valid(ue_index), "Invalid ue id={}", ue_index);
-    ue_idx_to_exec_index[ue_index] = pcell_index % execs.size();
+    ue_idx_to_exec_index[ue_index].store(pcell_index % execs.size(), std::memory_order_relaxed);
   }
 
   task_executor& ctrl_executor(du_ue_index_t ue_index) override
   {
     if (ue_index < MAX_NOF_DU_UES) {
-      return *execs[ue_idx_to_exec_index[ue_index]].ctrl_exec;
+      return *execs[ue_idx_to_exec_index[ue_index].load(std::memory_order_relaxed)].ctrl_exec;
     }
     return *execs[0].ctrl_exec;
   }
@@ -133,7 +134,7 @@ public:
   task_executor& f1u_dl_pdu_executor(du_ue_index_t ue_index) override
   {
     if (ue_index < MAX_NOF_DU_UES) {
-      return *execs[ue_idx_to_exec_index[ue_index]].dl_exec;
+      return *execs[ue_idx_to_exec_index[ue_index].load(std::memory_order_relaxed)].dl_exec;
     }
     return *execs[0].dl_exec;
   }
@@ -141,7 +142,7 @@ public:
   task_executor& mac_ul_pdu_executor(du_ue_index_t ue_index) override
   {
     if (ue_index < MAX_NOF_DU_UES) {
-      return *execs[ue_idx_to_exec_index[ue_index]].ul_exec;
+      return *execs[ue_idx_to_exec_index[ue_index].load(std::memory_order_relaxed)].ul_exec;
     }
     return *execs[0].ul_exec;
   }
@@ -155,8 +156,11 @@ private:
 
   std::vector<ue_executors> execs;
 
-  /// Map of ue indexes to executors. The last position is used when the UE has no ue_index yet assigned.
-  std::array<unsigned, MAX_NOF_DU_UES> ue_idx_to_exec_index;
+  /// \brief Map of ue indexes to executors. The last position is used when the UE has no ue_index yet assigned.
+  ///
+  /// Entries are written from the UE control context on PCell (re)binding and read concurrently from the per-cell Rx
+  /// demux paths (e.g. MAC UL PDU dispatching), so they are published atomically instead of guarded by a lock.
+  std::array<std::atomic<unsigned>, MAX_NOF_DU_UES> ue_idx_to_exec_index;
 };
 
 /// \brief Mapper of task executors used by the MAC DL, RLC DL and MAC scheduler for low-latency tasks. The task
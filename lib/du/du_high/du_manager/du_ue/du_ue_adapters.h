@@ -300,6 +300,29 @@ public:
     return SRSRAN_LIKELY(connected.load(std::memory_order_relaxed)) ? rlc_handler->pull_pdu(mac_sdu_buf) : 0;
   }
 
+  size_t on_new_tx_sdus(mac_tx_sdu_writer& writer) override
+  {
+    srsran_assert(rlc_handler != nullptr, "MAC Rx SDU notifier is disconnected");
+    if (SRSRAN_UNLIKELY(not connected.load(std::memory_order_relaxed))) {
+      return 0;
+    }
+
+    // Bridges the MAC SDU writer to the RLC PDU writer. Each RLC PDU maps one-to-one to a MAC SDU.
+    class writer_adapter final : public rlc_pdu_writer
+    {
+    public:
+      explicit writer_adapter(mac_tx_sdu_writer& writer_) : writer(writer_) {}
+
+      span<uint8_t> begin_pdu(unsigned max_pdu_size) override { return writer.begin_sdu(max_pdu_size); }
+      unsigned      commit_pdu(unsigned nof_bytes) override { return writer.commit_sdu(nof_bytes); }
+
+    private:
+      mac_tx_sdu_writer& writer;
+    } adapter{writer};
+
+    return rlc_handler->pull_pdus(adapter);
+  }
+
   unsigned on_buffer_state_update() override
   {
     srsran_assert(rlc_handler != nullptr, "MAC Rx SDU notifier is disconnected");
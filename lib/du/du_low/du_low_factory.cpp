@@ -24,6 +24,7 @@
 #include "du_low_impl.h"
 #include "srsran/du/du_low/du_low_config.h"
 #include "srsran/support/error_handling.h"
+#include <future>
 
 using namespace srsran;
 using namespace srs_du;
@@ -65,9 +66,21 @@ static std::unique_ptr<upper_phy> create_upper_phy(const upper_phy_config&
 
 std::unique_ptr<du_low> srsran::srs_du::make_du_low(const du_low_config& config)
 {
-  std::vector<std::unique_ptr<upper_phy>> upper;
+  // Instantiate the upper PHY of each cell concurrently on temporary threads. Each cell builds its own factory stack,
+  // and the only state shared among them - the FFTW planner and its wisdom - is internally synchronized. For
+  // multi-cell configurations this hides the DFT planning and channel processor pool construction of the cells behind
+  // each other, which dominates the cold start time.
+  std::vector<std::future<std::unique_ptr<upper_phy>>> upper_futures;
+  upper_futures.reserve(config.cells.size());
   for (const auto& cell_cfg : config.cells) {
-    upper.push_back(create_upper_phy(cell_cfg.upper_phy_cfg, cell_cfg.dl_proc_cfg));
+    upper_futures.push_back(std::async(
+        std::launch::async, [&cell_cfg]() { return create_upper_phy(cell_cfg.upper_phy_cfg, cell_cfg.dl_proc_cfg); }));
+  }
+
+  std::vector<std::unique_ptr<upper_phy>> upper;
+  upper.reserve(config.cells.size());
+  for (auto& fut : upper_futures) {
+    upper.push_back(fut.get());
   }
 
   return std::make_unique<du_low_impl>(std::move(upper));
@@ -146,6 +146,30 @@ bool e2sm_kpm_cu_meas_provider_impl::get_meas_data(const asn1::e2sm::meas_type_c
   return (this->*metric_meas_getter_func)(label_info_list, ues, cell_global_id, items);
 }
 
+e2sm_kpm_meas_provider::metric_handle_t
+e2sm_kpm_cu_meas_provider_impl::resolve_meas_type(const asn1::e2sm::meas_type_c& meas_type)
+{
+  auto it = supported_metrics.find(meas_type.meas_name().to_string().c_str());
+  if (it == supported_metrics.end()) {
+    logger.debug("Metric {} not supported.", meas_type.meas_name().to_string());
+    return INVALID_METRIC_HANDLE;
+  }
+  srsran_assert(it->second.func != nullptr, "Metric getter function cannot be empty.");
+  resolved_metric_getters.push_back(it->second.func);
+  return resolved_metric_getters.size() - 1;
+}
+
+bool e2sm_kpm_cu_meas_provider_impl::get_meas_data(metric_handle_t                              metric_handle,
+                                                   const asn1::e2sm::label_info_list_l          label_info_list,
+                                                   const std::vector<asn1::e2sm::ue_id_c>&      ues,
+                                                   const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
+                                                   std::vector<asn1::e2sm::meas_record_item_c>& items)
+{
+  srsran_assert(metric_handle < resolved_metric_getters.size(), "Invalid metric handle={}", metric_handle);
+  metric_meas_getter_func_ptr metric_meas_getter_func = resolved_metric_getters[metric_handle];
+  return (this->*metric_meas_getter_func)(label_info_list, ues, cell_global_id, items);
+}
+
 float e2sm_kpm_cu_meas_provider_impl::bytes_to_kbits(float value)
 {
   constexpr unsigned nof_bits_per_byte = 8;
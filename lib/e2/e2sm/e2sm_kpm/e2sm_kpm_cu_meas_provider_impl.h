@@ -69,6 +69,14 @@ public:
                      const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
                      std::vector<asn1::e2sm::meas_record_item_c>& items) override;
 
+  metric_handle_t resolve_meas_type(const asn1::e2sm::meas_type_c& meas_type) override;
+
+  bool get_meas_data(metric_handle_t                              metric_handle,
+                     const asn1::e2sm::label_info_list_l          label_info_list,
+                     const std::vector<asn1::e2sm::ue_id_c>&      ues,
+                     const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
+                     std::vector<asn1::e2sm::meas_record_item_c>& items) override;
+
 private:
   typedef bool(metric_meas_getter_func_t)(const asn1::e2sm::label_info_list_l          label_info_list,
                                           const std::vector<asn1::e2sm::ue_id_c>&      ues,
@@ -95,6 +103,8 @@ private:
   srslog::basic_logger& logger;
 
   std::map<std::string, e2sm_kpm_supported_metric_t> supported_metrics;
+  /// Getter functions bound at subscription time, indexed by the handles returned by resolve_meas_type().
+  std::vector<metric_meas_getter_func_ptr> resolved_metric_getters;
 };
 
 } // namespace srsran
@@ -167,12 +167,48 @@ void e2sm_kpm_du_meas_provider_impl::report_metrics(const scheduler_cell_metrics
 void e2sm_kpm_du_meas_provider_impl::report_metrics(const rlc_metrics& metrics)
 {
   logger.debug("Received RLC metrics: ue={} {}.", metrics.ue_index, metrics.rb_id.get_drb_id());
-  ue_aggr_rlc_metrics[metrics.ue_index].push_back(metrics);
-  if (ue_aggr_rlc_metrics[metrics.ue_index].size() > max_rlc_metrics) {
-    ue_aggr_rlc_metrics[metrics.ue_index].pop_front();
+  ue_aggr_rlc_metrics[metrics.ue_index].push(metrics, max_rlc_metrics);
+}
+
+void e2sm_kpm_du_meas_provider_impl::ue_rlc_metrics_window::push(const rlc_metrics& m, size_t max_snapshots)
+{
+  snapshots.push_back(m);
+  accumulate(m, 1);
+  if (snapshots.size() > max_snapshots) {
+    accumulate(snapshots.front(), -1);
+    snapshots.pop_front();
   }
 }
 
+void e2sm_kpm_du_meas_provider_impl::ue_rlc_metrics_window::accumulate(const rlc_metrics& m, int sign)
+{
+  switch (m.tx.tx_low.mode) {
+    case rlc_mode::um_bidir:
+    case rlc_mode::um_unidir_dl:
+      tx_pdu_bytes_with_segmentation +=
+          sign * static_cast<int64_t>(m.tx.tx_low.mode_specific.um.num_pdu_bytes_with_segmentation);
+      break;
+    case rlc_mode::am:
+      tx_pdu_bytes_with_segmentation +=
+          sign * static_cast<int64_t>(m.tx.tx_low.mode_specific.am.num_pdu_bytes_with_segmentation);
+      break;
+    default:
+      break;
+  }
+  tx_pdu_bytes_no_segmentation += sign * static_cast<int64_t>(m.tx.tx_low.num_pdu_bytes_no_segmentation);
+  tx_num_sdus += sign * static_cast<int64_t>(m.tx.tx_high.num_sdus);
+  tx_num_sdu_bytes += sign * static_cast<int64_t>(m.tx.tx_high.num_sdu_bytes);
+  tx_num_dropped_sdus += sign * static_cast<int64_t>(m.tx.tx_high.num_dropped_sdus + m.tx.tx_high.num_discarded_sdus);
+  tx_num_pulled_sdus += sign * static_cast<int64_t>(m.tx.tx_low.num_of_pulled_sdus);
+  tx_sum_sdu_latency_us += sign * static_cast<int64_t>(m.tx.tx_low.sum_sdu_latency_us);
+  rx_num_pdus += sign * static_cast<int64_t>(m.rx.num_pdus);
+  rx_num_lost_pdus += sign * static_cast<int64_t>(m.rx.num_lost_pdus);
+  rx_pdu_bytes += sign * static_cast<int64_t>(m.rx.num_pdu_bytes);
+  rx_num_sdus += sign * static_cast<int64_t>(m.rx.num_sdus);
+  rx_num_sdu_bytes += sign * static_cast<int64_t>(m.rx.num_sdu_bytes);
+  rx_sum_sdu_latency_us += sign * static_cast<int64_t>(m.rx.sdu_latency_us);
+}
+
 std::vector<std::string> e2sm_kpm_du_meas_provider_impl::get_supported_metric_names(e2sm_kpm_metric_level_enum level)
 {
   std::vector<std::string> metrics;
@@ -285,6 +321,30 @@ bool e2sm_kpm_du_meas_provider_impl::get_meas_data(const asn1::e2sm::meas_type_c
   return (this->*metric_meas_getter_func)(label_info_list, ues, cell_global_id, items);
 }
 
+e2sm_kpm_meas_provider::metric_handle_t
+e2sm_kpm_du_meas_provider_impl::resolve_meas_type(const asn1::e2sm::meas_type_c& meas_type)
+{
+  auto it = supported_metrics.find(meas_type.meas_name().to_string().c_str());
+  if (it == supported_metrics.end()) {
+    logger.debug("Metric {} not supported.", meas_type.meas_name().to_string());
+    return INVALID_METRIC_HANDLE;
+  }
+  srsran_assert(it->second.func != nullptr, "Metric getter function cannot be empty.");
+  resolved_metric_getters.push_back(it->second.func);
+  return resolved_metric_getters.size() - 1;
+}
+
+bool e2sm_kpm_du_meas_provider_impl::get_meas_data(metric_handle_t                              metric_handle,
+                                                   const asn1::e2sm::label_info_list_l          label_info_list,
+                                                   const std::vector<asn1::e2sm::ue_id_c>&      ues,
+                                                   const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
+                                                   std::vector<asn1::e2sm::meas_record_item_c>& items)
+{
+  srsran_assert(metric_handle < resolved_metric_getters.size(), "Invalid metric handle={}", metric_handle);
+  metric_meas_getter_func_ptr metric_meas_getter_func = resolved_metric_getters[metric_handle];
+  return (this->*metric_meas_getter_func)(label_info_list, ues, cell_global_id, items);
+}
+
 bool e2sm_kpm_du_meas_provider_impl::handle_no_meas_data_available(
     const std::vector<asn1::e2sm::ue_id_c>&        ues,
     std::vector<asn1::e2sm::meas_record_item_c>&   items,
@@ -655,34 +715,12 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_dl_mean_throughput(const asn1::e2sm
   double                       seconds = 1;
   std::map<uint16_t, unsigned> ue_throughput;
   for (auto& ue : ue_aggr_rlc_metrics) {
-    size_t num_pdu_bytes_with_segmentation;
-    switch (ue.second.front().tx.tx_low.mode) {
-      case rlc_mode::um_bidir:
-      case rlc_mode::um_unidir_dl:
-        // get average from queue
-        num_pdu_bytes_with_segmentation =
-            std::accumulate(ue.second.begin(), ue.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-              return sum + metric.tx.tx_low.mode_specific.um.num_pdu_bytes_with_segmentation;
-            });
-        num_pdu_bytes_with_segmentation /= ue.second.size();
-        break;
-      case rlc_mode::am:
-        num_pdu_bytes_with_segmentation =
-            std::accumulate(ue.second.begin(), ue.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-              return sum + metric.tx.tx_low.mode_specific.am.num_pdu_bytes_with_segmentation;
-            });
-        num_pdu_bytes_with_segmentation /= ue.second.size();
-        break;
-      default:
-        num_pdu_bytes_with_segmentation = 0;
-    }
-    auto num_pdu_bytes_no_segmentation =
-        std::accumulate(ue.second.begin(), ue.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-          return sum + metric.tx.tx_low.num_pdu_bytes_no_segmentation;
-        });
-    num_pdu_bytes_no_segmentation /= ue.second.size();
-    seconds = (float)std::chrono::duration_cast<std::chrono::milliseconds>(ue.second.back().metrics_period).count() /
-              (float)1000;
+    // Average over the window using the preaggregated sums.
+    size_t num_pdu_bytes_with_segmentation = ue.second.tx_pdu_bytes_with_segmentation / ue.second.snapshots.size();
+    size_t num_pdu_bytes_no_segmentation   = ue.second.tx_pdu_bytes_no_segmentation / ue.second.snapshots.size();
+    seconds =
+        (float)std::chrono::duration_cast<std::chrono::milliseconds>(ue.second.snapshots.back().metrics_period).count() /
+        (float)1000;
     ue_throughput[ue.first] = bytes_to_kbits(num_pdu_bytes_no_segmentation + num_pdu_bytes_with_segmentation) / seconds;
   }
   if (ues.empty()) {
@@ -731,13 +769,11 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_ul_mean_throughput(const asn1::e2sm
   double                       seconds = 1;
   std::map<uint16_t, unsigned> ue_throughput;
   for (auto& ue : ue_aggr_rlc_metrics) {
-    auto num_pdu_bytes =
-        std::accumulate(ue.second.begin(), ue.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-          return sum + metric.rx.num_pdu_bytes;
-        });
-    num_pdu_bytes /= ue.second.size();
-    seconds = (float)std::chrono::duration_cast<std::chrono::milliseconds>(ue.second.back().metrics_period).count() /
-              (float)1000;
+    // Average over the window using the preaggregated sums.
+    size_t num_pdu_bytes = ue.second.rx_pdu_bytes / ue.second.snapshots.size();
+    seconds =
+        (float)std::chrono::duration_cast<std::chrono::milliseconds>(ue.second.snapshots.back().metrics_period).count() /
+        (float)1000;
     ue_throughput[ue.first] = bytes_to_kbits(num_pdu_bytes) / seconds; // unit is kbps
   }
   if (ues.empty()) {
@@ -792,15 +828,8 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_ul_success_rate(const asn1::e2sm::l
     uint32_t           total_lost_pdus = 0;
     uint32_t           total_pdus      = 0;
     for (auto& ue_metric : ue_aggr_rlc_metrics) {
-      // rlc_metrics& rlc_metric = ue_metric.second;
-      total_lost_pdus += std::accumulate(
-          ue_metric.second.begin(), ue_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.rx.num_lost_pdus;
-          });
-      total_pdus += std::accumulate(ue_metric.second.begin(),
-                                    ue_metric.second.end(),
-                                    0,
-                                    [](size_t sum, const rlc_metrics& metric) { return sum + metric.rx.num_pdus; });
+      total_lost_pdus += ue_metric.second.rx_num_lost_pdus;
+      total_pdus += ue_metric.second.rx_num_pdus;
     }
     if (total_pdus) {
       success_rate = 1.0 * (total_pdus - total_lost_pdus) / total_pdus;
@@ -822,16 +851,8 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_ul_success_rate(const asn1::e2sm::l
       continue;
     }
     float success_rate    = 0;
-    float total_lost_pdus = 0;
-    float total_pdus      = 0;
-    auto  ue_metric       = ue_aggr_rlc_metrics[ue_idx];
-    total_lost_pdus +=
-        std::accumulate(ue_metric.begin(), ue_metric.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-          return sum + metric.rx.num_lost_pdus;
-        });
-    total_pdus += std::accumulate(ue_metric.begin(), ue_metric.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-      return sum + metric.rx.num_pdus;
-    });
+    float total_lost_pdus = ue_aggr_rlc_metrics[ue_idx].rx_num_lost_pdus;
+    float total_pdus      = ue_aggr_rlc_metrics[ue_idx].rx_num_pdus;
 
     if (total_pdus) {
       success_rate = 1.0 * (total_pdus - total_lost_pdus) / total_pdus;
@@ -872,14 +893,8 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_rlc_packet_drop_rate_dl(
     uint32_t           total_dropped_sdus = 0;
     uint32_t           total_tx_num_sdus  = 0;
     for (auto& rlc_metric : ue_aggr_rlc_metrics) {
-      total_dropped_sdus += std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.tx.tx_high.num_dropped_sdus + metric.tx.tx_high.num_discarded_sdus;
-          });
-      total_tx_num_sdus += std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.tx.tx_high.num_sdus;
-          });
+      total_dropped_sdus += rlc_metric.second.tx_num_dropped_sdus;
+      total_tx_num_sdus += rlc_metric.second.tx_num_sdus;
     }
     if (total_tx_num_sdus) {
       drop_rate = 1.0 * total_dropped_sdus / total_tx_num_sdus;
@@ -900,19 +915,9 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_rlc_packet_drop_rate_dl(
         meas_collected = true;
         continue;
       }
-      float    drop_rate = 0;
-      uint32_t total_dropped_sdus =
-          std::accumulate(ue_aggr_rlc_metrics[ue_idx].begin(),
-                          ue_aggr_rlc_metrics[ue_idx].end(),
-                          0,
-                          [](size_t sum, const rlc_metrics& metric) {
-                            return sum + metric.tx.tx_high.num_dropped_sdus + metric.tx.tx_high.num_discarded_sdus;
-                          });
-      uint32_t total_tx_num_sdus =
-          std::accumulate(ue_aggr_rlc_metrics[ue_idx].begin(),
-                          ue_aggr_rlc_metrics[ue_idx].end(),
-                          0,
-                          [](size_t sum, const rlc_metrics& metric) { return sum + metric.tx.tx_high.num_sdus; });
+      float    drop_rate          = 0;
+      uint32_t total_dropped_sdus = ue_aggr_rlc_metrics[ue_idx].tx_num_dropped_sdus;
+      uint32_t total_tx_num_sdus  = ue_aggr_rlc_metrics[ue_idx].tx_num_sdus;
       if (total_tx_num_sdus) {
         drop_rate = 1.0 * total_dropped_sdus / total_tx_num_sdus;
       }
@@ -951,10 +956,7 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_rlc_sdu_transmitted_volume_dl(
     meas_record_item_c meas_record_item;
     size_t             total_tx_num_sdu_bytes = 0;
     for (auto& rlc_metric : ue_aggr_rlc_metrics) {
-      total_tx_num_sdu_bytes += std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.tx.tx_high.num_sdu_bytes;
-          });
+      total_tx_num_sdu_bytes += rlc_metric.second.tx_num_sdu_bytes;
     }
     meas_record_item.set_integer() = total_tx_num_sdu_bytes * 8 / 1000; // unit is kbit
     items.push_back(meas_record_item);
@@ -971,11 +973,7 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_rlc_sdu_transmitted_volume_dl(
         meas_collected = true;
         continue;
       }
-      int num_sdu_bytes =
-          std::accumulate(ue_aggr_rlc_metrics[ue_idx].begin(),
-                          ue_aggr_rlc_metrics[ue_idx].end(),
-                          0,
-                          [](size_t sum, const rlc_metrics& metric) { return sum + metric.tx.tx_high.num_sdu_bytes; });
+      int num_sdu_bytes              = ue_aggr_rlc_metrics[ue_idx].tx_num_sdu_bytes;
       meas_record_item.set_integer() = num_sdu_bytes * 8 / 1000; // unit is kbit
       items.push_back(meas_record_item);
       meas_collected = true;
@@ -1010,10 +1008,7 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_rlc_sdu_transmitted_volume_ul(
     meas_record_item_c meas_record_item;
     size_t             total_rx_num_sdu_bytes = 0;
     for (auto& rlc_metric : ue_aggr_rlc_metrics) {
-      total_rx_num_sdu_bytes += std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.rx.num_sdu_bytes;
-          });
+      total_rx_num_sdu_bytes += rlc_metric.second.rx_num_sdu_bytes;
     }
     meas_record_item.set_integer() = total_rx_num_sdu_bytes * 8 / 1000; // unit is kbit
     items.push_back(meas_record_item);
@@ -1030,11 +1025,7 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_rlc_sdu_transmitted_volume_ul(
         meas_collected = true;
         continue;
       }
-      int num_sdu_bytes =
-          std::accumulate(ue_aggr_rlc_metrics[ue_idx].begin(),
-                          ue_aggr_rlc_metrics[ue_idx].end(),
-                          0,
-                          [](size_t sum, const rlc_metrics& metric) { return sum + metric.rx.num_sdu_bytes; });
+      int num_sdu_bytes              = ue_aggr_rlc_metrics[ue_idx].rx_num_sdu_bytes;
       meas_record_item.set_integer() = num_sdu_bytes * 8 / 1000; // unit is kbit
       items.push_back(meas_record_item);
       meas_collected = true;
@@ -1063,14 +1054,8 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_dl_rlc_sdu_latency(const asn1::e2sm
     meas_record_item_c meas_record_item;
     float              av_ue_sdu_latency_us = 0;
     for (auto& rlc_metric : ue_aggr_rlc_metrics) {
-      int tot_num_of_pulled_sdus = std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.tx.tx_low.num_of_pulled_sdus;
-          });
-      int tot_sum_sdu_latency_us = std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.tx.tx_low.sum_sdu_latency_us;
-          });
+      int tot_num_of_pulled_sdus = rlc_metric.second.tx_num_pulled_sdus;
+      int tot_sum_sdu_latency_us = rlc_metric.second.tx_sum_sdu_latency_us;
       if (tot_num_of_pulled_sdus && tot_sum_sdu_latency_us) {
         av_ue_sdu_latency_us += (float)tot_sum_sdu_latency_us / (float)tot_num_of_pulled_sdus;
       }
@@ -1095,16 +1080,8 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_dl_rlc_sdu_latency(const asn1::e2sm
         meas_collected = true;
         continue;
       }
-      int tot_sdu_latency_us = std::accumulate(
-          ue_aggr_rlc_metrics[ue_idx].begin(),
-          ue_aggr_rlc_metrics[ue_idx].end(),
-          0,
-          [](size_t sum, const rlc_metrics& metric) { return sum + metric.tx.tx_low.sum_sdu_latency_us; });
-      int tot_num_sdus =
-          std::accumulate(ue_aggr_rlc_metrics[ue_idx].begin(),
-                          ue_aggr_rlc_metrics[ue_idx].end(),
-                          0,
-                          [](size_t sum, const rlc_metrics& metric) { return sum + metric.tx.tx_high.num_sdus; });
+      int tot_sdu_latency_us = ue_aggr_rlc_metrics[ue_idx].tx_sum_sdu_latency_us;
+      int tot_num_sdus       = ue_aggr_rlc_metrics[ue_idx].tx_num_sdus;
       if (tot_sdu_latency_us) {
         meas_record_item.set_real();
         meas_record_item.real().value = tot_sdu_latency_us / tot_num_sdus;
@@ -1138,14 +1115,8 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_ul_rlc_sdu_latency(const asn1::e2sm
     meas_record_item_c meas_record_item;
     float              av_ue_sdu_latency_us = 0;
     for (auto& rlc_metric : ue_aggr_rlc_metrics) {
-      int tot_num_sdus = std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.rx.num_sdus;
-          });
-      int tot_sdu_latency_us = std::accumulate(
-          rlc_metric.second.begin(), rlc_metric.second.end(), 0, [](size_t sum, const rlc_metrics& metric) {
-            return sum + metric.rx.sdu_latency_us;
-          });
+      int tot_num_sdus       = rlc_metric.second.rx_num_sdus;
+      int tot_sdu_latency_us = rlc_metric.second.rx_sum_sdu_latency_us;
       if (tot_num_sdus && tot_sdu_latency_us) {
         av_ue_sdu_latency_us += (float)tot_sdu_latency_us / (float)tot_num_sdus;
       }
@@ -1170,16 +1141,8 @@ bool e2sm_kpm_du_meas_provider_impl::get_drb_ul_rlc_sdu_latency(const asn1::e2sm
         meas_collected = true;
         continue;
       }
-      int tot_sdu_latency =
-          std::accumulate(ue_aggr_rlc_metrics[ue_idx].begin(),
-                          ue_aggr_rlc_metrics[ue_idx].end(),
-                          0,
-                          [](size_t sum, const rlc_metrics& metric) { return sum + metric.rx.sdu_latency_us; });
-      int tot_num_sdus =
-          std::accumulate(ue_aggr_rlc_metrics[ue_idx].begin(),
-                          ue_aggr_rlc_metrics[ue_idx].end(),
-                          0,
-                          [](size_t sum, const rlc_metrics& metric) { return sum + metric.rx.num_sdus; });
+      int tot_sdu_latency = ue_aggr_rlc_metrics[ue_idx].rx_sum_sdu_latency_us;
+      int tot_num_sdus    = ue_aggr_rlc_metrics[ue_idx].rx_num_sdus;
       if (tot_sdu_latency) {
         meas_record_item.set_real();
         meas_record_item.real().value = tot_sdu_latency / tot_num_sdus;
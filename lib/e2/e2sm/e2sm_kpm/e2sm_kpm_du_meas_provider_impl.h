@@ -76,6 +76,14 @@ public:
                      const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
                      std::vector<asn1::e2sm::meas_record_item_c>& items) override;
 
+  metric_handle_t resolve_meas_type(const asn1::e2sm::meas_type_c& meas_type) override;
+
+  bool get_meas_data(metric_handle_t                              metric_handle,
+                     const asn1::e2sm::label_info_list_l          label_info_list,
+                     const std::vector<asn1::e2sm::ue_id_c>&      ues,
+                     const std::optional<asn1::e2sm::cgi_c>       cell_global_id,
+                     std::vector<asn1::e2sm::meas_record_item_c>& items) override;
+
 private:
   typedef bool(metric_meas_getter_func_t)(const asn1::e2sm::label_info_list_l          label_info_list,
                                           const std::vector<asn1::e2sm::ue_id_c>&      ues,
@@ -91,6 +99,34 @@ private:
     metric_meas_getter_func_ptr func;
   };
 
+  /// \brief Per-UE window of recent RLC metric snapshots with running sums maintained incrementally.
+  ///
+  /// The sums are updated in place when a snapshot is added or evicted from the window, so that report generation
+  /// reads preaggregated values instead of re-scanning the snapshot history once per subscribed metric.
+  struct ue_rlc_metrics_window {
+    std::deque<rlc_metrics> snapshots;
+
+    int64_t tx_pdu_bytes_with_segmentation = 0;
+    int64_t tx_pdu_bytes_no_segmentation   = 0;
+    int64_t tx_num_sdus                    = 0;
+    int64_t tx_num_sdu_bytes               = 0;
+    int64_t tx_num_dropped_sdus            = 0;
+    int64_t tx_num_pulled_sdus             = 0;
+    int64_t tx_sum_sdu_latency_us          = 0;
+    int64_t rx_num_pdus                    = 0;
+    int64_t rx_num_lost_pdus               = 0;
+    int64_t rx_pdu_bytes                   = 0;
+    int64_t rx_num_sdus                    = 0;
+    int64_t rx_num_sdu_bytes               = 0;
+    int64_t rx_sum_sdu_latency_us          = 0;
+
+    /// Adds a new snapshot to the window, evicting the oldest one when the window exceeds \c max_snapshots.
+    void push(const rlc_metrics& m, size_t max_snapshots);
+
+  private:
+    void accumulate(const rlc_metrics& m, int sign);
+  };
+
   bool check_e2sm_kpm_metrics_definitions(span<const e2sm_kpm_metric_t> metrics_defs);
 
   // Helper functions.
@@ -127,9 +163,11 @@ private:
   unsigned                                           nof_ul_slots;
   unsigned                                           nof_ded_cell_preambles;
   std::vector<scheduler_ue_metrics>                  last_ue_metrics;
-  std::map<uint16_t, std::deque<rlc_metrics>>        ue_aggr_rlc_metrics;
+  std::map<uint16_t, ue_rlc_metrics_window>          ue_aggr_rlc_metrics;
   size_t                                             max_rlc_metrics = 1;
   std::map<std::string, e2sm_kpm_supported_metric_t> supported_metrics;
+  /// Getter functions bound at subscription time, indexed by the handles returned by resolve_meas_type().
+  std::vector<metric_meas_getter_func_ptr> resolved_metric_getters;
 };
 
 } // namespace srsran
@@ -83,6 +83,26 @@ bool e2sm_kpm_report_service_base::initialize_ric_ind_msg_format_1(meas_info_lis
   return true;
 }
 
+void e2sm_kpm_report_service_base::compile_report_plan(const meas_info_list_l& meas_info_list)
+{
+  report_plan.resize(meas_info_list.size(), e2sm_kpm_meas_provider::INVALID_METRIC_HANDLE);
+  for (unsigned i = 0; i != meas_info_list.size(); ++i) {
+    report_plan[i] = meas_provider.resolve_meas_type(meas_info_list[i].meas_type);
+  }
+}
+
+bool e2sm_kpm_report_service_base::collect_meas_data(unsigned                         meas_info_idx,
+                                                     const meas_info_item_s&          meas_info,
+                                                     const std::vector<ue_id_c>&      ues,
+                                                     std::vector<meas_record_item_c>& items)
+{
+  if (meas_info_idx < report_plan.size() and report_plan[meas_info_idx] != e2sm_kpm_meas_provider::INVALID_METRIC_HANDLE) {
+    return meas_provider.get_meas_data(
+        report_plan[meas_info_idx], meas_info.label_info_list, ues, cell_global_id, items);
+  }
+  return meas_provider.get_meas_data(meas_info.meas_type, meas_info.label_info_list, ues, cell_global_id, items);
+}
+
 bool e2sm_kpm_report_service_base::is_ind_msg_ready()
 {
   if (not is_ind_msg_ready_) {
@@ -130,6 +150,9 @@ e2sm_kpm_report_service_style1::e2sm_kpm_report_service_style1(e2sm_kpm_action_d
 
   // Initialize RIC indication metadata.
   initialize_ric_ind_msg_format_1(action_def.meas_info_list, ric_ind_message);
+
+  // Bind the subscribed metrics to provider getters.
+  compile_report_plan(action_def.meas_info_list);
 }
 
 void e2sm_kpm_report_service_style1::clear_collect_measurements()
@@ -152,11 +175,10 @@ bool e2sm_kpm_report_service_style1::collect_measurements()
   meas_data_item_s                meas_data_item;
 
   auto& meas_info_list = ric_ind_message.meas_info_list;
-  for (auto& meas_info : meas_info_list) {
+  for (unsigned i = 0; i != meas_info_list.size(); ++i) {
     // Get measurements.
     meas_records_items.clear();
-    if (meas_provider.get_meas_data(
-            meas_info.meas_type, meas_info.label_info_list, {}, cell_global_id, meas_records_items)) {
+    if (collect_meas_data(i, meas_info_list[i], {}, meas_records_items)) {
       // Fill measurements data.
       meas_data_item.meas_record.push_back(meas_records_items[0]);
     }
@@ -182,6 +204,9 @@ e2sm_kpm_report_service_style2::e2sm_kpm_report_service_style2(e2sm_kpm_action_d
 
   // Initialize RIC indication metadata.
   initialize_ric_ind_msg_format_1(subscript_info.meas_info_list, ric_ind_message);
+
+  // Bind the subscribed metrics to provider getters.
+  compile_report_plan(subscript_info.meas_info_list);
 }
 
 void e2sm_kpm_report_service_style2::clear_collect_measurements()
@@ -202,11 +227,10 @@ bool e2sm_kpm_report_service_style2::collect_measurements()
   meas_data_item_s                meas_data_item;
 
   auto& meas_info_list = action_def.subscript_info.meas_info_list;
-  for (auto& meas_info : meas_info_list) {
+  for (unsigned i = 0; i != meas_info_list.size(); ++i) {
     // Get measurements.
     meas_records_items.clear();
-    meas_provider.get_meas_data(
-        meas_info.meas_type, meas_info.label_info_list, {ue_id}, cell_global_id, meas_records_items);
+    collect_meas_data(i, meas_info_list[i], {ue_id}, meas_records_items);
     // Fill measurements data.
     meas_data_item.meas_record.push_back(meas_records_items[0]);
   }
@@ -367,6 +391,9 @@ e2sm_kpm_report_service_style4::e2sm_kpm_report_service_style4(e2sm_kpm_action_d
   }
   nof_collected_meas_data = 0;
   // Note: no need to initialize RIC indication as each time different nof UEs.
+
+  // Bind the subscribed metrics to provider getters.
+  compile_report_plan(subscription_info.meas_info_list);
 }
 
 void e2sm_kpm_report_service_style4::clear_collect_measurements()
@@ -445,11 +472,10 @@ bool e2sm_kpm_report_service_style4::collect_measurements()
                  [](ue_meas_report_item_s& x) { return x.ue_id; });
 
   auto& meas_info_list = action_def.sub_info.meas_info_list;
-  for (auto& meas_info : meas_info_list) {
+  for (unsigned meas_info_idx = 0; meas_info_idx != meas_info_list.size(); ++meas_info_idx) {
     // Get measurements.
     meas_records_items.clear();
-    meas_provider.get_meas_data(
-        meas_info.meas_type, meas_info.label_info_list, all_matching_ues, cell_global_id, meas_records_items);
+    collect_meas_data(meas_info_idx, meas_info_list[meas_info_idx], all_matching_ues, meas_records_items);
 
     // Put each measurement record into a proper place.
     for (unsigned ue_idx = 0; ue_idx < ric_ind_message.ue_meas_report_list.size(); ue_idx++) {
@@ -490,6 +516,9 @@ e2sm_kpm_report_service_style5::e2sm_kpm_report_service_style5(e2sm_kpm_action_d
     ue_ids.push_back(action_def.matching_ue_id_list[i].ue_id);
   }
   nof_collected_meas_data = 0;
+
+  // Bind the subscribed metrics to provider getters.
+  compile_report_plan(subscription_info.meas_info_list);
 }
 
 void e2sm_kpm_report_service_style5::clear_collect_measurements()
@@ -515,11 +544,10 @@ bool e2sm_kpm_report_service_style5::collect_measurements()
   std::vector<asn1::e2sm::ue_id_c> reported_ues;
 
   auto& meas_info_list = action_def.sub_info.meas_info_list;
-  for (auto& meas_info : meas_info_list) {
+  for (unsigned meas_info_idx = 0; meas_info_idx != meas_info_list.size(); ++meas_info_idx) {
     // Get measurements.
     meas_records_items.clear();
-    meas_provider.get_meas_data(
-        meas_info.meas_type, meas_info.label_info_list, ue_ids, cell_global_id, meas_records_items);
+    collect_meas_data(meas_info_idx, meas_info_list[meas_info_idx], ue_ids, meas_records_items);
 
     // Indication is ready when filled with at least one valid value.
     if (not is_ind_msg_ready_) {
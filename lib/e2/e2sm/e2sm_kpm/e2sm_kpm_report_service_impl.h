@@ -52,6 +52,21 @@ protected:
                                                asn1::e2sm::e2sm_kpm_ind_msg_format1_s& ric_ind_msg);
   virtual void clear_collect_measurements() = 0;
 
+  /// \brief Compile the report plan for the given measurement info list.
+  ///
+  /// Resolves each subscribed metric into a provider metric handle once at subscription time, so that periodic report
+  /// generation dispatches directly to the metric getters instead of re-interpreting the ASN.1 metric names. The plan
+  /// is immutable for the lifetime of the report service; a subscription modification creates a new report service
+  /// and, with it, a new plan.
+  void compile_report_plan(const asn1::e2sm::meas_info_list_l& meas_info_list);
+
+  /// Collect measurements for the metric at position \c meas_info_idx of the subscribed measurement info list, using
+  /// the compiled report plan when available and falling back to the name-based provider lookup otherwise.
+  bool collect_meas_data(unsigned                                     meas_info_idx,
+                         const asn1::e2sm::meas_info_item_s&          meas_info,
+                         const std::vector<asn1::e2sm::ue_id_c>&      ues,
+                         std::vector<asn1::e2sm::meas_record_item_c>& items);
+
   srslog::basic_logger&                    logger;
   asn1::e2sm::e2sm_kpm_action_definition_s action_def_generic;
   uint32_t                                 granul_period  = 0;
@@ -63,6 +78,9 @@ protected:
 
   asn1::e2sm::e2sm_kpm_ind_hdr_format1_s& ric_ind_header;
   bool                                    is_ind_msg_ready_;
+
+  /// Compiled report plan: one provider metric handle per entry of the subscribed measurement info list.
+  std::vector<e2sm_kpm_meas_provider::metric_handle_t> report_plan;
 };
 
 class e2sm_kpm_report_service_style1 : public e2sm_kpm_report_service_base
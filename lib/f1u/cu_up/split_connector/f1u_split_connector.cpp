@@ -23,6 +23,7 @@
 #include "f1u_split_connector.h"
 #include "srsran/gtpu/gtpu_tunnel_nru_factory.h"
 #include "srsran/ran/lcid.h"
+#include <mutex>
 
 using namespace srsran;
 using namespace srs_cu_up;
@@ -33,6 +33,7 @@
 #include "srsran/pcap/dlt_pcap.h"
 #include "srsran/srslog/srslog.h"
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 
 namespace srsran::srs_du {
@@ -22,6 +22,7 @@
 
 #include "srsran/f1u/local_connector/f1u_local_connector.h"
 #include "srsran/ran/lcid.h"
+#include <mutex>
 
 using namespace srsran;
 
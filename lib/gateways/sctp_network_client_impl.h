@@ -59,6 +59,10 @@ private:
 
   void receive();
 
+  /// \brief Receive a single SCTP message or notification from the socket.
+  /// \return True if more messages may be pending and reading can continue, false otherwise.
+  bool receive_one();
+
   void handle_data(span<const uint8_t> payload);
   void handle_notification(span<const uint8_t>           payload,
                            const struct sctp_sndrcvinfo& sri,
@@ -30,6 +30,10 @@ using namespace srsran;
 // the stream number to use for sending
 const unsigned stream_no = 0;
 
+// Maximum number of messages read per IO event. Reading in bounded batches amortizes the epoll wakeup over signaling
+// bursts without starving other sockets that share the broker thread.
+const unsigned rx_max_msgs_per_event = 16;
+
 class sctp_network_server_impl::sctp_send_notifier : public sctp_association_sdu_notifier
 {
 public:
@@ -164,6 +168,21 @@ bool sctp_network_server_impl::create_and_bind()
 }
 
 void sctp_network_server_impl::receive()
+{
+  // Drain a bounded batch of messages per IO event, so that during F1AP/NGAP signaling bursts we do not pay one
+  // epoll_wait round-trip per message.
+  for (unsigned i = 0; i != rx_max_msgs_per_event; ++i) {
+    if (not receive_one()) {
+      break;
+    }
+    if (not node_cfg.non_blocking_mode) {
+      // In blocking mode, another sctp_recvmsg would block until the RX timeout when no message is pending.
+      break;
+    }
+  }
+}
+
+bool sctp_network_server_impl::receive_one()
 {
   struct sctp_sndrcvinfo sri       = {};
   int                    msg_flags = 0;
@@ -189,15 +208,17 @@ void sctp_network_server_impl::receive()
         logger.debug("Socket timeout reached");
       }
     }
-    return;
+    return false;
   }
 
   span<const uint8_t> payload(temp_recv_buffer.data(), rx_bytes);
   if (msg_flags & MSG_NOTIFICATION) {
     handle_notification(payload, sri, (const sockaddr&)msg_src_addr, msg_src_addrlen);
-  } else {
-    handle_data(sri.sinfo_assoc_id, payload);
+    // The notification may have triggered a socket shutdown. Stop the RX batch to re-evaluate the subscription.
+    return false;
   }
+  handle_data(sri.sinfo_assoc_id, payload);
+  return true;
 }
 
 void sctp_network_server_impl::handle_socket_shutdown(const char* cause)
@@ -51,6 +51,10 @@ public:
 
   void receive();
 
+  /// \brief Receive a single SCTP message or notification from the socket.
+  /// \return True if more messages may be pending and reading can continue, false otherwise.
+  bool receive_one();
+
   bool listen() override;
 
   std::optional<uint16_t> get_listen_port() override;
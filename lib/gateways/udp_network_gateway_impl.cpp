@@ -43,7 +43,10 @@ udp_network_gateway_impl::udp_network_gateway_impl(udp_network_gateway_config
   logger(srslog::fetch_basic_logger("UDP-GW")),
   io_tx_executor(io_tx_executor_)
 {
-  logger.info("UDP GW configured. rx_max_mmsg={} pool_thres={}", config.rx_max_mmsg, config.pool_occupancy_threshold);
+  logger.info("UDP GW configured. rx_max_mmsg={} tx_max_mmsg={} pool_thres={}",
+              config.rx_max_mmsg,
+              config.tx_max_mmsg,
+              config.pool_occupancy_threshold);
 
   // Allocate RX buffers
   rx_mem.resize(config.rx_max_mmsg);
@@ -55,6 +58,16 @@ udp_network_gateway_impl::udp_network_gateway_impl(udp_network_gateway_config
   rx_srcaddr.resize(config.rx_max_mmsg);
   rx_msghdr.resize(config.rx_max_mmsg);
   rx_iovecs.resize(config.rx_max_mmsg);
+
+  // Allocate context for send_mmsg
+  tx_pdus.reserve(config.tx_max_mmsg);
+  tx_destaddr.resize(config.tx_max_mmsg);
+  tx_msghdr.resize(config.tx_max_mmsg);
+  tx_iovecs.resize(config.tx_max_mmsg * network_gateway_udp_tx_max_iov);
+  tx_mem.resize(config.tx_max_mmsg);
+  for (uint32_t i = 0; i < config.tx_max_mmsg; ++i) {
+    tx_mem[i].resize(network_gateway_udp_max_len);
+  }
 }
 
 bool udp_network_gateway_impl::subscribe_to(io_broker& broker)
@@ -76,7 +89,7 @@ void udp_network_gateway_impl::handle_pdu(byte_buffer pdu, const sockaddr_storag
   }
 }
 
-void udp_network_gateway_impl::handle_pdu_impl(const byte_buffer& pdu, const sockaddr_storage& dest_addr)
+void udp_network_gateway_impl::handle_pdu_impl(byte_buffer pdu, const sockaddr_storage& dest_addr)
 {
   if (not sock_fd.is_open()) {
     logger.error("Socket not initialized");
@@ -88,23 +101,78 @@ void udp_network_gateway_impl::handle_pdu_impl(const byte_buffer& pdu, const soc
     return;
   }
 
-  span<const uint8_t> pdu_span = to_span(pdu, tx_mem);
+  // Queue the PDU so that it is sent in a single syscall together with the PDUs of the tasks already queued in the IO
+  // TX executor.
+  tx_destaddr[tx_pdus.size()] = dest_addr;
+  tx_pdus.push_back(std::move(pdu));
+
+  if (tx_pdus.size() >= config.tx_max_mmsg) {
+    flush_tx();
+    return;
+  }
+
+  if (not tx_flush_pending) {
+    tx_flush_pending = true;
+    // As the executor is FIFO, the flush task runs after all the PDU handling tasks queued so far have added their
+    // PDUs to the pending batch.
+    if (not io_tx_executor.defer([this]() { flush_tx(); })) {
+      flush_tx();
+    }
+  }
+}
+
+void udp_network_gateway_impl::flush_tx()
+{
+  tx_flush_pending = false;
+  if (tx_pdus.empty()) {
+    return;
+  }
+
+  unsigned nof_pdus = tx_pdus.size();
+  for (unsigned i = 0; i != nof_pdus; ++i) {
+    ::iovec* iov     = &tx_iovecs[i * network_gateway_udp_tx_max_iov];
+    unsigned nof_iov = 0;
+
+    // Send the PDU segments with scatter-gather I/O, falling back to a linearized copy when the PDU is spread over
+    // more segments than iovec entries are available.
+    for (span<const uint8_t> segment : tx_pdus[i].segments()) {
+      if (nof_iov == network_gateway_udp_tx_max_iov) {
+        nof_iov = 0;
+        break;
+      }
+      iov[nof_iov].iov_base = const_cast<uint8_t*>(segment.data());
+      iov[nof_iov].iov_len  = segment.size();
+      ++nof_iov;
+    }
+    if (nof_iov == 0) {
+      span<const uint8_t> pdu_span = to_span(tx_pdus[i], tx_mem[i]);
+      iov[0].iov_base              = const_cast<uint8_t*>(pdu_span.data());
+      iov[0].iov_len               = pdu_span.size_bytes();
+      nof_iov                      = 1;
+    }
+
+    tx_msghdr[i]                    = {};
+    tx_msghdr[i].msg_hdr.msg_name   = &tx_destaddr[i];
+    tx_msghdr[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    tx_msghdr[i].msg_hdr.msg_iov    = iov;
+    tx_msghdr[i].msg_hdr.msg_iovlen = nof_iov;
+  }
 
-  int bytes_sent = sendto(
-      sock_fd.value(), pdu_span.data(), pdu_span.size_bytes(), 0, (sockaddr*)&dest_addr, sizeof(sockaddr_storage));
-  if (bytes_sent == -1) {
+  int tx_msgs = sendmmsg(sock_fd.value(), tx_msghdr.data(), nof_pdus, 0);
+  if (tx_msgs == -1) {
     std::string local_addr_str;
-    std::string dest_addr_str;
-    sockaddr_to_ip_str((sockaddr*)&dest_addr, dest_addr_str, logger);
     sockaddr_to_ip_str((sockaddr*)&local_addr, local_addr_str, logger);
-    logger.error("Couldn't send {} B of data on UDP socket: local_ip={} dest_ip={} error=\"{}\"",
-                 pdu_span.size_bytes(),
+    logger.error("Couldn't send {} PDUs on UDP socket: local_ip={} error=\"{}\"",
+                 nof_pdus,
                  local_addr_str,
-                 dest_addr_str,
                  strerror(errno));
+  } else if (static_cast<unsigned>(tx_msgs) < nof_pdus) {
+    logger.warning("Partial sendmmsg on UDP socket, sent {} out of {} PDUs", tx_msgs, nof_pdus);
+  } else {
+    logger.debug("Sent {} PDUs on UDP socket", nof_pdus);
   }
 
-  logger.debug("Sent PDU of {} bytes", pdu.length());
+  tx_pdus.clear();
 }
 
 void udp_network_gateway_impl::handle_io_error(io_broker::error_code code)
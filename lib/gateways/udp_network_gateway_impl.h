@@ -34,6 +34,10 @@ namespace srsran {
 
 constexpr uint32_t network_gateway_udp_max_len = 9100;
 
+/// Maximum number of iovec entries used to send one PDU with scatter-gather I/O. PDUs with more segments are
+/// linearized into a temporary buffer before transmission.
+constexpr uint32_t network_gateway_udp_tx_max_iov = 16;
+
 class udp_network_gateway_impl final : public udp_network_gateway
 {
 public:
@@ -50,8 +54,11 @@ private:
   // udp_network_gateway_data_handler interface, called from CU-UP executor.
   void handle_pdu(byte_buffer pdu, const sockaddr_storage& dest_addr) override;
 
-  // Actual PDU handling, shall run in IO executor.
-  void handle_pdu_impl(const byte_buffer& pdu, const sockaddr_storage& dest_addr);
+  // Actual PDU handling, shall run in IO executor. Queues the PDU for transmission in the next sendmmsg burst.
+  void handle_pdu_impl(byte_buffer pdu, const sockaddr_storage& dest_addr);
+
+  // Sends all queued PDUs with a single syscall, shall run in IO executor.
+  void flush_tx();
 
   // Handle error detected by io_broker that led to the io deregistration.
   void handle_io_error(io_broker::error_code code);
@@ -89,8 +96,13 @@ private:
   std::vector<::mmsghdr>            rx_msghdr;
   std::vector<::iovec>              rx_iovecs;
 
-  // Temporary Tx buffer for transmission.
-  std::array<uint8_t, network_gateway_udp_max_len> tx_mem;
+  /// Pending TX PDUs and context for sendmmsg. Only accessed from the IO TX executor.
+  std::vector<byte_buffer>          tx_pdus;
+  std::vector<::sockaddr_storage>   tx_destaddr;
+  std::vector<::mmsghdr>            tx_msghdr;
+  std::vector<::iovec>              tx_iovecs;
+  std::vector<std::vector<uint8_t>> tx_mem;
+  bool                              tx_flush_pending = false;
 
   // Helper boolean to avoid spamming the logs in case of buffer pool depletion
   bool warn_low_buffer_pool = true;
@@ -22,6 +22,7 @@
 
 #include "gtpu_demux_impl.h"
 #include "gtpu_pdu.h"
+#include <mutex>
 #include <sys/socket.h>
 
 using namespace srsran;
@@ -37,7 +38,8 @@ bool gtpu_demux_impl::add_tunnel(gtpu_teid_t                                  te
                                  gtpu_tunnel_common_rx_upper_layer_interface* tunnel)
 {
   std::lock_guard<std::mutex> guard(map_mutex);
-  auto                        it = teid_to_tunnel.try_emplace(teid, gtpu_demux_tunnel_ctx_t{&tunnel_exec, tunnel});
+  auto                        it =
+      teid_to_tunnel.try_emplace(teid, std::make_shared<gtpu_demux_tunnel_ctx_t>(gtpu_demux_tunnel_ctx_t{&tunnel_exec, tunnel}));
   if (not it.second) {
     logger.error("Tunnel already exists. teid={}", teid);
     return false;
@@ -57,6 +59,9 @@ bool gtpu_demux_impl::remove_tunnel(gtpu_teid_t teid)
   }
 
   logger.info("Tunnel removed. teid={}", teid);
+  // Invalidate the tunnel reference so that PDU handling tasks already queued for this tunnel are dropped. This runs
+  // in the same executor as the PDU handling, hence no synchronization is required.
+  it->second->tunnel = nullptr;
   teid_to_tunnel.erase(it);
   return true;
 }
@@ -71,17 +76,22 @@ void gtpu_demux_impl::handle_pdu(byte_buffer pdu, const sockaddr_storage& src_ad
     }
   }
 
-  std::lock_guard<std::mutex> guard(map_mutex);
-
-  gtpu_teid_t teid{read_teid};
-  auto        it = teid_to_tunnel.find(teid);
-  if (it == teid_to_tunnel.end()) {
-    logger.info("Dropped GTP-U PDU, tunnel not found. teid={}", teid);
-    return;
+  gtpu_teid_t                              teid{read_teid};
+  std::shared_ptr<gtpu_demux_tunnel_ctx_t> tunnel_ctx;
+  {
+    std::lock_guard<std::mutex> guard(map_mutex);
+    auto                        it = teid_to_tunnel.find(teid);
+    if (it == teid_to_tunnel.end()) {
+      logger.info("Dropped GTP-U PDU, tunnel not found. teid={}", teid);
+      return;
+    }
+    tunnel_ctx = it->second;
   }
 
-  if (not it->second.tunnel_exec->defer(
-          [this, teid, p = std::move(pdu), src_addr]() mutable { handle_pdu_impl(teid, std::move(p), src_addr); })) {
+  task_executor& tunnel_exec = *tunnel_ctx->tunnel_exec;
+  if (not tunnel_exec.defer([this, teid, ctx = std::move(tunnel_ctx), p = std::move(pdu), src_addr]() mutable {
+        handle_pdu_impl(teid, std::move(ctx), std::move(p), src_addr);
+      })) {
     if (not cfg.warn_on_drop) {
       logger.info("Dropped GTP-U PDU, queue is full. teid={}", teid);
     } else {
@@ -90,9 +100,14 @@ void gtpu_demux_impl::handle_pdu(byte_buffer pdu, const sockaddr_storage& src_ad
   }
 }
 
-void gtpu_demux_impl::handle_pdu_impl(gtpu_teid_t teid, byte_buffer pdu, const sockaddr_storage& src_addr)
+void gtpu_demux_impl::handle_pdu_impl(gtpu_teid_t                              teid,
+                                      std::shared_ptr<gtpu_demux_tunnel_ctx_t> tunnel_ctx,
+                                      byte_buffer                              pdu,
+                                      const sockaddr_storage&                  src_addr)
 {
   if (gtpu_pcap.is_write_enabled()) {
+    // Note: A deep copy is required here. The T-PDU extraction in the tunnel trims the GTP-U header in place on the
+    // shared segment list, which would race with the PCAP backend thread reading a shallow copy.
     auto pdu_copy = pdu.deep_copy();
     if (not pdu_copy.has_value()) {
       logger.warning("Unable to deep copy PDU for PCAP writer");
@@ -103,20 +118,14 @@ void gtpu_demux_impl::handle_pdu_impl(gtpu_teid_t teid, byte_buffer pdu, const s
 
   logger.debug(pdu.begin(), pdu.end(), "Forwarding PDU. pdu_len={} teid={}", pdu.length(), teid);
 
-  gtpu_tunnel_common_rx_upper_layer_interface* tunnel = nullptr;
-  {
-    // Get GTP-U tunnel.
-    // We lookup the tunnel again, as the tunnel could have been removed between the time PDU processing was enqueued
-    // and the time we actually run the task.
-    std::lock_guard<std::mutex> guard(map_mutex);
-    auto                        it = teid_to_tunnel.find(teid);
-    if (it == teid_to_tunnel.end()) {
-      logger.info("Dropped GTP-U PDU, tunnel not found. teid={}", teid);
-      return;
-    }
-    tunnel = it->second.tunnel;
+  // The tunnel could have been removed between the time PDU processing was enqueued and the time we actually run the
+  // task. As removal happens in the same thread as handling the PDU, checking the context reference is enough and the
+  // map does not need to be looked up again.
+  if (tunnel_ctx->tunnel == nullptr) {
+    logger.info("Dropped GTP-U PDU, tunnel not found. teid={}", teid);
+    return;
   }
+
   // Forward entire PDU to the tunnel.
-  // As removal happens in the same thread as handling the PDU, we no longer need the lock.
-  tunnel->handle_pdu(std::move(pdu), src_addr);
+  tunnel_ctx->tunnel->handle_pdu(std::move(pdu), src_addr);
 }
@@ -27,13 +27,16 @@
 #include "srsran/srslog/srslog.h"
 #include "srsran/support/executors/task_executor.h"
 #include "fmt/format.h"
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
 namespace srsran {
 
 struct gtpu_demux_tunnel_ctx_t {
-  task_executor*                               tunnel_exec;
+  task_executor* tunnel_exec;
+  /// Tunnel to forward the PDUs to. It is reset upon tunnel removal, which runs in the same executor as the PDU
+  /// handling, so queued PDUs of a removed tunnel are safely dropped.
   gtpu_tunnel_common_rx_upper_layer_interface* tunnel;
 };
 
@@ -54,15 +57,19 @@ public:
 
 private:
   // Actual demuxing, to be run in CU-UP executor.
-  void handle_pdu_impl(gtpu_teid_t teid, byte_buffer pdu, const sockaddr_storage& src_addr);
+  void handle_pdu_impl(gtpu_teid_t                              teid,
+                       std::shared_ptr<gtpu_demux_tunnel_ctx_t> tunnel_ctx,
+                       byte_buffer                              pdu,
+                       const sockaddr_storage&                  src_addr);
 
   const gtpu_demux_cfg_t cfg;
   dlt_pcap&              gtpu_pcap;
 
-  // The map is modified by accessed the io_broker (to get the right executor)
-  // and the modified by UE executors when setting up/tearing down.
-  std::mutex                                                                   map_mutex;
-  std::unordered_map<gtpu_teid_t, gtpu_demux_tunnel_ctx_t, gtpu_teid_hasher_t> teid_to_tunnel;
+  // The map is accessed by the io_broker (to get the right executor)
+  // and modified by UE executors when setting up/tearing down. Tunnel contexts are shared pointers so that the PDU
+  // handling tasks can reference them without taking the map lock again.
+  std::mutex                                                                                    map_mutex;
+  std::unordered_map<gtpu_teid_t, std::shared_ptr<gtpu_demux_tunnel_ctx_t>, gtpu_teid_hasher_t> teid_to_tunnel;
 
   srslog::basic_logger& logger;
 };
@@ -64,12 +64,9 @@ protected:
   void send_pdu(byte_buffer buf, const ::sockaddr_storage& peer_sockaddr)
   {
     if (gtpu_pcap.is_write_enabled()) {
-      auto buf_copy = buf.deep_copy();
-      if (not buf_copy.has_value()) {
-        logger.log_warning("Unable to deep copy buffer for PCAP writer");
-      } else {
-        gtpu_pcap.push_pdu(std::move(buf_copy.value()));
-      }
+      // Capture by reference via shallow copy. The PDU is complete at this point and only read downstream (socket
+      // send), so the PCAP backend can safely share the underlying segments without copying the payload.
+      gtpu_pcap.push_pdu(buf.copy());
     }
 
     upper_dn.on_new_pdu(std::move(buf), peer_sockaddr);
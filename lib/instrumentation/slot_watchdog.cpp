@@ -0,0 +1,156 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/instrumentation/slot_watchdog.h"
+
+using namespace srsran;
+
+slot_timing_watchdog srsran::slot_watchdog;
+
+int64_t slot_timing_watchdog::now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void slot_timing_watchdog::enable(std::chrono::microseconds late_threshold)
+{
+  late_threshold_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(late_threshold).count();
+  logger            = &srslog::fetch_basic_logger("METRICS", false);
+  enabled.store(true, std::memory_order_relaxed);
+}
+
+void slot_timing_watchdog::record_impl(slot_point slot, slot_watchdog_stage stage)
+{
+  uint32_t       tag      = slot.to_uint();
+  slot_timeline& timeline = ring[tag % ring_size];
+
+  if (stage == slot_watchdog_stage::slot_indication) {
+    // The slot indication is the first stage of the pipeline: it claims the ring entry and resets the timeline.
+    // Invalidating the tag first keeps concurrent readers of a recycled entry from mixing slots.
+    timeline.tag.store(invalid_tag, std::memory_order_release);
+    for (auto& stage_time : timeline.stage_time_ns) {
+      stage_time.store(0, std::memory_order_relaxed);
+    }
+    timeline.stage_time_ns[static_cast<unsigned>(slot_watchdog_stage::slot_indication)].store(
+        now_ns(), std::memory_order_relaxed);
+    timeline.tag.store(tag, std::memory_order_release);
+    return;
+  }
+
+  // Later stages only annotate a timeline claimed by the matching slot indication.
+  if (timeline.tag.load(std::memory_order_acquire) != tag) {
+    return;
+  }
+
+  timeline.stage_time_ns[static_cast<unsigned>(stage)].store(now_ns(), std::memory_order_relaxed);
+}
+
+void slot_timing_watchdog::record_tx_window_impl(slot_point slot, bool missed)
+{
+  uint32_t       tag      = slot.to_uint();
+  slot_timeline& timeline = ring[tag % ring_size];
+
+  if (timeline.tag.load(std::memory_order_acquire) != tag) {
+    return;
+  }
+
+  int64_t now = now_ns();
+  timeline.stage_time_ns[static_cast<unsigned>(slot_watchdog_stage::ofh_tx_window)].store(now,
+                                                                                          std::memory_order_relaxed);
+
+  int64_t elapsed_ns =
+      now - timeline.stage_time_ns[static_cast<unsigned>(slot_watchdog_stage::slot_indication)].load(
+                std::memory_order_relaxed);
+
+  update_stage_stats(timeline, slot);
+
+  if (missed || (elapsed_ns > late_threshold_ns)) {
+    dump_timeline(timeline, slot, missed, elapsed_ns);
+  }
+}
+
+void slot_timing_watchdog::update_stage_stats(const slot_timeline& timeline, slot_point slot)
+{
+  int64_t indication_ns = timeline.stage_time_ns[static_cast<unsigned>(slot_watchdog_stage::slot_indication)].load(
+      std::memory_order_relaxed);
+  int64_t budget_ns = slot_deadline::slot_duration(slot).count();
+
+  for (unsigned i = static_cast<unsigned>(slot_watchdog_stage::slot_indication) + 1; i != nof_stages; ++i) {
+    int64_t stage_ns = timeline.stage_time_ns[i].load(std::memory_order_relaxed);
+    if (stage_ns == 0) {
+      // Stage was not reached for this slot.
+      continue;
+    }
+    int64_t              consumed_ns = stage_ns - indication_ns;
+    stage_stats_atomics& stats       = stage_stats[i];
+
+    stats.nof_slots.fetch_add(1, std::memory_order_relaxed);
+    stats.cum_consumed_ns.fetch_add(static_cast<uint64_t>(std::max<int64_t>(consumed_ns, 0)),
+                                    std::memory_order_relaxed);
+    if (consumed_ns > budget_ns) {
+      stats.nof_deadline_overruns.fetch_add(1, std::memory_order_relaxed);
+    }
+    int64_t prev_max = stats.max_consumed_ns.load(std::memory_order_relaxed);
+    while (consumed_ns > prev_max &&
+           !stats.max_consumed_ns.compare_exchange_weak(prev_max, consumed_ns, std::memory_order_relaxed)) {
+    }
+  }
+}
+
+slot_watchdog_stage_stats slot_timing_watchdog::get_stage_stats(slot_watchdog_stage stage) const
+{
+  const stage_stats_atomics& stats = stage_stats[static_cast<unsigned>(stage)];
+
+  slot_watchdog_stage_stats result;
+  result.nof_slots             = stats.nof_slots.load(std::memory_order_relaxed);
+  result.cum_consumed_ns       = stats.cum_consumed_ns.load(std::memory_order_relaxed);
+  result.max_consumed_ns       = stats.max_consumed_ns.load(std::memory_order_relaxed);
+  result.nof_deadline_overruns = stats.nof_deadline_overruns.load(std::memory_order_relaxed);
+  return result;
+}
+
+void slot_timing_watchdog::dump_timeline(const slot_timeline& timeline,
+                                         slot_point           slot,
+                                         bool                 missed,
+                                         int64_t              elapsed_ns)
+{
+  int64_t indication_ns = timeline.stage_time_ns[static_cast<unsigned>(slot_watchdog_stage::slot_indication)].load(
+      std::memory_order_relaxed);
+
+  // Offset of the given stage relative to the slot indication, in microseconds, or -1 if the stage was not recorded.
+  auto stage_offset_us = [&timeline, indication_ns](slot_watchdog_stage stage) -> int64_t {
+    int64_t stage_ns = timeline.stage_time_ns[static_cast<unsigned>(stage)].load(std::memory_order_relaxed);
+    return (stage_ns == 0) ? -1 : (stage_ns - indication_ns) / 1000;
+  };
+
+  logger->warning("Late slot '{}' ({}): elapsed={}us threshold={}us budget={}us timeline: sched_done=+{}us "
+                  "mac_assembly=+{}us ofh_tx_window=+{}us (-1 marks a stage that was not reached)",
+                  slot,
+                  missed ? "tx window missed" : "budget exceeded",
+                  elapsed_ns / 1000,
+                  late_threshold_ns / 1000,
+                  slot_deadline::slot_duration(slot).count() / 1000,
+                  stage_offset_us(slot_watchdog_stage::scheduler_done),
+                  stage_offset_us(slot_watchdog_stage::mac_assembly_done),
+                  stage_offset_us(slot_watchdog_stage::ofh_tx_window));
+}
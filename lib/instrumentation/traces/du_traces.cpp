@@ -22,6 +22,6 @@
 
 #include "srsran/instrumentation/traces/du_traces.h"
 
-srsran::file_event_tracer<srsran::L1_TRACE_ENABLED> srsran::l1_tracer;
+srsran::file_event_tracer<srsran::L1_TRACE_ENABLED> srsran::l1_tracer{srsran::trace_category::l1};
 
-srsran::file_event_tracer<srsran::L2_TRACE_ENABLED> srsran::l2_tracer;
+srsran::file_event_tracer<srsran::L2_TRACE_ENABLED> srsran::l2_tracer{srsran::trace_category::l2};
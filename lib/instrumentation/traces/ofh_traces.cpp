@@ -22,4 +22,4 @@
 
 #include "srsran/instrumentation/traces/ofh_traces.h"
 
-srsran::file_event_tracer<srsran::OFH_TRACE_ENABLED> srsran::ofh_tracer;
+srsran::file_event_tracer<srsran::OFH_TRACE_ENABLED> srsran::ofh_tracer{srsran::trace_category::ofh};
@@ -22,4 +22,4 @@
 
 #include "srsran/instrumentation/traces/ru_traces.h"
 
-srsran::file_event_tracer<srsran::RU_TRACE_ENABLED> srsran::ru_tracer;
+srsran::file_event_tracer<srsran::RU_TRACE_ENABLED> srsran::ru_tracer{srsran::trace_category::ru};
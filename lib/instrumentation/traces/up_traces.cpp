@@ -22,4 +22,4 @@
 
 #include "srsran/instrumentation/traces/up_traces.h"
 
-srsran::file_event_tracer<srsran::UP_TRACE_ENABLED> srsran::up_tracer;
+srsran::file_event_tracer<srsran::UP_TRACE_ENABLED> srsran::up_tracer{srsran::trace_category::up};
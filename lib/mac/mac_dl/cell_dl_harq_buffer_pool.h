@@ -56,7 +56,7 @@ public:
   span<uint8_t> dl_harq_buffer(du_ue_index_t ue_index, harq_id_t h_id)
   {
     srsran_sanity_check(is_du_ue_index_valid(ue_index), "Invalid UE index");
-    srsran_assert(cell_buffers[ue_index].size() >= h_id, "Invalid HARQ ID={}", h_id);
+    srsran_assert(cell_buffers[ue_index].size() > h_id, "Invalid HARQ ID={}", h_id);
     return cell_buffers[ue_index][h_id];
   }
 
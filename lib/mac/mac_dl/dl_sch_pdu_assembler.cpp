@@ -361,52 +361,92 @@ void dl_sch_pdu_assembler::assemble_sdus(dl_sch_pdu&           ue_pdu,
 
   const unsigned total_space =
       std::min(get_mac_sdu_required_bytes(lc_grant_info.sched_bytes), ue_pdu.nof_empty_bytes());
-  unsigned rem_bytes = total_space;
-  while (rem_bytes >= MIN_MAC_SDU_SIZE) {
-    // Get MAC opportunity size based on the remaining bytes to encode for this LCID.
-    const unsigned mac_opportunity_size = get_mac_sdu_payload_size(rem_bytes);
-
-    // Setup a SDU encoder.
-    dl_sch_pdu::mac_sdu_encoder sdu_enc = ue_pdu.get_sdu_encoder(lcid, mac_opportunity_size);
-    if (not sdu_enc.valid()) {
-      logger.info("ue={} rnti={} lcid={}: Insufficient MAC opportunity size={}. Remaining space in PDU={}",
-                  ue_mng.get_ue_index(rnti),
-                  rnti,
-                  lcid,
-                  mac_opportunity_size,
-                  rem_bytes);
-      break;
-    }
 
-    // Fetch MAC Tx SDU from upper layers and write inplace, into the buffer provided by the SDU encoder.
-    size_t sdu_actual_len = bearer->on_new_tx_sdu(sdu_enc.sdu_buffer());
-    if (sdu_actual_len == 0) {
-      // The RLC Tx window is full or the RLC buffer is empty.
-      logger.debug("ue={} rnti={} lcid={}: Unable to encode MAC SDU in MAC opportunity of size={}.",
-                   ue_mng.get_ue_index(rnti),
-                   rnti,
-                   lcid,
-                   mac_opportunity_size);
-      break;
+  // Writer through which upper layers encode MAC SDUs in-place into the PDU, bounded by the scheduled bytes for this
+  // logical channel. SDUs are pulled in a single batched call per bearer, so that upper layers (e.g. RLC) can
+  // amortize per-pull synchronization over the whole batch.
+  class sdu_writer final : public mac_tx_sdu_writer
+  {
+  public:
+    sdu_writer(dl_sch_pdu& ue_pdu_, lcid_t lcid_, unsigned space_, unsigned min_sdu_size_, pdu_log_builder& logger_) :
+      ue_pdu(ue_pdu_), lcid(lcid_), rem_bytes(space_), min_sdu_size(min_sdu_size_), pdu_logger(logger_)
+    {
     }
 
-    // Encode MAC subheader + SDU.
-    size_t subh_and_sdu_size = sdu_enc.encode_sdu(sdu_actual_len);
-    if (subh_and_sdu_size == 0) {
-      logger.error("ue={} rnti={} lcid={}: Scheduled SDU with size={} cannot fit in scheduled DL grant",
-                   ue_mng.get_ue_index(rnti),
-                   rnti,
-                   lc_grant_info.lcid.to_lcid(),
-                   lc_grant_info.sched_bytes);
-      break;
+    span<uint8_t> begin_sdu(unsigned max_sdu_size) override
+    {
+      if (rem_bytes < min_sdu_size) {
+        return {};
+      }
+      // Get MAC opportunity size based on the remaining bytes to encode for this LCID.
+      last_opportunity_size = std::min(max_sdu_size, get_mac_sdu_payload_size(rem_bytes));
+      sdu_enc               = ue_pdu.get_sdu_encoder(lcid, last_opportunity_size);
+      if (not sdu_enc.valid()) {
+        encoder_setup_failed = true;
+        return {};
+      }
+      return sdu_enc.sdu_buffer();
     }
-    srsran_assert(rem_bytes >= subh_and_sdu_size, "Too many bytes were packed in MAC SDU");
 
-    // Log SDU.
-    pdu_logger.add_sdu(lc_grant_info.lcid.to_lcid(), subh_and_sdu_size);
+    unsigned commit_sdu(unsigned nof_bytes) override
+    {
+      if (nof_bytes == 0) {
+        return 0;
+      }
+
+      // Encode MAC subheader + SDU.
+      unsigned subh_and_sdu_size = sdu_enc.encode_sdu(nof_bytes);
+      if (subh_and_sdu_size == 0) {
+        // Stop the batch, the SDU cannot fit in the scheduled DL grant.
+        subhdr_encode_failed = true;
+        rem_bytes            = 0;
+        return 0;
+      }
+      srsran_assert(rem_bytes >= subh_and_sdu_size, "Too many bytes were packed in MAC SDU");
+
+      // Log SDU.
+      pdu_logger.add_sdu(lcid, subh_and_sdu_size);
+
+      rem_bytes -= subh_and_sdu_size;
+      return subh_and_sdu_size;
+    }
 
-    rem_bytes -= subh_and_sdu_size;
+    unsigned remaining_bytes() const { return rem_bytes; }
+    unsigned opportunity_size() const { return last_opportunity_size; }
+
+    bool encoder_setup_failed = false;
+    bool subhdr_encode_failed = false;
+
+  private:
+    dl_sch_pdu&                 ue_pdu;
+    const lcid_t                lcid;
+    unsigned                    rem_bytes;
+    const unsigned              min_sdu_size;
+    pdu_log_builder&            pdu_logger;
+    dl_sch_pdu::mac_sdu_encoder sdu_enc;
+    unsigned                    last_opportunity_size = 0;
+  } writer{ue_pdu, lcid, total_space, MIN_MAC_SDU_SIZE, pdu_logger};
+
+  // Fetch MAC Tx SDUs from upper layers in one batched call per bearer.
+  bearer->on_new_tx_sdus(writer);
+
+  if (writer.encoder_setup_failed) {
+    logger.info("ue={} rnti={} lcid={}: Insufficient MAC opportunity size={}. Remaining space in PDU={}",
+                ue_mng.get_ue_index(rnti),
+                rnti,
+                lcid,
+                writer.opportunity_size(),
+                writer.remaining_bytes());
   }
+  if (writer.subhdr_encode_failed) {
+    logger.error("ue={} rnti={} lcid={}: Scheduled SDU with size={} cannot fit in scheduled DL grant",
+                 ue_mng.get_ue_index(rnti),
+                 rnti,
+                 lc_grant_info.lcid.to_lcid(),
+                 lc_grant_info.sched_bytes);
+  }
+
+  const unsigned rem_bytes = writer.remaining_bytes();
   if (rem_bytes == total_space) {
     // No SDU was encoded for this LCID.
     // Causes for failure to create MAC SDU include: RLC Tx window is full, mismatch between the logical channel
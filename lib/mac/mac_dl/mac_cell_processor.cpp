@@ -21,6 +21,7 @@
  */
 
 #include "mac_cell_processor.h"
+#include "srsran/instrumentation/slot_watchdog.h"
 #include "srsran/instrumentation/traces/du_traces.h"
 #include "srsran/mac/mac_cell_result.h"
 #include "srsran/ran/pdsch/pdsch_constants.h"
@@ -103,11 +104,16 @@ async_task<void> mac_cell_processor::stop()
 
 void mac_cell_processor::handle_slot_indication(slot_point sl_tx)
 {
+  slot_watchdog.record(sl_tx, slot_watchdog_stage::slot_indication);
+
+  // The slot budget starts to run when the indication arrives at the timing boundary.
+  slot_deadline deadline(sl_tx);
+
   trace_point slot_ind_enqueue_tp = l2_tracer.now();
   // Change execution context to slot indication executor.
-  if (not slot_exec.execute([this, sl_tx, slot_ind_enqueue_tp]() {
+  if (not slot_exec.execute([this, sl_tx, deadline, slot_ind_enqueue_tp]() {
         l2_tracer << trace_event{"mac_slot_ind_enqueue", slot_ind_enqueue_tp};
-        handle_slot_indication_impl(sl_tx);
+        handle_slot_indication_impl(sl_tx, deadline);
       })) {
     logger.warning("Skipped slot indication={}. Cause: DL task queue is full.", sl_tx);
   }
@@ -204,7 +210,7 @@ async_task<bool> mac_cell_processor::remove_bearers(du_ue_index_t ue_index, span
       });
 }
 
-void mac_cell_processor::handle_slot_indication_impl(slot_point sl_tx)
+void mac_cell_processor::handle_slot_indication_impl(slot_point sl_tx, slot_deadline deadline)
 {
   // * Start of Critical Path * //
 
@@ -212,6 +218,15 @@ void mac_cell_processor::handle_slot_indication_impl(slot_point sl_tx)
 
   logger.set_context(sl_tx.sfn(), sl_tx.slot_index());
 
+  if (SRSRAN_UNLIKELY(deadline.is_expired())) {
+    // The slot indication task waited in the queue for longer than the slot duration. The results of this slot will
+    // miss the transmission window no matter how fast the remaining stages run.
+    logger.warning("Late slot indication dequeue for slot={}. Queued for {}us with a budget of {}us",
+                   sl_tx,
+                   std::chrono::duration_cast<std::chrono::microseconds>(deadline.consumed()).count(),
+                   std::chrono::duration_cast<std::chrono::microseconds>(deadline.total_budget()).count());
+  }
+
   // Cleans old MAC DL PDU buffers.
   pdu_pool.tick(sl_tx.to_uint());
 
@@ -242,8 +257,9 @@ void mac_cell_processor::handle_slot_indication_impl(slot_point sl_tx)
   mac_dl_data_result  data_res{};
 
   l2_tracer << trace_event{"mac_sched", sched_tp};
+  slot_watchdog.record(sl_tx, slot_watchdog_stage::scheduler_done);
 
-  // If it is a DL slot, process results.
+  // If it is a DL slot, send the DL scheduling results to the PHY.
   if (sl_res.dl.nof_dl_symbols > 0) {
     trace_point dl_tti_req_tp = l2_tracer.now();
 
@@ -254,21 +270,11 @@ void mac_cell_processor::handle_slot_indication_impl(slot_point sl_tx)
     phy_cell.on_new_downlink_scheduler_results(mac_dl_res);
 
     l2_tracer << trace_event{"mac_dl_tti_req", dl_tti_req_tp};
-
-    // Start assembling Slot Data Result.
-    if (not sl_res.dl.ue_grants.empty() or not sl_res.dl.rar_grants.empty() or not sl_res.dl.bc.sibs.empty() or
-        not sl_res.dl.paging_grants.empty()) {
-      trace_point tx_data_req_tp = l2_tracer.now();
-
-      assemble_dl_data_request(data_res, sl_tx, cell_cfg.cell_index, sl_res.dl);
-
-      // Send DL Data to PHY.
-      phy_cell.on_new_downlink_data(data_res);
-
-      l2_tracer << trace_event{"mac_tx_data_req", tx_data_req_tp};
-    }
   }
 
+  // Send the UL scheduling results to the PHY before assembling the DL transport blocks. This way, the PHY can start
+  // processing the slot DL/UL configuration while the MAC encodes the DL PDU payloads, which is the costliest step of
+  // the slot indication handling.
   if (sl_res.ul.nof_ul_symbols > 0) {
     trace_point ul_tti_req_tp = l2_tracer.now();
 
@@ -281,7 +287,22 @@ void mac_cell_processor::handle_slot_indication_impl(slot_point sl_tx)
     l2_tracer << trace_event{"mac_ul_tti_req", ul_tti_req_tp};
   }
 
+  // Start assembling Slot Data Result.
+  if (sl_res.dl.nof_dl_symbols > 0 and
+      (not sl_res.dl.ue_grants.empty() or not sl_res.dl.rar_grants.empty() or not sl_res.dl.bc.sibs.empty() or
+       not sl_res.dl.paging_grants.empty())) {
+    trace_point tx_data_req_tp = l2_tracer.now();
+
+    assemble_dl_data_request(data_res, sl_tx, cell_cfg.cell_index, sl_res.dl);
+
+    // Send DL Data to PHY.
+    phy_cell.on_new_downlink_data(data_res);
+
+    l2_tracer << trace_event{"mac_tx_data_req", tx_data_req_tp};
+  }
+
   // All results have been notified at this point.
+  slot_watchdog.record(sl_tx, slot_watchdog_stage::mac_assembly_done);
   phy_cell.on_cell_results_completion(sl_tx);
 
   // * End of Critical Path * //
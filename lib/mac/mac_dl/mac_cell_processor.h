@@ -31,6 +31,7 @@
 #include "rar_pdu_assembler.h"
 #include "sib_pdu_assembler.h"
 #include "ssb_assembler.h"
+#include "srsran/instrumentation/slot_deadline.h"
 #include "srsran/mac/mac.h"
 #include "srsran/pcap/dlt_pcap.h"
 #include "srsran/scheduler/mac_scheduler.h"
@@ -76,7 +77,7 @@ public:
   async_task<bool> remove_bearers(du_ue_index_t ue_index, span<const lcid_t> lcids_to_rem);
 
 private:
-  void handle_slot_indication_impl(slot_point sl_tx);
+  void handle_slot_indication_impl(slot_point sl_tx, slot_deadline deadline);
 
   /// Assemble struct that is going to be passed down to PHY with the DL scheduling result.
   /// \remark FAPI will use this struct to generate a DL_TTI.Request.
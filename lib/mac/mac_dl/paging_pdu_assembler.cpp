@@ -63,18 +63,47 @@ static byte_buffer make_asn1_rrc_cell_pcch_pch_msg(const dl_paging_allocation& p
   return buf;
 }
 
-span<const uint8_t> paging_pdu_assembler::encode_paging_pdu(const dl_paging_allocation& pg)
+/// Returns true if the two paging record lists are identical.
+static bool same_paging_record_list(span<const paging_ue_info> lhs, span<const paging_ue_info> rhs)
+{
+  return std::equal(
+      lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const paging_ue_info& a, const paging_ue_info& b) {
+        return a.paging_type_indicator == b.paging_type_indicator and a.paging_identity == b.paging_identity;
+      });
+}
+
+span<const uint8_t> paging_pdu_assembler::get_packed_payload(const dl_paging_allocation& pg)
 {
+  // Check if a Paging message with the same paging record list has already been assembled.
+  for (const cached_payload& entry : cache) {
+    if (same_paging_record_list(entry.ue_list, pg.paging_ue_list)) {
+      return entry.payload;
+    }
+  }
+
+  // Cache miss. Assemble the Paging message and store it in the cache.
   byte_buffer payload = make_asn1_rrc_cell_pcch_pch_msg(pg);
-  srsran_assert(pg.pdsch_cfg.codewords[0].tb_size_bytes >= payload.length(),
+
+  if (cache.size() < MAX_CACHED_PAYLOADS) {
+    cache.emplace_back();
+  }
+  cached_payload& entry = cache[next_replace_idx];
+  next_replace_idx      = (next_replace_idx + 1) % MAX_CACHED_PAYLOADS;
+  entry.ue_list         = pg.paging_ue_list;
+  entry.payload.assign(payload.begin(), payload.end());
+  return entry.payload;
+}
+
+span<const uint8_t> paging_pdu_assembler::encode_paging_pdu(const dl_paging_allocation& pg)
+{
+  span<const uint8_t> payload = get_packed_payload(pg);
+  srsran_assert(pg.pdsch_cfg.codewords[0].tb_size_bytes >= payload.size(),
                 "The TBS for Paging cannot be smaller than the Paging payload");
 
   span<uint8_t> pdu_bytes = pdu_pool.allocate_buffer(pg.pdsch_cfg.codewords[0].tb_size_bytes);
-  for (unsigned idx = 0; idx < payload.length(); ++idx) {
-    pdu_bytes[idx] = payload[idx];
-  }
+  std::copy(payload.begin(), payload.end(), pdu_bytes.begin());
   // Apply RRC padding if RRC message does not fill a transport block. See TS 38.321, clause 6.1.4 and TS 38.331,
   // clause 8.5.
-  std::fill(pdu_bytes.data() + payload.length(), pdu_bytes.data() + pdu_bytes.size(), 0);
+  std::fill(pdu_bytes.data() + payload.size(), pdu_bytes.data() + pdu_bytes.size(), 0);
   return pdu_bytes;
 }
@@ -39,8 +39,29 @@ public:
   span<const uint8_t> encode_paging_pdu(const dl_paging_allocation& pg);
 
 private:
+  /// Maximum number of cached packed Paging payloads. This value is implementation-defined and covers the Paging
+  /// messages of different paging occasions being repeated within their repetition windows.
+  static constexpr unsigned MAX_CACHED_PAYLOADS = 8;
+
+  /// Packed PCCH-PCH Paging message, cached for the paging record list it was assembled from.
+  struct cached_payload {
+    static_vector<paging_ue_info, MAX_PAGING_RECORDS_PER_PAGING_PDU> ue_list;
+    std::vector<uint8_t>                                             payload;
+  };
+
+  /// \brief Returns the packed PCCH-PCH Paging message for the given grant.
+  ///
+  /// Reuses a cached assembly when a Paging message with the same paging record list was recently encoded (e.g.
+  /// repetitions of the same Paging message within its repetition window), avoiding the re-packing of the ASN.1
+  /// message on every transmission occasion.
+  span<const uint8_t> get_packed_payload(const dl_paging_allocation& pg);
+
   /// Buffer pool holding Paging PDUs.
   ticking_ring_buffer_pool& pdu_pool;
+
+  /// Cache of packed Paging payloads, replaced in round-robin order.
+  static_vector<cached_payload, MAX_CACHED_PAYLOADS> cache;
+  unsigned                                           next_replace_idx = 0;
 };
 
 } // namespace srsran
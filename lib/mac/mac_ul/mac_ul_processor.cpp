@@ -111,27 +111,43 @@ void mac_ul_processor::handle_ue_config_applied(du_ue_index_t ue_index)
 
 void mac_ul_processor::handle_rx_data_indication(mac_rx_data_indication msg)
 {
-  for (mac_rx_pdu& pdu : msg.pdus) {
-    if (pdu.pdu.empty()) {
+  // Move the Rx data indication into a shared context, so that batches of its PDUs can be dispatched to the respective
+  // UE executors without copying the PDUs out of the indication.
+  auto ind = std::make_shared<mac_rx_data_indication>(std::move(msg));
+
+  for (unsigned i = 0; i != ind->pdus.size();) {
+    if (ind->pdus[i].pdu.empty()) {
       logger.error("cell={} slot_rx={} rnti={}: Received empty MAC RX PDU from lower layers",
-                   msg.cell_index,
-                   msg.sl_rx,
-                   pdu.rnti);
+                   ind->cell_index,
+                   ind->sl_rx,
+                   ind->pdus[i].rnti);
+      ++i;
       continue;
     }
 
     // > Convert C-RNTI to DU-specific UE index.
     // Note: for Msg3, the UE context is not yet created, and ue_index will be an invalid index. This situation is
     // handled inside the pdu_handler.
-    du_ue_index_t ue_index = cfg.rnti_table[pdu.rnti];
+    task_executor& ue_exec = cfg.ue_exec_mapper.mac_ul_pdu_executor(cfg.rnti_table[ind->pdus[i].rnti]);
+
+    // > Batch contiguous PDUs that map to the same executor (e.g. UEs with the same PCell), so that they are handled
+    // with a single task dispatch rather than one per PDU.
+    unsigned batch_end = i + 1;
+    while (batch_end != ind->pdus.size() and not ind->pdus[batch_end].pdu.empty() and
+           &cfg.ue_exec_mapper.mac_ul_pdu_executor(cfg.rnti_table[ind->pdus[batch_end].rnti]) == &ue_exec) {
+      ++batch_end;
+    }
 
-    // > Fork each PDU handling to different executors based on the PDU RNTI.
-    if (not cfg.ue_exec_mapper.mac_ul_pdu_executor(ue_index).execute(
-            [this, slot_rx = msg.sl_rx, cell_idx = msg.cell_index, pdu = std::move(pdu)]() mutable {
-              // > Decode Rx PDU and handle respective subPDUs.
-              pdu_handler.handle_rx_pdu(slot_rx, cell_idx, std::move(pdu));
-            })) {
-      logger.warning("cell={} slot_rx={}: Discarding Rx PDU. Cause: Rx task queue is full.", msg.cell_index, msg.sl_rx);
+    // > Fork the batch handling to the executor associated with the PDU RNTIs.
+    if (not ue_exec.execute([this, ind, i, batch_end]() {
+          for (unsigned k = i; k != batch_end; ++k) {
+            // > Decode Rx PDU and handle respective subPDUs.
+            pdu_handler.handle_rx_pdu(ind->sl_rx, ind->cell_index, std::move(ind->pdus[k]));
+          }
+        })) {
+      logger.warning(
+          "cell={} slot_rx={}: Discarding Rx PDU batch. Cause: Rx task queue is full.", ind->cell_index, ind->sl_rx);
     }
+    i = batch_end;
   }
 }
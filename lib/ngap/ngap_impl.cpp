@@ -357,7 +357,8 @@ void ngap_impl::handle_initiating_message(const init_msg_s& msg)
 
 void ngap_impl::handle_dl_nas_transport_message(const asn1::ngap::dl_nas_transport_s& msg)
 {
-  if (!ue_ctxt_list.contains(uint_to_ran_ue_id(msg->ran_ue_ngap_id))) {
+  ngap_ue_context* ue_ctxt_ptr = ue_ctxt_list.find(uint_to_ran_ue_id(msg->ran_ue_ngap_id));
+  if (ue_ctxt_ptr == nullptr) {
     logger.warning("ran_ue={} amf_ue={}: Dropping DlNasTransportMessage. UE context does not exist",
                    msg->ran_ue_ngap_id,
                    msg->amf_ue_ngap_id);
@@ -369,7 +370,7 @@ void ngap_impl::handle_dl_nas_transport_message(const asn1::ngap::dl_nas_transpo
     return;
   }
 
-  ngap_ue_context& ue_ctxt = ue_ctxt_list[uint_to_ran_ue_id(msg->ran_ue_ngap_id)];
+  ngap_ue_context& ue_ctxt = *ue_ctxt_ptr;
 
   if (ue_ctxt.release_scheduled) {
     ue_ctxt.logger.log_info("Dropping DlNasTransportMessage. UE is already scheduled for release");
@@ -143,6 +143,40 @@ public:
     return &it->second;
   }
 
+  ngap_ue_context* find(ue_index_t ue_index)
+  {
+    auto it = ue_index_to_ran_ue_id.find(ue_index);
+    if (it == ue_index_to_ran_ue_id.end()) {
+      return nullptr;
+    }
+    return find(it->second);
+  }
+  const ngap_ue_context* find(ue_index_t ue_index) const
+  {
+    auto it = ue_index_to_ran_ue_id.find(ue_index);
+    if (it == ue_index_to_ran_ue_id.end()) {
+      return nullptr;
+    }
+    return find(it->second);
+  }
+
+  ngap_ue_context* find(amf_ue_id_t amf_ue_id)
+  {
+    auto it = amf_ue_id_to_ran_ue_id.find(amf_ue_id);
+    if (it == amf_ue_id_to_ran_ue_id.end()) {
+      return nullptr;
+    }
+    return find(it->second);
+  }
+  const ngap_ue_context* find(amf_ue_id_t amf_ue_id) const
+  {
+    auto it = amf_ue_id_to_ran_ue_id.find(amf_ue_id);
+    if (it == amf_ue_id_to_ran_ue_id.end()) {
+      return nullptr;
+    }
+    return find(it->second);
+  }
+
   ngap_ue_context& add_ue(ue_index_t              ue_index,
                           ran_ue_id_t             ran_ue_id,
                           ngap_cu_cp_ue_notifier& ue_notifier,
@@ -252,13 +286,8 @@ public:
 
     // iterate over all ids starting with the next_ran_ue_id to find the available id
     while (true) {
-      // Iterate over ue_index_to_ran_ue_id
-      auto it = std::find_if(ue_index_to_ran_ue_id.begin(), ue_index_to_ran_ue_id.end(), [this](auto& u) {
-        return u.second == next_ran_ue_id;
-      });
-
-      // return the id if it is not already used
-      if (it == ue_index_to_ran_ue_id.end()) {
+      // Check whether the id is already in use. The UE map is keyed by RAN-UE-ID, so this is a single probe.
+      if (ues.find(next_ran_ue_id) == ues.end()) {
         ran_ue_id_t ret = next_ran_ue_id;
         // increase the next cu ue f1ap id
         increase_next_ran_ue_id();
@@ -41,6 +41,10 @@
 #include "iq_compression_none_neon.h"
 #endif // __ARM_NEON
 
+#ifdef OFH_SVE_SUPPORTED
+#include "iq_compression_bfp_sve.h"
+#endif // OFH_SVE_SUPPORTED
+
 using namespace srsran;
 using namespace ofh;
 
@@ -86,6 +90,11 @@ std::unique_ptr<iq_compressor> srsran::ofh::create_iq_compressor(compression_typ
       }
     }
 #endif
+#ifdef OFH_SVE_SUPPORTED
+      if (((impl_type == "sve") || (impl_type == "auto")) && cpu_supports_feature(cpu_feature::sve)) {
+        return std::make_unique<iq_compression_bfp_sve>(logger, iq_scaling);
+      }
+#endif // OFH_SVE_SUPPORTED
 #ifdef __ARM_NEON
       if ((impl_type == "neon") || (impl_type == "auto")) {
         return std::make_unique<iq_compression_bfp_neon>(logger, iq_scaling);
@@ -145,6 +154,11 @@ srsran::ofh::create_iq_decompressor(compression_type type, srslog::basic_logger&
       }
     }
 #endif
+#ifdef OFH_SVE_SUPPORTED
+      if (((impl_type == "sve") || (impl_type == "auto")) && cpu_supports_feature(cpu_feature::sve)) {
+        return std::make_unique<iq_compression_bfp_sve>(logger);
+      }
+#endif // OFH_SVE_SUPPORTED
 #ifdef __ARM_NEON
       if ((impl_type == "neon") || (impl_type == "auto")) {
         return std::make_unique<iq_compression_bfp_neon>(logger);
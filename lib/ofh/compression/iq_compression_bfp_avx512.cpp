@@ -26,34 +26,55 @@
 #include "quantizer.h"
 #include "srsran/ofh/compression/compression_properties.h"
 #include "srsran/srsvec/prod.h"
+#include "srsran/srsvec/simd.h"
 #include "srsran/support/math_utils.h"
 #include "srsran/support/units.h"
 
 using namespace srsran;
 using namespace ofh;
 
-/// Loads packed 16-bit integers from non-aligned memory.
-static inline __m512i loadu_epi16_avx512(const void* mem_address)
+/// \brief Loads, scales and quantizes 32 contiguous brain float samples into packed 16-bit integers.
+///
+/// The conversion matches bit-exactly the one performed by \ref srsvec::convert, so the compressed output is identical
+/// to the one obtained by quantizing the whole symbol upfront.
+///
+/// \param[in] samples Pointer to an array of uncompressed brain float samples.
+/// \param[in] scale   Scaling factor applied to the samples prior to quantization.
+static inline __m512i quantize_samples_avx512(const bf16_t* samples, __m512 scale)
 {
-  const __mmask32 mask       = 0xffffffff;
-  const __m512i   zero_epi16 = _mm512_set1_epi64(0);
-  return _mm512_mask_loadu_epi16(zero_epi16, mask, mem_address);
+  simd_f_t even, odd;
+  srsran_simd_bf16_loadu(even, odd, samples);
+  return srsran_simd_convert_2f_interleaved_s(_mm512_mul_ps(even, scale), _mm512_mul_ps(odd, scale));
 }
 
-/// \brief Compresses samples of a single resource block using AVX512 intrinsics.
+/// \brief Loads, scales and quantizes the 24 brain float samples of one resource block into packed 16-bit integers.
+///
+/// The upper eight 16-bit words of the returned register are set to zero.
 ///
-/// \param[out] compressed_prb Compressed PRB (stores compressed packed values).
-/// \param[in] uncompr_samples Pointer to an array of uncompressed 16-bit samples.
-/// \param[in] exponent        Exponent used in BFP compression.
-/// \param[in] data_width      Bit width of resulting compressed samples.
-static void
-compress_prb_avx512(span<uint8_t> comp_prb_buffer, const int16_t* uncomp_samples, uint8_t exponent, unsigned data_width)
+/// \param[in] samples Pointer to an array of uncompressed brain float samples.
+/// \param[in] scale   Scaling factor applied to the samples prior to quantization.
+static inline __m512i quantize_prb_avx512(const bf16_t* samples, __m512 scale)
 {
   const __mmask32 load_mask = 0x00ffffff;
 
-  // Load from memory.
-  __m512i rb_epi16 = _mm512_maskz_loadu_epi16(load_mask, uncomp_samples);
+  // Load 24 16-bit brain float values, setting the remaining positions to zero.
+  __m512i temp = _mm512_maskz_loadu_epi16(load_mask, samples);
+
+  // Unpack brain floats from 32-bit registers into two vectors of single-precision floats.
+  __m512 even = _mm512_castsi512_ps(_mm512_slli_epi32(temp, 16));
+  __m512 odd  = _mm512_castsi512_ps(_mm512_and_si512(temp, _mm512_set1_epi32(0xffff0000)));
+
+  return srsran_simd_convert_2f_interleaved_s(_mm512_mul_ps(even, scale), _mm512_mul_ps(odd, scale));
+}
 
+/// \brief Compresses samples of a single resource block using AVX512 intrinsics.
+///
+/// \param[out] comp_prb_buffer Compressed PRB (stores compressed packed values).
+/// \param[in] rb_epi16         AVX512 register storing the 16-bit samples of the PRB in its first 24 words.
+/// \param[in] exponent         Exponent used in BFP compression.
+/// \param[in] data_width       Bit width of resulting compressed samples.
+static void compress_prb_avx512(span<uint8_t> comp_prb_buffer, __m512i rb_epi16, uint8_t exponent, unsigned data_width)
+{
   // Apply exponent (compress).
   __m512i rb_shifted_epi16 = _mm512_srai_epi16(rb_epi16, exponent);
 
@@ -86,24 +107,34 @@ void iq_compression_bfp_avx512::compress(span<uint8_t>                buffer,
 
   srsran_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
 
-  // Auxiliary arrays used for float to fixed point conversion of the input data.
-  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+  // Scaling factor fused into the brain float to fixed point conversion of the input data.
+  const __m512 scale = _mm512_set1_ps(get_quantization_scale());
 
-  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
-  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
-  // Performs conversion of input brain float values to signed 16-bit integers.
-  quantize_input(input_quantized_span, float_samples_span);
+  const auto* float_samples = reinterpret_cast<const bf16_t*>(iq_data.data());
+
+  // Word indices used to gather the samples of the second, third and fourth PRBs from the pair of registers storing
+  // them. The upper eight words are don't-care values, as the packing utilities only use the first 24 words.
+  const __m512i rb1_index_epi16 = _mm512_set_epi16(
+      0, 0, 0, 0, 0, 0, 0, 0, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26,
+      25, 24);
+  const __m512i rb2_index_epi16 = _mm512_set_epi16(
+      0, 0, 0, 0, 0, 0, 0, 0, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+      17, 16);
+  const __m512i rb3_index_epi16 = _mm512_set_epi16(
+      0, 0, 0, 0, 0, 0, 0, 0, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+      9, 8);
 
   // Compression algorithm implemented according to Annex A.1.2 in O-RAN.WG4.CUS.
   unsigned sample_idx = 0;
   unsigned rb         = 0;
 
-  // With 3 AVX512 registers we can process 4 PRBs at a time (48 16-bit IQ pairs).
+  // With 3 AVX512 registers we can process 4 PRBs at a time (48 16-bit IQ pairs). The input samples are quantized in
+  // registers, thus avoiding an extra pass over the symbol through an intermediate fixed point buffer.
   for (size_t rb_index_end = (nof_prbs / 4) * 4; rb != rb_index_end; rb += 4) {
-    // Load input.
-    __m512i r0_epi16 = loadu_epi16_avx512(&input_quantized[sample_idx]);
-    __m512i r1_epi16 = loadu_epi16_avx512(&input_quantized[sample_idx + AVX512_REG_SIZE]);
-    __m512i r2_epi16 = loadu_epi16_avx512(&input_quantized[sample_idx + 2 * AVX512_REG_SIZE]);
+    // Load input and convert it to signed 16-bit integers.
+    __m512i r0_epi16 = quantize_samples_avx512(float_samples + sample_idx, scale);
+    __m512i r1_epi16 = quantize_samples_avx512(float_samples + sample_idx + AVX512_REG_SIZE, scale);
+    __m512i r2_epi16 = quantize_samples_avx512(float_samples + sample_idx + 2 * AVX512_REG_SIZE, scale);
 
     // Determine exponents for each of the four PRBs.
     __m512i exp_epu32 = mm512::determine_bfp_exponent(r0_epi16, r1_epi16, r2_epi16, params.data_width);
@@ -111,39 +142,34 @@ void iq_compression_bfp_avx512::compress(span<uint8_t>                buffer,
     // Exponents are stored in the first bytes of each 128bit lane of the result.
     const auto* exp_byte_ptr = reinterpret_cast<const uint8_t*>(&exp_epu32);
 
+    // Realign the samples of the last three PRBs, whose boundaries straddle the loaded registers.
+    __m512i rb1_epi16 = _mm512_permutex2var_epi16(r0_epi16, rb1_index_epi16, r1_epi16);
+    __m512i rb2_epi16 = _mm512_permutex2var_epi16(r1_epi16, rb2_index_epi16, r2_epi16);
+    __m512i rb3_epi16 = _mm512_permutexvar_epi16(rb3_index_epi16, r2_epi16);
+
     // Compress the first PRB.
-    // Save the exponent.
     span<uint8_t> output_span(&buffer[rb * prb_size], prb_size);
-    std::memcpy(output_span.data(), &exp_byte_ptr[0], sizeof(uint8_t));
-    // Apply exponent (compress).
-    __m512i rb0_shifted_epi16 = _mm512_srai_epi16(r0_epi16, exp_byte_ptr[0]);
-    // Pack compressed samples.
-    mm512::pack_prb_big_endian(
-        output_span.last(output_span.size() - sizeof(uint8_t)), rb0_shifted_epi16, params.data_width);
+    compress_prb_avx512(output_span, r0_epi16, exp_byte_ptr[0], params.data_width);
 
     // Compress second PRB.
     output_span = span<uint8_t>(&buffer[(rb + 1) * prb_size], prb_size);
-    compress_prb_avx512(
-        output_span, &input_quantized[sample_idx + NOF_SAMPLES_PER_PRB], exp_byte_ptr[16], params.data_width);
+    compress_prb_avx512(output_span, rb1_epi16, exp_byte_ptr[16], params.data_width);
 
     // Compress third PRB.
     output_span = span<uint8_t>(&buffer[(rb + 2) * prb_size], prb_size);
-    compress_prb_avx512(
-        output_span, &input_quantized[sample_idx + 2 * NOF_SAMPLES_PER_PRB], exp_byte_ptr[32], params.data_width);
+    compress_prb_avx512(output_span, rb2_epi16, exp_byte_ptr[32], params.data_width);
 
     // Compress fourth PRB.
     output_span = span<uint8_t>(&buffer[(rb + 3) * prb_size], prb_size);
-    compress_prb_avx512(
-        output_span, &input_quantized[sample_idx + 3 * NOF_SAMPLES_PER_PRB], exp_byte_ptr[48], params.data_width);
+    compress_prb_avx512(output_span, rb3_epi16, exp_byte_ptr[48], params.data_width);
 
     sample_idx += 4 * NOF_SAMPLES_PER_PRB;
   }
 
   // Process the remaining PRBs (one PRB at a time),
   for (; rb != nof_prbs; ++rb) {
-    const __m512i   AVX512_ZERO = _mm512_set1_epi16(0);
-    const __mmask32 load_mask   = 0x00ffffff;
-    __m512i         rb_epi16    = _mm512_maskz_loadu_epi16(load_mask, &input_quantized[sample_idx]);
+    const __m512i AVX512_ZERO = _mm512_set1_epi16(0);
+    __m512i       rb_epi16    = quantize_prb_avx512(float_samples + sample_idx, scale);
 
     // Determine BFP exponent and extract it from the first byte of the first 128bit lane.
     __m512i     exp_epu32    = mm512::determine_bfp_exponent(rb_epi16, AVX512_ZERO, AVX512_ZERO, params.data_width);
@@ -151,13 +177,8 @@ void iq_compression_bfp_avx512::compress(span<uint8_t>                buffer,
 
     span<uint8_t> output_span(&buffer[rb * prb_size], prb_size);
 
-    // Save exponent.
-    memcpy(output_span.data(), &exp_byte_ptr[0], sizeof(uint8_t));
-
     // Shift and pack a PRB using utility function.
-    __m512i rb_shifted_epi16 = _mm512_srai_epi16(rb_epi16, exp_byte_ptr[0]);
-    mm512::pack_prb_big_endian(
-        output_span.last(output_span.size() - sizeof(uint8_t)), rb_shifted_epi16, params.data_width);
+    compress_prb_avx512(output_span, rb_epi16, exp_byte_ptr[0], params.data_width);
 
     sample_idx += NOF_SAMPLES_PER_PRB;
   }
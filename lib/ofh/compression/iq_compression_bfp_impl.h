@@ -102,6 +102,10 @@ protected:
   /// \param[in] bit_width Number of significant bits used by the quantized samples.
   void quantize_input(span<int16_t> out, span<const bf16_t> in);
 
+  /// Returns the combined scaling factor, comprising the quantizer gain and the IQ scaling, applied to the input
+  /// samples when converting them to fixed point.
+  float get_quantization_scale() const { return ((1 << (Q_BIT_WIDTH - 1)) - 1.0f) * iq_scaling; }
+
 private:
   srslog::basic_logger& logger;
   /// Scaling factor applied to IQ data prior to quantization.
@@ -0,0 +1,132 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "iq_compression_bfp_sve.h"
+#include "packing_utils_sve.h"
+#include "quantizer.h"
+#include "sve_helpers.h"
+#include "srsran/ofh/compression/compression_properties.h"
+#include "srsran/support/math_utils.h"
+
+using namespace srsran;
+using namespace ofh;
+
+void iq_compression_bfp_sve::compress(span<uint8_t>                buffer,
+                                      span<const cbf16_t>          iq_data,
+                                      const ru_compression_params& params)
+{
+  // Use generic implementation if SVE utils don't support requested bit width.
+  if (!sve::iq_width_packing_supported(params.data_width)) {
+    iq_compression_bfp_impl::compress(buffer, iq_data, params);
+    return;
+  }
+
+  // Number of input PRBs.
+  unsigned nof_prbs = (iq_data.size() / NOF_SUBCARRIERS_PER_RB);
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned prb_size = get_compressed_prb_size(params).value();
+
+  srsran_assert(buffer.size() >= prb_size * nof_prbs, "Output buffer doesn't have enough space to decompress PRBs");
+
+  // Auxiliary arrays used for float to fixed point conversion of the input data.
+  std::array<int16_t, NOF_SAMPLES_PER_PRB * MAX_NOF_PRBS> input_quantized;
+
+  span<const bf16_t> float_samples_span(reinterpret_cast<const bf16_t*>(iq_data.data()), iq_data.size() * 2U);
+  span<int16_t>      input_quantized_span(input_quantized.data(), float_samples_span.size());
+
+  // Performs conversion of input brain float values to signed 16-bit integers.
+  quantize_input(input_quantized_span, float_samples_span);
+
+  // Compression algorithm implemented according to Annex A.1.2 in O-RAN.WG4.CUS.
+  for (unsigned rb = 0; rb != nof_prbs; ++rb) {
+    const int16_t* prb_samples = &input_quantized[rb * NOF_SAMPLES_PER_PRB];
+
+    // Determine the exponent using a vector-length-agnostic scan over the resource block.
+    uint8_t exponent = 0;
+    if (SRSRAN_LIKELY(params.data_width != MAX_IQ_WIDTH)) {
+      exponent = sve::determine_bfp_exponent(prb_samples, NOF_SAMPLES_PER_PRB, params.data_width);
+    }
+
+    // Shift original IQ samples right. SVE takes the arithmetic shift amount as a run-time vector operand, so no
+    // immediate shift workaround is required.
+    alignas(64) std::array<int16_t, NOF_SAMPLES_PER_PRB> shifted_data;
+    for (uint64_t i = 0; i < NOF_SAMPLES_PER_PRB; i += svcnth()) {
+      svbool_t  pg  = svwhilelt_b16(i, static_cast<uint64_t>(NOF_SAMPLES_PER_PRB));
+      svint16_t vec = svld1_s16(pg, prb_samples + i);
+      svst1_s16(pg, shifted_data.data() + i, svasr_s16_x(pg, vec, svdup_n_u16(exponent)));
+    }
+
+    // Save exponent of the compressed PRB and pack its compressed IQ samples using utility function.
+    span<uint8_t> output_span(&buffer[rb * prb_size], prb_size);
+    std::memcpy(output_span.data(), &exponent, sizeof(uint8_t));
+    sve::pack_prb_big_endian(
+        output_span.last(output_span.size() - sizeof(uint8_t)), shifted_data.data(), params.data_width);
+  }
+}
+
+void iq_compression_bfp_sve::decompress(span<cbf16_t>                iq_data,
+                                        span<const uint8_t>          compressed_data,
+                                        const ru_compression_params& params)
+{
+  // Use generic implementation if SVE utils don't support requested bit width.
+  if (!sve::iq_width_packing_supported(params.data_width)) {
+    iq_compression_bfp_impl::decompress(iq_data, compressed_data, params);
+    return;
+  }
+
+  // Number of output PRBs.
+  unsigned nof_prbs = iq_data.size() / NOF_SUBCARRIERS_PER_RB;
+
+  // Size in bytes of one compressed PRB using the given compression parameters.
+  unsigned comp_prb_size = get_compressed_prb_size(params).value();
+
+  srsran_assert(compressed_data.size() >= nof_prbs * comp_prb_size,
+                "Input does not contain enough bytes to decompress {} PRBs",
+                nof_prbs);
+
+  quantizer q_out(Q_BIT_WIDTH);
+
+  unsigned out_idx = 0;
+  for (unsigned c_prb_idx = 0; c_prb_idx != nof_prbs; ++c_prb_idx) {
+    // Get view over compressed PRB bytes.
+    span<const uint8_t> comp_prb_buffer(&compressed_data[c_prb_idx * comp_prb_size], comp_prb_size);
+
+    // Compute scaling factor, first byte contains the exponent.
+    uint8_t exponent = comp_prb_buffer[0];
+    float   scaler   = 1 << exponent;
+
+    // Get view over the bytes following the compression parameter.
+    comp_prb_buffer = comp_prb_buffer.last(comp_prb_buffer.size() - sizeof(exponent));
+
+    // Unpack resource block. The SVE stores are predicated, so no padding of the output array is required.
+    alignas(64) std::array<int16_t, NOF_SAMPLES_PER_PRB> unpacked_iq_data;
+    sve::unpack_prb_big_endian(unpacked_iq_data, comp_prb_buffer, params.data_width);
+
+    span<cbf16_t>       output_span = iq_data.subspan(out_idx, NOF_SUBCARRIERS_PER_RB);
+    span<const int16_t> unpacked_span(unpacked_iq_data.data(), NOF_SUBCARRIERS_PER_RB * 2);
+
+    // Convert to complex samples.
+    q_out.to_brain_float(output_span, unpacked_span, scaler);
+    out_idx += NOF_SUBCARRIERS_PER_RB;
+  }
+}
@@ -0,0 +1,194 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#pragma once
+
+#include "srsran/adt/span.h"
+#include "srsran/support/error_handling.h"
+#include <arm_sve.h>
+
+namespace srsran {
+namespace ofh {
+namespace sve {
+
+/// Number of quantized 16-bit samples per resource block.
+static constexpr unsigned NOF_SAMPLES_PER_PRB_SVE = 24;
+
+/// \brief Packs 16bit IQ values of the PRB using 9-bit width and big-endian format.
+///
+/// The packing works on groups of eight samples (72 bits, nine output bytes). Within a group, sample \c k is shifted
+/// left by <tt>7 - k</tt> so that the nine significant bits of consecutive samples become byte-aligned, and a byte
+/// table lookup then splits the shifted lanes into two vectors that OR into the packed big-endian bit stream. All
+/// shift amounts and table indices are generated modulo the group size, so the kernel is vector-length agnostic.
+///
+/// \param[out] comp_prb_buffer Buffer dedicated for storing compressed packed bytes of the PRB.
+/// \param[in]  iq_samples      Pointer to 24 shifted 16bit IQ samples of the PRB.
+inline void pack_prb_9b_big_endian(span<uint8_t> comp_prb_buffer, const int16_t* iq_samples)
+{
+  /// Number of bytes used by 1 packed PRB with IQ samples compressed to 9 bits.
+  static constexpr unsigned BYTES_PER_PRB_9BIT_COMPRESSION = 27;
+
+  srsran_assert(comp_prb_buffer.size() == BYTES_PER_PRB_9BIT_COMPRESSION,
+                "Output buffer has incorrect size for packing compressed samples");
+
+  // Byte shuffle tables gathering the shifted 16-bit lanes into the packed bit stream. Packed byte j takes the high
+  // byte of lane j and the low byte of lane j - 1. An index of 255 selects a byte that reads as zero.
+  alignas(16) static constexpr uint8_t idx_low[16] = {
+      255, 0, 2, 4, 6, 8, 10, 12, 14, 255, 255, 255, 255, 255, 255, 255};
+  alignas(16) static constexpr uint8_t idx_high[16] = {
+      1, 3, 5, 7, 9, 11, 13, 15, 255, 255, 255, 255, 255, 255, 255, 255};
+
+  const svuint8_t tbl_low  = svld1_u8(svwhilelt_b8(0U, 16U), idx_low);
+  const svuint8_t tbl_high = svld1_u8(svwhilelt_b8(0U, 16U), idx_high);
+
+  // Per-lane bit alignment: lane k is shifted left by 7 - (k mod 8).
+  const svuint16_t shifts =
+      svsubr_n_u16_x(svptrue_b16(), svand_n_u16_x(svptrue_b16(), svindex_u16(0, 1), 7), 7);
+  // Mask keeping only the nine shifted significant bits of every lane.
+  const svuint16_t mask = svlsl_u16_x(svptrue_b16(), svdup_n_u16(0x1ff), shifts);
+
+  for (unsigned i_group = 0; i_group != 3; ++i_group) {
+    // Load one group of eight samples. Inactive lanes read as zero.
+    svint16_t vec = svld1_s16(svwhilelt_b16(0U, 8U), iq_samples + (i_group * 8));
+
+    // Shift the samples according to their lane position and keep the significant bits only.
+    svuint16_t vec_shl = svlsl_u16_x(svptrue_b16(), svreinterpret_u16_s16(vec), shifts);
+    vec_shl            = svand_u16_x(svptrue_b16(), vec_shl, mask);
+
+    // Gather the bytes of the packed bit stream and merge the two contributions of every packed byte.
+    svuint8_t bytes  = svreinterpret_u8_u16(vec_shl);
+    svuint8_t packed = svorr_u8_x(svptrue_b8(), svtbl_u8(bytes, tbl_low), svtbl_u8(bytes, tbl_high));
+
+    // Store nine packed bytes.
+    svst1_u8(svwhilelt_b8(0U, 9U), comp_prb_buffer.data() + (i_group * 9), packed);
+  }
+}
+
+/// \brief Packs 16bit IQ values of the PRB using 16-bit width and big-endian format.
+///
+/// \param[out] comp_prb_buffer Buffer dedicated for storing compressed packed bytes of the PRB.
+/// \param[in]  iq_samples      Pointer to 24 16bit IQ samples of the PRB.
+inline void pack_prb_16b_big_endian(span<uint8_t> comp_prb_buffer, const int16_t* iq_samples)
+{
+  /// Number of bytes used by 1 packed PRB with IQ samples compressed to 16 bits.
+  static constexpr unsigned BYTES_PER_PRB_16BIT_COMPRESSION = 48;
+
+  srsran_assert(comp_prb_buffer.size() == BYTES_PER_PRB_16BIT_COMPRESSION,
+                "Output buffer has incorrect size for packing compressed samples");
+
+  int16_t* out = reinterpret_cast<int16_t*>(comp_prb_buffer.data());
+  for (uint64_t i = 0; i < NOF_SAMPLES_PER_PRB_SVE; i += svcnth()) {
+    svbool_t  pg  = svwhilelt_b16(i, static_cast<uint64_t>(NOF_SAMPLES_PER_PRB_SVE));
+    svint16_t vec = svld1_s16(pg, iq_samples + i);
+    svst1_s16(pg, out + i, svrevb_s16_x(pg, vec));
+  }
+}
+
+/// \brief Packs 16bit IQ values of a resource block using the specified width and big-endian format.
+///
+/// \param[out] comp_prb_buffer Buffer dedicated for storing compressed packed bytes of the PRB.
+/// \param[in]  iq_samples      Pointer to 24 16bit IQ samples of the PRB.
+/// \param[in]  iq_width        Bit width of the resulting packed IQ samples.
+inline void pack_prb_big_endian(span<uint8_t> comp_prb_buffer, const int16_t* iq_samples, unsigned iq_width)
+{
+  if (iq_width == 9) {
+    return pack_prb_9b_big_endian(comp_prb_buffer, iq_samples);
+  }
+  if (iq_width == 16) {
+    return pack_prb_16b_big_endian(comp_prb_buffer, iq_samples);
+  }
+  report_fatal_error("Unsupported bit width");
+}
+
+/// \brief Unpacks packed 9bit IQ samples stored as bytes in big-endian format to an array of 16bit signed values.
+///
+/// \param[out] unpacked_iq_data A sequence of 24 integers, corresponding to \c NOF_CARRIERS_PER_RB unpacked IQ pairs.
+/// \param[in]  packed_data      A sequence of 27 packed bytes.
+inline void unpack_prb_9b_big_endian(span<int16_t> unpacked_iq_data, span<const uint8_t> packed_data)
+{
+  // Duplication table: 16-bit lane k is built from packed byte k (most significant) and packed byte k + 1.
+  alignas(16) static constexpr uint8_t idx_dup[16] = {1, 0, 2, 1, 3, 2, 4, 3, 5, 4, 6, 5, 7, 6, 8, 7};
+
+  const svuint8_t tbl_dup = svld1_u8(svwhilelt_b8(0U, 16U), idx_dup);
+
+  // Per-lane bit alignment: lane k is shifted left by k mod 8 to place its nine bits at the 16-bit boundary.
+  const svuint16_t shifts = svand_n_u16_x(svptrue_b16(), svindex_u16(0, 1), 7);
+
+  for (unsigned i_group = 0; i_group != 3; ++i_group) {
+    // Load nine packed bytes of the group. Inactive lanes read as zero.
+    svuint8_t vec_packed = svld1_u8(svwhilelt_b8(0U, 9U), packed_data.data() + (i_group * 9));
+
+    // Duplicate the packed bytes so that every 16-bit lane holds the two bytes contributing to one sample.
+    svuint16_t vec_dup = svreinterpret_u16_u8(svtbl_u8(vec_packed, tbl_dup));
+
+    // Shift left to align the nine significant bits to the 16-bit boundary, then arithmetically shift right by seven
+    // positions to put the bits of interest into the LSB positions while preserving the sign.
+    svuint16_t vec_aligned = svlsl_u16_x(svptrue_b16(), vec_dup, shifts);
+    svint16_t  vec_out     = svasr_n_s16_x(svptrue_b16(), svreinterpret_s16_u16(vec_aligned), 7);
+
+    // Store eight unpacked samples.
+    svst1_s16(svwhilelt_b16(0U, 8U), unpacked_iq_data.data() + (i_group * 8), vec_out);
+  }
+}
+
+/// \brief Unpacks packed 16bit IQ samples stored as bytes in big-endian format to an array of 16bit signed values.
+///
+/// \param[out] unpacked_iq_data A sequence of 24 integers, corresponding to \c NOF_CARRIERS_PER_RB unpacked IQ pairs.
+/// \param[in]  packed_data      A sequence of 48 packed bytes.
+inline void unpack_prb_16b_big_endian(span<int16_t> unpacked_iq_data, span<const uint8_t> packed_data)
+{
+  const int16_t* in = reinterpret_cast<const int16_t*>(packed_data.data());
+  for (uint64_t i = 0; i < NOF_SAMPLES_PER_PRB_SVE; i += svcnth()) {
+    svbool_t  pg  = svwhilelt_b16(i, static_cast<uint64_t>(NOF_SAMPLES_PER_PRB_SVE));
+    svint16_t vec = svld1_s16(pg, in + i);
+    svst1_s16(pg, unpacked_iq_data.data() + i, svrevb_s16_x(pg, vec));
+  }
+}
+
+/// \brief Unpacks packed IQ samples stored as bytes in big-endian format to an array of 16bit signed values.
+///
+/// \param[out] unpacked_iq_data A sequence of 24 integers, corresponding to \c NOF_CARRIERS_PER_RB unpacked IQ pairs.
+/// \param[in]  packed_data      A sequence of input packed bytes.
+/// \param[in]  iq_width         Bit width of the packed IQ samples.
+inline void unpack_prb_big_endian(span<int16_t> unpacked_iq_data, span<const uint8_t> packed_data, unsigned iq_width)
+{
+  if (iq_width == 9) {
+    return unpack_prb_9b_big_endian(unpacked_iq_data, packed_data);
+  }
+  if (iq_width == 16) {
+    return unpack_prb_16b_big_endian(unpacked_iq_data, packed_data);
+  }
+  report_fatal_error("Unsupported bit width");
+}
+
+/// \brief Checks whether the requested bit width is supported by the SVE implementation.
+/// \param[in] iq_width Requested bit width.
+///
+/// \return True in case packing/unpacking with the requested bit width is supported.
+inline bool iq_width_packing_supported(unsigned iq_width)
+{
+  return ((iq_width == 9) || (iq_width == 16));
+}
+
+} // namespace sve
+} // namespace ofh
+} // namespace srsran
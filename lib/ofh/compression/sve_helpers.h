@@ -0,0 +1,77 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief SVE support for OFH Compression algorithms.
+
+#pragma once
+
+#include <algorithm>
+#include <arm_sve.h>
+#include <cstdint>
+#include <cstdlib>
+
+namespace srsran {
+namespace ofh {
+namespace sve {
+
+/// \brief Determines the BFP exponent for a resource block of quantized samples.
+///
+/// The maximum and minimum sample values are reduced in a single vector-length-agnostic pass over the resource block,
+/// so wider SVE implementations scan the block in fewer iterations.
+///
+/// \param[in] prb_samples Pointer to the quantized 16-bit IQ samples of the resource block.
+/// \param[in] nof_samples Number of samples in the resource block.
+/// \param[in] data_width  Compressed samples bit width.
+///
+/// \return Calculated exponent value.
+inline uint8_t determine_bfp_exponent(const int16_t* prb_samples, unsigned nof_samples, unsigned data_width)
+{
+  // Max allowed exponent (accounts for the extra bit used for sign).
+  int max_lzcnt = (16 - data_width) + 1;
+
+  // Reduce maximum and minimum values across the resource block. Inactive lanes of the predicated loads read as zero,
+  // which does not affect the result since zero samples never dominate the maximum absolute value.
+  svint16_t vec_max = svdup_n_s16(0);
+  svint16_t vec_min = svdup_n_s16(0);
+  for (uint64_t i = 0; i < nof_samples; i += svcnth()) {
+    svbool_t  pg  = svwhilelt_b16(i, static_cast<uint64_t>(nof_samples));
+    svint16_t vec = svld1_s16(pg, prb_samples + i);
+    vec_max       = svmax_s16_x(svptrue_b16(), vec_max, vec);
+    vec_min       = svmin_s16_x(svptrue_b16(), vec_min, vec);
+  }
+  int16_t max_s16 = svmaxv_s16(svptrue_b16(), vec_max);
+  int16_t min_s16 = svminv_s16(svptrue_b16(), vec_min);
+
+  // Calculate maximum absolute value, following the same convention as the other vector backends.
+  uint16_t max_abs = std::max(std::abs(static_cast<int>(max_s16)), std::abs(static_cast<int>(min_s16)) - 1);
+
+  // Calculate number of leading zeros of the 16-bit maximum absolute value.
+  int lzc = (max_abs == 0) ? 16 : (__builtin_clz(max_abs) - 16);
+
+  // Calculate exponent.
+  return static_cast<uint8_t>(std::max(max_lzcnt - lzc, 0));
+}
+
+} // namespace sve
+} // namespace ofh
+} // namespace srsran
@@ -24,6 +24,7 @@
 #include "srsran/adt/static_vector.h"
 #include "srsran/ofh/ethernet/ethernet_gw_config.h"
 #include <rte_ethdev.h>
+#include <rte_memcpy.h>
 
 using namespace srsran;
 using namespace ether;
@@ -57,7 +58,7 @@ void dpdk_transmitter_impl::send(span<span<const uint8_t>> frames)
       mbuf->pkt_len  = frame.size();
 
       uint8_t* data = rte_pktmbuf_mtod(mbuf, uint8_t*);
-      std::memcpy(data, frame.data(), frame.size());
+      ::rte_memcpy(data, frame.data(), frame.size());
     }
 
     unsigned nof_sent_packets = ::rte_eth_tx_burst(port_ctx->get_port_id(), 0, mbufs.data(), mbufs.size());
@@ -22,6 +22,7 @@
 
 #include "ethernet_receiver_impl.h"
 #include "ethernet_rx_buffer_impl.h"
+#include "srsran/adt/static_vector.h"
 #include "srsran/instrumentation/traces/ofh_traces.h"
 #include "srsran/ofh/ethernet/ethernet_frame_notifier.h"
 #include "srsran/ofh/ethernet/ethernet_properties.h"
@@ -32,6 +33,7 @@
 #include <future>
 #include <net/if.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <thread>
 #include <unistd.h>
 
@@ -164,21 +166,40 @@ void receiver_impl::receive()
 
   trace_point tp = ofh_tracer.now();
 
-  auto exp_buffer = buffer_pool.reserve();
-  if (!exp_buffer.has_value()) {
+  // Reserve a buffer from the pool for every frame of the burst. Buffers left unused are returned to the pool on
+  // destruction.
+  static_vector<ethernet_rx_buffer_impl, RX_BURST_SIZE> buffers;
+  std::array<::mmsghdr, RX_BURST_SIZE>                  msgs = {};
+  std::array<::iovec, RX_BURST_SIZE>                    iovs;
+  for (unsigned i = 0; i != RX_BURST_SIZE; ++i) {
+    auto exp_buffer = buffer_pool.reserve();
+    if (!exp_buffer.has_value()) {
+      break;
+    }
+    buffers.emplace_back(std::move(exp_buffer.value()));
+
+    span<uint8_t> data_span    = buffers.back().storage();
+    iovs[i].iov_base           = data_span.data();
+    iovs[i].iov_len            = data_span.size();
+    msgs[i].msg_hdr.msg_iov    = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  if (buffers.empty()) {
     logger.warning("No buffer is available for receiving an Ethernet packet");
     return;
   }
-  ethernet_rx_buffer_impl buffer    = std::move(exp_buffer.value());
-  span<uint8_t>           data_span = buffer.storage();
-  auto                    nof_bytes = ::recvfrom(socket_fd, data_span.data(), BUFFER_SIZE, 0, nullptr, nullptr);
 
-  if (nof_bytes < 0) {
-    logger.warning("Ethernet receiver call to recvfrom failed");
+  // Drain a burst of frames from the socket with a single system call.
+  int nof_msgs = ::recvmmsg(socket_fd, msgs.data(), buffers.size(), MSG_DONTWAIT, nullptr);
+  if (nof_msgs < 0) {
+    logger.warning("Ethernet receiver call to recvmmsg failed");
     return;
   }
-  buffer.resize(nof_bytes);
 
-  notifier.get().on_new_frame(unique_rx_buffer(std::move(buffer)));
+  for (unsigned i = 0, e = nof_msgs; i != e; ++i) {
+    buffers[i].resize(msgs[i].msg_len);
+    notifier.get().on_new_frame(unique_rx_buffer(std::move(buffers[i])));
+  }
   ofh_tracer << trace_event("ofh_receiver", tp);
 }
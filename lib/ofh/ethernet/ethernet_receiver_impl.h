@@ -37,6 +37,9 @@ class receiver_impl : public receiver
 {
   static constexpr unsigned BUFFER_SIZE = 9600;
 
+  /// Maximum number of frames drained from the socket with a single system call.
+  static constexpr unsigned RX_BURST_SIZE = 16;
+
   enum class receiver_status { idle, running, stop_requested, stopped };
 
 public:
@@ -34,3 +34,13 @@ void sector_controller::stop()
 {
   ofh_rx.get_controller().stop();
 }
+
+void sector_controller::pause()
+{
+  ofh_rx.get_controller().pause();
+}
+
+void sector_controller::resume()
+{
+  ofh_rx.get_controller().resume();
+}
@@ -40,6 +40,12 @@ public:
   // See interface for documentation.
   void stop() override;
 
+  // See interface for documentation.
+  void pause() override;
+
+  // See interface for documentation.
+  void resume() override;
+
 private:
   receiver& ofh_rx;
 };
@@ -53,6 +53,11 @@ message_receiver_impl::message_receiver_impl(const message_receiver_config&  con
 
 void message_receiver_impl::on_new_frame(ether::unique_rx_buffer buffer)
 {
+  // Drop the frame without decoding while the reception is warm-suspended.
+  if (paused.load(std::memory_order_relaxed)) {
+    return;
+  }
+
   process_new_frame(std::move(buffer));
 }
 
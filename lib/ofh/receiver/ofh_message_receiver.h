@@ -34,6 +34,7 @@
 #include "srsran/ofh/serdes/ofh_message_properties.h"
 #include "srsran/ofh/serdes/ofh_uplane_message_decoder.h"
 #include "srsran/srslog/logger.h"
+#include <atomic>
 
 namespace srsran {
 namespace ofh {
@@ -86,6 +87,15 @@ public:
 
   /// Returns the Ethernet receiver of this Open Fronthaul message receiver.
   virtual ether::receiver& get_ethernet_receiver() = 0;
+
+  /// \brief Warm-suspends the message reception.
+  ///
+  /// While paused, received Ethernet frames are dropped before decoding but the underlying Ethernet receiver keeps
+  /// running, so reception can be resumed without re-initialization.
+  virtual void pause() = 0;
+
+  /// Resumes a warm-suspended message reception.
+  virtual void resume() = 0;
 };
 
 /// Open Fronthaul message receiver interface implementation.
@@ -100,6 +110,12 @@ public:
   // See interface for the documentation.
   ether::receiver& get_ethernet_receiver() override { return *eth_receiver; }
 
+  // See interface for the documentation.
+  void pause() override { paused.store(true, std::memory_order_relaxed); }
+
+  // See interface for the documentation.
+  void resume() override { paused.store(false, std::memory_order_relaxed); }
+
 private:
   /// Processes an Ethernet frame received from the underlying Ethernet link.
   void process_new_frame(ether::unique_rx_buffer buff);
@@ -124,6 +140,8 @@ private:
   std::unique_ptr<data_flow_uplane_uplink_data>         data_flow_uplink;
   std::unique_ptr<data_flow_uplane_uplink_prach>        data_flow_prach;
   std::unique_ptr<ether::receiver>                      eth_receiver;
+  /// Warm suspension flag. While set, received frames are dropped before decoding.
+  std::atomic<bool>                                     paused{false};
 };
 
 } // namespace ofh
@@ -49,6 +49,12 @@ public:
   // See interface for documentation.
   ether::receiver& get_ethernet_receiver() override { return msg_receiver.get_ethernet_receiver(); }
 
+  // See interface for documentation.
+  void pause() override { msg_receiver.pause(); }
+
+  // See interface for documentation.
+  void resume() override { msg_receiver.resume(); }
+
 private:
   message_receiver& msg_receiver;
   task_executor&    executor;
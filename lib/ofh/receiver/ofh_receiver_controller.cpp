@@ -34,3 +34,14 @@ void receiver_controller::stop()
 {
   msg_receiver.get_ethernet_receiver().stop();
 }
+
+void receiver_controller::pause()
+{
+  // The Ethernet receiver keeps running so that the reception can be resumed without re-initialization.
+  msg_receiver.pause();
+}
+
+void receiver_controller::resume()
+{
+  msg_receiver.resume();
+}
@@ -41,6 +41,12 @@ public:
 
   // See interface for documentation.
   void stop() override;
+
+  // See interface for documentation.
+  void pause() override;
+
+  // See interface for documentation.
+  void resume() override;
 };
 
 } // namespace ofh
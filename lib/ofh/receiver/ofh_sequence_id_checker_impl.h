@@ -24,8 +24,8 @@
 
 #include "ofh_sequence_id_checker.h"
 #include "srsran/adt/bounded_bitset.h"
-#include "srsran/adt/circular_map.h"
 #include "srsran/ofh/ofh_constants.h"
+#include <array>
 
 namespace srsran {
 namespace ofh {
@@ -36,17 +36,12 @@ class sequence_id_checker_impl : public sequence_id_checker
   static constexpr int NOF_SEQUENCES_IDENTIFIERS      = 1u << 8;
   static constexpr int HALF_NOF_SEQUENCES_IDENTIFIERS = NOF_SEQUENCES_IDENTIFIERS / 2;
 
-  bounded_bitset<MAX_SUPPORTED_EAXC_ID_VALUE>                  initialized;
-  circular_map<unsigned, uint8_t, MAX_SUPPORTED_EAXC_ID_VALUE> counters;
+  bounded_bitset<MAX_SUPPORTED_EAXC_ID_VALUE>       initialized;
+  std::array<uint8_t, MAX_SUPPORTED_EAXC_ID_VALUE>  counters;
 
 public:
   /// Default constructor.
-  sequence_id_checker_impl() : initialized(MAX_SUPPORTED_EAXC_ID_VALUE)
-  {
-    for (unsigned K = 0; K != MAX_SUPPORTED_EAXC_ID_VALUE; ++K) {
-      counters.insert(K, 0);
-    }
-  }
+  sequence_id_checker_impl() : initialized(MAX_SUPPORTED_EAXC_ID_VALUE) { counters.fill(0); }
 
   // See interface for documentation.
   int update_and_compare_seq_id(unsigned eaxc, uint8_t seq_id) override
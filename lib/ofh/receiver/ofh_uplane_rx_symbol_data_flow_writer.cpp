@@ -32,10 +32,14 @@ void uplane_rx_symbol_data_flow_writer::write_to_resource_grid(unsigned
 {
   trace_point access_repo_tp = ofh_tracer.now();
 
-  slot_point            slot       = results.params.slot;
-  unsigned              symbol     = results.params.symbol_id;
-  const uplink_context& ul_context = ul_context_repo->get(slot, symbol);
-  if (ul_context.empty()) {
+  slot_point slot   = results.params.slot;
+  unsigned   symbol = results.params.symbol_id;
+
+  // The DU cell bandwidth may be narrower than the operating bandwidth of the RU. A value of zero PRBs signals that no
+  // uplink context exists for this slot and symbol. Note that the context itself is not copied out of the repository,
+  // as this path runs for every received User-Plane message.
+  unsigned du_nof_prbs = ul_context_repo->get_grid_nof_prbs(slot, symbol);
+  if (du_nof_prbs == 0) {
     logger.warning("Dropped received Open Fronthaul message as no uplink slot context was found for slot '{}', symbol "
                    "'{}' and eAxC '{}'",
                    results.params.slot,
@@ -49,9 +53,6 @@ void uplane_rx_symbol_data_flow_writer::write_to_resource_grid(unsigned
   // Find resource grid port with eAxC.
   unsigned rg_port = std::distance(ul_eaxc.begin(), std::find(ul_eaxc.begin(), ul_eaxc.end(), eaxc));
   srsran_assert(rg_port < ul_eaxc.size(), "Invalid resource grid port value '{}'", rg_port);
-
-  // The DU cell bandwidth may be narrower than the operating bandwidth of the RU.
-  unsigned du_nof_prbs = ul_context.get_grid_nof_prbs();
   for (const auto& section : results.sections) {
     // Drop the whole section when all PRBs are outside the range of the DU bandwidth and the operating bandwidth of the
     // RU is larger.
@@ -33,7 +33,8 @@
 #include "srsran/ran/resource_allocation/ofdm_symbol_range.h"
 #include "srsran/ran/resource_block.h"
 #include "srsran/srsvec/copy.h"
-#include <mutex>
+#include <atomic>
+#include <limits>
 
 namespace srsran {
 namespace ofh {
@@ -137,34 +138,76 @@ private:
   static_vector<bounded_bitset<MAX_NOF_PRBS * NRE>, MAX_NOF_SUPPORTED_EAXC> re_written;
 };
 
-/// Uplink context repository.
+/// \brief Uplink context repository.
+///
+/// Contexts are stored in a slot-ring-indexed table (slot modulo ring size, symbol subindex) and published with a
+/// per-entry atomic slot tag. Registration is performed by a single writer, the uplink request handler, while every
+/// other operation runs on the receiver execution context. This makes the per-frame context lookup on the reception
+/// critical path wait-free instead of serializing it with a mutex.
+///
+/// The ring must be dimensioned so that an entry is consumed before the registration of the slot that reuses its
+/// index, as was already the case when access was mutex-protected.
 class uplink_context_repository
 {
   /// System frame number maximum value in this repository.
   static constexpr unsigned SFN_MAX_VALUE = 1U << 8;
 
-  std::vector<std::array<uplink_context, MAX_NSYMB_PER_SLOT>> buffer;
-  //: TODO: make this lock free
-  mutable std::mutex mutex;
+  /// Slot tag value that signals an empty entry.
+  static constexpr uint32_t INVALID_SLOT_TAG = std::numeric_limits<uint32_t>::max();
+
+  /// \brief Repository entry.
+  ///
+  /// The slot tag is written last on registration with release semantics, publishing the context to the receiver
+  /// execution context. A lookup only succeeds when the tag matches the requested slot.
+  struct repository_entry {
+    std::atomic<uint32_t> slot_tag{INVALID_SLOT_TAG};
+    uplink_context        context;
+  };
+
+  std::vector<std::array<repository_entry, MAX_NSYMB_PER_SLOT>> buffer;
+
+  /// Returns the tag that identifies the given slot within the repository ring domain.
+  static uint32_t slot_tag_of(slot_point slot)
+  {
+    slot_point entry_slot(slot.numerology(), slot.sfn() % SFN_MAX_VALUE, slot.slot_index());
+    return entry_slot.system_slot();
+  }
 
   /// Returns the entry of the repository for the given slot and symbol.
-  uplink_context& entry(slot_point slot, unsigned symbol)
+  repository_entry& entry(slot_point slot, unsigned symbol)
   {
     srsran_assert(symbol < MAX_NSYMB_PER_SLOT, "Invalid symbol index '{}'", symbol);
 
-    slot_point entry_slot(slot.numerology(), slot.sfn() % SFN_MAX_VALUE, slot.slot_index());
-    unsigned   index = entry_slot.system_slot() % buffer.size();
-    return buffer[index][symbol];
+    return buffer[slot_tag_of(slot) % buffer.size()][symbol];
   }
 
   /// Returns the entry of the repository for the given slot and symbol.
-  const uplink_context& entry(slot_point slot, unsigned symbol) const
+  const repository_entry& entry(slot_point slot, unsigned symbol) const
   {
     srsran_assert(symbol < MAX_NSYMB_PER_SLOT, "Invalid symbol index '{}'", symbol);
 
-    slot_point entry_slot(slot.numerology(), slot.sfn() % SFN_MAX_VALUE, slot.slot_index());
-    unsigned   index = entry_slot.system_slot() % buffer.size();
-    return buffer[index][symbol];
+    return buffer[slot_tag_of(slot) % buffer.size()][symbol];
+  }
+
+  /// Returns the published context for the given slot and symbol, or nullptr when no context exists.
+  uplink_context* find(slot_point slot, unsigned symbol)
+  {
+    repository_entry& e = entry(slot, symbol);
+    return (e.slot_tag.load(std::memory_order_acquire) == slot_tag_of(slot)) ? &e.context : nullptr;
+  }
+
+  /// Returns the published context for the given slot and symbol, or nullptr when no context exists.
+  const uplink_context* find(slot_point slot, unsigned symbol) const
+  {
+    const repository_entry& e = entry(slot, symbol);
+    return (e.slot_tag.load(std::memory_order_acquire) == slot_tag_of(slot)) ? &e.context : nullptr;
+  }
+
+  /// Unpublishes and clears the given entry.
+  void clear_entry(repository_entry& e)
+  {
+    e.slot_tag.store(INVALID_SLOT_TAG, std::memory_order_relaxed);
+    e.context = {};
   }
 
 public:
@@ -174,26 +217,43 @@ public:
   void
   add(const resource_grid_context& context, const shared_resource_grid& grid, const ofdm_symbol_range& symbol_range)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-
     for (unsigned symbol_id = symbol_range.start(), symbol_end = symbol_range.stop(); symbol_id != symbol_end;
          ++symbol_id) {
-      entry(context.slot, symbol_id) = uplink_context(symbol_id, context, grid);
+      repository_entry& e = entry(context.slot, symbol_id);
+
+      // Unpublish the entry before rewriting it, so that concurrent receiver lookups observe an empty entry instead
+      // of a partially written context.
+      e.slot_tag.store(INVALID_SLOT_TAG, std::memory_order_release);
+      e.context = uplink_context(symbol_id, context, grid);
+      e.slot_tag.store(slot_tag_of(context.slot), std::memory_order_release);
     }
   }
 
   /// Writes to the grid at the given slot, port, symbol and start resource element the given IQ buffer.
   void write_grid(slot_point slot, unsigned port, unsigned symbol, unsigned start_re, span<const cbf16_t> re_iq_buffer)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    entry(slot, symbol).write_grid(port, start_re, re_iq_buffer);
+    if (uplink_context* context = find(slot, symbol)) {
+      context->write_grid(port, start_re, re_iq_buffer);
+    }
   }
 
-  /// Returns the entry of the repository for the given slot and symbol.
+  /// Returns a copy of the context for the given slot and symbol, or an empty context when none exists.
   uplink_context get(slot_point slot, unsigned symbol) const
   {
-    std::lock_guard<std::mutex> lock(mutex);
-    return entry(slot, symbol).copy();
+    if (const uplink_context* context = find(slot, symbol)) {
+      return context->copy();
+    }
+    return {};
+  }
+
+  /// \brief Returns the number of PRBs of the grid configured for the given slot and symbol, or zero when no context
+  /// exists.
+  ///
+  /// Unlike \ref get, this query does not copy the context, making it suitable for the reception critical path.
+  unsigned get_grid_nof_prbs(slot_point slot, unsigned symbol) const
+  {
+    const uplink_context* context = find(slot, symbol);
+    return (context != nullptr) ? context->get_grid_nof_prbs() : 0U;
   }
 
   /// \brief Tries to pop a complete resource grid for the given slot and symbol.
@@ -202,13 +262,16 @@ public:
   expected<uplink_context::uplink_context_resource_grid_info> try_popping_complete_resource_grid_symbol(slot_point slot,
                                                                                                         unsigned symbol)
   {
-    std::lock_guard<std::mutex> lock(mutex);
+    uplink_context* context = find(slot, symbol);
+    if (context == nullptr) {
+      return make_unexpected(default_error_t{});
+    }
 
-    auto result = entry(slot, symbol).try_getting_complete_resource_grid();
+    auto result = context->try_getting_complete_resource_grid();
 
-    // Symbol is complete or exists. Clear the context.
+    // Symbol is complete. Clear the context.
     if (result.has_value()) {
-      entry(slot, symbol) = {};
+      clear_entry(entry(slot, symbol));
     }
 
     return result;
@@ -217,26 +280,21 @@ public:
   /// Pops a resource grid for the given slot and symbol.
   expected<uplink_context::uplink_context_resource_grid_info> pop_resource_grid_symbol(slot_point slot, unsigned symbol)
   {
-    std::lock_guard<std::mutex> lock(mutex);
-
-    auto& result = entry(slot, symbol);
+    uplink_context* context = find(slot, symbol);
 
-    // Symbol does not exists. Do nothing.
-    if (result.empty()) {
+    // Symbol does not exist. Do nothing.
+    if (context == nullptr || context->empty()) {
       return make_unexpected(default_error_t{});
     }
 
     // Pop and clear the slot/symbol information.
-    uplink_context::uplink_context_resource_grid_info info = result.pop_uplink_context_resource_grid_info();
+    uplink_context::uplink_context_resource_grid_info info = context->pop_uplink_context_resource_grid_info();
+    clear_entry(entry(slot, symbol));
     return info;
   }
 
   /// Clears the repository entry for the given slot and symbol.
-  void clear(slot_point slot, unsigned symbol)
-  {
-    std::lock_guard<std::mutex> lock(mutex);
-    entry(slot, symbol) = {};
-  }
+  void clear(slot_point slot, unsigned symbol) { clear_entry(entry(slot, symbol)); }
 };
 
 } // namespace ofh
@@ -192,6 +192,11 @@ void realtime_timing_worker::poll()
     return;
   }
 
+  // Offset of the wake-up time from the nominal boundary of the current symbol.
+  update_jitter_statistics(ns_fraction - std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             current_symbol_index * symbol_duration),
+                           delta);
+
   // Check if we have missed more than one symbol.
   if (SRSRAN_UNLIKELY(delta > 1)) {
     logger.info("Real-time timing worker woke up late, skipped '{}' symbols", delta);
@@ -216,6 +221,30 @@ void realtime_timing_worker::poll()
   }
 }
 
+void realtime_timing_worker::update_jitter_statistics(std::chrono::nanoseconds lateness, unsigned delta)
+{
+  uint64_t lateness_ns = std::max<int64_t>(lateness.count(), 0);
+  jitter_sum_ns += lateness_ns;
+  jitter_max_ns = std::max(jitter_max_ns, lateness_ns);
+  ++jitter_nof_samples;
+
+  // Print the aggregated statistics once per second.
+  symbols_since_print += delta;
+  if (symbols_since_print < nof_symbols_per_sec) {
+    return;
+  }
+
+  logger.debug("Timing worker wake-up jitter: avg={}ns max={}ns over '{}' wake-ups",
+               jitter_sum_ns / jitter_nof_samples,
+               jitter_max_ns,
+               jitter_nof_samples);
+
+  jitter_sum_ns       = 0;
+  jitter_max_ns       = 0;
+  jitter_nof_samples  = 0;
+  symbols_since_print = 0;
+}
+
 void realtime_timing_worker::notify_slot_symbol_point(slot_symbol_point slot)
 {
   ofh_tracer << instant_trace_event("ofh_timing_notify_symbol", instant_trace_event::cpu_scope::global);
@@ -64,6 +64,11 @@ class realtime_timing_worker : public controller, public ota_symbol_boundary_not
   const std::chrono::nanoseconds                 sleep_time;
   unsigned                                       previous_symb_index = 0;
   std::atomic<worker_status>                     status{worker_status::idle};
+  /// Wake-up jitter statistics, aggregated over one second and printed from the timing thread.
+  uint64_t jitter_sum_ns         = 0;
+  uint64_t jitter_max_ns         = 0;
+  unsigned jitter_nof_samples    = 0;
+  unsigned symbols_since_print   = 0;
 
 public:
   realtime_timing_worker(srslog::basic_logger& logger_, task_executor& executor_, const realtime_worker_cfg& cfg);
@@ -74,6 +79,13 @@ public:
   // See interface for documentation.
   void stop() override;
 
+  /// The OTA timing is shared by all sectors and keeps running while a sector is warm-suspended, so pausing is a
+  /// no-op here.
+  void pause() override {}
+
+  // See interface for documentation.
+  void resume() override {}
+
   // See interface for documentation.
   void subscribe(span<ota_symbol_boundary_notifier*> notifiers) override;
 
@@ -84,6 +96,9 @@ private:
   /// Polls the system time checking for the start of a new OTA symbol.
   void poll();
 
+  /// Accumulates the wake-up jitter of the current symbol and prints the aggregated statistics once per second.
+  void update_jitter_statistics(std::chrono::nanoseconds lateness, unsigned delta);
+
   /// Notifies the given slot symbol point through the registered notifiers.
   void notify_slot_symbol_point(slot_symbol_point slot);
 };
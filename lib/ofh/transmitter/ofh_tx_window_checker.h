@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "srsran/instrumentation/slot_watchdog.h"
 #include "srsran/ofh/timing/ofh_ota_symbol_boundary_notifier.h"
 #include "srsran/srslog/srslog.h"
 #include <atomic>
@@ -61,7 +62,10 @@ public:
     slot_symbol_point rg_point(slot, 0, nof_symbols);
     rg_point -= advance_time_in_symbols;
 
-    if (ota_symbol_point < rg_point) {
+    bool late = !(ota_symbol_point < rg_point);
+    slot_watchdog.record_tx_window(slot, late);
+
+    if (!late) {
       return false;
     }
 
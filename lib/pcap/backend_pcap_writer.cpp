@@ -100,7 +100,7 @@ void backend_pcap_writer::write_pdu(byte_buffer pdu)
     return;
   }
   if (not backend_exec.defer([this, pdu = std::move(pdu)]() { write_pdu_impl(pdu); })) {
-    logger.warning("Dropped {} PCAP PDU. Cause: Task executor queue is full", layer_name);
+    report_dropped_pdu();
   }
 }
 
@@ -114,7 +114,16 @@ void backend_pcap_writer::write_pdu(pcap_pdu_data pdu)
     return;
   }
   if (not backend_exec.defer([this, pdu = std::move(pdu)]() { write_context_pdu_impl(pdu); })) {
-    logger.warning("Dropped {} PCAP PDU. Cause: Task executor queue is full", layer_name);
+    report_dropped_pdu();
+  }
+}
+
+void backend_pcap_writer::report_dropped_pdu()
+{
+  // Log the first drop and every subsequent 1024th drop with the accumulated count.
+  uint32_t drops = dropped_pdus.fetch_add(1, std::memory_order_relaxed) + 1;
+  if (drops == 1 or drops % 1024 == 0) {
+    logger.warning("Dropped {} {} PCAP PDUs. Cause: Task executor queue is full", drops, layer_name);
   }
 }
 
@@ -74,6 +74,7 @@ class backend_pcap_writer
   srslog::basic_logger& logger;
   pcap_file_writer      writer;
   std::atomic<bool>     is_open{true};
+  std::atomic<uint32_t> dropped_pdus{0};
 
 public:
   backend_pcap_writer(unsigned           dlt_,
@@ -100,6 +101,10 @@ private:
   void write_pdu_impl(const byte_buffer& pdu);
 
   void write_context_pdu_impl(const pcap_pdu_data& pdu);
+
+  /// \brief Accounts for a PDU that could not be enqueued to the backend executor.
+  /// Logging is rate-limited, so that bursts of drops during overload do not flood the log from the caller thread.
+  void report_dropped_pdu();
 };
 
 } // namespace srsran
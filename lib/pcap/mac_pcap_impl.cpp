@@ -30,9 +30,13 @@ static constexpr uint16_t MAC_DLT = 157;
 
 static int nr_pcap_pack_mac_context_to_buffer(const mac_nr_context_info& context, span<uint8_t> buffer);
 
-mac_pcap_impl::mac_pcap_impl(const std::string& filename_, mac_pcap_type type_, task_executor& backend_exec_) :
+mac_pcap_impl::mac_pcap_impl(const std::string& filename_,
+                             mac_pcap_type      type_,
+                             task_executor&     backend_exec_,
+                             mac_pcap_filter    filter_) :
   logger(srslog::fetch_basic_logger("ALL")),
   type(type_),
+  filter(filter_),
   writer(type == mac_pcap_type::dlt ? MAC_DLT : UDP_DLT, "MAC", filename_, backend_exec_)
 {
 }
@@ -49,6 +53,11 @@ void mac_pcap_impl::close()
 
 void mac_pcap_impl::push_pdu(const mac_nr_context_info& context, const_span<uint8_t> pdu)
 {
+  // Evaluate the capture filter before copying the PDU into a byte_buffer.
+  if (!is_write_enabled() || !filter.matches(context)) {
+    // skip.
+    return;
+  }
   auto pdu_buffer = byte_buffer::create(pdu);
   if (not pdu_buffer.has_value()) {
     return;
@@ -58,7 +67,7 @@ void mac_pcap_impl::push_pdu(const mac_nr_context_info& context, const_span<uint
 
 void mac_pcap_impl::push_pdu(const mac_nr_context_info& context, byte_buffer pdu)
 {
-  if (!is_write_enabled() || pdu.empty()) {
+  if (!is_write_enabled() || !filter.matches(context) || pdu.empty()) {
     // skip.
     return;
   }
@@ -130,11 +139,13 @@ int nr_pcap_pack_mac_context_to_buffer(const mac_nr_context_info& context, span<
   return offset;
 }
 
-std::unique_ptr<mac_pcap>
-srsran::create_mac_pcap(const std::string& filename, mac_pcap_type pcap_type, task_executor& backend_exec)
+std::unique_ptr<mac_pcap> srsran::create_mac_pcap(const std::string& filename,
+                                                  mac_pcap_type      pcap_type,
+                                                  task_executor&     backend_exec,
+                                                  mac_pcap_filter    filter)
 {
   srsran_assert(not filename.empty(), "File name is empty");
-  return std::make_unique<mac_pcap_impl>(filename, pcap_type, backend_exec);
+  return std::make_unique<mac_pcap_impl>(filename, pcap_type, backend_exec, filter);
 }
 
 std::unique_ptr<mac_pcap> srsran::create_null_mac_pcap()
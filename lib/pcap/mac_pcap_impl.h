@@ -40,7 +40,10 @@ constexpr uint8_t     MAC_NR_HARQID                  = 0x06;
 class mac_pcap_impl final : public mac_pcap
 {
 public:
-  explicit mac_pcap_impl(const std::string& filename_, mac_pcap_type type, task_executor& backend_exec);
+  explicit mac_pcap_impl(const std::string& filename_,
+                         mac_pcap_type      type,
+                         task_executor&     backend_exec,
+                         mac_pcap_filter    filter = {});
 
   ~mac_pcap_impl() override;
 
@@ -60,6 +63,7 @@ public:
 private:
   srslog::basic_logger& logger;
   mac_pcap_type         type;
+  mac_pcap_filter       filter;
   backend_pcap_writer   writer;
 };
 
@@ -25,6 +25,7 @@
 #include "../support/sdu_window_impl.h"
 #include "srsran/instrumentation/traces/up_traces.h"
 #include "srsran/support/bit_encoding.h"
+#include <thread>
 
 using namespace srsran;
 
@@ -58,10 +59,20 @@ pdcp_entity_rx::pdcp_entity_rx(uint32_t                        ue_index,
     logger.log_warning("t-Reordering of infinity on DRBs is not advised. It can cause data stalls.");
   }
   logger.log_info("PDCP configured. {}", cfg);
+}
+
+pdcp_entity_rx::~pdcp_entity_rx()
+{
+  // Completions that are already queued on the UE UL executor check this flag and bail out; they are serialized with
+  // the destruction by the UE UL executor.
+  *alive_flag = false;
 
-  // TODO: implement usage of crypto_executor
-  (void)ue_ul_executor;
-  (void)crypto_executor;
+  // Wait until no offloaded task can reference the entity or its executors anymore. Crypto tasks run on a worker pool
+  // and stop touching the entity right after re-injecting their result, so this wait is bounded by the deciphering
+  // time of the in-flight PDUs.
+  while (pdus_in_crypto.load(std::memory_order_acquire) != 0) {
+    std::this_thread::yield();
+  }
 }
 
 void pdcp_entity_rx::handle_pdu(byte_buffer_chain buf)
@@ -78,17 +89,17 @@ void pdcp_entity_rx::handle_pdu(byte_buffer_chain buf)
     return;
   }
 
-  auto pdu_copy = buf.deep_copy();
-  if (not pdu_copy.has_value()) {
-    metrics_add_dropped_pdus(1);
-    logger.log_error("Dropping PDU: Copy failed. pdu_len={}", buf.length());
-    return;
-  }
-  byte_buffer pdu = std::move(pdu_copy.value());
-
-  pdcp_dc_field dc = pdcp_pdu_get_dc(*(pdu.begin()));
+  pdcp_dc_field dc = pdcp_pdu_get_dc(*(buf.begin()));
   if (is_srb() || dc == pdcp_dc_field::data) {
-    handle_data_pdu(std::move(pdu));
+    // Data PDUs are deciphered in place, which requires exclusive ownership of the bytes. Control PDUs are read-only
+    // and are handled directly on the received segments without copying.
+    auto pdu_copy = buf.deep_copy();
+    if (not pdu_copy.has_value()) {
+      metrics_add_dropped_pdus(1);
+      logger.log_error("Dropping PDU: Copy failed. pdu_len={}", buf.length());
+      return;
+    }
+    handle_data_pdu(std::move(pdu_copy.value()));
   } else {
     handle_control_pdu(std::move(buf));
   }
@@ -206,18 +217,76 @@ void pdcp_entity_rx::handle_data_pdu(byte_buffer pdu)
     return;
   }
 
-  // Apply deciphering and integrity check
+  // Apply deciphering and integrity check. If a free engine replica is available, offload the crypto work to the
+  // crypto executor; the RX window restores sequence order before SDU delivery, regardless of the completion order.
+  // When the pool is exhausted (or parallel crypto is disabled), process inline, which also provides backpressure.
+  if (sec_engine != nullptr and not free_crypto_engines.empty()) {
+    const unsigned engine_idx = free_crypto_engines.back();
+    free_crypto_engines.pop_back();
+    dispatch_crypto(std::move(pdu), rcvd_count, engine_idx);
+    return;
+  }
+
   expected<byte_buffer> exp_buf = apply_deciphering_and_integrity_check(std::move(pdu), rcvd_count);
   if (!exp_buf.has_value()) {
     logger.log_warning("Failed deciphering and integrity check. count={}", rcvd_count);
     return;
   }
 
+  process_deciphered_pdu(std::move(exp_buf.value()), rcvd_count);
+}
+
+void pdcp_entity_rx::dispatch_crypto(byte_buffer pdu, uint32_t rcvd_count, unsigned engine_idx)
+{
+  std::shared_ptr<security::security_engine_rx> engine   = crypto_engine_pool[engine_idx];
+  const uint32_t                                pool_gen = crypto_pool_generation;
+  const unsigned                                hdr_size = cfg.sn_size == pdcp_sn_size::size12bits ? 2 : 3;
+
+  pdus_in_crypto.fetch_add(1, std::memory_order_relaxed);
+  bool queued = crypto_executor.execute(
+      [this, engine = std::move(engine), pool_gen, engine_idx, hdr_size, rcvd_count, pdu = std::move(pdu)]() mutable {
+        security::security_result result = engine->decrypt_and_verify_integrity(std::move(pdu), hdr_size, rcvd_count);
+        if (not ue_ul_executor.execute(
+                [this, pool_gen, engine_idx, result = std::move(result), alive = alive_flag]() mutable {
+                  if (not *alive) {
+                    return;
+                  }
+                  handle_crypto_result(pool_gen, engine_idx, std::move(result));
+                })) {
+          logger.log_warning("Dropped PDU, UE UL executor queue is full. count={}", rcvd_count);
+        }
+        // Do not touch the entity after this point; the destructor only waits for this counter.
+        pdus_in_crypto.fetch_sub(1, std::memory_order_release);
+      });
+  if (not queued) {
+    pdus_in_crypto.fetch_sub(1, std::memory_order_release);
+    free_crypto_engines.push_back(engine_idx);
+    logger.log_warning("Dropped PDU, crypto executor queue is full. count={}", rcvd_count);
+  }
+}
+
+void pdcp_entity_rx::handle_crypto_result(uint32_t pool_generation, unsigned engine_idx, security::security_result result)
+{
+  // Return the engine replica, unless the pool has been rebuilt while the task was in flight.
+  if (pool_generation == crypto_pool_generation) {
+    free_crypto_engines.push_back(engine_idx);
+  }
+
+  const uint32_t        rcvd_count = result.count;
+  expected<byte_buffer> exp_buf    = handle_security_result(std::move(result));
+  if (!exp_buf.has_value()) {
+    logger.log_warning("Failed deciphering and integrity check. count={}", rcvd_count);
+    return;
+  }
+
+  process_deciphered_pdu(std::move(exp_buf.value()), rcvd_count);
+}
+
+void pdcp_entity_rx::process_deciphered_pdu(byte_buffer pdu, uint32_t rcvd_count)
+{
   // After checking the integrity, we can discard the header.
   unsigned hdr_size = cfg.sn_size == pdcp_sn_size::size12bits ? 2 : 3;
-  exp_buf.value().trim_head(hdr_size);
-
-  pdu = std::move(exp_buf.value());
+  pdu.trim_head(hdr_size);
 
   /*
    * Check valid rcvd_count:
@@ -435,8 +504,12 @@ expected<byte_buffer> pdcp_entity_rx::apply_deciphering_and_integrity_check(byte
   // The data unit that is integrity protected is the PDU header
   // and the data part of the PDU before ciphering.
 
-  unsigned                  hdr_size = cfg.sn_size == pdcp_sn_size::size12bits ? 2 : 3;
-  security::security_result result   = sec_engine->decrypt_and_verify_integrity(std::move(buf), hdr_size, count);
+  unsigned hdr_size = cfg.sn_size == pdcp_sn_size::size12bits ? 2 : 3;
+  return handle_security_result(sec_engine->decrypt_and_verify_integrity(std::move(buf), hdr_size, count));
+}
+
+expected<byte_buffer> pdcp_entity_rx::handle_security_result(security::security_result result)
+{
   if (!result.buf.has_value()) {
     switch (result.buf.error()) {
       case srsran::security::security_error::integrity_failure:
@@ -512,6 +585,21 @@ void pdcp_entity_rx::configure_security(security::sec_128_as_config sec_cfg,
   sec_engine     = std::make_unique<security::security_engine_impl>(
       sec_cfg, bearer_id, direction, integrity_enabled, ciphering_enabled);
 
+  // Rebuild the pool of engine replicas used for parallel crypto processing. The replicas of the previous pool are
+  // kept alive by the in-flight tasks that captured them; bumping the generation prevents those tasks from returning
+  // their replica index to the new pool.
+  crypto_engine_pool.clear();
+  free_crypto_engines.clear();
+  crypto_pool_generation++;
+  if (is_drb() and cfg.custom.max_nof_parallel_pdus > 1) {
+    for (unsigned i = 0; i != cfg.custom.max_nof_parallel_pdus; ++i) {
+      crypto_engine_pool.push_back(std::make_shared<security::security_engine_impl>(
+          sec_cfg, bearer_id, direction, integrity_enabled, ciphering_enabled));
+      free_crypto_engines.push_back(i);
+    }
+    logger.log_info("Parallel crypto processing enabled. max_nof_parallel_pdus={}", cfg.custom.max_nof_parallel_pdus);
+  }
+
   logger.log_info("Security configured: NIA{} ({}) NEA{} ({}) domain={}",
                   sec_cfg.integ_algo,
                   integrity_enabled,
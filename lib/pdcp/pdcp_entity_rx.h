@@ -73,6 +73,7 @@ public:
                  timer_factory                   ue_ul_timer_factory_,
                  task_executor&                  ue_ul_executor_,
                  task_executor&                  crypto_executor_);
+  ~pdcp_entity_rx() override;
 
   void handle_pdu(byte_buffer_chain buf) override;
 
@@ -138,6 +139,20 @@ private:
   /// \param buf The data PDU to be handled (including header and payload)
   void handle_data_pdu(byte_buffer buf);
 
+  /// \brief Runs the RX window logic (duplicate detection, storage, in-order delivery and reordering timers) for a
+  /// deciphered and integrity-verified PDU. Must be called on the UE UL executor.
+  /// \param pdu The deciphered PDU, still including the PDCP header.
+  /// \param rcvd_count The COUNT value computed at PDU arrival.
+  void process_deciphered_pdu(byte_buffer pdu, uint32_t rcvd_count);
+
+  /// \brief Dispatches deciphering and integrity verification of a PDU to the crypto executor, using the engine
+  /// replica at the given index. The result is re-injected into the UE UL executor, where the existing RX window
+  /// takes care of restoring sequence order before SDU delivery.
+  void dispatch_crypto(byte_buffer pdu, uint32_t rcvd_count, unsigned engine_idx);
+
+  /// \brief Handles the result of an offloaded crypto task on the UE UL executor.
+  void handle_crypto_result(uint32_t pool_generation, unsigned engine_idx, security::security_result result);
+
   /// \brief Handles a received control PDU.
   /// \param buf The control PDU to be handled (including header and payload)
   void handle_control_pdu(byte_buffer_chain buf);
@@ -149,6 +164,29 @@ private:
   /// Apply deciphering and integrity check to the PDU
   expected<byte_buffer> apply_deciphering_and_integrity_check(byte_buffer buf, uint32_t count);
 
+  /// Maps a security engine result to the corresponding metrics, logs and upper layer notifications.
+  expected<byte_buffer> handle_security_result(security::security_result result);
+
+  /// Pool of security engine replicas used for parallel crypto processing of DRB PDUs. Each in-flight PDU holds
+  /// exactly one replica, as the engines keep per-call cipher state. Replicas are handed out and returned only on the
+  /// UE UL executor; in-flight tasks keep the shared_ptr of the engine they captured alive across reconfigurations.
+  std::vector<std::shared_ptr<security::security_engine_rx>> crypto_engine_pool;
+
+  /// Indices of the currently free engine replicas. Only accessed from the UE UL executor.
+  std::vector<unsigned> free_crypto_engines;
+
+  /// Incremented whenever the engine pool is rebuilt, so that completions of tasks dispatched against an old pool do
+  /// not return their replica index to the new pool.
+  uint32_t crypto_pool_generation = 0;
+
+  /// Number of PDUs currently on the crypto executor. The destructor spins until this reaches zero, so that no
+  /// offloaded task can reference the entity or its executors after destruction.
+  std::atomic<uint32_t> pdus_in_crypto{0};
+
+  /// Cleared on destruction. Completions re-injected into the UE UL executor check this flag before touching the
+  /// entity; destruction and completions are serialized by the UE UL executor, so a plain bool suffices.
+  std::shared_ptr<bool> alive_flag = std::make_shared<bool>(true);
+
   /*
    * Notifiers and handlers
    */
@@ -272,9 +272,7 @@ void pdcp_entity_tx::handle_status_report(byte_buffer_chain status)
   logger.log_info("Status report. fmc={}", fmc);
 
   // Discard any SDU with COUNT < FMC
-  for (uint32_t count = st.tx_next_ack; count < fmc; count++) {
-    discard_pdu(count);
-  }
+  discard_pdus_up_to(fmc);
 
   // Evaluate bitmap: discard any SDU with the bit in the bitmap set to 1
   unsigned bit = 0;
@@ -726,6 +724,41 @@ void pdcp_entity_tx::discard_pdu(uint32_t count)
   }
 }
 
+void pdcp_entity_tx::discard_pdus_up_to(uint32_t highest_count)
+{
+  if (!cfg.discard_timer.has_value()) {
+    logger.log_debug("Cannot discard PDUs. No discard timer configured. highest_count={}", highest_count);
+    return;
+  }
+  if (highest_count <= st.tx_next_ack) {
+    // Nothing to discard.
+    return;
+  }
+  uint32_t end = std::min(highest_count, st.tx_next);
+  logger.log_debug("Discarding PDUs. from_count={} to_count={}", st.tx_next_ack, end);
+
+  // Sweep the contiguous COUNT range once, notifying lower layers and removing present entries.
+  for (uint32_t count = st.tx_next_ack; count != end; ++count) {
+    if (!tx_window->has_sn(count)) {
+      continue;
+    }
+    // Notify lower layers of the discard. It's the RLC to actually discard, if no segment was transmitted yet.
+    lower_dn.on_discard_pdu(SN(count));
+    tx_window->remove_sn(count);
+  }
+
+  // Update TX_NEXT_ACK to oldest element in tx_window
+  st.tx_next_ack = end;
+  while (st.tx_next_ack < st.tx_next && !tx_window->has_sn(st.tx_next_ack)) {
+    st.tx_next_ack++;
+  }
+
+  // Update TX_TRANS if it falls out of the tx_window
+  if (st.tx_trans < st.tx_next_ack) {
+    st.tx_trans = st.tx_next_ack;
+  }
+}
+
 std::unique_ptr<sdu_window<pdcp_entity_tx::pdcp_tx_sdu_info>> pdcp_entity_tx::create_tx_window(pdcp_sn_size sn_size_)
 {
   std::unique_ptr<sdu_window<pdcp_tx_sdu_info>> tx_window_;
@@ -218,6 +218,14 @@ private:
   /// \param count The COUNT value of the PDU to be discarded.
   void discard_pdu(uint32_t count);
 
+  /// \brief Discard all PDUs with a COUNT lower than the provided COUNT in a single sweep over the tx_window.
+  ///
+  /// Contrary to \ref discard_pdu, PDUs missing in the tx_window (e.g. already confirmed) are skipped silently and
+  /// the TX state variables are only updated once at the end of the sweep.
+  ///
+  /// \param highest_count The COUNT value up to which (exclusive) PDUs shall be discarded.
+  void discard_pdus_up_to(uint32_t highest_count);
+
   /// \brief Discard timer information and, only for AM, a copy of the SDU for data recovery procedure.
   struct pdcp_tx_sdu_info {
     uint32_t     count;
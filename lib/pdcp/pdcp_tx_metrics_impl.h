@@ -23,54 +23,72 @@
 #pragma once
 
 #include "srsran/pdcp/pdcp_tx_metrics.h"
-#include <mutex>
+#include <atomic>
 
 namespace srsran {
 
+/// \brief PDCP TX metrics accumulator.
+///
+/// Counters are updated from the entity's own execution context only, so plain relaxed atomics are sufficient for the
+/// sporadic metrics reports read from other threads, and no lock is taken in the PDU processing path. The counter
+/// block is aligned to a cache line so hot-path updates do not dirty a line shared with neighboring entity state.
 class pdcp_tx_metrics : pdcp_tx_metrics_interface
 {
-  pdcp_tx_metrics_container metrics = {};
-  std::mutex                metrics_mutex;
+  struct alignas(64) {
+    std::atomic<uint32_t> num_sdus{0};
+    std::atomic<uint32_t> num_sdu_bytes{0};
+    std::atomic<uint32_t> num_pdus{0};
+    std::atomic<uint32_t> num_pdu_bytes{0};
+    std::atomic<uint32_t> num_discard_timeouts{0};
+  } metrics;
 
 public:
   void metrics_add_sdus(uint32_t num_sdus_, size_t num_sdu_bytes_)
   {
-    std::lock_guard<std::mutex> lock(metrics_mutex);
-    metrics.num_sdus += num_sdus_;
-    metrics.num_sdu_bytes += num_sdu_bytes_;
+    metrics.num_sdus.fetch_add(num_sdus_, std::memory_order_relaxed);
+    metrics.num_sdu_bytes.fetch_add(num_sdu_bytes_, std::memory_order_relaxed);
   }
 
   void metrics_add_pdus(uint32_t num_pdus_, size_t num_pdu_bytes_)
   {
-    std::lock_guard<std::mutex> lock(metrics_mutex);
-    metrics.num_pdus += num_pdus_;
-    metrics.num_pdu_bytes += num_pdu_bytes_;
+    metrics.num_pdus.fetch_add(num_pdus_, std::memory_order_relaxed);
+    metrics.num_pdu_bytes.fetch_add(num_pdu_bytes_, std::memory_order_relaxed);
   }
 
   void metrics_add_discard_timouts(uint32_t num_discard_timeouts_)
   {
-    std::lock_guard<std::mutex> lock(metrics_mutex);
-    metrics.num_discard_timeouts += num_discard_timeouts_;
+    metrics.num_discard_timeouts.fetch_add(num_discard_timeouts_, std::memory_order_relaxed);
   }
 
   pdcp_tx_metrics_container get_metrics() final
   {
-    std::lock_guard<std::mutex> lock(metrics_mutex);
-    return metrics;
+    pdcp_tx_metrics_container ret;
+    ret.num_sdus             = metrics.num_sdus.load(std::memory_order_relaxed);
+    ret.num_sdu_bytes        = metrics.num_sdu_bytes.load(std::memory_order_relaxed);
+    ret.num_pdus             = metrics.num_pdus.load(std::memory_order_relaxed);
+    ret.num_pdu_bytes        = metrics.num_pdu_bytes.load(std::memory_order_relaxed);
+    ret.num_discard_timeouts = metrics.num_discard_timeouts.load(std::memory_order_relaxed);
+    return ret;
   }
 
   pdcp_tx_metrics_container get_metrics_and_reset() final
   {
-    std::lock_guard<std::mutex> lock(metrics_mutex);
-    pdcp_tx_metrics_container   ret = metrics;
-    metrics                         = {};
+    pdcp_tx_metrics_container ret;
+    ret.num_sdus             = metrics.num_sdus.exchange(0, std::memory_order_relaxed);
+    ret.num_sdu_bytes        = metrics.num_sdu_bytes.exchange(0, std::memory_order_relaxed);
+    ret.num_pdus             = metrics.num_pdus.exchange(0, std::memory_order_relaxed);
+    ret.num_pdu_bytes        = metrics.num_pdu_bytes.exchange(0, std::memory_order_relaxed);
+    ret.num_discard_timeouts = metrics.num_discard_timeouts.exchange(0, std::memory_order_relaxed);
     return ret;
   }
 
   void reset_metrics() final
   {
-    std::lock_guard<std::mutex> lock(metrics_mutex);
-    metrics = {};
+    metrics.num_sdus.store(0, std::memory_order_relaxed);
+    metrics.num_sdu_bytes.store(0, std::memory_order_relaxed);
+    metrics.num_pdus.store(0, std::memory_order_relaxed);
+    metrics.num_pdu_bytes.store(0, std::memory_order_relaxed);
+    metrics.num_discard_timeouts.store(0, std::memory_order_relaxed);
   }
 };
 } // namespace srsran
@@ -22,7 +22,9 @@
 
 #include "dft_processor_fftw_impl.h"
 #include "srsran/support/srsran_assert.h"
+#include <mutex>
 #include <pwd.h>
+#include <set>
 #include <unistd.h>
 
 using namespace srsran;
@@ -32,6 +34,8 @@ std::mutex dft_processor_fftw_impl::mutex_init = {};
 dft_processor_fftw_impl::fftw_wisdom_filename dft_processor_fftw_impl::wisdom_filename =
     dft_processor_fftw_impl::fftw_wisdom_filename();
 
+bool dft_processor_fftw_impl::wisdom_imported = false;
+
 unsigned dft_processor_fftw_impl::fftw_count = 0;
 
 static void dft_processor_fftw_import_wisdom(const char* full_path)
@@ -126,8 +130,9 @@ dft_processor_fftw_impl::dft_processor_fftw_impl(const dft_processor_fftw_config
   // Avoid that two or more plan creations are called at same time.
   std::lock_guard<std::mutex> lock(mutex_init);
 
-  // Load FFT wisdom if it is not marked to avoid.
-  if (!fftw_config.avoid_wisdom) {
+  // Load FFT wisdom if it is not marked to avoid. The wisdom is process-wide, so it is imported only once, with the
+  // first instance, and shared by all subsequent plan creations.
+  if (!fftw_config.avoid_wisdom && !wisdom_imported) {
     // Use file name given in the configuration by default.
     if (!fftw_config.wisdom_filename.empty()) {
       wisdom_filename = fftw_config.wisdom_filename;
@@ -142,6 +147,8 @@ dft_processor_fftw_impl::dft_processor_fftw_impl(const dft_processor_fftw_config
     if (!wisdom_filename.empty()) {
       dft_processor_fftw_import_wisdom(wisdom_filename.get());
     }
+
+    wisdom_imported = true;
   }
 
   // Prepare FFTW plan creation arguments.
@@ -165,6 +172,15 @@ dft_processor_fftw_impl::dft_processor_fftw_impl(const dft_processor_fftw_config
                 fftw_size,
                 dft_processor::direction_to_string(dir).c_str());
 
+  // Persist the accumulated wisdom the first time a plan with this size and direction is created, so that a later
+  // unclean termination does not lose it and the next start-up finds all plans in the wisdom file.
+  static std::set<uint64_t> known_plans;
+  uint64_t                  plan_key = (static_cast<uint64_t>(fftw_size) << 1U) | ((fftw_sign == FFTW_FORWARD) ? 1U : 0U);
+  if (!wisdom_filename.empty() && (known_plans.count(plan_key) == 0)) {
+    dft_processor_fftw_export_wisdom(wisdom_filename.get());
+    known_plans.insert(plan_key);
+  }
+
   // Count as another successful instance.
   ++fftw_count;
 }
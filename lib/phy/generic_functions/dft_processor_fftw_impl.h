@@ -96,6 +96,8 @@ private:
   static std::mutex mutex_init;
   /// If wisdom was loaded earlier by any instance, it contains the FFTW wisdom file name. Otherwise, it is empty.
   static fftw_wisdom_filename wisdom_filename;
+  /// Set to true once the wisdom file has been imported, so each instance does not re-read it.
+  static bool wisdom_imported;
   /// Counts the number of FFTW instances. Used to clean up the FFTW context.
   static unsigned fftw_count;
   /// Stores the DFT direction.
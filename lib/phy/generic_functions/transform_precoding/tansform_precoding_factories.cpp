@@ -44,7 +44,7 @@ public:
   std::unique_ptr<transform_precoder> create() override
   {
     // Create DFT processors for each valid number of PRBs within the limit.
-    transform_precoder_dft_impl::collection_dft_processors dft_processors;
+    transform_precoder_dft_impl::collection_dft_processors dft_processors(max_nof_prb);
     for (unsigned nof_prb = 0; nof_prb != max_nof_prb; ++nof_prb) {
       if (is_transform_precoding_nof_prb_valid(nof_prb)) {
         // Prepare DFT size.
@@ -52,7 +52,7 @@ public:
         dft_config.dir  = dft_processor::direction::INVERSE;
         dft_config.size = NRE * nof_prb;
 
-        dft_processors.emplace(nof_prb, dft_factory->create(dft_config));
+        dft_processors[nof_prb] = dft_factory->create(dft_config);
       }
     }
 
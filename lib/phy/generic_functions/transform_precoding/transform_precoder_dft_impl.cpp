@@ -38,13 +38,15 @@ void transform_precoder_dft_impl::deprecode_ofdm_symbol(span<cf_t> x, span<const
   // Calculate number of resource blocks.
   unsigned M_rb = M_sc / NRE;
   srsran_assert(is_transform_precoding_nof_prb_valid(M_rb), "The number of PRB (i.e., {}) is not valid.", M_rb);
-  srsran_assert(dft_processors.count(M_rb), "No DFT processor available for the number of PRB (i.e., {}).", M_rb);
+  srsran_assert(M_rb < dft_processors.size() && dft_processors[M_rb],
+                "No DFT processor available for the number of PRB (i.e., {}).",
+                M_rb);
 
   // Calculate scaling factor.
   float scaling_factor = 1.0F / std::sqrt(static_cast<float>(M_sc));
 
   // Select DFT processor.
-  dft_processor& dft = *dft_processors.at(M_rb);
+  dft_processor& dft = *dft_processors[M_rb];
 
   // Convert input data in the DFT input.
   srsvec::copy(dft.get_input(), y);
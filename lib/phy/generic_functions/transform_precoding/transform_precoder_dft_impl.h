@@ -26,7 +26,7 @@
 #include "srsran/phy/generic_functions/dft_processor.h"
 #include "srsran/phy/generic_functions/transform_precoding/transform_precoder.h"
 #include "srsran/ran/transform_precoding/transform_precoding_helpers.h"
-#include <unordered_map>
+#include <vector>
 
 namespace srsran {
 
@@ -34,26 +34,31 @@ namespace srsran {
 class transform_precoder_dft_impl : public transform_precoder
 {
 public:
-  /// Collection of DFT processors type.
-  using collection_dft_processors = std::unordered_map<unsigned, std::unique_ptr<dft_processor>>;
+  /// \brief Collection of DFT processors type.
+  ///
+  /// Indexed by number of PRB, so that the per-symbol processor selection is an array access instead of a hash
+  /// lookup. Entries for invalid transform precoding sizes are left empty.
+  using collection_dft_processors = std::vector<std::unique_ptr<dft_processor>>;
 
   /// Implementation.
   transform_precoder_dft_impl(collection_dft_processors dft_processors_) : dft_processors(std::move(dft_processors_))
   {
 #ifdef ASSERTS_ENABLED
-    for (const auto& entry : dft_processors) {
-      unsigned M_rb     = entry.first;
+    for (unsigned M_rb = 0, M_rb_end = dft_processors.size(); M_rb != M_rb_end; ++M_rb) {
+      if (!dft_processors[M_rb]) {
+        continue;
+      }
       unsigned M_sc     = M_rb * NRE;
-      unsigned dft_size = entry.second->get_size();
+      unsigned dft_size = dft_processors[M_rb]->get_size();
       srsran_assert(
           is_transform_precoding_nof_prb_valid(M_rb), "Invalid number of resource elements (i.e., {}).", M_rb);
       srsran_assert(M_sc == dft_size,
                     "The DFT size (i.e., {}) is not consistent with the number of subcarriers (i.e., {}).",
                     dft_size,
                     M_sc);
-      srsran_assert(entry.second->get_direction() == dft_processor::direction::INVERSE,
+      srsran_assert(dft_processors[M_rb]->get_direction() == dft_processor::direction::INVERSE,
                     "Invalid DFT direction (i.e., {}).",
-                    dft_processor::direction_to_string(entry.second->get_direction()));
+                    dft_processor::direction_to_string(dft_processors[M_rb]->get_direction()));
     }
 #endif // ASSERTS_ENABLED
   }
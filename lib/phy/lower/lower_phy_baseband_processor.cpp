@@ -105,7 +105,13 @@ void lower_phy_baseband_processor::dl_process(baseband_gateway_timestamp timesta
   }
 
   // Get transmit baseband buffer. It blocks if all the buffers are enqueued for transmission.
-  std::unique_ptr<baseband_gateway_buffer_dynamic> dl_buffer = tx_buffers.pop_blocking();
+  std::unique_ptr<baseband_gateway_buffer_dynamic> dl_buffer;
+  if (!tx_buffers.try_pop(dl_buffer)) {
+    // The transmit buffer ring is exhausted - trace the stall while waiting for the transmitter to release a buffer.
+    trace_point stall_tp = ru_tracer.now();
+    dl_buffer            = tx_buffers.pop_blocking();
+    ru_tracer << trace_event("tx_buffer_ring_stall", stall_tp);
+  }
 
   // Throttling mechanism to keep a maximum latency of one millisecond in the transmit buffer based on the latest
   // received timestamp.
@@ -172,7 +178,14 @@ void lower_phy_baseband_processor::ul_process()
   }
 
   // Get receive buffer.
-  std::unique_ptr<baseband_gateway_buffer_dynamic> rx_buffer = rx_buffers.pop_blocking();
+  std::unique_ptr<baseband_gateway_buffer_dynamic> rx_buffer;
+  if (!rx_buffers.try_pop(rx_buffer)) {
+    // The receive buffer ring is exhausted - trace the stall while waiting for the uplink processor to release a
+    // buffer. A long stall here translates into a radio overflow.
+    trace_point stall_tp = ru_tracer.now();
+    rx_buffer            = rx_buffers.pop_blocking();
+    ru_tracer << trace_event("rx_buffer_ring_stall", stall_tp);
+  }
 
   // Receive baseband.
   trace_point                         tp          = ru_tracer.now();
@@ -109,6 +109,9 @@ public:
         report_fatal_error_if_not(tx_buffer_size > 0, "The radio does not have a transmitter optimal buffer size.");
         tx_buffer_size = (nof_samples_per_slot / tx_buffer_size) * tx_buffer_size;
         break;
+      case lower_phy_baseband_buffer_size_policy::single_symbol:
+        tx_buffer_size = nof_samples_per_slot / get_nsymb_per_slot(config.cp);
+        break;
     }
 
     unsigned rx_buffer_size = config.bb_gateway->get_receiver_optimal_buffer_size();
@@ -126,6 +129,9 @@ public:
         report_fatal_error_if_not(rx_buffer_size > 0, "The radio does not have a transmitter optimal buffer size.");
         rx_buffer_size = (nof_samples_per_slot / rx_buffer_size) * rx_buffer_size;
         break;
+      case lower_phy_baseband_buffer_size_policy::single_symbol:
+        rx_buffer_size = nof_samples_per_slot / get_nsymb_per_slot(config.cp);
+        break;
     }
 
     // Get transmit time offset between the UL and the DL.
@@ -121,20 +121,24 @@ void ofdm_symbol_demodulator_impl::demodulate(resource_grid_writer& grid,
   // Get phase correction (TS 138.211, Section 5.4)
   cf_t phase_compensation = phase_compensation_table.get_coefficient(symbol_index);
 
-  // Apply scaling and phase compensation.
-  srsvec::sc_prod(dft_output, phase_compensation * scale, compensated_output);
+  // Views of the frequency domain data mapped to the grid, skipping the guard bands.
+  span<cf_t> upper_bound(&compensated_output[dft_size - rg_size / 2], rg_size / 2);
+  span<cf_t> lower_bound(&compensated_output[0], rg_size / 2);
+
+  // Apply scaling and phase compensation only to the subcarriers mapped to the grid.
+  srsvec::sc_prod(dft_output.last(rg_size / 2), phase_compensation * scale, upper_bound);
+  srsvec::sc_prod(dft_output.first(rg_size / 2), phase_compensation * scale, lower_bound);
 
   // Compensate DFT window offset phase shift.
   if (!window_phase_compensation.empty()) {
-    srsvec::prod(compensated_output, window_phase_compensation, compensated_output);
+    srsvec::prod(upper_bound, span<const cf_t>(window_phase_compensation).last(rg_size / 2), upper_bound);
+    srsvec::prod(lower_bound, span<const cf_t>(window_phase_compensation).first(rg_size / 2), lower_bound);
   }
 
   // Map the upper bound frequency domain data.
-  span<cf_t> upper_bound(&compensated_output[dft_size - rg_size / 2], rg_size / 2);
   grid.put(port_index, symbol_index % nsymb, 0, upper_bound);
 
   // Map the lower bound frequency domain data.
-  span<cf_t> lower_bound(&compensated_output[0], rg_size / 2);
   grid.put(port_index, symbol_index % nsymb, rg_size / 2, lower_bound);
 }
 
@@ -178,7 +178,12 @@ private:
 
 } // namespace detail
 
-/// Implements a software generic lower PHY downlink baseband processor.
+/// \brief Implements a software generic lower PHY downlink baseband processor.
+///
+/// Whenever the destination baseband buffer can hold a complete OFDM symbol and the processing timestamp is aligned
+/// with the symbol start, the OFDM modulator writes the symbol (cyclic prefix included) directly into the buffer
+/// handed to \ref process, avoiding any intermediate copy. The internal temporary buffer is used only when the
+/// transmission window is not aligned with symbol boundaries.
 class downlink_processor_baseband_impl : public downlink_processor_baseband
 {
 public:
@@ -33,27 +33,40 @@ resource_grid_impl::resource_grid_impl(unsigned                          nof_por
   nof_ports(nof_ports_),
   nof_symb(nof_symb_),
   nof_subc(nof_subc_),
-  writer(rg_buffer, empty),
-  reader(rg_buffer, empty),
+  writer(rg_buffer, dirty_symbols),
+  reader(rg_buffer, dirty_symbols),
   mapper(nof_ports_, nof_subc_, writer, std::move(precoder_))
 {
+  srsran_assert(nof_ports <= MAX_PORTS, "The number of ports (i.e., {}) exceeds the maximum (i.e., {}).", nof_ports, MAX_PORTS);
+
   // Reserve memory for the internal buffer.
   rg_buffer.reserve({nof_subc, nof_symb, nof_ports});
 
-  // Set all the resource elements to zero.
-  srsvec::zero(rg_buffer.get_data());
-  empty = (1U << nof_ports) - 1;
+  // Set all the resource elements to zero. The grid is large and not read back immediately: non-temporal stores
+  // avoid flushing the caches while zeroing it.
+  srsvec::zero_nt(rg_buffer.get_data());
+  for (std::atomic<unsigned>& port_dirty_symbols : dirty_symbols) {
+    port_dirty_symbols.store(0, std::memory_order_relaxed);
+  }
 }
 
 void resource_grid_impl::set_all_zero()
 {
-  // For each non-empty port, set the underlying resource elements to zero.
+  // For each port, set the underlying resource elements of the OFDM symbols written since the last zeroing to zero.
+  // Symbols that have not been written are already zero: their zeroing cost is skipped, which makes the reset cost
+  // proportional to the grid occupation instead of the bandwidth.
   for (unsigned port = 0; port != nof_ports; ++port) {
-    if (!reader.is_port_empty(port)) {
-      srsvec::zero(rg_buffer.get_view<static_cast<unsigned>(resource_grid_dimensions::port)>({port}));
+    unsigned dirty_mask = dirty_symbols[port].load(std::memory_order_relaxed);
+    if (dirty_mask == 0) {
+      continue;
+    }
+    for (unsigned l = 0; l != nof_symb; ++l) {
+      if ((dirty_mask & (1U << l)) != 0) {
+        srsvec::zero_nt(rg_buffer.get_view({l, port}));
+      }
     }
+    dirty_symbols[port].store(0, std::memory_order_relaxed);
   }
-  empty = (1U << nof_ports) - 1;
 }
 
 resource_grid_writer& resource_grid_impl::get_writer()
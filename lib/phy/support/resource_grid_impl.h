@@ -39,10 +39,14 @@ class resource_grid_impl : public resource_grid
 {
 private:
   std::array<cbf16_t, NRE * MAX_RB> temp;
-  std::atomic<unsigned>             empty = {};
-  unsigned                          nof_ports;
-  unsigned                          nof_symb;
-  unsigned                          nof_subc;
+  /// \brief Per-port bitmaps of the OFDM symbols written since the last grid zeroing.
+  ///
+  /// They allow \ref set_all_zero to clear only the regions actually written, and the reader to skip the storage
+  /// access for symbols that are known to be zero.
+  std::array<std::atomic<unsigned>, MAX_PORTS> dirty_symbols;
+  unsigned                                     nof_ports;
+  unsigned                                     nof_symb;
+  unsigned                                     nof_subc;
 
   /// \brief Stores the resource grid data.
   ///
@@ -29,6 +29,43 @@ using namespace srsran;
 
 using precoding_buffer_type = static_re_buffer<precoding_constants::MAX_NOF_PORTS, NRE * MAX_RB, cbf16_t>;
 
+namespace {
+
+/// \brief Compiled RE-mapping plan.
+///
+/// Stores the per-symbol allocation masks derived from an allocation and a reserved RE pattern list, so that recurring
+/// allocations (e.g., full-buffer PDSCH repeating every slot, or the many per-codeblock mapping calls of one transport
+/// block) do not re-derive the pattern masks on every call.
+struct re_mapping_plan {
+  /// Allocation pattern the plan was compiled from.
+  re_pattern_list pattern;
+  /// Reserved RE pattern the plan was compiled from.
+  re_pattern_list reserved;
+  /// Set to true when the plan contains valid masks.
+  bool valid = false;
+  /// Per-symbol allocation masks, with the reserved RE excluded.
+  std::array<bounded_bitset<MAX_RB * NRE>, MAX_NSYMB_PER_SLOT> symbol_masks;
+
+  /// Returns the per-symbol masks for the given patterns, recompiling the plan only when the signature changes.
+  span<const bounded_bitset<MAX_RB * NRE>> get_masks(const re_pattern_list& pattern_, const re_pattern_list& reserved_)
+  {
+    if (!valid || !(pattern == pattern_) || !(reserved == reserved_)) {
+      for (unsigned i_symbol = 0; i_symbol != MAX_NSYMB_PER_SLOT; ++i_symbol) {
+        symbol_masks[i_symbol] = bounded_bitset<MAX_RB * NRE>(MAX_RB * NRE);
+        pattern_.get_inclusion_mask(symbol_masks[i_symbol], i_symbol);
+        reserved_.get_exclusion_mask(symbol_masks[i_symbol], i_symbol);
+      }
+      pattern  = pattern_;
+      reserved = reserved_;
+      valid    = true;
+    }
+
+    return symbol_masks;
+  }
+};
+
+} // namespace
+
 // Resource element allocation patterns within a resource block for PDSCH DM-RS type 1.
 static const re_prb_mask& get_re_mask_type_1(unsigned cdm_group_id)
 {
@@ -304,12 +341,15 @@ void resource_grid_mapper_impl::map(symbol_buffer&                 buffer,
                 nof_layers,
                 nof_layers_range);
 
+  // Thread-local mapping plan. The mapper can be used concurrently (e.g., from per-codeblock PDSCH tasks), so each
+  // worker keeps its own compiled plan and replays it while the allocation signature does not change.
+  thread_local re_mapping_plan                    plan;
+  span<const bounded_bitset<max_nof_subcarriers>> symbol_masks = plan.get_masks(pattern, reserved);
+
   unsigned re_count = 0;
   for (unsigned i_symbol = 0; i_symbol != MAX_NSYMB_PER_SLOT; ++i_symbol) {
-    // Get the symbol RE mask.
-    bounded_bitset<max_nof_subcarriers> symbol_re_mask(max_nof_subcarriers);
-    pattern.get_inclusion_mask(symbol_re_mask, i_symbol);
-    reserved.get_exclusion_mask(symbol_re_mask, i_symbol);
+    // Get the symbol RE mask from the mapping plan.
+    const bounded_bitset<max_nof_subcarriers>& symbol_re_mask = symbol_masks[i_symbol];
 
     // Get the number of active RE in the OFDM symbol.
     unsigned nof_re_symbol = symbol_re_mask.count();
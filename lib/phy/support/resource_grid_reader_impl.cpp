@@ -23,6 +23,7 @@
 #include "resource_grid_reader_impl.h"
 #include "srsran/srsvec/conversion.h"
 #include "srsran/srsvec/copy.h"
+#include "srsran/srsvec/zero.h"
 
 using namespace srsran;
 
@@ -92,6 +93,12 @@ span<cf_t> resource_grid_reader_impl::get(span<cf_t>                          sy
                 mask_count,
                 symbols.size());
 
+  // Known-zero fast path: the symbol has not been written since the last grid zeroing.
+  if (is_symbol_clean(port, l)) {
+    srsvec::zero(symbols.first(mask_count));
+    return symbols.last(symbols.size() - mask_count);
+  }
+
   // Do a straight copy if the elements of the mask are all contiguous.
   if (mask_count and mask.is_contiguous()) {
     srsvec::convert(symbols.first(mask_count), symb.subspan(mask.find_lowest(), mask_count));
@@ -141,6 +148,12 @@ span<cbf16_t> resource_grid_reader_impl::get(span<cbf16_t>
                 mask_count,
                 symbols.size());
 
+  // Known-zero fast path: the symbol has not been written since the last grid zeroing.
+  if (is_symbol_clean(port, l)) {
+    srsvec::zero(symbols.first(mask_count));
+    return symbols.last(symbols.size() - mask_count);
+  }
+
   // Do a straight copy if the elements of the mask are all contiguous.
   if (mask_count and mask.is_contiguous()) {
     srsvec::copy(symbols.first(mask_count), symb.subspan(mask.find_lowest(), mask_count));
@@ -178,6 +191,12 @@ void resource_grid_reader_impl::get(span<cf_t> symbols,
                 port,
                 get_nof_ports());
 
+  // Known-zero fast path: the symbol has not been written since the last grid zeroing.
+  if (is_symbol_clean(port, l)) {
+    srsvec::zero(symbols);
+    return;
+  }
+
   // Access the OFDM symbol from the resource grid.
   span<const cbf16_t> rg_symbol = data.get_view({l, port});
 
@@ -211,6 +230,12 @@ void resource_grid_reader_impl::get(span<cbf16_t> symbols, unsigned port, unsign
                 port,
                 get_nof_ports());
 
+  // Known-zero fast path: the symbol has not been written since the last grid zeroing.
+  if (is_symbol_clean(port, l)) {
+    srsvec::zero(symbols);
+    return;
+  }
+
   // Access the OFDM symbol from the resource grid.
   span<const cbf16_t> rg_symbol = data.get_view({l, port});
 
@@ -229,6 +254,13 @@ span<const cbf16_t> resource_grid_reader_impl::get_view(unsigned port, unsigned
                 port,
                 get_nof_ports());
 
+  // Known-zero fast path: the symbol has not been written since the last grid zeroing, so a view of a static
+  // all-zero symbol is returned without accessing the grid storage.
+  if (is_symbol_clean(port, l)) {
+    static const std::array<cbf16_t, MAX_RB * NRE> zero_symbol = {};
+    return span<const cbf16_t>(zero_symbol).first(get_nof_subc());
+  }
+
   // Access the OFDM symbol from the resource grid.
   return data.get_view({l, port});
 }
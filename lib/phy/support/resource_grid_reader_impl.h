@@ -21,8 +21,11 @@
  */
 
 #pragma once
+#include "srsran/phy/constants.h"
 #include "srsran/phy/support/resource_grid_dimensions.h"
 #include "srsran/phy/support/resource_grid_reader.h"
+#include <array>
+#include <atomic>
 
 namespace srsran {
 
@@ -32,8 +35,10 @@ class resource_grid_reader_impl : public resource_grid_reader
 public:
   using storage_type = tensor<static_cast<unsigned>(resource_grid_dimensions::all), cbf16_t, resource_grid_dimensions>;
 
-  /// Constructs a resource grid reader implementation from a tensor.
-  resource_grid_reader_impl(const storage_type& data_, const std::atomic<unsigned>& empty_) : data(data_), empty(empty_)
+  /// Constructs a resource grid reader implementation from a tensor and the grid dirty symbol state.
+  resource_grid_reader_impl(const storage_type&                                 data_,
+                            const std::array<std::atomic<unsigned>, MAX_PORTS>& dirty_symbols_) :
+    data(data_), dirty_symbols(dirty_symbols_)
   {
   }
 
@@ -75,12 +80,22 @@ public:
   // See interface for documentation.
   span<const cbf16_t> get_view(unsigned port, unsigned l) const override;
 
-  /// Checks if a port is empty.
-  bool is_port_empty(unsigned i_port) const { return (empty & (1U << i_port)) != 0; }
+  /// Checks if a port is empty, i.e., none of its OFDM symbols has been written since the last grid zeroing.
+  bool is_port_empty(unsigned i_port) const { return dirty_symbols[i_port].load(std::memory_order_relaxed) == 0; }
+
+  /// \brief Checks if an OFDM symbol of a port is clean.
+  ///
+  /// A clean symbol has not been written since the last grid zeroing: its underlying storage is known to be zero and
+  /// does not need to be accessed.
+  bool is_symbol_clean(unsigned i_port, unsigned l) const
+  {
+    return (dirty_symbols[i_port].load(std::memory_order_relaxed) & (1U << l)) == 0;
+  }
 
 private:
-  const storage_type&          data;
-  const std::atomic<unsigned>& empty;
+  const storage_type& data;
+  /// Per-port bitmaps of the OFDM symbols written since the last grid zeroing.
+  const std::array<std::atomic<unsigned>, MAX_PORTS>& dirty_symbols;
 };
 
 } // namespace srsran
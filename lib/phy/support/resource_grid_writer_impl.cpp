@@ -59,7 +59,7 @@ span<const cf_t> resource_grid_writer_impl::put(unsigned
   // Get view of the OFDM symbol subcarriers.
   span<cbf16_t> symb = data.get_view({l, port}).subspan(k_init, mask.size());
 
-  clear_empty(port);
+  mark_symbol_dirty(port, l);
 
   unsigned mask_count = mask.count();
   srsran_assert(mask_count <= symbols.size(),
@@ -98,7 +98,7 @@ span<const cbf16_t> resource_grid_writer_impl::put(unsigned
   // Get view of the OFDM symbol subcarriers.
   span<cbf16_t> symb = data.get_view({l, port}).subspan(k_init, mask.size());
 
-  clear_empty(port);
+  mark_symbol_dirty(port, l);
 
   unsigned mask_count = mask.count();
   srsran_assert(mask_count <= symbols.size(),
@@ -142,7 +142,7 @@ void resource_grid_writer_impl::put(unsigned port, unsigned l, unsigned k_init,
 
   // Copy resource elements.
   srsvec::convert(rg_symbol.subspan(k_init, symbols.size()), symbols);
-  clear_empty(port);
+  mark_symbol_dirty(port, l);
 }
 
 void resource_grid_writer_impl::put(unsigned            port,
@@ -175,7 +175,7 @@ void resource_grid_writer_impl::put(unsigned            port,
     i_re += stride;
   }
 
-  clear_empty(port);
+  mark_symbol_dirty(port, l);
 }
 
 span<cbf16_t> resource_grid_writer_impl::get_view(unsigned port, unsigned l)
@@ -188,5 +188,8 @@ span<cbf16_t> resource_grid_writer_impl::get_view(unsigned port, unsigned l)
                 "Port index (i.e., {}) exceeds the maximum number of ports (i.e., {})",
                 port,
                 get_nof_ports());
+
+  // The caller gets a mutable view of the symbol: it must be considered written.
+  mark_symbol_dirty(port, l);
   return data.get_view({l, port});
 }
@@ -21,8 +21,11 @@
  */
 
 #pragma once
+#include "srsran/phy/constants.h"
 #include "srsran/phy/support/resource_grid_dimensions.h"
 #include "srsran/phy/support/resource_grid_writer.h"
+#include <array>
+#include <atomic>
 
 namespace srsran {
 
@@ -32,8 +35,11 @@ class resource_grid_writer_impl : public resource_grid_writer
 public:
   using storage_type = tensor<static_cast<unsigned>(resource_grid_dimensions::all), cbf16_t, resource_grid_dimensions>;
 
-  /// Constructs a resource grid writer implementation from a tensor.
-  resource_grid_writer_impl(storage_type& data_, std::atomic<unsigned>& empty_) : data(data_), empty(empty_) {}
+  /// Constructs a resource grid writer implementation from a tensor and the grid dirty symbol state.
+  resource_grid_writer_impl(storage_type& data_, std::array<std::atomic<unsigned>, MAX_PORTS>& dirty_symbols_) :
+    data(data_), dirty_symbols(dirty_symbols_)
+  {
+  }
 
   // See interface for documentation.
   unsigned get_nof_ports() const override;
@@ -67,12 +73,16 @@ public:
   // See interface for documentation.
   span<cbf16_t> get_view(unsigned port, unsigned l) override;
 
-  /// Helper function to mark port as not empty.
-  inline void clear_empty(unsigned i_port) { empty &= ~(1U << i_port); }
+  /// Helper function to mark an OFDM symbol of a port as written since the last grid zeroing.
+  inline void mark_symbol_dirty(unsigned i_port, unsigned l)
+  {
+    dirty_symbols[i_port].fetch_or(1U << l, std::memory_order_relaxed);
+  }
 
 private:
-  storage_type&          data;
-  std::atomic<unsigned>& empty;
+  storage_type& data;
+  /// Per-port bitmaps of the OFDM symbols written since the last grid zeroing.
+  std::array<std::atomic<unsigned>, MAX_PORTS>& dirty_symbols;
 };
 
 } // namespace srsran
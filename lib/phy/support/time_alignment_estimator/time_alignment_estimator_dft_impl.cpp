@@ -48,7 +48,11 @@ time_alignment_measurement time_alignment_estimator_dft_impl::estimate(span<cons
                                                                        double                          max_ta)
 {
   span<cf_t> channel_observed_freq = idft->get_input();
-  srsvec::zero(channel_observed_freq);
+
+  // Clear only the region written by the previous estimation, the rest of the DFT input is already zero.
+  srsvec::zero(channel_observed_freq.first(nof_used_re));
+  nof_used_re = re_mask.size();
+
   re_mask.for_each(0, re_mask.size(), [&channel_observed_freq, &pilots_lse, i_lse = 0U](unsigned i_re) mutable {
     channel_observed_freq[i_re] = pilots_lse[i_lse++];
   });
@@ -68,7 +72,11 @@ time_alignment_measurement time_alignment_estimator_dft_impl::estimate(span<cons
       stride,
       idft->get_size());
   span<cf_t> channel_observed_freq = idft->get_input();
-  srsvec::zero(channel_observed_freq);
+
+  // Clear only the region written by the previous estimation, the rest of the DFT input is already zero.
+  srsvec::zero(channel_observed_freq.first(nof_used_re));
+  nof_used_re = stride * symbols.size();
+
   for (unsigned i_symbol = 0, i_re = 0, i_end = stride * symbols.size(); i_re != i_end; i_re += stride) {
     channel_observed_freq[i_re] = symbols[i_symbol++];
   }
@@ -25,6 +25,7 @@
 #include "srsran/adt/bounded_bitset.h"
 #include "srsran/phy/generic_functions/dft_processor.h"
 #include "srsran/phy/support/time_alignment_estimator/time_alignment_estimator.h"
+#include "srsran/srsvec/zero.h"
 
 namespace srsran {
 
@@ -45,6 +46,9 @@ public:
     srsran_assert(idft, "Invalid DFT processor.");
     srsran_assert(idft->get_direction() == dft_processor::direction::INVERSE, "Invalid DFT processor direction.");
     srsran_assert(idft->get_size() == dft_size, "Invalid DFT processor size (i.e., {}).", idft->get_size());
+
+    // Zero the DFT input once: each estimation only clears the region written by the previous one.
+    srsvec::zero(idft->get_input());
   }
 
   // See interface for documentation.
@@ -61,6 +65,13 @@ private:
   /// DFT processor for converting frequency domain to time domain.
   std::unique_ptr<dft_processor> idft;
 
+  /// \brief Number of DFT input resource elements written by the last estimation.
+  ///
+  /// The DFT input outside the first \c nof_used_re elements is guaranteed to be zero, so each estimation clears only
+  /// this region instead of the entire DFT input. The used region is bounded by the OFDM symbol bandwidth, which is
+  /// typically a fraction of the DFT size.
+  unsigned nof_used_re = 0;
+
   /// Estimates the TA assuming the complex symbols are already in the DFT input.
   time_alignment_measurement estimate(subcarrier_spacing scs, double max_ta);
 };
@@ -98,15 +98,87 @@ private:
   std::string type;
 };
 
+/// LDPC decoder decorator that caps the maximum number of iterations depending on the codeblock modulation.
+class ldpc_decoder_iteration_budget_impl : public ldpc_decoder
+{
+public:
+  ldpc_decoder_iteration_budget_impl(std::unique_ptr<ldpc_decoder>         decoder_,
+                                     const ldpc_decoder_iteration_budgets& budgets_) :
+    decoder(std::move(decoder_)), budgets(budgets_)
+  {
+  }
+
+  // See interface for the documentation.
+  std::optional<unsigned> decode(bit_buffer&                      output,
+                                 span<const log_likelihood_ratio> input,
+                                 crc_calculator*                  crc,
+                                 const configuration&             cfg) override
+  {
+    return decoder->decode(output, input, crc, apply_budget(cfg));
+  }
+
+  // See interface for the documentation.
+  void decode_batch(span<std::optional<unsigned>>                stats,
+                    span<bit_buffer>                             outputs,
+                    span<const span<const log_likelihood_ratio>> inputs,
+                    crc_calculator*                              crc,
+                    const configuration&                         cfg) override
+  {
+    decoder->decode_batch(stats, outputs, inputs, crc, apply_budget(cfg));
+  }
+
+private:
+  /// Returns a copy of the given configuration with the iteration budget of the codeblock modulation applied.
+  configuration apply_budget(const configuration& cfg) const
+  {
+    unsigned budget = budgets.qpsk;
+    switch (cfg.block_conf.tb_common.mod) {
+      case modulation_scheme::QAM16:
+        budget = budgets.qam16;
+        break;
+      case modulation_scheme::QAM64:
+        budget = budgets.qam64;
+        break;
+      case modulation_scheme::QAM256:
+        budget = budgets.qam256;
+        break;
+      default:
+        break;
+    }
+
+    configuration budget_cfg                 = cfg;
+    budget_cfg.algorithm_conf.max_iterations = std::min(budget_cfg.algorithm_conf.max_iterations, budget);
+    return budget_cfg;
+  }
+
+  std::unique_ptr<ldpc_decoder>  decoder;
+  ldpc_decoder_iteration_budgets budgets;
+};
+
 class ldpc_decoder_factory_sw : public ldpc_decoder_factory
 {
 private:
   std::string dec_type;
+  std::optional<ldpc_decoder_iteration_budgets> budgets;
 
 public:
-  explicit ldpc_decoder_factory_sw(std::string dec_type_) : dec_type(std::move(dec_type_)) {}
+  explicit ldpc_decoder_factory_sw(std::string                                   dec_type_,
+                                   std::optional<ldpc_decoder_iteration_budgets> budgets_ = std::nullopt) :
+    dec_type(std::move(dec_type_)), budgets(budgets_)
+  {
+  }
 
   std::unique_ptr<ldpc_decoder> create() override
+  {
+    std::unique_ptr<ldpc_decoder> decoder = create_base();
+    if (decoder && budgets.has_value()) {
+      return std::make_unique<ldpc_decoder_iteration_budget_impl>(std::move(decoder), budgets.value());
+    }
+    return decoder;
+  }
+
+private:
+  std::unique_ptr<ldpc_decoder> create_base()
   {
 #ifdef __x86_64__
     bool supports_avx2   = cpu_supports_feature(cpu_feature::avx2);
@@ -281,6 +353,12 @@ std::shared_ptr<ldpc_decoder_factory> srsran::create_ldpc_decoder_factory_sw(con
   return std::make_unique<ldpc_decoder_factory_sw>(dec_type);
 }
 
+std::shared_ptr<ldpc_decoder_factory>
+srsran::create_ldpc_decoder_factory_sw(const std::string& dec_type, const ldpc_decoder_iteration_budgets& budgets)
+{
+  return std::make_unique<ldpc_decoder_factory_sw>(dec_type, budgets);
+}
+
 std::shared_ptr<ldpc_encoder_factory> srsran::create_ldpc_encoder_factory_sw(const std::string& enc_type)
 {
   return std::make_unique<ldpc_encoder_factory_sw>(enc_type);
@@ -64,6 +64,32 @@ std::optional<unsigned> ldpc_decoder_impl::decode(bit_buffer&
 {
   init(cfg);
 
+  return decode_codeblock(output, input, crc);
+}
+
+void ldpc_decoder_impl::decode_batch(span<std::optional<unsigned>>                stats,
+                                     span<bit_buffer>                             outputs,
+                                     span<const span<const log_likelihood_ratio>> inputs,
+                                     crc_calculator*                              crc,
+                                     const configuration&                         cfg)
+{
+  srsran_assert((stats.size() == outputs.size()) && (outputs.size() == inputs.size()),
+                "The number of stats ({}), outputs ({}) and inputs ({}) must be equal.",
+                stats.size(),
+                outputs.size(),
+                inputs.size());
+
+  // The graph, look-up tables and algorithm parameters are common to the entire batch - load them only once.
+  init(cfg);
+
+  for (unsigned i_cb = 0, nof_cb = inputs.size(); i_cb != nof_cb; ++i_cb) {
+    stats[i_cb] = decode_codeblock(outputs[i_cb], inputs[i_cb], crc);
+  }
+}
+
+std::optional<unsigned>
+ldpc_decoder_impl::decode_codeblock(bit_buffer& output, span<const log_likelihood_ratio> input, crc_calculator* crc)
+{
   uint16_t message_length   = bg_K * lifting_size;
   uint16_t max_input_length = bg_N_short * lifting_size;
   srsran_assert(output.size() == message_length,
@@ -148,6 +174,19 @@ std::optional<unsigned> ldpc_decoder_impl::decode(bit_buffer&
 
 void ldpc_decoder_impl::load_soft_bits(span<const log_likelihood_ratio> llrs)
 {
+  // Fast path: when the node size matches the lifting size, the internal node layout coincides with the linear LLR
+  // layout produced by the rate dematcher (no per-node zero padding). The soft bits can then be initialized with a
+  // single wide clamped copy instead of a node-by-node pass, letting the clamp kernel run over the full codeblock.
+  // This is always the case for the generic decoder and, for the SIMD decoders, whenever the lifting size is a
+  // multiple of the SIMD register width (most notably the large lifting sizes used by full-band transport blocks).
+  if (node_size_byte == lifting_size) {
+    span<log_likelihood_ratio> soft_bits_view(soft_bits);
+    // Recall that the first 2 * lifting_size bits (2 nodes) are not transmitted.
+    srsvec::zero(soft_bits_view.first(2 * node_size_byte));
+    clamp(soft_bits_view.subspan(2 * node_size_byte, llrs.size()), llrs, soft_bits_clamp_low, soft_bits_clamp_high);
+    return;
+  }
+
   // Compute the number of data nodes fully occupied by the llrs (the + 2 is due to the shortened nodes at the beginning
   // of the codeblock).
   unsigned nof_full_nodes = llrs.size() / lifting_size + 2;
@@ -53,10 +53,24 @@ public:
                                  crc_calculator*                  crc,
                                  const configuration&             cfg) override;
 
+  // See interface for the documentation.
+  void decode_batch(span<std::optional<unsigned>>                stats,
+                    span<bit_buffer>                             outputs,
+                    span<const span<const log_likelihood_ratio>> inputs,
+                    crc_calculator*                              crc,
+                    const configuration&                         cfg) override;
+
 private:
   /// Initializes the decoder inner variables.
   void init(const configuration& cfg);
 
+  /// \brief Decodes a single codeblock, assuming the decoder has already been initialized via \ref init.
+  ///
+  /// Shared back-end of \ref decode and \ref decode_batch (the latter initializes the decoder only once for the
+  /// entire batch).
+  std::optional<unsigned>
+  decode_codeblock(bit_buffer& output, span<const log_likelihood_ratio> input, crc_calculator* crc);
+
   /// Initializes implementation-specific inner variables.
   virtual void specific_init() = 0;
 
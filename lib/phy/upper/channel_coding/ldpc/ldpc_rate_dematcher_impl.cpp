@@ -24,6 +24,7 @@
 #include "ldpc_graph_impl.h"
 #include "ldpc_luts_impl.h"
 #include "srsran/srsvec/copy.h"
+#include "srsran/srsvec/simd.h"
 #include "srsran/srsvec/zero.h"
 #include "srsran/support/srsran_assert.h"
 
@@ -120,7 +121,28 @@ void ldpc_rate_dematcher_impl::combine_softbits(span<log_likelihood_ratio>
   srsran_assert(out.size() == in0.size(), "All sizes must be equal.");
   srsran_assert(out.size() == in1.size(), "All sizes must be equal.");
 
-  for (unsigned index = 0, index_end = out.size(); index != index_end; ++index) {
+  unsigned index = 0, index_end = out.size();
+
+#if SRSRAN_SIMD_B_SIZE
+  // HARQ soft combining is a saturating int8 addition over the whole codeblock. Run it over SIMD lanes, clamping the
+  // saturated sum to the finite LLR range as the optimized rate dematchers do.
+  const int8_t* in0_ptr = reinterpret_cast<const int8_t*>(in0.data());
+  const int8_t* in1_ptr = reinterpret_cast<const int8_t*>(in1.data());
+  int8_t*       out_ptr = reinterpret_cast<int8_t*>(out.data());
+
+  simd_b_t llr_max_epi8 = srsran_simd_b_set1(LLR_MAX.to_value_type());
+  simd_b_t llr_min_epi8 = srsran_simd_b_set1(LLR_MIN.to_value_type());
+
+  for (unsigned simd_end = (index_end / SRSRAN_SIMD_B_SIZE) * SRSRAN_SIMD_B_SIZE; index != simd_end;
+       index += SRSRAN_SIMD_B_SIZE) {
+    simd_b_t result = srsran_simd_b_add(srsran_simd_b_loadu(in0_ptr + index), srsran_simd_b_loadu(in1_ptr + index));
+    result          = srsran_simd_b_min(result, llr_max_epi8);
+    result          = srsran_simd_b_max(result, llr_min_epi8);
+    srsran_simd_b_storeu(out_ptr + index, result);
+  }
+#endif // SRSRAN_SIMD_B_SIZE
+
+  for (; index != index_end; ++index) {
     out[index] = in0[index] + in1[index];
   }
 }
@@ -22,6 +22,7 @@
 
 #include "polar_decoder_impl.h"
 #include "srsran/srsvec/binary.h"
+#include "srsran/srsvec/simd.h"
 #include "srsran/srsvec/zero.h"
 
 using namespace srsran;
@@ -35,7 +36,31 @@ vec_function_f(span<log_likelihood_ratio> z, span<const log_likelihood_ratio> x,
   srsran_assert(y.size() == x.size(), "Input spans must have the same size.");
   srsran_assert(z.size() == x.size(), "Input and output spans must have the same size.");
 
-  std::transform(x.begin(), x.end(), y.begin(), z.begin(), log_likelihood_ratio::soft_xor);
+  unsigned i = 0, len = x.size();
+
+#if SRSRAN_SIMD_B_SIZE
+  const int8_t* x_ptr = reinterpret_cast<const int8_t*>(x.data());
+  const int8_t* y_ptr = reinterpret_cast<const int8_t*>(y.data());
+  int8_t*       z_ptr = reinterpret_cast<int8_t*>(z.data());
+
+  for (unsigned i_end = (len / SRSRAN_SIMD_B_SIZE) * SRSRAN_SIMD_B_SIZE; i != i_end; i += SRSRAN_SIMD_B_SIZE) {
+    simd_b_t x_epi8 = srsran_simd_b_loadu(x_ptr + i);
+    simd_b_t y_epi8 = srsran_simd_b_loadu(y_ptr + i);
+
+    // Compute min(|x|, |y|), where the absolute value is obtained by applying the sign of an LLR to itself.
+    simd_b_t min_abs_epi8 =
+        srsran_simd_b_min(srsran_simd_b_neg(x_epi8, x_epi8), srsran_simd_b_neg(y_epi8, y_epi8));
+
+    // Apply the sign of the product of the two LLRs. Recall that a zero-valued LLR yields a zero minimum.
+    simd_b_t result_epi8 = srsran_simd_b_neg(srsran_simd_b_neg(min_abs_epi8, x_epi8), y_epi8);
+
+    srsran_simd_b_storeu(z_ptr + i, result_epi8);
+  }
+#endif // SRSRAN_SIMD_B_SIZE
+
+  for (; i != len; ++i) {
+    z[i] = log_likelihood_ratio::soft_xor(x[i], y[i]);
+  }
 }
 
 /// Combines two log-likelihood ratio: constructively (sum) if b = 0, destructively (difference) if b = 1.
@@ -55,7 +80,37 @@ static void vec_function_g(span<log_likelihood_ratio>       z,
   srsran_assert((y.size() == x.size()) && (b.size() == x.size()), "Input spans must have the same size.");
   srsran_assert(z.size() == x.size(), "Input and output spans must have the same size.");
 
-  for (unsigned i = 0, len = x.size(); i != len; ++i) {
+  unsigned i = 0, len = x.size();
+
+#if SRSRAN_SIMD_B_SIZE
+  const int8_t* x_ptr = reinterpret_cast<const int8_t*>(x.data());
+  const int8_t* y_ptr = reinterpret_cast<const int8_t*>(y.data());
+  const int8_t* b_ptr = reinterpret_cast<const int8_t*>(b.data());
+  int8_t*       z_ptr = reinterpret_cast<int8_t*>(z.data());
+
+  simd_b_t llr_max_epi8 = srsran_simd_b_set1(LLR_MAX.to_value_type());
+  simd_b_t llr_min_epi8 = srsran_simd_b_set1(LLR_MIN.to_value_type());
+
+  for (unsigned i_end = (len / SRSRAN_SIMD_B_SIZE) * SRSRAN_SIMD_B_SIZE; i != i_end; i += SRSRAN_SIMD_B_SIZE) {
+    simd_b_t x_epi8 = srsran_simd_b_loadu(x_ptr + i);
+    simd_b_t y_epi8 = srsran_simd_b_loadu(y_ptr + i);
+    simd_b_t b_epi8 = srsran_simd_b_loadu(b_ptr + i);
+
+    // Flip the sign of x where b == 1: subtract twice the value of x selected by b (in {0, 1}). Both subtractions
+    // saturate, so no intermediate overflow can occur.
+    simd_b_t x_sel_epi8 = srsran_simd_b_neg(x_epi8, b_epi8);
+    simd_b_t x_adj_epi8 = srsran_simd_b_sub(srsran_simd_b_sub(x_epi8, x_sel_epi8), x_sel_epi8);
+
+    // Saturated sum clamped to the finite LLR range, as done by the saturated log_likelihood_ratio sum.
+    simd_b_t result_epi8 = srsran_simd_b_add(y_epi8, x_adj_epi8);
+    result_epi8          = srsran_simd_b_min(result_epi8, llr_max_epi8);
+    result_epi8          = srsran_simd_b_max(result_epi8, llr_min_epi8);
+
+    srsran_simd_b_storeu(z_ptr + i, result_epi8);
+  }
+#endif // SRSRAN_SIMD_B_SIZE
+
+  for (; i != len; ++i) {
     z[i] = switch_combine(y[i], x[i], b[i]);
   }
 }
@@ -56,20 +56,14 @@ demodulate_soft_PI_2_BPSK(span<log_likelihood_ratio> llrs, span<const cf_t> symb
   // Maximum (absolute) value considered for quantization. Larger values will be clipped.
   constexpr float RANGE_LIMIT_FLOAT = 24;
 
-  // Even-indexed symbols.
-  auto*       out = llrs.begin();
-  const auto* in  = symbols.begin();
-  const auto* n   = noise_vars.begin();
-  for (; out < llrs.end(); out += 2, in += 2, n += 2) {
-    *out = demod_BPSK_symbol(*in, *n, RANGE_LIMIT_FLOAT);
-  }
-
-  // Odd-indexed symbols.
-  out = llrs.begin() + 1;
-  in  = symbols.begin() + 1;
-  n   = noise_vars.begin() + 1;
-  for (; out < llrs.end(); out += 2, in += 2, n += 2) {
-    *out = demod_BPSK_symbol(cf_t(std::imag(*in), -std::real(*in)), *n, RANGE_LIMIT_FLOAT);
+  // Single sequential pass: odd-indexed symbols are derotated on the fly, instead of walking the buffers twice with
+  // stride two.
+  for (unsigned i_symbol = 0, len = symbols.size(); i_symbol != len; ++i_symbol) {
+    cf_t z = symbols[i_symbol];
+    if ((i_symbol & 1U) != 0U) {
+      z = cf_t(std::imag(z), -std::real(z));
+    }
+    llrs[i_symbol] = demod_BPSK_symbol(z, noise_vars[i_symbol], RANGE_LIMIT_FLOAT);
   }
 }
 
@@ -38,7 +38,7 @@ namespace detail {
 
 /// Free PDSCH processor identifier list type.
 using pdsch_processor_free_list =
-    concurrent_queue<unsigned, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::sleep>;
+    concurrent_queue<unsigned, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::spin>;
 
 /// PDSCH processor wrapper. It appends its identifier into the free list when the processing is finished.
 class pdsch_processor_wrapper : private pdsch_processor, private pdsch_processor_notifier
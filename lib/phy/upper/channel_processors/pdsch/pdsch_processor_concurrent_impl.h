@@ -33,6 +33,12 @@
 namespace srsran {
 
 /// \brief Implements a PDSCH processor with concurrent codeblock processing.
+///
+/// A single transport block is segmented and its codeblocks are distributed over the downlink executor: each worker
+/// claims codeblocks, encodes and modulates them, and maps the resulting symbols into its slice of the resource grid.
+/// This makes the processing latency of one large transport block scale with the number of workers, instead of being
+/// bound to a single core as with \ref pdsch_processor_impl.
+///
 /// \remark The number of PDSCH codeblock processor instances contained in \ref cb_processor_pool must be equal to or
 /// greater than the number of consumers in \ref executor. Otherwise, an assertion is triggered at runtime.
 class pdsch_processor_concurrent_impl : public pdsch_processor
@@ -279,9 +279,22 @@ span<const cf_t> prach_generator_impl::generate(const prach_generator::configura
     cyclic_shift                    = (config.preamble_index % nof_sequences_per_root) * N_cs;
   }
 
-  if (is_long_preamble(config.format)) {
-    return generate_y_u_v_long(get_sequence_number_long(root_sequence_index), cyclic_shift);
+  bool     is_long         = is_long_preamble(config.format);
+  unsigned sequence_number = is_long ? get_sequence_number_long(root_sequence_index)
+                                     : get_sequence_number_short(root_sequence_index);
+
+  // Return the cached sequence if it was generated before.
+  uint32_t key   = get_cache_key(sequence_length, sequence_number, cyclic_shift);
+  auto     found = cache.find(key);
+  if (found != cache.end()) {
+    return found->second;
   }
 
-  return generate_y_u_v_short(get_sequence_number_short(root_sequence_index), cyclic_shift);
+  // Otherwise, generate the sequence and cache it.
+  span<const cf_t> y_u_v =
+      is_long ? generate_y_u_v_long(sequence_number, cyclic_shift) : generate_y_u_v_short(sequence_number, cyclic_shift);
+
+  std::vector<cf_t>& entry = cache[key];
+  entry.assign(y_u_v.begin(), y_u_v.end());
+  return entry;
 }
@@ -25,13 +25,17 @@
 #include "srsran/phy/upper/channel_processors/prach_generator.h"
 #include "srsran/ran/prach/prach_constants.h"
 #include "srsran/srsvec/aligned_vec.h"
+#include <map>
+#include <vector>
 
 namespace srsran {
 
 /// \brief On-demand PRACH time-domain signal generator.
 ///
-/// It generates PRACH frequency-domain signals on demand instead of generating and storing them off-line. It minimizes
-/// memory footprint at the cost of longer processing time.
+/// It generates PRACH frequency-domain signals on demand instead of generating and storing them off-line. Generated
+/// sequences are kept in an internal cache, so each sequence of the configured logical root range is computed only the
+/// first time it is requested. The cache size is naturally bounded by the root sequence range of the cell
+/// configuration.
 ///
 /// More details about the generation algorithm can be found in
 /// > D. Gregoratti, X. Arteaga, and J. Broquetas, "Mathematical Properties of the Zadoff-Chu Sequences,"
@@ -47,6 +51,16 @@ private:
   /// Temporary sequence.
   srsvec::aligned_vec<cf_t> sequence;
 
+  /// Cache of generated sequences, indexed by sequence length, sequence number and cyclic shift.
+  std::map<uint32_t, std::vector<cf_t>> cache;
+
+  /// Builds the cache key corresponding to the given sequence parameters.
+  static uint32_t get_cache_key(unsigned sequence_length, unsigned sequence_number, unsigned cyclic_shift)
+  {
+    return static_cast<uint32_t>((sequence_length == LONG) ? 1U : 0U) | (sequence_number << 1U) |
+           (cyclic_shift << 11U);
+  }
+
   /// Calculates sequence number \f$u\f$ as per TS38.211 Table 6.3.3.1-3.
   static unsigned get_sequence_number_long(unsigned root_sequence_index);
 
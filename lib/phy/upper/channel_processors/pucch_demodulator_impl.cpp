@@ -118,12 +118,8 @@ void pucch_demodulator_impl::get_data_re_ests(const resource_grid_reader&
                                               const channel_estimate&                         channel_ests,
                                               const pucch_demodulator::format2_configuration& config)
 {
-  // Prepare RB mask. RB allocation is contiguous for PUCCH Format 2.
-  prb_mask.resize(config.nof_prb);
-  prb_mask.fill(0, config.nof_prb, true);
-
-  // Prepare RE mask.
-  bounded_bitset<MAX_RB* NRE> re_mask = prb_mask.kronecker_product<NRE>(format2_prb_re_mask);
+  // Control data RE positions within a PRB, as per TS38.211 Section 6.4.1.3.2.2. The remaining RE carry DM-RS.
+  static constexpr std::array<unsigned, pucch_constants::FORMAT2_NOF_DATA_SC> data_re_idx = {0, 2, 3, 5, 6, 8, 9, 11};
 
   for (unsigned i_port = 0, i_port_end = config.rx_ports.size(); i_port != i_port_end; ++i_port) {
     // Get a view of the data RE destination buffer for a single Rx port.
@@ -135,6 +131,9 @@ void pucch_demodulator_impl::get_data_re_ests(const resource_grid_reader&
     // First OFDM subcarrier containing PUCCH Format 2.
     unsigned first_subc = config.first_prb * NRE;
 
+    // Running write position within the port destination buffers.
+    unsigned i_out = 0;
+
     for (unsigned i_symbol = config.start_symbol_index, i_symbol_end = config.start_symbol_index + config.nof_symbols;
          i_symbol != i_symbol_end;
          ++i_symbol) {
@@ -142,30 +141,29 @@ void pucch_demodulator_impl::get_data_re_ests(const resource_grid_reader&
         first_subc = config.second_hop_prb.value() * NRE;
       }
 
-      // Extract data RE from the resource grid.
-      re_port_buffer = resource_grid.get(re_port_buffer, i_port, i_symbol, first_subc, re_mask);
+      // View over the resource grid for a single OFDM symbol.
+      span<const cbf16_t> grid_symbol = resource_grid.get_view(i_port, i_symbol);
 
       // View over the channel estimation coefficients for a single OFDM symbol.
       span<const cbf16_t> ests_symbol = channel_ests.get_symbol_ch_estimate(i_symbol, i_port);
 
-      // Copy channel estimation coefficients of the data RE into the destination buffer.
-      re_mask.for_each(0, re_mask.size(), [&ests_port_buffer, &ests_symbol, &first_subc](unsigned bitpos) {
-        ests_port_buffer.front() = ests_symbol[first_subc + bitpos];
-        ests_port_buffer         = ests_port_buffer.last(ests_port_buffer.size() - 1);
-      });
+      // Pull the data RE and their channel estimates together in a single pass. PUCCH Format 2 allocations are
+      // typically one or two PRB, so direct indexing beats building an RE mask and running masked extractions.
+      for (unsigned i_prb = 0; i_prb != config.nof_prb; ++i_prb) {
+        unsigned k_prb = first_subc + i_prb * NRE;
+        for (unsigned re_idx : data_re_idx) {
+          re_port_buffer[i_out]   = grid_symbol[k_prb + re_idx];
+          ests_port_buffer[i_out] = ests_symbol[k_prb + re_idx];
+          ++i_out;
+        }
+      }
     }
 
-    // Assert that all port data RE buffer elements have been filled.
-    srsran_assert(re_port_buffer.empty(),
-                  "Number of extracted port data RE does not match destination buffer dimensions: "
-                  "{} unused elements.",
+    // Assert that all port data RE and channel estimates buffer elements have been filled.
+    srsran_assert(i_out == re_port_buffer.size(),
+                  "Number of extracted port data RE (i.e., {}) does not match destination buffer dimensions (i.e., "
+                  "{}).",
+                  i_out,
                   re_port_buffer.size());
-
-    // Assert that all port channel estimates buffer elements have been filled.
-    srsran_assert(
-        ests_port_buffer.empty(),
-        "Number of extracted port channel estimation coefficients does not match destination buffer dimensions: "
-        "{} unused elements.",
-        ests_port_buffer.size());
   }
 }
@@ -113,16 +113,6 @@ private:
 
   /// Buffer used to transfer noise variance estimates from the channel estimate to the equalizer.
   std::array<float, MAX_PORTS> noise_var_estimates;
-
-  /// \brief Control data RE allocation pattern for PUCCH Format 2.
-  ///
-  /// Indicates the Resource Elements containing control data symbols within a PRB, as per TS38.211 Section 6.4.1.3.2.2.
-  const re_prb_mask format2_prb_re_mask = {true, false, true, true, false, true, true, false, true, true, false, true};
-
-  /// Temporary channel estimates for an OFDM symbol.
-  std::array<cf_t, MAX_RB * NRE> temp_ests_symbol;
-  /// PRB mask indicating the used PRB within the resource grid.
-  bounded_bitset<MAX_RB> prb_mask;
 };
 
 } // namespace srsran
@@ -89,13 +89,8 @@ static float detect_bits(span<uint8_t> out_bits, cf_t detected_symbol, float eq_
   return (std::norm(detected_symbol) / eq_noise_var);
 }
 
-pucch_detector::pucch_detection_result
-pucch_detector_format1::detect(const resource_grid_reader&                  grid,
-                               const channel_estimate&                      estimates,
-                               const pucch_detector::format1_configuration& config)
+void pucch_detector_format1::prepare_buffers(const pucch_detector::format1_configuration& config)
 {
-  validate_config(config);
-
   // Total number of REs used for PUCCH data (recall that positive integer division implies taking the floor).
   unsigned nof_res   = (config.nof_symbols / 2) * NRE;
   unsigned nof_ports = config.ports.size();
@@ -112,10 +107,12 @@ pucch_detector_format1::detect(const resource_grid_reader&                  grid
   }
 
   alpha_indices = span<unsigned>(alpha_buffer).first(nof_data_symbols);
+}
 
-  extract_data_and_estimates(
-      grid, estimates, config.start_symbol_index, config.starting_prb, config.second_hop_prb, config.ports);
-
+void pucch_detector_format1::equalize_and_marginalize(const channel_estimate&                      estimates,
+                                                      const pucch_detector::format1_configuration& config)
+{
+  unsigned    nof_ports           = config.ports.size();
   span<float> noise_var_all_ports = span<float>(noise_var_buffer).first(nof_ports);
   for (unsigned i_port = 0; i_port != nof_ports; ++i_port) {
     noise_var_all_ports[i_port] = estimates.get_noise_variance(config.ports[i_port]);
@@ -128,7 +125,66 @@ pucch_detector_format1::detect(const resource_grid_reader&                  grid
                       config.beta_pucch);
 
   marginalize_w_and_r_out(config);
+}
 
+pucch_detector::pucch_detection_result
+pucch_detector_format1::detect(const resource_grid_reader&                  grid,
+                               const channel_estimate&                      estimates,
+                               const pucch_detector::format1_configuration& config)
+{
+  validate_config(config);
+
+  prepare_buffers(config);
+
+  extract_data(grid, config.start_symbol_index, config.starting_prb, config.second_hop_prb, config.ports);
+  extract_estimates(estimates, config.start_symbol_index, config.starting_prb, config.second_hop_prb, config.ports);
+
+  equalize_and_marginalize(estimates, config);
+
+  return build_result(config);
+}
+
+void pucch_detector_format1::detect_multiplexed(span<pucch_detector::pucch_detection_result>      results,
+                                                const resource_grid_reader&                       grid,
+                                                span<const channel_estimate* const>               estimates,
+                                                span<const pucch_detector::format1_configuration> configs)
+{
+  srsran_assert(!configs.empty(), "The list of configurations is empty.");
+  srsran_assert((results.size() == configs.size()) && (estimates.size() == configs.size()),
+                "The numbers of results (i.e., {}), estimates (i.e., {}) and configurations (i.e., {}) do not match.",
+                results.size(),
+                estimates.size(),
+                configs.size());
+
+  const pucch_detector::format1_configuration& common = configs.front();
+  for (const pucch_detector::format1_configuration& config : configs) {
+    validate_config(config);
+    srsran_assert((config.starting_prb == common.starting_prb) && (config.second_hop_prb == common.second_hop_prb) &&
+                      (config.start_symbol_index == common.start_symbol_index) &&
+                      (config.nof_symbols == common.nof_symbols) && (config.ports == common.ports),
+                  "All multiplexed configurations must share the same time-frequency allocation and antenna ports.");
+  }
+
+  prepare_buffers(common);
+
+  // The data REs are common to all multiplexed transmissions - extract them only once.
+  extract_data(grid, common.start_symbol_index, common.starting_prb, common.second_hop_prb, common.ports);
+
+  // Separate the multiplexed transmissions, each with its own channel estimates, cyclic shift and OCC.
+  for (unsigned i_config = 0, nof_configs = configs.size(); i_config != nof_configs; ++i_config) {
+    const pucch_detector::format1_configuration& config   = configs[i_config];
+    const channel_estimate*                      estimate = estimates[i_config];
+    srsran_assert(estimate != nullptr, "Invalid channel estimate.");
+
+    extract_estimates(*estimate, config.start_symbol_index, config.starting_prb, config.second_hop_prb, config.ports);
+    equalize_and_marginalize(*estimate, config);
+    results[i_config] = build_result(config);
+  }
+}
+
+pucch_detector::pucch_detection_result
+pucch_detector_format1::build_result(const pucch_detector::format1_configuration& config)
+{
   // Prepare UCI message output.
   // We don't set the SR bit here - this task is delegated to a higher-level function, based on the uci_status returned
   // by this detector and on the used PUCCH resource.
@@ -183,27 +239,22 @@ pucch_detector_format1::detect(const resource_grid_reader&                  grid
   return output;
 }
 
-void pucch_detector_format1::extract_data_and_estimates(const resource_grid_reader&              grid,
-                                                        const channel_estimate&                  estimates,
-                                                        unsigned                                 first_symbol,
-                                                        unsigned                                 first_prb,
-                                                        std::optional<unsigned>                  second_prb,
-                                                        const static_vector<uint8_t, MAX_PORTS>& antenna_ports)
+void pucch_detector_format1::extract_data(const resource_grid_reader&              grid,
+                                          unsigned                                 first_symbol,
+                                          unsigned                                 first_prb,
+                                          std::optional<unsigned>                  second_prb,
+                                          const static_vector<uint8_t, MAX_PORTS>& antenna_ports)
 {
   for (uint8_t port : antenna_ports) {
     unsigned      i_symbol       = 0;
     unsigned      skip           = 0;
     unsigned      symbol_index   = first_symbol + 1;
     span<cbf16_t> sequence_slice = time_spread_sequence.get_slice(port);
-    span<cbf16_t> estimate_slice = ch_estimates.get_channel(port, 0);
     for (; i_symbol != nof_data_symbols_pre_hop; ++i_symbol, skip += NRE, symbol_index += 2) {
       // Index of the first subcarrier assigned to PUCCH, before hopping.
       unsigned      k_init         = NRE * first_prb;
       span<cbf16_t> sequence_chunk = sequence_slice.subspan(skip, NRE);
       grid.get(sequence_chunk, port, symbol_index, k_init);
-
-      span<const cbf16_t> tmp = estimates.get_symbol_ch_estimate(symbol_index, port);
-      srsvec::copy(estimate_slice.subspan(skip, NRE), tmp.subspan(k_init, NRE));
     }
 
     for (; i_symbol != nof_data_symbols; ++i_symbol, skip += NRE, symbol_index += 2) {
@@ -212,6 +263,33 @@ void pucch_detector_format1::extract_data_and_estimates(const resource_grid_read
       unsigned      k_init         = NRE * second_prb.value();
       span<cbf16_t> sequence_chunk = sequence_slice.subspan(skip, NRE);
       grid.get(sequence_chunk, port, symbol_index, k_init);
+    }
+  }
+}
+
+void pucch_detector_format1::extract_estimates(const channel_estimate&                  estimates,
+                                               unsigned                                 first_symbol,
+                                               unsigned                                 first_prb,
+                                               std::optional<unsigned>                  second_prb,
+                                               const static_vector<uint8_t, MAX_PORTS>& antenna_ports)
+{
+  for (uint8_t port : antenna_ports) {
+    unsigned      i_symbol       = 0;
+    unsigned      skip           = 0;
+    unsigned      symbol_index   = first_symbol + 1;
+    span<cbf16_t> estimate_slice = ch_estimates.get_channel(port, 0);
+    for (; i_symbol != nof_data_symbols_pre_hop; ++i_symbol, skip += NRE, symbol_index += 2) {
+      // Index of the first subcarrier assigned to PUCCH, before hopping.
+      unsigned k_init = NRE * first_prb;
+
+      span<const cbf16_t> tmp = estimates.get_symbol_ch_estimate(symbol_index, port);
+      srsvec::copy(estimate_slice.subspan(skip, NRE), tmp.subspan(k_init, NRE));
+    }
+
+    for (; i_symbol != nof_data_symbols; ++i_symbol, skip += NRE, symbol_index += 2) {
+      // Index of the first subcarrier assigned to PUCCH, after hopping. Note that we only enter this loop if
+      // second_prb.has_value().
+      unsigned k_init = NRE * second_prb.value();
 
       span<const cbf16_t> tmp_in  = estimates.get_symbol_ch_estimate(symbol_index, port).subspan(k_init, NRE);
       span<cbf16_t>       tmp_out = estimate_slice.subspan(skip, NRE);
@@ -69,16 +69,46 @@ public:
                                                 const channel_estimate&                      estimates,
                                                 const pucch_detector::format1_configuration& config);
 
-private:
-  /// \brief Extracts PUCCH data and channel coefficients.
+  /// \brief Detects a group of PUCCH Format 1 transmissions multiplexed on the same time-frequency resources.
+  ///
+  /// All configurations must share the same PRB and OFDM symbol allocation as well as the same antenna ports,
+  /// differing only in their UE-specific parameters (initial cyclic shift, time-domain OCC, scrambling identifier and
+  /// payload). The common received block is extracted from the resource grid only once and reused for separating all
+  /// multiplexed transmissions.
   ///
-  /// This method extracts the PUCCH data REs from the resource grid as well as the corresponding channel estimates.
-  void extract_data_and_estimates(const resource_grid_reader&              grid,
-                                  const channel_estimate&                  estimates,
-                                  unsigned                                 first_symbol,
-                                  unsigned                                 first_prb,
-                                  std::optional<unsigned>                  second_prb,
-                                  const static_vector<uint8_t, MAX_PORTS>& antenna_ports);
+  /// \param[out] results   Detection results, one per configuration.
+  /// \param[in]  grid      Received resource grid.
+  /// \param[in]  estimates Channel estimates, one per configuration.
+  /// \param[in]  configs   Configurations of the multiplexed PUCCH transmissions.
+  void detect_multiplexed(span<pucch_detector::pucch_detection_result>      results,
+                          const resource_grid_reader&                       grid,
+                          span<const channel_estimate* const>               estimates,
+                          span<const pucch_detector::format1_configuration> configs);
+
+private:
+  /// Resizes the internal buffers and sets the data symbol counters for the given configuration.
+  void prepare_buffers(const pucch_detector::format1_configuration& config);
+
+  /// \brief Extracts the PUCCH data REs from the resource grid.
+  void extract_data(const resource_grid_reader&              grid,
+                    unsigned                                 first_symbol,
+                    unsigned                                 first_prb,
+                    std::optional<unsigned>                  second_prb,
+                    const static_vector<uint8_t, MAX_PORTS>& antenna_ports);
+
+  /// \brief Extracts the channel coefficients corresponding to the PUCCH data REs.
+  void extract_estimates(const channel_estimate&                  estimates,
+                         unsigned                                 first_symbol,
+                         unsigned                                 first_prb,
+                         std::optional<unsigned>                  second_prb,
+                         const static_vector<uint8_t, MAX_PORTS>& antenna_ports);
+
+  /// \brief Equalizes the extracted data REs and combines all spread replicas into the detected symbol.
+  void equalize_and_marginalize(const channel_estimate&                      estimates,
+                                const pucch_detector::format1_configuration& config);
+
+  /// Builds the detection result from the detected symbol and its equivalent noise variance.
+  pucch_detector::pucch_detection_result build_result(const pucch_detector::format1_configuration& config);
 
   /// \brief Marginalizes the spreading sequences out.
   ///
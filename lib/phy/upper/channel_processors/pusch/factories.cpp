@@ -172,7 +172,8 @@ public:
                                                     std::move(evm_calc),
                                                     prg_factory->create(),
                                                     max_nof_prb,
-                                                    enable_post_eq_sinr);
+                                                    enable_post_eq_sinr,
+                                                    evm_sampling_period);
   }
 
   pusch_demodulator_factory_generic(std::shared_ptr<channel_equalizer_factory>       equalizer_factory_,
@@ -181,14 +182,16 @@ public:
                                     std::shared_ptr<pseudo_random_generator_factory> prg_factory_,
                                     unsigned                                         max_nof_prb_,
                                     bool                                             enable_evm_,
-                                    bool                                             enable_post_eq_sinr_) :
+                                    bool                                             enable_post_eq_sinr_,
+                                    unsigned                                         evm_sampling_period_) :
     equalizer_factory(std::move(equalizer_factory_)),
     precoder_factory(std::move(precoder_factory_)),
     demodulation_factory(std::move(demodulation_factory_)),
     prg_factory(std::move(prg_factory_)),
     max_nof_prb(max_nof_prb_),
     enable_evm(enable_evm_),
-    enable_post_eq_sinr(enable_post_eq_sinr_)
+    enable_post_eq_sinr(enable_post_eq_sinr_),
+    evm_sampling_period(evm_sampling_period_)
   {
     srsran_assert(equalizer_factory, "Invalid equalizer factory.");
     srsran_assert(precoder_factory, "Invalid transform precoder factory.");
@@ -204,6 +207,7 @@ private:
   unsigned                                         max_nof_prb;
   bool                                             enable_evm;
   bool                                             enable_post_eq_sinr;
+  unsigned                                         evm_sampling_period;
 };
 
 class pusch_processor_factory_generic : public pusch_processor_factory
@@ -304,20 +308,20 @@ public:
     return std::make_unique<pusch_processor_pool>(std::move(processors), std::move(uci_processors), blocking);
   }
 
-  std::unique_ptr<pusch_processor> create(srslog::basic_logger& logger) override
+  std::unique_ptr<pusch_processor> create(srslog::basic_logger& logger, unsigned logging_sample_rate) override
   {
     if (nof_regular_processors <= 1) {
-      return regular_factory->create(logger);
+      return regular_factory->create(logger, logging_sample_rate);
     }
 
     std::vector<std::unique_ptr<pusch_processor>> processors(nof_regular_processors);
     for (std::unique_ptr<pusch_processor>& processor : processors) {
-      processor = regular_factory->create(logger);
+      processor = regular_factory->create(logger, logging_sample_rate);
     }
 
     std::vector<std::unique_ptr<pusch_processor>> uci_processors(nof_uci_processors);
     for (std::unique_ptr<pusch_processor>& processor : uci_processors) {
-      processor = uci_factory->create(logger);
+      processor = uci_factory->create(logger, logging_sample_rate);
     }
 
     return std::make_unique<pusch_processor_pool>(std::move(processors), std::move(uci_processors), blocking);
@@ -365,7 +369,8 @@ srsran::create_pusch_demodulator_factory_sw(std::shared_ptr<channel_equalizer_fa
                                             std::shared_ptr<pseudo_random_generator_factory> prg_factory,
                                             unsigned                                         max_nof_prb,
                                             bool                                             enable_evm,
-                                            bool                                             enable_post_eq_sinr)
+                                            bool                                             enable_post_eq_sinr,
+                                            unsigned                                         evm_sampling_period)
 {
   return std::make_shared<pusch_demodulator_factory_generic>(std::move(equalizer_factory),
                                                              std::move(precoder_factory),
@@ -373,7 +378,8 @@ srsran::create_pusch_demodulator_factory_sw(std::shared_ptr<channel_equalizer_fa
                                                              std::move(prg_factory),
                                                              max_nof_prb,
                                                              enable_evm,
-                                                             enable_post_eq_sinr);
+                                                             enable_post_eq_sinr,
+                                                             evm_sampling_period);
 }
 
 std::shared_ptr<pusch_processor_factory>
@@ -388,9 +394,10 @@ srsran::create_pusch_processor_pool(pusch_processor_pool_factory_config& config)
   return std::make_shared<pusch_processor_pool_factory>(config);
 }
 
-std::unique_ptr<pusch_processor> pusch_processor_factory::create(srslog::basic_logger& logger)
+std::unique_ptr<pusch_processor> pusch_processor_factory::create(srslog::basic_logger& logger,
+                                                                 unsigned              logging_sample_rate)
 {
-  return std::make_unique<logging_pusch_processor_decorator>(logger, create());
+  return std::make_unique<logging_pusch_processor_decorator>(logger, logging_sample_rate, create());
 }
 
 std::shared_ptr<ulsch_demultiplex_factory> srsran::create_ulsch_demultiplex_factory_sw()
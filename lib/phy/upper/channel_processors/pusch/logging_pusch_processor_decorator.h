@@ -79,10 +79,13 @@ namespace srsran {
 class logging_pusch_processor_decorator : public pusch_processor, private pusch_processor_result_notifier
 {
 public:
-  logging_pusch_processor_decorator(srslog::basic_logger& logger_, std::unique_ptr<pusch_processor> processor_) :
-    logger(logger_), processor(std::move(processor_))
+  logging_pusch_processor_decorator(srslog::basic_logger&            logger_,
+                                    unsigned                         sample_rate_,
+                                    std::unique_ptr<pusch_processor> processor_) :
+    logger(logger_), sample_rate(sample_rate_), processor(std::move(processor_))
   {
     srsran_assert(processor, "Invalid processor.");
+    srsran_assert(sample_rate != 0, "Invalid logging sample rate.");
   }
 
   void process(span<uint8_t>                    data_,
@@ -145,6 +148,16 @@ private:
     // Calculate the final time.
     std::chrono::nanoseconds time_ns = time_end - time_start;
 
+    // Select whether this PDU is logged. The debug level logs all PDUs. At lower levels, only one out of every
+    // \c sample_rate PDUs is logged, except for PDUs whose transport block failed CRC, which are always logged.
+    bool log_this_pdu = true;
+    if (!logger.debug.enabled() && (sample_rate > 1) && sch.data.tb_crc_ok) {
+      log_this_pdu = (++sample_count >= sample_rate);
+      if (log_this_pdu) {
+        sample_count = 0;
+      }
+    }
+
     if (logger.debug.enabled()) {
       // Detailed log information, including a list of all PDU fields.
       logger.debug(pdu.slot.sfn(),
@@ -160,7 +173,7 @@ private:
                    time_return_ns,
                    pdu,
                    results);
-    } else {
+    } else if (log_this_pdu) {
       // Single line log entry.
       logger.info(pdu.slot.sfn(),
                   pdu.slot.slot_index(),
@@ -184,6 +197,10 @@ private:
   }
 
   srslog::basic_logger&                              logger;
+  /// Logs one out of every \c sample_rate PDUs. CRC failures are always logged.
+  unsigned sample_rate;
+  /// Number of PDUs skipped since the last logged PDU.
+  unsigned                                           sample_count = 0;
   std::unique_ptr<pusch_processor>                   processor;
   span<uint8_t>                                      data;
   pdu_t                                              pdu;
@@ -119,6 +119,8 @@ pusch_decoder_buffer& pusch_decoder_impl::new_data(span<uint8_t>
   nof_codeblocks       = ldpc::compute_nof_codeblocks(units::bits(tb_size), segmentation_config.base_graph);
   cb_task_counter      = nof_codeblocks;
   available_cb_counter = 0;
+  cb_claim_counter     = 0;
+  cb_ready_counter     = 0;
 
   srsran_assert(nof_codeblocks == unique_rm_buffer->get_nof_codeblocks(),
                 "Wrong number of codeblocks {} (expected {}).",
@@ -195,11 +197,13 @@ void pusch_decoder_impl::set_nof_softbits(units::bits nof_softbits)
   // Compute the number of currently available codeblocks.
   available_cb_counter = get_nof_available_codeblocks(codeblock_llrs, softbits_count);
 
-  // If there are available codeblocks, start as many decoding tasks as possible.
+  // If there are available codeblocks, publish them and start as many decoding workers as possible.
   if (available_cb_counter > 0) {
-    // Fork tasks for new codeblocks.
+    cb_ready_counter.store(available_cb_counter, std::memory_order_release);
+
+    // Fork workers for the new codeblocks.
     for (unsigned i_cb = 0; i_cb != available_cb_counter; ++i_cb) {
-      fork_codeblock_task(i_cb);
+      fork_codeblock_worker();
     }
   }
 }
@@ -228,9 +232,13 @@ void pusch_decoder_impl::on_new_softbits(span<const log_likelihood_ratio> softbi
     // Update the number of currently available codeblocks.
     available_cb_counter = get_nof_available_codeblocks(codeblock_llrs, softbits_count);
 
-    // Fork tasks for new codeblocks.
-    for (unsigned i_cb = dispatched_codeblocks, i_cb_end = available_cb_counter; i_cb != i_cb_end; ++i_cb) {
-      fork_codeblock_task(i_cb);
+    // Publish the new codeblocks and fork workers for them.
+    if (available_cb_counter > dispatched_codeblocks) {
+      cb_ready_counter.store(available_cb_counter, std::memory_order_release);
+
+      for (unsigned i_cb = dispatched_codeblocks, i_cb_end = available_cb_counter; i_cb != i_cb_end; ++i_cb) {
+        fork_codeblock_worker();
+      }
     }
   }
 }
@@ -300,85 +308,104 @@ void pusch_decoder_impl::on_end_softbits()
       codeblock_llrs.size(),
       nof_codeblocks);
 
-  // Iterate for each remaining code block.
+  // Publish all codeblocks and fork a worker for each of them.
+  cb_ready_counter.store(nof_codeblocks, std::memory_order_release);
   for (unsigned cb_id = 0; cb_id != nof_codeblocks; ++cb_id) {
-    fork_codeblock_task(cb_id);
+    fork_codeblock_worker();
   }
 }
 
-void pusch_decoder_impl::fork_codeblock_task(unsigned cb_id)
+void pusch_decoder_impl::fork_codeblock_worker()
 {
-  auto cb_process_task = [this, cb_id]() {
-    span<const log_likelihood_ratio> cb_llrs = codeblock_llrs[cb_id].first;
-    const codeblock_metadata&        cb_meta = codeblock_llrs[cb_id].second;
-    srsran_assert(cb_llrs.size() == cb_meta.cb_specific.rm_length, "Wrong rate-matched codeblock length.");
+  auto cb_worker = [this]() {
+    // Claim and process pending codeblocks until none is left. Codeblocks are claimed from a shared counter, so a
+    // worker that starts late (or finishes its codeblock early) picks up whatever unit is still pending, instead of
+    // leaving it queued behind busy workers.
+    while (true) {
+      unsigned cb_id = cb_claim_counter.load(std::memory_order_relaxed);
+      if (cb_id >= cb_ready_counter.load(std::memory_order_acquire)) {
+        break;
+      }
+      if (!cb_claim_counter.compare_exchange_weak(cb_id, cb_id + 1, std::memory_order_relaxed)) {
+        continue;
+      }
 
-    // Get codeblock length, without rate matching, the message length and the number of data bits (no CRC, no filler
-    // bits - may contain zero-padding).
-    unsigned cb_length = 0, msg_length = 0, nof_data_bits = 0;
-    std::tie(cb_length, msg_length, nof_data_bits) = get_cblk_bit_breakdown(cb_meta);
+      process_codeblock(cb_id);
+    }
+  };
 
-    // Get data bits from previous transmissions, if any.
-    // Messages are written on a dedicated buffer associated to the softbuffer. By doing this, we keep the decoded
-    // message in memory and we don't need to compute it again if there is a retransmission.
-    bit_buffer message = unique_rm_buffer->get_codeblock_data_bits(cb_id, msg_length);
+  // Execute task asynchronously if an executor is available and the number of codeblocks is larger than one.
+  bool enqueued = false;
+  if ((executor != nullptr) && (nof_codeblocks > 1)) {
+    enqueued = executor->execute(cb_worker);
+  }
 
-    // Get the LLRs from previous transmissions, if any, or a clean buffer.
-    span<log_likelihood_ratio> rm_buffer = unique_rm_buffer->get_codeblock_soft_bits(cb_id, cb_length);
+  // Process task synchronously if is not successfully enqueued.
+  if (!enqueued) {
+    cb_worker();
+  }
+}
 
-    span<bool> cb_crcs = unique_rm_buffer->get_codeblocks_crc();
+void pusch_decoder_impl::process_codeblock(unsigned cb_id)
+{
+  span<const log_likelihood_ratio> cb_llrs = codeblock_llrs[cb_id].first;
+  const codeblock_metadata&        cb_meta = codeblock_llrs[cb_id].second;
+  srsran_assert(cb_llrs.size() == cb_meta.cb_specific.rm_length, "Wrong rate-matched codeblock length.");
 
-    // Code block processing task.
-    trace_point tp = l1_tracer.now();
+  // Get codeblock length, without rate matching, the message length and the number of data bits (no CRC, no filler
+  // bits - may contain zero-padding).
+  unsigned cb_length = 0, msg_length = 0, nof_data_bits = 0;
+  std::tie(cb_length, msg_length, nof_data_bits) = get_cblk_bit_breakdown(cb_meta);
 
-    // Check current CRC status.
-    if (cb_crcs[cb_id]) {
-      // Dematch the new LLRs and combine them with the ones from previous transmissions. We do this everytime,
-      // including when the CRC for the codeblock is OK (from previous retransmissions), because we may need to
-      // decode it again if, eventually, we find out that the CRC of the entire transport block is KO.
-      decoder_pool->get().rate_match(rm_buffer, cb_llrs, current_config.new_data, cb_meta);
+  // Get data bits from previous transmissions, if any.
+  // Messages are written on a dedicated buffer associated to the softbuffer. By doing this, we keep the decoded
+  // message in memory and we don't need to compute it again if there is a retransmission.
+  bit_buffer message = unique_rm_buffer->get_codeblock_data_bits(cb_id, msg_length);
 
-      if (cb_task_counter.fetch_sub(1) == 1) {
-        join_and_notify();
-      }
-      return;
-    }
+  // Get the LLRs from previous transmissions, if any, or a clean buffer.
+  span<log_likelihood_ratio> rm_buffer = unique_rm_buffer->get_codeblock_soft_bits(cb_id, cb_length);
 
-    // Try to decode.
-    std::optional<unsigned> nof_iters = decoder_pool->get().decode(message,
-                                                                   rm_buffer,
-                                                                   cb_llrs,
-                                                                   current_config.new_data,
-                                                                   block_crc->get_generator_poly(),
-                                                                   current_config.use_early_stop,
-                                                                   current_config.nof_ldpc_iterations,
-                                                                   cb_meta);
-
-    if (nof_iters.has_value()) {
-      // If successful decoding, flag the CRC, record number of iterations and copy bits to the TB buffer.
-      cb_crcs[cb_id] = true;
-      cb_stats.push_blocking(nof_iters.value());
-    } else {
-      cb_stats.push_blocking(current_config.nof_ldpc_iterations);
-    }
+  span<bool> cb_crcs = unique_rm_buffer->get_codeblocks_crc();
+
+  // Code block processing task.
+  trace_point tp = l1_tracer.now();
+
+  // Check current CRC status.
+  if (cb_crcs[cb_id]) {
+    // Dematch the new LLRs and combine them with the ones from previous transmissions. We do this everytime,
+    // including when the CRC for the codeblock is OK (from previous retransmissions), because we may need to
+    // decode it again if, eventually, we find out that the CRC of the entire transport block is KO.
+    decoder_pool->get().rate_match(rm_buffer, cb_llrs, current_config.new_data, cb_meta);
 
     if (cb_task_counter.fetch_sub(1) == 1) {
       join_and_notify();
     }
+    return;
+  }
 
-    l1_tracer << trace_event("cb_decode", tp);
-  };
-
-  // Execute task asynchronously if an executor is available and the number of codeblocks is larger than one.
-  bool enqueued = false;
-  if ((executor != nullptr) && (nof_codeblocks > 1)) {
-    enqueued = executor->execute(cb_process_task);
+  // Try to decode.
+  std::optional<unsigned> nof_iters = decoder_pool->get().decode(message,
+                                                                 rm_buffer,
+                                                                 cb_llrs,
+                                                                 current_config.new_data,
+                                                                 block_crc->get_generator_poly(),
+                                                                 current_config.use_early_stop,
+                                                                 current_config.nof_ldpc_iterations,
+                                                                 cb_meta);
+
+  if (nof_iters.has_value()) {
+    // If successful decoding, flag the CRC, record number of iterations and copy bits to the TB buffer.
+    cb_crcs[cb_id] = true;
+    cb_stats.push_blocking(nof_iters.value());
+  } else {
+    cb_stats.push_blocking(current_config.nof_ldpc_iterations);
   }
 
-  // Process task synchronously if is not successfully enqueued.
-  if (!enqueued) {
-    cb_process_task();
+  if (cb_task_counter.fetch_sub(1) == 1) {
+    join_and_notify();
   }
+
+  l1_tracer << trace_event("cb_decode", tp);
 }
 
 void pusch_decoder_impl::join_and_notify()
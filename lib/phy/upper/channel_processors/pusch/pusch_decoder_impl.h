@@ -186,6 +186,10 @@ private:
   std::atomic<unsigned> cb_task_counter;
   /// Counts the number of CB available for decoding.
   unsigned available_cb_counter;
+  /// Index of the next codeblock to be claimed by a decoding worker.
+  std::atomic<unsigned> cb_claim_counter;
+  /// Number of codeblocks published to the decoding workers, i.e., whose softbits are entirely available.
+  std::atomic<unsigned> cb_ready_counter;
   /// Enqueues code block decoder statistics.
   concurrent_queue<unsigned, concurrent_queue_policy::locking_mpsc, concurrent_queue_wait_policy::sleep> cb_stats;
   /// Number of UL-SCH codeword softbits. If set, the decoder will start decoding codeblocks as they become available.
@@ -204,10 +208,21 @@ private:
   // See interface for the documentation.
   void on_end_softbits() override;
 
-  /// \brief Creates a codeblock decoding task.
+  /// \brief Spawns a codeblock decoding worker.
+  ///
+  /// Workers do not process a fixed codeblock: they repeatedly claim the next pending codeblock from a shared counter
+  /// until all published codeblocks are taken. A worker is spawned for every codeblock that becomes available, so a
+  /// worker that finishes early (or whose task starts late) steals units that would otherwise wait in the executor
+  /// queue behind busy workers.
+  void fork_codeblock_worker();
+
+  /// \brief Processes a single codeblock: rate dematching, LDPC decoding and CB CRC check.
+  ///
+  /// Called from the decoding workers with a claimed codeblock identifier. The last processed codeblock triggers
+  /// \ref join_and_notify.
   ///
   /// \param[in] cb_id Identifier of the codeblock to decode.
-  void fork_codeblock_task(unsigned cb_id);
+  void process_codeblock(unsigned cb_id);
 
   /// \brief Joins the multiple code block processing.
   ///
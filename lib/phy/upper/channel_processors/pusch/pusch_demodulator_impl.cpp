@@ -46,11 +46,50 @@ revert_scrambling(span<log_likelihood_ratio> out, span<const log_likelihood_rati
   unsigned i      = 0;
   unsigned length = in.size();
 
+#ifdef __AVX2__
+  // Number of bits that can be processed with an AVX2 register.
+  static constexpr unsigned nof_bits_per_avx2 = 32;
+
+  for (unsigned i_byte = 0, i_end = (length / nof_bits_per_avx2) * nof_bits_per_avx2; i != i_end;
+       i_byte += 4, i += nof_bits_per_avx2) {
+    uint8_t byte0 = sequence.get_byte(i_byte);
+    uint8_t byte1 = sequence.get_byte(i_byte + 1);
+    uint8_t byte2 = sequence.get_byte(i_byte + 2);
+    uint8_t byte3 = sequence.get_byte(i_byte + 3);
+    int32_t c     = static_cast<int32_t>(byte0) + (static_cast<int32_t>(byte1) << 8) +
+                (static_cast<int32_t>(byte2) << 16) + (static_cast<int32_t>(byte3) << 24);
+
+    // Preload bits of interest in the 32 LSB of each 128-bit lane.
+    __m256i mask = _mm256_set1_epi32(c);
+    mask         = _mm256_shuffle_epi8(mask,
+                                       _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+                                                        2, 2, 3, 3, 3, 3, 3, 3, 3, 3));
+
+    // Mask each bit.
+    mask = _mm256_and_si256(mask, _mm256_set1_epi64x(0x0102040810204080));
+
+    // Get non zero mask.
+    mask = _mm256_cmpeq_epi8(mask, _mm256_set1_epi64x(0x0102040810204080));
+
+    // Load input.
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in.data() + i));
+
+    // Negate.
+    v = _mm256_xor_si256(mask, v);
+
+    // Add one.
+    mask = _mm256_and_si256(mask, _mm256_set1_epi8(1));
+    v    = _mm256_add_epi8(v, mask);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i), v);
+  }
+#endif // __AVX2__
+
 #ifdef __SSE3__
   // Number of bits that can be processed with a SIMD register.
   static constexpr unsigned nof_bits_per_simd = 16;
 
-  for (unsigned i_byte = 0, i_end = (length / nof_bits_per_simd) * nof_bits_per_simd; i != i_end;
+  for (unsigned i_byte = i / 8, i_end = (length / nof_bits_per_simd) * nof_bits_per_simd; i != i_end;
        i_byte += 2, i += nof_bits_per_simd) {
     uint8_t byte0 = sequence.get_byte(i_byte);
     uint8_t byte1 = sequence.get_byte(i_byte + 1);
@@ -154,6 +193,16 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&      codeword_buf
                 config.nof_tx_layers,
                 to_string(config.modulation));
 
+  // Select whether this PDU is an EVM measurement sample. The EVM requires remodulating the soft bits, so it is only
+  // measured on one out of every evm_sampling_period PDUs.
+  evm_calculator* evm = nullptr;
+  if (evm_calc) {
+    if (++evm_sampling_count >= evm_sampling_period) {
+      evm_sampling_count = 0;
+      evm                = evm_calc.get();
+    }
+  }
+
   // Stats accumulators.
   pusch_demodulator_notifier::demodulation_stats stats;
   unsigned                                       evm_symbol_count     = 0;
@@ -244,10 +293,10 @@ void pusch_demodulator_impl::demodulate(pusch_codeword_buffer&      codeword_buf
       // Build LLRs from channel symbols.
       demapper->demodulate_soft(codeword, eq_re_block, eq_noise_vars_block, config.modulation);
 
-      // Calculate EVM only if it is available.
-      if (evm_calc) {
+      // Calculate EVM only if it is available and this PDU is an EVM measurement sample.
+      if (evm != nullptr) {
         evm_accumulate +=
-            static_cast<float>(codeword_block_size) * evm_calc->calculate(codeword, eq_re_block, config.modulation);
+            static_cast<float>(codeword_block_size) * evm->calculate(codeword, eq_re_block, config.modulation);
         evm_symbol_count += codeword_block_size;
       }
 
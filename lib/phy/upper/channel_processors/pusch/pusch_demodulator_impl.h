@@ -51,7 +51,8 @@ public:
                          std::unique_ptr<evm_calculator>          evm_calc_,
                          std::unique_ptr<pseudo_random_generator> descrambler_,
                          unsigned                                 max_nof_rb,
-                         bool                                     compute_post_eq_sinr_) :
+                         bool                                     compute_post_eq_sinr_,
+                         unsigned                                 evm_sampling_period_ = 1) :
     equalizer(std::move(equalizer_)),
     precoder(std::move(precoder_)),
     demapper(std::move(demapper_)),
@@ -61,7 +62,8 @@ public:
     temp_eq_re(max_nof_rb * NRE * pusch_constants::MAX_NOF_LAYERS),
     temp_eq_noise_vars(max_nof_rb * NRE * pusch_constants::MAX_NOF_LAYERS),
     ch_estimates_copy(max_nof_rb * NRE, pusch_constants::MAX_NOF_RX_PORTS, pusch_constants::MAX_NOF_LAYERS),
-    compute_post_eq_sinr(compute_post_eq_sinr_)
+    compute_post_eq_sinr(compute_post_eq_sinr_),
+    evm_sampling_period(std::max(evm_sampling_period_, 1U))
   {
     srsran_assert(equalizer, "Invalid pointer to channel_equalizer object.");
     srsran_assert(demapper, "Invalid pointer to demodulation_mapper object.");
@@ -239,6 +241,13 @@ private:
 
   /// Enables post equalization SINR calculation.
   bool compute_post_eq_sinr;
+  /// \brief EVM sampling period in PDUs.
+  ///
+  /// EVM is measured on one out of every \c evm_sampling_period demodulated PDUs. A period of one measures every PDU,
+  /// which is required when the EVM feeds the reported CSI.
+  unsigned evm_sampling_period;
+  /// Number of demodulated PDUs since the last EVM measurement.
+  unsigned evm_sampling_count = 0;
 };
 
 } // namespace srsran
@@ -34,7 +34,7 @@ namespace detail {
 
 /// Free PUSCH processor identifier list type.
 using pusch_processor_free_list =
-    concurrent_queue<unsigned, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::sleep>;
+    concurrent_queue<unsigned, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::spin>;
 
 /// PUSCH processor wrapper. It appends its identifier into the free list when the processing is finished.
 class pusch_processor_wrapper : public pusch_processor, private pusch_processor_result_notifier
@@ -28,6 +28,7 @@
 #include "srsran/phy/upper/upper_phy_rg_gateway.h"
 #include "srsran/support/executors/task_executor.h"
 #include "srsran/support/srsran_assert.h"
+#include <mutex>
 
 using namespace srsran;
 
@@ -38,6 +39,7 @@ downlink_processor_single_executor_impl::downlink_processor_single_executor_impl
     std::unique_ptr<ssb_processor>        ssb_proc_,
     std::unique_ptr<nzp_csi_rs_generator> csi_rs_proc_,
     task_executor&                        executor_,
+    unsigned                              nof_slots_processing_deadline_,
     srslog::basic_logger&                 logger_) :
   gateway(gateway_),
   pdcch_proc(std::move(pdcch_proc_)),
@@ -46,6 +48,7 @@ downlink_processor_single_executor_impl::downlink_processor_single_executor_impl
   csi_rs_proc(std::move(csi_rs_proc_)),
   executor(executor_),
   logger(logger_),
+  nof_slots_processing_deadline(nof_slots_processing_deadline_),
   pdsch_notifier(*this)
 {
   srsran_assert(pdcch_proc, "Invalid PDCCH processor received.");
@@ -74,6 +77,16 @@ void downlink_processor_single_executor_impl::process_pdcch(const pdcch_processo
   bool enqueued = executor.execute([this, pdu]() {
     trace_point process_pdcch_tp = l1_tracer.now();
 
+    // Abandon the PDU if the slot processing deadline expired, so cycles are not spent on an already late grid.
+    if (is_slot_processing_late()) {
+      logger.warning(pdu.slot.sfn(),
+                     pdu.slot.slot_index(),
+                     "Processing deadline expired. Abandoning PDCCH (total abandoned PDUs {}).",
+                     nof_abandoned_pdus.fetch_add(1, std::memory_order_relaxed) + 1);
+      on_task_completion();
+      return;
+    }
+
     // Do not execute if the grid is not available.
     if (current_grid) {
       resource_grid_mapper& mapper = current_grid.get().get_mapper();
@@ -117,6 +130,16 @@ void downlink_processor_single_executor_impl::process_pdsch(
   bool enqueued = executor.execute([this, data, pdu]() mutable {
     trace_point process_pdsch_tp = l1_tracer.now();
 
+    // Abandon the PDU if the slot processing deadline expired, so cycles are not spent on an already late grid.
+    if (is_slot_processing_late()) {
+      logger.warning(pdu.slot.sfn(),
+                     pdu.slot.slot_index(),
+                     "Processing deadline expired. Abandoning PDSCH (total abandoned PDUs {}).",
+                     nof_abandoned_pdus.fetch_add(1, std::memory_order_relaxed) + 1);
+      on_task_completion();
+      return;
+    }
+
     // Do not execute if the grid is not available.
     if (current_grid) {
       resource_grid_mapper& mapper = current_grid->get_mapper();
@@ -161,6 +184,16 @@ void downlink_processor_single_executor_impl::process_ssb(const ssb_processor::p
   bool enqueued = executor.execute([this, pdu]() {
     trace_point process_ssb_tp = l1_tracer.now();
 
+    // Abandon the PDU if the slot processing deadline expired, so cycles are not spent on an already late grid.
+    if (is_slot_processing_late()) {
+      logger.warning(pdu.slot.sfn(),
+                     pdu.slot.slot_index(),
+                     "Processing deadline expired. Abandoning SSB (total abandoned PDUs {}).",
+                     nof_abandoned_pdus.fetch_add(1, std::memory_order_relaxed) + 1);
+      on_task_completion();
+      return;
+    }
+
     // Do not execute if the grid is not available.
     if (current_grid) {
       ssb_proc->process(current_grid->get_writer(), pdu);
@@ -203,6 +236,16 @@ void downlink_processor_single_executor_impl::process_nzp_csi_rs(const nzp_csi_r
   bool enqueued = executor.execute([this, config]() {
     trace_point process_nzp_csi_rs_tp = l1_tracer.now();
 
+    // Abandon the PDU if the slot processing deadline expired, so cycles are not spent on an already late grid.
+    if (is_slot_processing_late()) {
+      logger.warning(config.slot.sfn(),
+                     config.slot.slot_index(),
+                     "Processing deadline expired. Abandoning NZP-CSI-RS (total abandoned PDUs {}).",
+                     nof_abandoned_pdus.fetch_add(1, std::memory_order_relaxed) + 1);
+      on_task_completion();
+      return;
+    }
+
     // Do not execute if the grid is not available.
     if (current_grid) {
       resource_grid_mapper& mapper = current_grid->get_mapper();
@@ -239,6 +282,12 @@ bool downlink_processor_single_executor_impl::configure_resource_grid(const reso
   current_grid = std::move(grid);
   rg_context   = context;
 
+  // Anchor the processing deadline of the slot to the grid configuration time, scaled with the slot duration of the
+  // grid numerology.
+  grid_config_time    = std::chrono::steady_clock::now();
+  processing_deadline = std::chrono::nanoseconds(
+      (1000000UL * static_cast<uint64_t>(nof_slots_processing_deadline)) >> context.slot.numerology());
+
   // update internal state to allow processing PDUs and increase the pending task counter.
   state.on_resource_grid_configured();
 
@@ -279,6 +328,14 @@ void downlink_processor_single_executor_impl::send_resource_grid()
   }
 }
 
+bool downlink_processor_single_executor_impl::is_slot_processing_late() const
+{
+  // The members read here are written in configure_resource_grid(), which happens-before the execution of any PDU
+  // task of the configured slot.
+  return (processing_deadline.count() != 0) &&
+         ((std::chrono::steady_clock::now() - grid_config_time) > processing_deadline);
+}
+
 void downlink_processor_single_executor_impl::on_task_completion()
 {
   // Decrement the number of pending PDUs.
@@ -28,6 +28,8 @@
 #include "srsran/phy/support/shared_resource_grid.h"
 #include "srsran/phy/upper/downlink_processor.h"
 #include "srsran/srslog/logger.h"
+#include <atomic>
+#include <chrono>
 #include <mutex>
 
 namespace srsran {
@@ -76,6 +78,8 @@ public:
   /// \param ssb_proc_    SSB processor used to process SSB PDUs.
   /// \param csi_rs_proc_ CSI-RS processor used to process CSI-RS configurations.
   /// \param executor_    Task executor that will be used to process every PDU.
+  /// \param nof_slots_processing_deadline_ Number of slots after the resource grid configuration in which PDU
+  ///                     processing may still start. Zero disables the deadline check.
   /// \param logger_      Logger instance.
   downlink_processor_single_executor_impl(upper_phy_rg_gateway&                 gateway_,
                                           std::unique_ptr<pdcch_processor>      pdcch_proc_,
@@ -83,6 +87,7 @@ public:
                                           std::unique_ptr<ssb_processor>        ssb_proc_,
                                           std::unique_ptr<nzp_csi_rs_generator> csi_rs_proc_,
                                           task_executor&                        executor_,
+                                          unsigned                              nof_slots_processing_deadline_,
                                           srslog::basic_logger&                 logger_);
 
   // See interface for documentation.
@@ -131,6 +136,12 @@ private:
   /// gateway.
   void on_task_completion() override;
 
+  /// \brief Returns true if the processing deadline of the configured slot has expired.
+  ///
+  /// Called at PDU task execution start. When the executor falls behind by more than the deadline, the grid is
+  /// already late for transmission and the PDU is abandoned instead of processed.
+  bool is_slot_processing_late() const;
+
   upper_phy_rg_gateway&                 gateway;
   resource_grid_context                 rg_context;
   shared_resource_grid                  current_grid;
@@ -141,6 +152,16 @@ private:
   task_executor&                        executor;
   srslog::basic_logger&                 logger;
 
+  /// Number of slots after the resource grid configuration in which PDU processing may still start. Zero disables
+  /// the deadline check.
+  const unsigned nof_slots_processing_deadline;
+  /// Time at which the current resource grid was configured.
+  std::chrono::steady_clock::time_point grid_config_time;
+  /// Processing deadline of the configured slot, derived from its numerology. Zero if the check is disabled.
+  std::chrono::nanoseconds processing_deadline{0};
+  /// Cumulative number of PDUs abandoned because their processing started past the deadline.
+  std::atomic<unsigned> nof_abandoned_pdus{0};
+
   /// DL processor internal state.
   downlink_processor_single_executor_state state;
 
@@ -25,6 +25,7 @@
 
 #include "channel_equalizer_generic_impl.h"
 #include "equalize_mmse_1xn.h"
+#include "equalize_mmse_2xn.h"
 #include "equalize_zf_1xn.h"
 #include "equalize_zf_2xn.h"
 #include "srsran/adt/interval.h"
@@ -270,6 +271,18 @@ void channel_equalizer_generic_impl::equalize(span<cf_t>                       e
           nof_rx_ports, eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, noise_var_estimates, tx_scaling);
       return;
     }
+
+    // Two transmit layers and two receive ports.
+    if ((nof_rx_ports == 2) && (nof_tx_layers == 2)) {
+      equalize_mmse_2xn<2>(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, noise_var, tx_scaling);
+      return;
+    }
+
+    // Two transmit layers and four receive ports.
+    if ((nof_rx_ports == 4) && (nof_tx_layers == 2)) {
+      equalize_mmse_2xn<4>(eq_symbols, eq_noise_vars, ch_symbols, ch_estimates, noise_var, tx_scaling);
+      return;
+    }
   }
 
   srsran_assertion_failure(
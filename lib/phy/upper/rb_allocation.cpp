@@ -55,18 +55,21 @@ bounded_bitset<MAX_RB> rb_allocation::get_contiguous_prb_mask(unsigned bwp_start
 
 bounded_bitset<MAX_RB> rb_allocation::get_other_prb_mask(unsigned bwp_start_rb, unsigned bwp_size_rb) const
 {
-  bounded_bitset<MAX_RB>          result(bwp_start_rb + bwp_size_rb);
-  static_vector<uint16_t, MAX_RB> vrb_to_prb_indices = vrb_to_prb_map.get_allocation_indices(bwp_size_rb);
+  bounded_bitset<MAX_RB> result(bwp_start_rb + bwp_size_rb);
+
+  // For non-interleaved mapping, the permutation is the identity shifted by the CORESET start. Skip building the
+  // VRB-to-PRB table.
+  if (!vrb_to_prb_map.is_interleaved()) {
+    unsigned offset = vrb_to_prb_map.get_coreset_start();
+    vrb_mask.for_each(0, vrb_mask.size(), [&result, offset](size_t vrb_index) { result.set(vrb_index + offset, true); });
+    return result;
+  }
 
-  for (unsigned vrb_index = 0; vrb_index != vrb_mask.size(); ++vrb_index) {
-    // Skip if VRB is not used.
-    if (!vrb_mask.test(vrb_index)) {
-      continue;
-    }
+  static_vector<uint16_t, MAX_RB> vrb_to_prb_indices = vrb_to_prb_map.get_allocation_indices(bwp_size_rb);
 
-    unsigned prb_index = vrb_to_prb_indices[vrb_index];
-    result.set(prb_index, true);
-  }
+  vrb_mask.for_each(0, vrb_mask.size(), [&result, &vrb_to_prb_indices](size_t vrb_index) {
+    result.set(vrb_to_prb_indices[vrb_index], true);
+  });
 
   return result;
 }
@@ -146,14 +149,21 @@ static_vector<uint16_t, MAX_RB> rb_allocation::get_prb_indices(unsigned bwp_star
                 vrb_mask.size());
 
   static_vector<uint16_t, MAX_RB> result;
-  static_vector<uint16_t, MAX_RB> vrb_to_prb_indices = vrb_to_prb_map.get_allocation_indices(bwp_size_rb);
 
-  for (unsigned vrb_index = 0; vrb_index != vrb_mask.size(); ++vrb_index) {
-    // Skip unused VRB
-    if (vrb_mask.test(vrb_index)) {
-      result.push_back(vrb_to_prb_indices[vrb_index]);
-    }
+  // For non-interleaved mapping, the permutation is the identity shifted by the CORESET start. Skip building the
+  // VRB-to-PRB table.
+  if (!vrb_to_prb_map.is_interleaved()) {
+    unsigned offset = vrb_to_prb_map.get_coreset_start();
+    vrb_mask.for_each(
+        0, vrb_mask.size(), [&result, offset](size_t vrb_index) { result.push_back(vrb_index + offset); });
+    return result;
   }
 
+  static_vector<uint16_t, MAX_RB> vrb_to_prb_indices = vrb_to_prb_map.get_allocation_indices(bwp_size_rb);
+
+  vrb_mask.for_each(0, vrb_mask.size(), [&result, &vrb_to_prb_indices](size_t vrb_index) {
+    result.push_back(vrb_to_prb_indices[vrb_index]);
+  });
+
   return result;
 }
@@ -58,7 +58,17 @@ static const pseudo_random_generator_fast_advance<pseudo_random_state_fast_advan
 void pseudo_random_generator_impl::init(unsigned c_init)
 {
   x1 = x1_init.get_reverse();
-  x2 = x2_init.get_reverse(c_init);
+
+  // Seeds repeat across HARQ retransmissions and periodic occasions (e.g., the PUSCH/PDSCH scrambling seed does not
+  // depend on the slot), so memoize the derived state of the last seed.
+  if (last_c_init.has_value() && (last_c_init.value() == c_init)) {
+    x2 = last_x2_init;
+    return;
+  }
+
+  x2           = x2_init.get_reverse(c_init);
+  last_c_init  = c_init;
+  last_x2_init = x2;
 }
 
 void pseudo_random_generator_impl::init(const state_s& state)
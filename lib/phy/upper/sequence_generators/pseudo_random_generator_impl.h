@@ -28,6 +28,7 @@
 #include "srsran/phy/upper/sequence_generators/pseudo_random_generator.h"
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 namespace srsran {
 
@@ -39,6 +40,10 @@ private:
   uint32_t x1 = 0;
   /// Memory register for sequence \f$x_2(n)\f$.
   uint32_t x2 = 0;
+  /// Last seed used to initialize the generator, for memoizing repeated initializations.
+  std::optional<unsigned> last_c_init;
+  /// Initial \f$x_2(n)\f$ state derived from \ref last_c_init.
+  uint32_t last_x2_init = 0;
 
 public:
   /// Default constructor.
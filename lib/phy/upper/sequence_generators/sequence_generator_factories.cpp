@@ -25,11 +25,36 @@
 #include "low_papr_sequence_generator_impl.h"
 #include "pseudo_random_generator_impl.h"
 #include "srsran/support/math_utils.h"
+#include <mutex>
+#include <vector>
 
 using namespace srsran;
 
 namespace {
 
+/// \brief Collection handle that forwards to a shared immutable collection.
+///
+/// Identical collections are requested by every PUCCH detector and DM-RS processor of every pool member: the
+/// pregenerated sequences are immutable, so the instances share the underlying collection by reference and only this
+/// lightweight handle is created per instance.
+class shared_low_papr_sequence_collection : public low_papr_sequence_collection
+{
+public:
+  explicit shared_low_papr_sequence_collection(std::shared_ptr<const low_papr_sequence_collection> collection_) :
+    collection(std::move(collection_))
+  {
+  }
+
+  // See interface for documentation.
+  span<const cf_t> get(unsigned u, unsigned v, unsigned alpha_idx) const override
+  {
+    return collection->get(u, v, alpha_idx);
+  }
+
+private:
+  std::shared_ptr<const low_papr_sequence_collection> collection;
+};
+
 class low_papr_sequence_collection_sw_factory : public low_papr_sequence_collection_factory
 {
 public:
@@ -41,13 +66,41 @@ public:
 
   std::unique_ptr<low_papr_sequence_collection> create(unsigned m, unsigned delta, span<const float> alphas) override
   {
+    return std::make_unique<shared_low_papr_sequence_collection>(get_cached_collection(m, delta, alphas));
+  }
+
+private:
+  /// Returns a process-wide shared collection for the given parameters, generating it on the first request.
+  std::shared_ptr<const low_papr_sequence_collection>
+  get_cached_collection(unsigned m, unsigned delta, span<const float> alphas)
+  {
+    struct cache_entry {
+      unsigned                                            m;
+      unsigned                                            delta;
+      std::vector<float>                                  alphas;
+      std::shared_ptr<const low_papr_sequence_collection> collection;
+    };
+    // The cache is shared among all factory instances (e.g. the per-cell factory stacks), as the collections only
+    // depend on the requested parameters. The number of distinct parameter combinations is small.
+    static std::mutex               cache_mutex;
+    static std::vector<cache_entry> cache;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    for (const cache_entry& entry : cache) {
+      if (entry.m == m && entry.delta == delta && entry.alphas.size() == alphas.size() &&
+          std::equal(entry.alphas.begin(), entry.alphas.end(), alphas.begin())) {
+        return entry.collection;
+      }
+    }
+
     std::unique_ptr<low_papr_sequence_generator> generator = lpg_factory->create();
     srsran_assert(generator, "Invalid generator.");
 
-    return std::make_unique<low_papr_sequence_collection_impl>(*generator, m, delta, alphas);
+    auto collection = std::make_shared<const low_papr_sequence_collection_impl>(*generator, m, delta, alphas);
+    cache.push_back({m, delta, {alphas.begin(), alphas.end()}, collection});
+    return collection;
   }
 
-private:
   std::shared_ptr<low_papr_sequence_generator_factory> lpg_factory;
 };
 
@@ -39,18 +39,22 @@ unsigned dmrs_pbch_processor_impl::c_init(const config_t& config)
          (config.phys_cell_id % 4);
 }
 
-void dmrs_pbch_processor_impl::generation(std::array<cf_t, NOF_RE>& sequence, const config_t& config) const
+void dmrs_pbch_processor_impl::generation(unsigned state)
 {
-  // Calculate initial state
-  prg->init(c_init(config));
+  // Initialise the pseudo-random generator.
+  prg->init(state);
 
-  // Generate sequence
+  // Generate sequence.
+  std::array<cf_t, NOF_RE> sequence;
   prg->generate(sequence, M_SQRT1_2);
+
+  // Convert symbols to complex BF16.
+  srsvec::convert(cached_sequence, sequence);
 }
 
-void dmrs_pbch_processor_impl::mapping(const std::array<cf_t, NOF_RE>& r,
-                                       resource_grid_writer&           grid,
-                                       const config_t&                 args) const
+void dmrs_pbch_processor_impl::mapping(span<const cbf16_t>   sequence,
+                                       resource_grid_writer& grid,
+                                       const config_t&       args) const
 {
   // Calculate index shift.
   uint32_t v = args.phys_cell_id % 4;
@@ -60,12 +64,8 @@ void dmrs_pbch_processor_impl::mapping(const std::array<cf_t, NOF_RE>& r,
 
   // For each port...
   for (unsigned port : args.ports) {
-    // Convert symbols to complex BF16.
-    std::array<cbf16_t, NOF_RE> symbols_cbf16;
-    srsvec::convert(symbols_cbf16, r);
-
     // Create view with the symbols.
-    span<const cbf16_t> symbols = symbols_cbf16;
+    span<const cbf16_t> symbols = sequence;
 
     // Put sequence in symbol 1 (0 + v , 4 + v , 8 + v ,..., 236 + v).
     grid.put(port, l0 + 1, k0 + v, stride, symbols.first(nof_dmrs_full_symbol));
@@ -86,10 +86,16 @@ void dmrs_pbch_processor_impl::mapping(const std::array<cf_t, NOF_RE>& r,
 
 void dmrs_pbch_processor_impl::map(resource_grid_writer& grid, const config_t& config)
 {
-  // Generate sequence
-  std::array<cf_t, NOF_RE> sequence;
-  generation(sequence, config);
+  // Calculate initial state.
+  unsigned state = c_init(config);
+
+  // The sequence depends only on the initial state: regenerate it when the state changes and reuse the cached copy
+  // across SSB occasions otherwise.
+  if (!cached_c_init.has_value() || (cached_c_init.value() != state)) {
+    generation(state);
+    cached_c_init = state;
+  }
 
   // Mapping to physical resources
-  mapping(sequence, grid, config);
+  mapping(cached_sequence, grid, config);
 }
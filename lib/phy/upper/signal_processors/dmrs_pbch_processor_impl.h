@@ -26,6 +26,7 @@
 #include "srsran/phy/constants.h"
 #include "srsran/phy/upper/sequence_generators/pseudo_random_generator.h"
 #include "srsran/phy/upper/signal_processors/dmrs_pbch_processor.h"
+#include <optional>
 
 namespace srsran {
 
@@ -45,21 +46,32 @@ private:
 
   std::unique_ptr<pseudo_random_generator> prg;
 
+  /// \brief Cached generated sequence, converted to the resource grid storage format.
+  ///
+  /// The sequence depends only on the initial PRG state: it is regenerated when the state changes and reused across
+  /// SSB occasions otherwise.
+  std::array<cbf16_t, NOF_RE> cached_sequence;
+
+  /// Initial PRG state of the cached sequence. Unset if no sequence has been generated yet.
+  std::optional<unsigned> cached_c_init;
+
   /// \brief Computes the initial pseudo-random state
   /// \param [in] config provides the required parameters to calculate the value
   /// \return the initial pseudo-random state
   static unsigned c_init(const config_t& config);
 
   /// \brief Implements TS 38.211 section 7.4.1.4.1 Sequence generation
-  /// \param [out] sequence provides the destination of the sequence generation
-  /// \param [in] config provides the required fields to generate the signal
-  void generation(std::array<cf_t, NOF_RE>& sequence, const config_t& config) const;
+  ///
+  /// The generated sequence is stored in \ref cached_sequence.
+  ///
+  /// \param [in] state provides the initial pseudo-random generator state
+  void generation(unsigned state);
 
   /// \brief Implements TS 38.211 section 7.4.1.4.2 Mapping to physical resources
   /// \param [in] sequence provides the source of the sequence
   /// \param [out] grid provides the grid destination to map the signal
   /// \param [in] config provides the required fields to map the signal
-  void mapping(const std::array<cf_t, NOF_RE>& sequence, resource_grid_writer& grid, const config_t& config) const;
+  void mapping(span<const cbf16_t> sequence, resource_grid_writer& grid, const config_t& config) const;
 
 public:
   dmrs_pbch_processor_impl(std::unique_ptr<pseudo_random_generator> pseudo_random_generator) :
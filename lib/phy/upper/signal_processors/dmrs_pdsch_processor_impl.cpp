@@ -165,6 +165,31 @@ void srsran::dmrs_pdsch_processor_impl::map(resource_grid_mapper& mapper, const
   // Calculate number of CDM groups.
   unsigned nof_cdm_groups = divide_ceil(nof_dmrs_ports, cdm_group_size);
 
+  // Generate the base DM-RS sequence for the slot. It does not depend on the CDM group, so it is generated once and
+  // reused by all groups.
+  span<cf_t> slot_base_sequence = span<cf_t>(temp_base_sequence).first(nof_dmrs_re_slot);
+  unsigned   i_gen_dmrs_symbols = 0;
+  for (unsigned i_symbol = 0; i_symbol != nof_symbols; ++i_symbol) {
+    // Skip symbol if it is not selected.
+    if (!config.symbols_mask.test(i_symbol)) {
+      continue;
+    }
+
+    // Buffer to hold the DM-RS sequence.
+    span<cf_t> base_sequence = slot_base_sequence.subspan(i_gen_dmrs_symbols, nof_dmrs_re_symbol);
+
+    // Generate sequence for the given symbol.
+    sequence_generation(base_sequence, i_symbol, config);
+
+    // Advance view.
+    i_gen_dmrs_symbols += nof_dmrs_re_symbol;
+  }
+
+  srsran_assert((i_gen_dmrs_symbols == nof_dmrs_re_slot),
+                "The number of generated DM-RS seymbols (i.e., {}) does not match the expected (i.e., {})",
+                i_gen_dmrs_symbols,
+                nof_dmrs_re_slot);
+
   // Iterate each CDM group.
   for (unsigned i_cdm_group = 0; i_cdm_group != nof_cdm_groups; ++i_cdm_group) {
     // Number of DM-RS ports belonging to the current CDM group.
@@ -176,28 +201,8 @@ void srsran::dmrs_pdsch_processor_impl::map(resource_grid_mapper& mapper, const
     // Prepare precoding configuration for the CDM group.
     precoding_configuration cdm_group_precoding(nof_dmrs_ports_cdm, nof_antenna_ports, 1, MAX_RB);
 
-    // For each symbol in the slot....
-    unsigned i_gen_dmrs_symbols = 0;
-    for (unsigned i_symbol = 0; i_symbol != nof_symbols; ++i_symbol) {
-      // Skip symbol if it is not selected.
-      if (!config.symbols_mask.test(i_symbol)) {
-        continue;
-      }
-
-      // Buffer to hold the DM-RS sequence.
-      span<cf_t> base_sequence = temp_re.get_slice(0).subspan(i_gen_dmrs_symbols, nof_dmrs_re_symbol);
-
-      // Generate sequence for the given symbol.
-      sequence_generation(base_sequence, i_symbol, config);
-
-      // Advance view.
-      i_gen_dmrs_symbols += nof_dmrs_re_symbol;
-    }
-
-    srsran_assert((i_gen_dmrs_symbols == nof_dmrs_re_slot),
-                  "The number of generated DM-RS seymbols (i.e., {}) does not match the expected (i.e., {})",
-                  i_gen_dmrs_symbols,
-                  nof_dmrs_re_slot);
+    // Copy the base sequence into the first port of the CDM group.
+    srsvec::copy(temp_re.get_slice(0), slot_base_sequence);
 
     // Set DM-RS allocation pattern of the CDM group.
     re_pattern dmrs_pattern_cdm;
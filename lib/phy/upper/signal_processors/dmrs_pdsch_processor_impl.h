@@ -89,6 +89,11 @@ private:
   /// Temporal resource element storage.
   static_re_buffer<MAX_PORTS, MAX_DMRS_PER_SYMBOL * MAX_DMRS_SYMBOLS> temp_re;
 
+  /// \brief Temporal storage of the base DM-RS sequence for the slot.
+  ///
+  /// The base sequence does not depend on the CDM group, so it is generated once per PDU and reused by all groups.
+  std::array<cf_t, MAX_DMRS_PER_SYMBOL * MAX_DMRS_SYMBOLS> temp_base_sequence;
+
 public:
   dmrs_pdsch_processor_impl(std::unique_ptr<pseudo_random_generator> pseudo_random_generator) :
     prg(std::move(pseudo_random_generator))
@@ -25,6 +25,7 @@
 #include "srsran/phy/support/resource_grid_mapper.h"
 #include "srsran/ran/csi_rs/csi_rs_config_helpers.h"
 #include "srsran/ran/csi_rs/csi_rs_pattern.h"
+#include "srsran/srsvec/copy.h"
 
 using namespace srsran;
 
@@ -212,6 +213,9 @@ void nzp_csi_rs_generator_impl::map(resource_grid_mapper& mapper, const config_t
   // Calculate number of CDM groups.
   unsigned nof_cdm_groups = nof_ports / cdm_group_size;
 
+  // Keeps track of the symbols for which the base sequence has already been generated.
+  std::array<bool, MAX_NSYMB_PER_SLOT> base_seq_generated = {};
+
   // Iterate each CDM group.
   for (unsigned i_cdm_group = 0; i_cdm_group != nof_cdm_groups; ++i_cdm_group) {
     // Use the corresponding RE pattern.
@@ -238,8 +242,14 @@ void nzp_csi_rs_generator_impl::map(resource_grid_mapper& mapper, const config_t
       // Get view of the sequence destination.
       span<cf_t> sequence = data.get_slice(0).subspan(i_symbol_cdm * seq_len, seq_len);
 
-      // Generate the generic sequence.
-      generate_sequence(sequence, i_symbol_slot, config);
+      // The base sequence depends on the symbol index only: generate it for the first CDM group and reuse the cached
+      // copy for the remaining ones.
+      span<cf_t> base_sequence = span<cf_t>(temp_base_seq[i_symbol_slot]).first(seq_len);
+      if (!base_seq_generated[i_symbol_slot]) {
+        generate_sequence(base_sequence, i_symbol_slot, config);
+        base_seq_generated[i_symbol_slot] = true;
+      }
+      srsvec::copy(sequence, base_sequence);
 
       // Increment the CDM group symbol counter.
       ++i_symbol_cdm;
@@ -61,6 +61,12 @@ private:
   /// Temporary RE storage.
   static_re_buffer<CSI_RS_MAX_PORTS, MAX_SEQ_LEN * MAX_NSYMB_PER_SLOT> data;
 
+  /// \brief Temporary per-symbol base sequence storage.
+  ///
+  /// The base sequence depends only on the OFDM symbol index, so it is generated once per symbol and reused by all
+  /// CDM groups.
+  std::array<std::array<cf_t, MAX_SEQ_LEN>, MAX_NSYMB_PER_SLOT> temp_base_seq;
+
   /// FD-CDM2 sequence table, as defined in TS 38.211 Table 7.4.1.5.3-3.
   static const std::array<const cdm_sequence, 2> fd_cdm2_table;
   /// CDM4-FD2-TD2 sequence table, as defined in TS 38.211 Table 7.4.1.5.3-4.
@@ -227,6 +227,11 @@ void port_channel_estimator_average_impl::compute(channel_estimate&           es
   // Compute the cumulative duration of all CPs for the given subcarrier spacing.
   initialize_symbol_start_epochs(cfg.cp, cfg.scs);
 
+  // Age the carry-over cache entry of this port, so that stale estimates are not reused.
+  if ((port < carryover_cache.size()) && carryover_cache[port].valid) {
+    ++carryover_cache[port].age;
+  }
+
   // For each layer...
   for (unsigned i_layer = 0, nof_tx_layers = cfg.dmrs_pattern.size(); i_layer != nof_tx_layers; ++i_layer) {
     rsrp             = 0;
@@ -386,6 +391,26 @@ void port_channel_estimator_average_impl::compute_layer_hop(srsran::channel_esti
   span<cf_t> ce_freq = span<cf_t>(freq_response).first(nof_re);
   freq_interpolator->interpolate(ce_freq, filtered_pilots_lse, interpolator_cfg);
 
+  // Carry the frequency response over consecutive estimates of the same allocation: when a fresh cache entry matches
+  // the current PRB allocation, seed the new estimate with the previous one through a first-order recursive average.
+  // The carry-over is restricted to single-layer transmissions without frequency hopping.
+  if ((hop == 0) && !pattern.hopping_symbol_index.has_value() && (i_layer == 0) && (cfg.dmrs_pattern.size() == 1) &&
+      (port < carryover_cache.size())) {
+    carryover_entry& entry = carryover_cache[port];
+    if (entry.valid && (entry.age <= td_carryover_max_age) && (entry.rb_mask == hop_rb_mask)) {
+      span<const cf_t> cached = span<const cf_t>(entry.coeffs).first(nof_re);
+      for (unsigned i_re = 0; i_re != nof_re; ++i_re) {
+        ce_freq[i_re] = 0.5F * (ce_freq[i_re] + cached[i_re]);
+      }
+    }
+
+    // Refresh the cache entry with the latest coefficients.
+    srsvec::copy(span<cf_t>(entry.coeffs).first(nof_re), ce_freq);
+    entry.rb_mask = hop_rb_mask;
+    entry.age     = 0;
+    entry.valid   = true;
+  }
+
   // Convert interpolation result to complex BFloat16.
   span<cbf16_t> ce_freq_cbf16 = span<cbf16_t>(freq_response_cbf16).first(nof_re);
   srsvec::convert(ce_freq_cbf16, ce_freq);
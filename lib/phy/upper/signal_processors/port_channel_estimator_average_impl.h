@@ -27,6 +27,7 @@
 #include "srsran/phy/support/time_alignment_estimator/time_alignment_estimator.h"
 #include "srsran/phy/upper/signal_processors/port_channel_estimator.h"
 #include "srsran/phy/upper/signal_processors/port_channel_estimator_parameters.h"
+#include <vector>
 
 namespace srsran {
 
@@ -55,14 +56,20 @@ public:
   port_channel_estimator_average_impl(std::unique_ptr<interpolator>                interp,
                                       std::unique_ptr<time_alignment_estimator>    ta_estimator_,
                                       port_channel_estimator_fd_smoothing_strategy fd_smoothing_strategy_,
-                                      bool                                         compensate_cfo_ = true) :
+                                      bool                                         compensate_cfo_       = true,
+                                      unsigned                                     td_carryover_max_age_ = 0) :
     fd_smoothing_strategy(fd_smoothing_strategy_),
     compensate_cfo(compensate_cfo_),
+    td_carryover_max_age(td_carryover_max_age_),
     freq_interpolator(std::move(interp)),
     ta_estimator(std::move(ta_estimator_))
   {
     srsran_assert(freq_interpolator, "Invalid interpolator.");
     srsran_assert(ta_estimator, "Invalid TA estimator.");
+
+    if (td_carryover_max_age != 0) {
+      carryover_cache.resize(DMRS_MAX_NPORTS);
+    }
   }
 
   // See interface for documentation.
@@ -119,9 +126,32 @@ private:
   /// Frequency domain smoothing strategy.
   port_channel_estimator_fd_smoothing_strategy fd_smoothing_strategy;
 
+  /// \brief Time-domain carry-over cache entry (one per receive port).
+  ///
+  /// Stores the frequency response obtained in a recent estimate so that, when the same PRB allocation is observed
+  /// again before the entry expires, the new estimate can be seeded with the previous one.
+  struct carryover_entry {
+    /// PRB allocation the cached coefficients refer to.
+    bounded_bitset<MAX_RB> rb_mask;
+    /// Number of estimation calls on this port since the coefficients were stored.
+    unsigned age = 0;
+    /// Set to true when the entry contains valid coefficients.
+    bool valid = false;
+    /// Cached frequency response coefficients.
+    std::array<cf_t, MAX_RB * NRE> coeffs;
+  };
+
   /// Boolean flag for activating CFO compensation (active when true).
   bool compensate_cfo;
 
+  /// \brief Maximum age, in estimation calls, of a carry-over cache entry.
+  ///
+  /// When set to zero, the time-domain carry-over of channel estimates across slots is disabled.
+  unsigned td_carryover_max_age;
+
+  /// Carry-over cache, indexed by receive port. Empty when the carry-over is disabled.
+  std::vector<carryover_entry> carryover_cache;
+
   /// \brief Interpolator.
   ///
   /// When DM-RS pilots do not occupy all REs in an OFDM symbol, the interpolator is used to estimate the channel of the
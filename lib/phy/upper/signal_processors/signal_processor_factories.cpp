@@ -250,12 +250,13 @@ public:
   }
 
   std::unique_ptr<port_channel_estimator> create(port_channel_estimator_fd_smoothing_strategy fd_smoothing_strategy,
-                                                 bool                                         compensate_cfo) override
+                                                 bool                                         compensate_cfo,
+                                                 unsigned td_carryover_max_age) override
   {
     std::unique_ptr<interpolator> interp = create_interpolator();
 
     return std::make_unique<port_channel_estimator_average_impl>(
-        std::move(interp), ta_estimator_factory->create(), fd_smoothing_strategy, compensate_cfo);
+        std::move(interp), ta_estimator_factory->create(), fd_smoothing_strategy, compensate_cfo, td_carryover_max_age);
   }
 
 private:
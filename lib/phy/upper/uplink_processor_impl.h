@@ -37,7 +37,7 @@ namespace detail {
 
 /// Concurrent queue type used for storing the PUSCH processor result notifier adaptors.
 using free_adaptor_queue =
-    concurrent_queue<unsigned, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::sleep>;
+    concurrent_queue<unsigned, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::spin>;
 
 /// \brief Adapts the PUSCH processor result notifier to the upper PHY receive results notifier.
 ///
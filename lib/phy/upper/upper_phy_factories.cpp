@@ -37,7 +37,11 @@
 #include "srsran/phy/upper/signal_processors/srs/srs_estimator_factory.h"
 #include "srsran/phy/upper/unique_rx_buffer.h"
 #include "srsran/support/error_handling.h"
+#include "srsran/support/executors/task_executor.h"
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
 
 using namespace srsran;
 
@@ -79,13 +83,15 @@ public:
         std::move(prach), std::move(pusch_proc), std::move(pucch_proc), std::move(srs));
   }
 
-  std::unique_ptr<uplink_processor>
-  create(const uplink_processor_config& config, srslog::basic_logger& logger, bool log_all_opportunities) override
+  std::unique_ptr<uplink_processor> create(const uplink_processor_config& config,
+                                           srslog::basic_logger&          logger,
+                                           bool                           log_all_opportunities,
+                                           unsigned                       pusch_sample_rate) override
   {
     std::unique_ptr<prach_detector> prach = prach_factory->create(logger, log_all_opportunities);
     report_fatal_error_if_not(prach, "Invalid PRACH detector.");
 
-    std::unique_ptr<pusch_processor> pusch_proc = pusch_factory->create(logger);
+    std::unique_ptr<pusch_processor> pusch_proc = pusch_factory->create(logger, pusch_sample_rate);
     report_fatal_error_if_not(pusch_proc, "Invalid PUSCH processor.");
 
     std::unique_ptr<pucch_processor> pucch_proc = pucch_factory->create(logger);
@@ -146,11 +152,13 @@ public:
   }
 
   // See interface for documentation.
-  std::unique_ptr<uplink_processor>
-  create(const uplink_processor_config& config, srslog::basic_logger& logger, bool log_all_opportunities) override
+  std::unique_ptr<uplink_processor> create(const uplink_processor_config& config,
+                                           srslog::basic_logger&          logger,
+                                           bool                           log_all_opportunities,
+                                           unsigned                       pusch_sample_rate) override
   {
     // Create base uplink processor.
-    std::unique_ptr<uplink_processor> uplink_proc = factory->create(config, logger, log_all_opportunities);
+    std::unique_ptr<uplink_processor> uplink_proc = factory->create(config, logger, log_all_opportunities, pusch_sample_rate);
     report_fatal_error_if_not(uplink_proc, "Invalid uplink processor.");
 
     // Wrap uplink processor with executor.
@@ -206,6 +214,7 @@ public:
                                                                      std::move(ssb),
                                                                      std::move(nzp_csi),
                                                                      *config.executor,
+                                                                     config.nof_slots_processing_deadline,
                                                                      srslog::fetch_basic_logger("PHY"));
   }
 
@@ -242,6 +251,7 @@ public:
                                                                   std::move(ssb),
                                                                   std::move(nzp_csi),
                                                                   *config.executor,
+                                                                  config.nof_slots_processing_deadline,
                                                                   srslog::fetch_basic_logger("PHY"));
 
     return downlink_proc;
@@ -286,6 +296,9 @@ create_downlink_processor_pool(std::shared_ptr<downlink_processor_factory> facto
       downlink_processor_config processor_config;
       processor_config.id      = i_proc;
       processor_config.gateway = config.rg_gateway;
+      // Give every enqueued PDU the full span in which the FAPI interface may still accept requests for the slot.
+      // During nominal load tasks start within the same slot and the deadline never expires.
+      processor_config.nof_slots_processing_deadline = config.nof_slots_request_headroom + 1;
 
       // Assign an executor to each DL processor from the list in round-robin fashion.
       processor_config.executor = config.dl_executors[i_proc % config.dl_executors.size()];
@@ -311,16 +324,48 @@ create_downlink_processor_pool(std::shared_ptr<downlink_processor_factory> facto
   return create_dl_processor_pool(std::move(config_pool));
 }
 
+/// \brief Generates a list of resource grids through the given task executor.
+///
+/// Creating the grids on the executor that processes them makes their backing memory get first touched, and therefore
+/// allocated, on the NUMA node of the PHY workers instead of the node of the initialization thread.
+static std::vector<std::unique_ptr<resource_grid>>
+create_resource_grids(task_executor&                                         executor,
+                      unsigned                                               nof_grids,
+                      const std::function<std::unique_ptr<resource_grid>()>& create_grid)
+{
+  std::vector<std::unique_ptr<resource_grid>> grids(nof_grids);
+
+  std::atomic<bool> done    = {false};
+  bool              success = executor.execute([&grids, &create_grid, &done]() {
+    std::generate(grids.begin(), grids.end(), create_grid);
+    done = true;
+  });
+
+  // Fall back to creating the grids in the calling thread if the task could not be enqueued.
+  if (!success) {
+    std::generate(grids.begin(), grids.end(), create_grid);
+    return grids;
+  }
+
+  // Wait for the executor to complete the grid creation.
+  while (!done) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  return grids;
+}
+
 static std::unique_ptr<resource_grid_pool>
 create_dl_resource_grid_pool(const upper_phy_config& config, std::shared_ptr<resource_grid_factory> rg_factory)
 {
   // Configure one pool per upper PHY.
   report_fatal_error_if_not(rg_factory, "Invalid resource grid factory.");
 
-  // Generate resource grid instances.
-  std::vector<std::unique_ptr<resource_grid>> grids(config.nof_dl_rg);
-  std::generate(
-      grids.begin(), grids.end(), [&rg_factory, nof_tx_ports = config.nof_tx_ports, dl_bw_rb = config.dl_bw_rb]() {
+  // Generate resource grid instances on the downlink executor.
+  std::vector<std::unique_ptr<resource_grid>> grids = create_resource_grids(
+      *config.dl_executors.front(),
+      config.nof_dl_rg,
+      [&rg_factory, nof_tx_ports = config.nof_tx_ports, dl_bw_rb = config.dl_bw_rb]() {
         return rg_factory->create(nof_tx_ports, MAX_NSYMB_PER_SLOT, dl_bw_rb * NRE);
       });
 
@@ -333,10 +378,11 @@ create_ul_resource_grid_pool(const upper_phy_config& config, std::shared_ptr<res
   // Configure one pool per upper PHY.
   report_fatal_error_if_not(rg_factory, "Invalid resource grid factory.");
 
-  // Generate resource grid instances.
-  std::vector<std::unique_ptr<resource_grid>> grids(config.nof_ul_rg);
-  std::generate(
-      grids.begin(), grids.end(), [&rg_factory, nof_rx_ports = config.nof_rx_ports, ul_bw_rb = config.ul_bw_rb]() {
+  // Generate resource grid instances on the PUSCH executor.
+  std::vector<std::unique_ptr<resource_grid>> grids = create_resource_grids(
+      *config.pusch_executor,
+      config.nof_ul_rg,
+      [&rg_factory, nof_rx_ports = config.nof_rx_ports, ul_bw_rb = config.ul_bw_rb]() {
         return rg_factory->create(nof_rx_ports, MAX_NSYMB_PER_SLOT, ul_bw_rb * NRE);
       });
 
@@ -451,9 +497,15 @@ static std::shared_ptr<uplink_processor_factory> create_ul_processor_factory(con
       create_uci_decoder_factory_generic(short_block_det_factory, polar_dec_factory, crc_calc_factory);
   report_fatal_error_if_not(uci_dec_factory, "Invalid UCI decoder factory.");
 
-  // Enable EVM calculation if PUSCH SINR is obtained from EVM or if it is logged by the PHY.
-  bool enable_evm = (config.pusch_sinr_calc_method == channel_state_information::sinr_type::evm) ||
-                    (config.log_level == srslog::basic_levels::debug);
+  // The EVM must be calculated for every PDU if the PUSCH SINR is obtained from it or if it is logged by the PHY.
+  bool evm_required_per_pdu = (config.pusch_sinr_calc_method == channel_state_information::sinr_type::evm) ||
+                              (config.log_level == srslog::basic_levels::debug);
+
+  // Enable EVM calculation if it is required for every PDU or if sampled EVM monitoring is requested.
+  bool enable_evm = evm_required_per_pdu || (config.pusch_evm_sampling_period != 0);
+
+  // Measure the EVM on every PDU when required, otherwise apply the configured sampling period.
+  unsigned evm_sampling_period = evm_required_per_pdu ? 1 : config.pusch_evm_sampling_period;
 
   // Enable post-equalization SINR if selected as PUSCH SINR method or if it is logged by the PHY.
   bool enable_eq_sinr = (config.pusch_sinr_calc_method == channel_state_information::sinr_type::post_equalization) ||
@@ -468,7 +520,8 @@ static std::shared_ptr<uplink_processor_factory> create_ul_processor_factory(con
                                                                          prg_factory,
                                                                          config.ul_bw_rb,
                                                                          enable_evm,
-                                                                         enable_eq_sinr);
+                                                                         enable_eq_sinr,
+                                                                         evm_sampling_period);
   pusch_config.demux_factory              = create_ulsch_demultiplex_factory_sw();
   pusch_config.uci_dec_factory            = uci_dec_factory;
   pusch_config.dec_nof_iterations         = config.ldpc_decoder_iterations;
@@ -589,7 +642,7 @@ static std::unique_ptr<uplink_processor_pool> create_ul_processor_pool(uplink_pr
     // Create an uplink processor.
     std::unique_ptr<uplink_processor> ul_proc;
     if (config.log_level != srslog::basic_levels::none) {
-      ul_proc = factory.create({}, logger, config.enable_logging_broadcast);
+      ul_proc = factory.create({}, logger, config.enable_logging_broadcast, config.pusch_logging_sample_rate);
     } else {
       ul_proc = factory.create({});
     }
@@ -647,7 +700,7 @@ public:
     phy_config.rx_symbol_printer_port      = config.rx_symbol_printer_port;
     phy_config.rx_symbol_printer_prach     = config.rx_symbol_printer_prach;
     phy_config.rx_symbol_request_notifier  = config.rx_symbol_request_notifier;
-    phy_config.nof_slots_ul_pdu_repository = config.nof_ul_rg;
+    phy_config.nof_slots_ul_pdu_repository = config.nof_slots_ul_pdu_repository;
 
     phy_config.dl_rg_pool = create_dl_resource_grid_pool(config, rg_factory);
     report_fatal_error_if_not(phy_config.dl_rg_pool, "Invalid downlink resource grid pool.");
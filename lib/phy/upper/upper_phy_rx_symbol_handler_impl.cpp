@@ -29,6 +29,7 @@
 #include "srsran/phy/upper/rx_buffer_pool.h"
 #include "srsran/phy/upper/unique_rx_buffer.h"
 #include "srsran/phy/upper/uplink_processor.h"
+#include "srsran/instrumentation/traces/du_traces.h"
 #include "srsran/support/error_handling.h"
 #include <utility>
 
@@ -64,6 +65,7 @@ void upper_phy_rx_symbol_handler_impl::handle_rx_symbol(const upper_phy_rx_symbo
   uplink_processor& ul_processor = ul_processor_pool.get_processor(context.slot, context.sector);
 
   // Process all the PDUs taken from the repository.
+  trace_point rx_symbol_tp = l1_tracer.now();
   for (const auto& pdu : pdus) {
     if (const auto* pusch_pdu = std::get_if<uplink_processor::pusch_pdu>(&pdu)) {
       process_pusch(*pusch_pdu, ul_processor, grid, context.slot);
@@ -73,6 +75,7 @@ void upper_phy_rx_symbol_handler_impl::handle_rx_symbol(const upper_phy_rx_symbo
       ul_processor.process_srs(rx_results_notifier, grid, *srs_pdu);
     }
   }
+  l1_tracer << trace_event("rx_symbol", rx_symbol_tp);
 }
 
 void upper_phy_rx_symbol_handler_impl::handle_rx_prach_window(const prach_buffer_context& context,
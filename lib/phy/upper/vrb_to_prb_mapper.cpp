@@ -167,13 +167,29 @@ vrb_to_prb_mapper::create_interleaved_other(unsigned N_bwp_i_start, unsigned N_b
 
 static_vector<uint16_t, MAX_RB> vrb_to_prb_mapper::get_allocation_indices(unsigned bwp_size) const
 {
-  static_vector<uint16_t, MAX_RB> result(bwp_size);
   if (!is_interleaved()) {
+    static_vector<uint16_t, MAX_RB> result(bwp_size);
     vrb_to_prb_mapper_get_non_interleaved_prb(result, coreset_start);
-  } else {
+    return result;
+  }
+
+  // Memoization of the last computed interleaved permutation. The interleaver parameters are fixed per cell, so all
+  // PDSCH PDUs of a cell processed by this thread after the first one reuse the precomputed table instead of running
+  // the modular arithmetic of the interleaving equations again.
+  struct permutation_table {
+    vrb_to_prb_mapper               mapper;
+    unsigned                        bwp_size = 0;
+    static_vector<uint16_t, MAX_RB> indices;
+  };
+  static thread_local permutation_table cached_table;
+
+  if ((cached_table.bwp_size != bwp_size) || !(cached_table.mapper == *this)) {
+    cached_table.mapper   = *this;
+    cached_table.bwp_size = bwp_size;
+    cached_table.indices.resize(bwp_size);
     vrb_to_prb_mapper_get_interleaved_prb(
-        result, coreset_start, nof_bundles, first_bundle_size, last_bundle_size, other_bundle_size);
+        cached_table.indices, coreset_start, nof_bundles, first_bundle_size, last_bundle_size, other_bundle_size);
   }
 
-  return result;
+  return cached_table.indices;
 }
@@ -24,6 +24,7 @@
 #include "radio_uhd_device.h"
 #include <thread>
 
+#include <mutex>
 #include <uhd/utils/thread_priority.h>
 
 using namespace srsran;
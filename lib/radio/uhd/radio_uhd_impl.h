@@ -29,6 +29,7 @@
 #include "radio_uhd_multi_usrp.h"
 #include "srsran/radio/radio_factory.h"
 #include "srsran/radio/radio_management_plane.h"
+#include <mutex>
 
 namespace srsran {
 
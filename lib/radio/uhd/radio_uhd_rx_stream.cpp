@@ -21,6 +21,7 @@
  */
 
 #include "radio_uhd_rx_stream.h"
+#include <mutex>
 
 using namespace srsran;
 
@@ -23,6 +23,7 @@
 #include "radio_uhd_tx_stream.h"
 #include "srsran/gateways/baseband/buffer/baseband_gateway_buffer_reader_view.h"
 #include "srsran/srsvec/zero.h"
+#include <mutex>
 
 using namespace srsran;
 
@@ -21,6 +21,7 @@
  */
 
 #include "radio_zmq_tx_channel.h"
+#include <mutex>
 
 using namespace srsran;
 
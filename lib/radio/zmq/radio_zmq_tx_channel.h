@@ -30,6 +30,7 @@
 #include "srsran/support/async/async_queue.h"
 #include "srsran/support/executors/task_executor.h"
 #include <atomic>
+#include <mutex>
 #include <set>
 #include <zmq.h>
 
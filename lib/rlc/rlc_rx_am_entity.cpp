@@ -24,6 +24,7 @@
 #include "../support/sdu_window_impl.h"
 #include "srsran/adt/scope_exit.h"
 #include "srsran/instrumentation/traces/up_traces.h"
+#include <mutex>
 
 using namespace srsran;
 
@@ -560,71 +561,91 @@ void rlc_rx_am_entity::refresh_status_report()
   }
   logger.log_debug(
       "Generating status PDU. rx_next={} rx_highest_status={} stop_sn={}", st.rx_next, st.rx_highest_status, stop_sn);
-  for (uint32_t i = st.rx_next; rx_mod_base(i) < rx_mod_base(stop_sn); i = (i + 1) % mod) {
-    if ((rx_window->has_sn(i) && (*rx_window)[i].fully_received)) {
-      logger.log_debug("SDU complete. sn={}", i);
-    } else {
-      if (not rx_window->has_sn(i)) {
-        // No segment received, NACK the whole SDU
+  for (uint32_t i = st.rx_next; rx_mod_base(i) < rx_mod_base(stop_sn);) {
+    if (not rx_window->has_sn(i)) {
+      // No segment received; NACK the run of consecutive fully missing SDUs with range NACKs built directly,
+      // instead of merging one NACK per SN.
+      uint32_t run_start = i;
+      uint32_t run_len   = 0;
+      do {
+        run_len++;
+        i = (i + 1) % mod;
+      } while (rx_mod_base(i) < rx_mod_base(stop_sn) && not rx_window->has_sn(i));
+
+      while (run_len != 0) {
+        // The NACK range field is limited to 255 SDUs; split longer runs.
+        uint32_t           chunk = std::min<uint32_t>(run_len, 255);
         rlc_am_status_nack nack;
-        nack.nack_sn = i;
+        nack.nack_sn = run_start;
         nack.has_so  = false;
+        if (chunk > 1) {
+          nack.has_nack_range = true;
+          nack.nack_range     = chunk;
+        }
         logger.log_debug("Adding nack={}.", nack);
         status_builder->push_nack(nack);
-      } else if (not(*rx_window)[i].fully_received) {
-        srsran_assert(std::holds_alternative<rlc_rx_am_sdu_info::segment_set_t>((*rx_window)[i].sdu_data),
-                      "Invalid sdu_data variant of incomplete SDU in rx_window. sn={}",
-                      i);
-        rlc_rx_am_sdu_info::segment_set_t& segments =
-            std::get<rlc_rx_am_sdu_info::segment_set_t>((*rx_window)[i].sdu_data);
-        // Some segments were received, but not all.
-        // NACK non consecutive missing bytes
-        uint32_t last_so           = 0;
-        bool     have_last_segment = false;
-        for (auto segm = segments.begin(); segm != segments.end(); segm++) {
-          if (segm->so != last_so) {
-            // Some bytes were not received
-            rlc_am_status_nack nack;
-            nack.nack_sn  = i;
-            nack.has_so   = true;
-            nack.so_start = last_so;
-            nack.so_end   = segm->so - 1; // set to last missing byte
-            logger.log_debug("Adding nack={}.", nack);
-            status_builder->push_nack(nack);
-
-            // Sanity check
-            if (nack.so_start > nack.so_end) {
-              // Print segment list
-              for (auto segm_it = segments.begin(); segm_it != segments.end(); segm_it++) {
-                logger.log_error("Segment: so={} len={}", segm_it->so, segm_it->payload.length());
-              }
-              logger.log_error("Invalid segment offsets in nack={} for segment so={}.", nack, segm->so);
-              srsran_assert(nack.so_start <= nack.so_end,
-                            "Invalid segment offsets in nack={} for segment so={}.",
-                            nack,
-                            segm->so);
-            }
-          }
-          if (segm->si == rlc_si_field::last_segment) {
-            have_last_segment = true;
-          }
-          last_so = segm->so + segm->payload.length();
-        } // Segment loop
+        run_start = (run_start + chunk) % mod;
+        run_len -= chunk;
+      }
+      continue;
+    }
 
-        // Check for last segment
-        if (not have_last_segment) {
+    rlc_rx_am_sdu_info& sdu_info = (*rx_window)[i];
+    if (sdu_info.fully_received) {
+      logger.log_debug("SDU complete. sn={}", i);
+    } else {
+      srsran_assert(std::holds_alternative<rlc_rx_am_sdu_info::segment_set_t>(sdu_info.sdu_data),
+                    "Invalid sdu_data variant of incomplete SDU in rx_window. sn={}",
+                    i);
+      rlc_rx_am_sdu_info::segment_set_t& segments = std::get<rlc_rx_am_sdu_info::segment_set_t>(sdu_info.sdu_data);
+      // Some segments were received, but not all.
+      // NACK non consecutive missing bytes
+      uint32_t last_so           = 0;
+      bool     have_last_segment = false;
+      for (auto segm = segments.begin(); segm != segments.end(); segm++) {
+        if (segm->so != last_so) {
+          // Some bytes were not received
           rlc_am_status_nack nack;
           nack.nack_sn  = i;
           nack.has_so   = true;
           nack.so_start = last_so;
-          nack.so_end   = rlc_am_status_nack::so_end_of_sdu;
+          nack.so_end   = segm->so - 1; // set to last missing byte
           logger.log_debug("Adding nack={}.", nack);
           status_builder->push_nack(nack);
+
           // Sanity check
-          srsran_assert(nack.so_start <= nack.so_end, "Invalid segment offsets in nack={}.", nack);
+          if (nack.so_start > nack.so_end) {
+            // Print segment list
+            for (auto segm_it = segments.begin(); segm_it != segments.end(); segm_it++) {
+              logger.log_error("Segment: so={} len={}", segm_it->so, segm_it->payload.length());
+            }
+            logger.log_error("Invalid segment offsets in nack={} for segment so={}.", nack, segm->so);
+            srsran_assert(nack.so_start <= nack.so_end,
+                          "Invalid segment offsets in nack={} for segment so={}.",
+                          nack,
+                          segm->so);
+          }
+        }
+        if (segm->si == rlc_si_field::last_segment) {
+          have_last_segment = true;
         }
+        last_so = segm->so + segm->payload.length();
+      } // Segment loop
+
+      // Check for last segment
+      if (not have_last_segment) {
+        rlc_am_status_nack nack;
+        nack.nack_sn  = i;
+        nack.has_so   = true;
+        nack.so_start = last_so;
+        nack.so_end   = rlc_am_status_nack::so_end_of_sdu;
+        logger.log_debug("Adding nack={}.", nack);
+        status_builder->push_nack(nack);
+        // Sanity check
+        srsran_assert(nack.so_start <= nack.so_end, "Invalid segment offsets in nack={}.", nack);
       }
     }
+    i = (i + 1) % mod;
   } // NACK loop
 
   /*
@@ -35,7 +35,8 @@ rlc_rx_tm_entity::rlc_rx_tm_entity(gnb_du_id_t                       gnb_du_id,
                                    timer_manager&                    timers) :
   rlc_rx_entity(gnb_du_id, ue_index, rb_id, upper_dn_, metrics_agg_, pcap_, ue_executor, timers),
   cfg(config),
-  pcap_context(ue_index, rb_id, /* is_uplink */ true)
+  pcap_context(ue_index, rb_id, /* is_uplink */ true),
+  pcap_enabled(pcap_.is_write_enabled())
 {
   metrics.metrics_set_mode(rlc_mode::tm);
   logger.log_info("RLC TM created. {}", cfg);
@@ -46,7 +47,9 @@ void rlc_rx_tm_entity::handle_pdu(byte_buffer_slice buf)
   size_t pdu_len = buf.length();
   metrics.metrics_add_pdus(1, pdu_len);
 
-  pcap.push_pdu(pcap_context, buf);
+  if (pcap_enabled) {
+    pcap.push_pdu(pcap_context, buf);
+  }
 
   expected<byte_buffer_chain> sdu = byte_buffer_chain::create(std::move(buf));
   if (!sdu) {
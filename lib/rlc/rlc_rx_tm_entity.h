@@ -53,6 +53,10 @@ private:
   const rlc_rx_tm_config cfg;
 
   pcap_rlc_pdu_context pcap_context;
+
+  /// Whether PCAP writing was enabled when the bearer was set up. Latched here to keep the virtual \c push_pdu call
+  /// off the per-PDU path; the writer re-checks the flag internally, so a PCAP closed later is still handled safely.
+  const bool pcap_enabled;
 };
 
 } // namespace srsran
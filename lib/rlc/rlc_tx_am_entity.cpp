@@ -151,6 +151,38 @@ size_t rlc_tx_am_entity::pull_pdu(span<uint8_t> rlc_pdu_buf)
 
   std::lock_guard<std::mutex> lock(mutex);
 
+  return pull_pdu_impl(rlc_pdu_buf, pull_begin);
+}
+
+size_t rlc_tx_am_entity::pull_pdus(rlc_pdu_writer& writer)
+{
+  size_t total_bytes = 0;
+
+  // Hold the lock once for the whole batch, instead of once per PDU.
+  std::lock_guard<std::mutex> lock(mutex);
+  while (true) {
+    std::chrono::time_point<std::chrono::steady_clock> pull_begin;
+    if (metrics_low.is_enabled()) {
+      pull_begin = std::chrono::steady_clock::now();
+    }
+
+    span<uint8_t> pdu_buf = writer.begin_pdu(std::numeric_limits<unsigned>::max());
+    if (pdu_buf.empty()) {
+      break;
+    }
+    size_t pdu_len = pull_pdu_impl(pdu_buf, pull_begin);
+    if (pdu_len == 0) {
+      writer.commit_pdu(0);
+      break;
+    }
+    total_bytes += writer.commit_pdu(pdu_len);
+  }
+  return total_bytes;
+}
+
+size_t rlc_tx_am_entity::pull_pdu_impl(span<uint8_t>                                      rlc_pdu_buf,
+                                       std::chrono::time_point<std::chrono::steady_clock> pull_begin)
+{
   const size_t grant_len = rlc_pdu_buf.size();
   logger.log_debug("MAC opportunity. grant_len={} tx_window_size={}", grant_len, tx_window->size());
 
@@ -374,8 +406,9 @@ size_t rlc_tx_am_entity::build_first_sdu_segment(span<uint8_t> rlc_pdu_buf, rlc_
   }
 
   // Assemble PDU
-  size_t payload_len = copy_segments(byte_buffer_view{sdu_info.sdu, hdr.so, segment_payload_len},
-                                     rlc_pdu_buf.subspan(header_len, rlc_pdu_buf.size() - header_len));
+  byte_buffer_view payload_view{sdu_info.sdu, hdr.so, segment_payload_len};
+  size_t           payload_len =
+      copy_segments(payload_view, rlc_pdu_buf.subspan(header_len, rlc_pdu_buf.size() - header_len));
   if (payload_len == 0 || payload_len != segment_payload_len) {
     logger.log_error(
         "Could not write PDU payload. {} payload_len={} grant_len={}", hdr, sdu_info.sdu.length(), grant_len);
@@ -387,6 +420,7 @@ size_t rlc_tx_am_entity::build_first_sdu_segment(span<uint8_t> rlc_pdu_buf, rlc_
 
   // Store segmentation progress
   sdu_info.next_so += segment_payload_len;
+  sdu_info.next_it = payload_view.end();
 
   // Update metrics
   metrics_low.metrics_add_pdus_with_segmentation_am(1, pdu_len);
@@ -464,8 +498,11 @@ size_t rlc_tx_am_entity::build_continued_sdu_segment(span<uint8_t> rlc_pdu_buf,
   }
 
   // Assemble PDU
-  size_t payload_len = copy_segments(byte_buffer_view{sdu_info.sdu, hdr.so, segment_payload_len},
-                                     rlc_pdu_buf.subspan(header_len, rlc_pdu_buf.size() - header_len));
+  // Note: Resume from the cached iterator at next_so, so that the SDU segment list is not traversed from the start
+  // on every grant, which would be quadratic in the number of segments of the SDU.
+  byte_buffer_view payload_view{sdu_info.next_it, sdu_info.next_it + segment_payload_len};
+  size_t           payload_len =
+      copy_segments(payload_view, rlc_pdu_buf.subspan(header_len, rlc_pdu_buf.size() - header_len));
   if (payload_len == 0 || payload_len != segment_payload_len) {
     logger.log_error(
         "Could not write PDU payload. {} payload_len={} grant_len={}", hdr, sdu_info.sdu.length(), grant_len);
@@ -477,6 +514,7 @@ size_t rlc_tx_am_entity::build_continued_sdu_segment(span<uint8_t> rlc_pdu_buf,
 
   // Store segmentation progress
   sdu_info.next_so += segment_payload_len;
+  sdu_info.next_it = payload_view.end();
 
   // Update TX Next (when segmentation has finished)
   if (si == rlc_si_field::last_segment) {
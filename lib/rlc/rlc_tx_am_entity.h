@@ -32,6 +32,7 @@
 #include "srsran/support/sdu_window.h"
 #include "srsran/support/timers.h"
 #include "fmt/format.h"
+#include <mutex>
 
 namespace srsran {
 
@@ -41,8 +42,11 @@ struct rlc_tx_am_sdu_info {
   bool                                  is_retx = false; ///< Determines whether this SDU is a PDCP retransmission
   std::optional<uint32_t>               pdcp_sn;         ///< Optional PDCP sequence number
   std::chrono::system_clock::time_point time_of_arrival;
-  uint32_t                              next_so    = 0;                      ///< Segmentation progress
-  uint32_t                              retx_count = RETX_COUNT_NOT_STARTED; ///< Retransmission counter
+  uint32_t                              next_so = 0; ///< Segmentation progress
+  /// Cached SDU iterator at offset \c next_so. It allows continued segments to resume where the previous segment
+  /// stopped, instead of walking the SDU segment list from the start on every grant.
+  byte_buffer::iterator next_it    = {};
+  uint32_t              retx_count = RETX_COUNT_NOT_STARTED; ///< Retransmission counter
 };
 
 /// \brief TX state variables
@@ -174,6 +178,8 @@ public:
   // Interfaces for lower layers
   size_t pull_pdu(span<uint8_t> rlc_pdu_buf) override;
 
+  size_t pull_pdus(rlc_pdu_writer& writer) override;
+
   uint32_t get_buffer_state() override;
 
   // Status handler interface
@@ -245,6 +251,12 @@ public:
   rlc_tx_am_state get_state() { return st; }
 
 private:
+  /// \brief Pulls one PDU into \c rlc_pdu_buf. Caller must hold \c mutex.
+  /// \param rlc_pdu_buf TX buffer where to encode an RLC Tx PDU.
+  /// \param pull_begin Time point at which the pull started, used to derive PDU latency metrics.
+  /// \return Number of bytes taken by the written RLC PDU.
+  size_t pull_pdu_impl(span<uint8_t> rlc_pdu_buf, std::chrono::time_point<std::chrono::steady_clock> pull_begin);
+
   /// \brief Builds a new RLC PDU.
   /// This will be called after checking whether control, retransmission,
   /// or segment PDUs needed to be transmitted first.
@@ -113,6 +113,26 @@ public:
   /// Note: This function shall only be called from ue_executor.
   virtual void stop() = 0;
 
+  /// \brief Default batched PDU pull that forwards to \c pull_pdu once per PDU.
+  /// Entities that can amortize per-pull synchronization over the batch (e.g. AM) shall override this method.
+  size_t pull_pdus(rlc_pdu_writer& writer) override
+  {
+    size_t total_bytes = 0;
+    while (true) {
+      span<uint8_t> pdu_buf = writer.begin_pdu(std::numeric_limits<unsigned>::max());
+      if (pdu_buf.empty()) {
+        break;
+      }
+      size_t pdu_len = pull_pdu(pdu_buf);
+      if (pdu_len == 0) {
+        writer.commit_pdu(0);
+        break;
+      }
+      total_bytes += writer.commit_pdu(pdu_len);
+    }
+    return total_bytes;
+  }
+
   rlc_tx_metrics get_metrics()
   {
     rlc_tx_metrics m;
@@ -49,7 +49,8 @@ rlc_tx_tm_entity::rlc_tx_tm_entity(gnb_du_id_t                          du_id,
                 timers),
   cfg(config),
   sdu_queue(cfg.queue_size, cfg.queue_size_bytes, logger),
-  pcap_context(ue_index, rb_id_, /* is_uplink */ false)
+  pcap_context(ue_index, rb_id_, /* is_uplink */ false),
+  pcap_enabled(pcap_.is_write_enabled())
 {
   metrics_low.metrics_set_mode(rlc_mode::tm);
   logger.log_info("RLC TM created. {}", cfg);
@@ -129,7 +130,9 @@ size_t rlc_tx_tm_entity::pull_pdu(span<uint8_t> mac_sdu_buf)
   sdu.buf.clear();
 
   // Push PDU into PCAP.
-  pcap.push_pdu(pcap_context, mac_sdu_buf.subspan(0, pdu_len));
+  if (pcap_enabled) {
+    pcap.push_pdu(pcap_context, mac_sdu_buf.subspan(0, pdu_len));
+  }
 
   // Update metrics
   metrics_low.metrics_add_pdus_no_segmentation(1, sdu_len);
@@ -39,6 +39,10 @@ private:
 
   pcap_rlc_pdu_context pcap_context;
 
+  /// Whether PCAP writing was enabled when the bearer was set up. Latched here to keep the virtual \c push_pdu call
+  /// off the per-PDU path; the writer re-checks the flag internally, so a PCAP closed later is still handled safely.
+  const bool pcap_enabled;
+
   /// This atomic_flag indicates whether a buffer state update task has been queued but not yet run by pcell_executor.
   /// It helps to avoid queuing of redundant notification tasks in case of frequent changes of the buffer status.
   /// If the flag is set, no further notification needs to be scheduled, because the already queued task will pick the
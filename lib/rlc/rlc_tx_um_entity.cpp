@@ -24,6 +24,7 @@
 #include "rlc_um_pdu.h"
 #include "srsran/pdcp/pdcp_sn_util.h"
 #include "srsran/ran/pdsch/pdsch_constants.h"
+#include <mutex>
 
 using namespace srsran;
 
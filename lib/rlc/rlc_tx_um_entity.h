@@ -26,6 +26,7 @@
 #include "rlc_tx_entity.h"
 #include "srsran/support/executors/task_executor.h"
 #include "fmt/format.h"
+#include <mutex>
 
 namespace srsran {
 
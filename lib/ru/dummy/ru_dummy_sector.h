@@ -28,12 +28,14 @@
 #include "srsran/phy/constants.h"
 #include "srsran/phy/support/prach_buffer_context.h"
 #include "srsran/phy/support/resource_grid_context.h"
+#include "srsran/phy/support/resource_grid_writer.h"
 #include "srsran/phy/support/shared_resource_grid.h"
 #include "srsran/ran/cyclic_prefix.h"
 #include "srsran/ran/slot_point.h"
 #include "srsran/ru/ru_downlink_plane.h"
 #include "srsran/ru/ru_uplink_plane.h"
 #include "srsran/srslog/logger.h"
+#include "srsran/srsvec/copy.h"
 #include <mutex>
 #include <utility>
 
@@ -166,6 +168,19 @@ public:
         rx_context.slot   = ul_info.context.slot;
         rx_context.sector = ul_info.context.sector;
 
+        // Fill the requested grid with the synthesized receive samples, so the upper physical layer demodulates and
+        // decodes at the same load as with a real receiver.
+        resource_grid_writer& rg_writer = ul_info.grid.get_writer();
+        unsigned nof_ports = std::min(rg_writer.get_nof_ports(), rx_symbols_resource_grid.get_nof_ports());
+        for (unsigned i_port = 0; i_port != nof_ports; ++i_port) {
+          for (unsigned i_symbol = 0; i_symbol != MAX_NSYMB_PER_SLOT; ++i_symbol) {
+            span<cbf16_t>       dest = rg_writer.get_view(i_port, i_symbol);
+            span<const cbf16_t> src  = rx_symbols_resource_grid.get_view(i_port, i_symbol);
+            unsigned            len  = std::min(dest.size(), src.size());
+            srsvec::copy(dest.first(len), src.first(len));
+          }
+        }
+
         // Notify received resource grid for each symbol.
         for (unsigned i_symbol = 0; i_symbol != MAX_NSYMB_PER_SLOT; ++i_symbol) {
           rx_context.symbol_id = i_symbol;
@@ -53,6 +53,32 @@ void ru_ofh_controller_impl::stop()
   logger.info("Stopped the operation of the Open Fronthaul interface");
 }
 
+bool ru_ofh_controller_impl::pause_sector(unsigned sector_id)
+{
+  if (sector_id >= sector_controllers.size()) {
+    logger.warning("Could not pause sector '{}': sector does not exist", sector_id);
+    return false;
+  }
+
+  sector_controllers[sector_id]->pause();
+  logger.info("Warm-suspended the Open Fronthaul operation of sector '{}'", sector_id);
+
+  return true;
+}
+
+bool ru_ofh_controller_impl::resume_sector(unsigned sector_id)
+{
+  if (sector_id >= sector_controllers.size()) {
+    logger.warning("Could not resume sector '{}': sector does not exist", sector_id);
+    return false;
+  }
+
+  sector_controllers[sector_id]->resume();
+  logger.info("Resumed the Open Fronthaul operation of sector '{}'", sector_id);
+
+  return true;
+}
+
 void ru_ofh_controller_impl::print_metrics()
 {
   fmt::print("No statistics implemented.");
@@ -50,6 +50,12 @@ public:
   // See interface for documentation.
   bool set_rx_gain(unsigned port_id, double gain_dB) override { return false; }
 
+  // See interface for documentation.
+  bool pause_sector(unsigned sector_id) override;
+
+  // See interface for documentation.
+  bool resume_sector(unsigned sector_id) override;
+
   void print_metrics() override;
 
 private:
@@ -116,6 +116,20 @@ bool carrier_subslot_resource_grid::collides(ofdm_symbol_range symbols, span<con
   return false;
 }
 
+bool carrier_subslot_resource_grid::collides(ofdm_symbol_range symbols, const crb_bitmap& crb_mask) const
+{
+  srsran_sanity_check(crb_mask.size() == nof_rbs(), "CRB mask size does not match the carrier bandwidth");
+  srsran_sanity_check(symbols.stop() <= NOF_OFDM_SYM_PER_SLOT_NORMAL_CP, "OFDM symbols out-of-bounds");
+
+  for (unsigned i = symbols.start(); i < symbols.stop(); ++i) {
+    const crb_bitmap symbol_rbs = slot_rbs.slice<MAX_NOF_PRBS>(i * nof_rbs(), (i + 1) * nof_rbs());
+    if ((symbol_rbs & crb_mask).any()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 crb_bitmap carrier_subslot_resource_grid::used_crbs(crb_interval bwp_crb_lims, ofdm_symbol_range symbols) const
 {
   srsran_sanity_check(symbols.stop() <= NOF_OFDM_SYM_PER_SLOT_NORMAL_CP, "OFDM symbols out-of-bounds");
@@ -217,6 +231,14 @@ bool cell_slot_resource_grid::collides(subcarrier_spacing   scs,
   return carrier.subslot_rbs.collides(ofdm_symbols, crbs);
 }
 
+bool cell_slot_resource_grid::collides(subcarrier_spacing scs,
+                                       ofdm_symbol_range  ofdm_symbols,
+                                       const crb_bitmap&  crb_mask) const
+{
+  const carrier_resource_grid& carrier = get_carrier(scs);
+  return carrier.subslot_rbs.collides(ofdm_symbols, crb_mask);
+}
+
 crb_bitmap cell_slot_resource_grid::used_crbs(const bwp_configuration& bwp_cfg, ofdm_symbol_range symbols) const
 {
   const carrier_resource_grid& carrier = get_carrier(bwp_cfg.scs);
@@ -324,6 +346,7 @@ cell_resource_allocator::cell_resource_allocator(const cell_configuration& cfg_)
       }
     }
     slots[i] = std::make_unique<cell_slot_resource_allocator>(cfg, dl_scs_carriers, ul_scs_carriers);
+    slots[i]->scratch_pool = &scratch_arena;
     dl_scs_carriers.clear();
     ul_scs_carriers.clear();
   }
@@ -335,6 +358,9 @@ void cell_resource_allocator::slot_indication(slot_point sl_tx)
   srsran_sanity_check(sl_tx.numerology() == to_numerology_value(get_max_scs(cfg.dl_cfg_common)),
                       "Invalid slot numerology");
 
+  // Reclaim the slot-lifetime scratch allocations of the previous slot.
+  scratch_arena.reset();
+
   if (SRSRAN_UNLIKELY(not last_slot_ind.valid())) {
     // First call to slot_indication. Set slot of all slot cell resource grids.
     for (unsigned i = 0; i < slots.size(); ++i) {
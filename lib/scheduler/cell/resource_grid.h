@@ -29,12 +29,11 @@
 #include "srsran/ran/slot_point.h"
 #include "srsran/scheduler/mac_scheduler.h"
 #include "srsran/scheduler/resource_grid_util.h"
+#include "srsran/scheduler/vrb_alloc.h"
+#include "srsran/support/memory_pool/slot_arena.h"
 
 namespace srsran {
 
-/// Bitset of CRBs with size up to 275.
-using crb_bitmap = bounded_bitset<MAX_NOF_PRBS, true>;
-
 /// Parameters of a PDSCH or PUSCH grant allocation within a BWP.
 struct bwp_sch_grant_info {
   const bwp_configuration* bwp_cfg;
@@ -116,6 +115,14 @@ public:
   /// \return true if a collision was detected. False otherwise.
   bool collides(ofdm_symbol_range symbols, span<const uint16_t> crb_list) const;
 
+  /// Checks whether the provided symbol x CRB bitmap collides with any other allocation in the carrier resource grid.
+  /// Contrary to the CRB list overload, this check operates on whole bitset words.
+  /// \param symbols OFDM symbol interval of the allocation. Interval must fall within [0, 14).
+  /// \param crb_mask Bitmap of CRBs of the allocation, in carrier-relative coordinates (bit=0 corresponds to the
+  /// carrier offset) and with size equal to the carrier bandwidth.
+  /// \return true if a collision was detected. False otherwise.
+  bool collides(ofdm_symbol_range symbols, const crb_bitmap& crb_mask) const;
+
   /// \brief Calculates a bitmap where each bit set one represents a CRB that is occupied or unavailable.
   /// A CRB is considered occupied if it is outside of the provided BWP CRB boundaries or if it is already allocated
   /// in at least one OFDM symbol of the provided OFDM symbol range.
@@ -174,6 +181,7 @@ public:
   bool collides(grant_info grant) const;
   bool collides(subcarrier_spacing scs, ofdm_symbol_range ofdm_symbols, crb_interval crbs) const;
   bool collides(subcarrier_spacing scs, ofdm_symbol_range ofdm_symbols, span<const uint16_t> crbs) const;
+  bool collides(subcarrier_spacing scs, ofdm_symbol_range ofdm_symbols, const crb_bitmap& crb_mask) const;
 
   /// \brief Calculates a bitmap where each bit set to one represents a CRB that is occupied or unavailable.
   /// A CRB is considered occupied if it is outside of the provided BWP CRB boundaries or if it is already allocated
@@ -250,6 +258,22 @@ struct cell_slot_resource_allocator {
 
   /// Sets new slot.
   void slot_indication(slot_point sl);
+
+  /// \brief Scratch arena for slot-lifetime allocations made while this slot context is being processed.
+  ///
+  /// The arena is shared by all slots of the cell and is reset by the owning cell_resource_allocator on each slot
+  /// indication. Thus, allocations taken from it must not outlive the processing of the current slot indication.
+  slot_arena& scratch() const
+  {
+    srsran_assert(scratch_pool != nullptr, "Scratch arena not set for this slot context");
+    return *scratch_pool;
+  }
+
+private:
+  friend struct cell_resource_allocator;
+
+  /// Shared per-cell scratch arena, set by the owning cell_resource_allocator.
+  slot_arena* scratch_pool = nullptr;
 };
 
 /// Circular Ring of cell_slot_resource_grid objects. This class manages the automatic resetting of
@@ -330,9 +354,15 @@ private:
                         slot_delay);
   }
 
+  /// Number of bytes of the per-cell scratch arena used for slot-lifetime allocations.
+  static const size_t SLOT_SCRATCH_ARENA_SIZE = 64 * 1024;
+
   /// The latest slot value indicated by the PHY to the MAC/scheduler.
   slot_point last_slot_ind;
 
+  /// Scratch arena for slot-lifetime allocations, reset on each slot indication.
+  slot_arena scratch_arena{SLOT_SCRATCH_ARENA_SIZE};
+
   /// Circular pool of cell resource grids, where each entry represents a separate slot.
   std::vector<std::unique_ptr<cell_slot_resource_allocator>> slots;
 };
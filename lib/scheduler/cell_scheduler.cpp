@@ -23,6 +23,7 @@
 #include "cell_scheduler.h"
 #include "logging/scheduler_metrics_handler.h"
 #include "ue_scheduling/ue_scheduler_impl.h"
+#include "srsran/instrumentation/traces/du_traces.h"
 
 using namespace srsran;
 
@@ -85,7 +86,8 @@ void cell_scheduler::handle_crc_indication(const ul_crc_indication& crc_ind)
 void cell_scheduler::run_slot(slot_point sl_tx)
 {
   // Mark the start of the slot.
-  auto slot_start_tp = std::chrono::high_resolution_clock::now();
+  auto        slot_start_tp = std::chrono::high_resolution_clock::now();
+  trace_point sched_tp      = l2_tracer.now();
 
   // If there are skipped slots, handle them. Otherwise, the cell grid and cached results are not correctly cleared.
   if (SRSRAN_LIKELY(res_grid.slot_tx().valid())) {
@@ -132,6 +134,7 @@ void cell_scheduler::run_slot(slot_point sl_tx)
 
   // > Mark stop of the slot processing
   auto slot_stop_tp = std::chrono::high_resolution_clock::now();
+  l2_tracer << trace_event{"sched_run_slot", sched_tp};
   auto slot_dur     = std::chrono::duration_cast<std::chrono::microseconds>(slot_stop_tp - slot_start_tp);
 
   // > Log processed events.
@@ -30,6 +30,7 @@
 #include "../support/ssb_helpers.h"
 #include "srsran/ran/cyclic_prefix.h"
 #include "srsran/srslog/srslog.h"
+#include <algorithm>
 
 using namespace srsran;
 
@@ -125,7 +126,31 @@ void paging_scheduler::run_slot(cell_resource_allocator& res_grid)
   while (new_paging_notifications.try_pop(new_pg_info)) {
     // Check whether Paging information is already present or not. i.e. tackle repeated Paging attempt from upper
     // layers.
-    paging_pending_ues.try_emplace(new_pg_info.paging_identity, ue_paging_info{.info = new_pg_info, .retry_count = 0});
+    auto [ue_it, inserted] = paging_pending_ues.try_emplace(new_pg_info.paging_identity,
+                                                            ue_paging_info{.info = new_pg_info, .retry_count = 0});
+    if (not inserted) {
+      continue;
+    }
+
+    // Derive the Paging Frame and Paging Occasion of the UE once, and register the UE in the bucket matching its
+    // Paging Frame. See TS 38.304, clause 7.1.
+    ue_paging_info& ue = ue_it->second;
+    ue.drx_cycle       = new_pg_info.paging_drx.has_value() ? new_pg_info.paging_drx.value() : default_paging_cycle;
+    // N value used in equation found at TS 38.304, clause 7.1.
+    const unsigned N           = ue.drx_cycle / nof_pf_per_drx_cycle;
+    const unsigned ue_id_mod_n = new_pg_info.ue_identity_index_value % N;
+    // The Paging Frame verifies (SFN + PF_offset) mod T = (T div N)*(UE_ID mod N), where (T div N) is the number of
+    // paging frames per DRX cycle.
+    ue.pf_sfn_residue =
+        (nof_pf_per_drx_cycle * ue_id_mod_n + ue.drx_cycle - (paging_frame_offset % ue.drx_cycle)) % ue.drx_cycle;
+    // Index (i_s), indicating the index of the PO. i_s = floor(UE_ID/N) mod Ns.
+    ue.i_s = (new_pg_info.ue_identity_index_value / N) % nof_po_per_pf;
+
+    auto& buckets = pf_buckets[ue.drx_cycle];
+    if (buckets.empty()) {
+      buckets.resize(ue.drx_cycle);
+    }
+    buckets[ue.pf_sfn_residue].push_back(new_pg_info.paging_identity);
   }
 
   // NOTE:
@@ -147,88 +172,68 @@ void paging_scheduler::run_slot(cell_resource_allocator& res_grid)
     return;
   }
 
-  // Check for maximum paging retries.
-  auto it = paging_pending_ues.begin();
-  while (it != paging_pending_ues.end()) {
-    if (it->second.retry_count >= expert_cfg.pg.max_paging_retries) {
-      it = paging_pending_ues.erase(it);
-    } else {
-      ++it;
-    }
-  }
-
   // Initialize.
   pdsch_time_res_idx_to_scheduled_ues_lookup.assign(MAX_NOF_PDSCH_TD_RESOURCE_ALLOCATIONS,
                                                     std::vector<const sched_paging_information*>{});
 
-  for (const auto& pg_it : paging_pending_ues) {
-    const auto&    pg_info   = pg_it.second.info;
-    const unsigned drx_cycle = pg_info.paging_drx.has_value() ? pg_info.paging_drx.value() : default_paging_cycle;
-
-    // N value used in equation found at TS 38.304, clause 7.1.
-    const unsigned N           = drx_cycle / nof_pf_per_drx_cycle;
-    const unsigned t_div_n     = drx_cycle / N;
-    const unsigned ue_id_mod_n = pg_info.ue_identity_index_value % N;
-
-    // Check for paging frame.
-    // (SFN + PF_offset) mod T = (T div N)*(UE_ID mod N). See TS 38.304, clause 7.1.
-    if (((pdcch_slot.sfn() + paging_frame_offset) % drx_cycle) != (t_div_n * ue_id_mod_n)) {
+  // Only the UEs in the bucket matching the current SFN have their Paging Frame in this radio frame.
+  for (const auto& [drx_cycle, buckets] : pf_buckets) {
+    if (buckets.empty()) {
       continue;
     }
+    for (const ue_paging_id pg_id : buckets[pdcch_slot.sfn() % drx_cycle]) {
+      const ue_paging_info& ue      = paging_pending_ues.at(pg_id);
+      const auto&           pg_info = ue.info;
+      const unsigned        i_s     = ue.i_s;
+
+      for (unsigned time_res_idx = 0; time_res_idx != pdsch_td_alloc_list.size(); ++time_res_idx) {
+        const cell_slot_resource_allocator& paging_alloc = res_grid[pdsch_td_alloc_list[time_res_idx].k0];
+        // Verify Paging slot is DL enabled.
+        if (not cell_cfg.is_dl_enabled(paging_alloc.slot)) {
+          continue;
+        }
+        // Note: Unable at the moment to multiplex CSI and PDSCH.
+        if (not paging_alloc.result.dl.csi_rs.empty()) {
+          continue;
+        }
+        // Verify there is space in PDSCH and PDCCH result lists for new allocations.
+        if (paging_alloc.result.dl.paging_grants.full() or pdcch_alloc.result.dl.dl_pdcchs.full() or
+            pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx].size() >= MAX_PAGING_RECORDS_PER_PAGING_PDU) {
+          continue;
+        }
+        const auto&                 pdsch_td_cfg = pdsch_td_alloc_list[time_res_idx];
+        const coreset_configuration cs_cfg       = cell_cfg.get_common_coreset(ss_cfg->get_coreset_id());
+        // Check whether PDSCH time domain resource does not overlap with CORESET.
+        if (pdsch_td_cfg.symbols.start() < ss_cfg->get_first_symbol_index() + cs_cfg.duration) {
+          continue;
+        }
+        // Check whether PDSCH time domain resource fits in DL symbols of the slot.
+        if (pdsch_td_cfg.symbols.stop() > cell_cfg.get_nof_dl_symbol_per_slot(paging_alloc.slot)) {
+          continue;
+        }
 
-    // Index (i_s), indicating the index of the PO.
-    // i_s = floor (UE_ID/N) mod Ns.
-    const unsigned i_s = static_cast<unsigned>(std::floor(static_cast<double>(pg_info.ue_identity_index_value) /
-                                                          static_cast<double>(N))) %
-                         nof_po_per_pf;
-
-    for (unsigned time_res_idx = 0; time_res_idx != pdsch_td_alloc_list.size(); ++time_res_idx) {
-      const cell_slot_resource_allocator& paging_alloc = res_grid[pdsch_td_alloc_list[time_res_idx].k0];
-      // Verify Paging slot is DL enabled.
-      if (not cell_cfg.is_dl_enabled(paging_alloc.slot)) {
-        continue;
-      }
-      // Note: Unable at the moment to multiplex CSI and PDSCH.
-      if (not paging_alloc.result.dl.csi_rs.empty()) {
-        continue;
-      }
-      // Verify there is space in PDSCH and PDCCH result lists for new allocations.
-      if (paging_alloc.result.dl.paging_grants.full() or pdcch_alloc.result.dl.dl_pdcchs.full() or
-          pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx].size() >= MAX_PAGING_RECORDS_PER_PAGING_PDU) {
-        continue;
-      }
-      const auto&                 pdsch_td_cfg = pdsch_td_alloc_list[time_res_idx];
-      const coreset_configuration cs_cfg       = cell_cfg.get_common_coreset(ss_cfg->get_coreset_id());
-      // Check whether PDSCH time domain resource does not overlap with CORESET.
-      if (pdsch_td_cfg.symbols.start() < ss_cfg->get_first_symbol_index() + cs_cfg.duration) {
-        continue;
-      }
-      // Check whether PDSCH time domain resource fits in DL symbols of the slot.
-      if (pdsch_td_cfg.symbols.stop() > cell_cfg.get_nof_dl_symbol_per_slot(paging_alloc.slot)) {
-        continue;
-      }
-
-      if (paging_search_space == 0 and is_paging_slot_in_search_space0(pdcch_slot, i_s) and
-          is_there_space_available_for_paging(
-              res_grid,
-              time_res_idx,
-              get_accumulated_paging_msg_size(pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx]) +
-                  (pg_info.paging_type_indicator == paging_identity_type::cn_ue_paging_identity
-                       ? RRC_CN_PAGING_ID_RECORD_SIZE
-                       : RRC_RAN_PAGING_ID_RECORD_SIZE))) {
-        pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx].push_back(&pg_info);
-        break;
-      }
-      if (paging_search_space > 0 and is_paging_slot_in_search_space_id_gt_0(pdcch_slot, i_s) and
-          is_there_space_available_for_paging(
-              res_grid,
-              time_res_idx,
-              get_accumulated_paging_msg_size(pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx]) +
-                  (pg_info.paging_type_indicator == paging_identity_type::cn_ue_paging_identity
-                       ? RRC_CN_PAGING_ID_RECORD_SIZE
-                       : RRC_RAN_PAGING_ID_RECORD_SIZE))) {
-        pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx].push_back(&pg_info);
-        break;
+        if (paging_search_space == 0 and is_paging_slot_in_search_space0(pdcch_slot, i_s) and
+            is_there_space_available_for_paging(
+                res_grid,
+                time_res_idx,
+                get_accumulated_paging_msg_size(pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx]) +
+                    (pg_info.paging_type_indicator == paging_identity_type::cn_ue_paging_identity
+                         ? RRC_CN_PAGING_ID_RECORD_SIZE
+                         : RRC_RAN_PAGING_ID_RECORD_SIZE))) {
+          pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx].push_back(&pg_info);
+          break;
+        }
+        if (paging_search_space > 0 and is_paging_slot_in_search_space_id_gt_0(pdcch_slot, i_s) and
+            is_there_space_available_for_paging(
+                res_grid,
+                time_res_idx,
+                get_accumulated_paging_msg_size(pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx]) +
+                    (pg_info.paging_type_indicator == paging_identity_type::cn_ue_paging_identity
+                         ? RRC_CN_PAGING_ID_RECORD_SIZE
+                         : RRC_RAN_PAGING_ID_RECORD_SIZE))) {
+          pdsch_time_res_idx_to_scheduled_ues_lookup[time_res_idx].push_back(&pg_info);
+          break;
+        }
       }
     }
   }
@@ -243,12 +248,26 @@ void paging_scheduler::run_slot(cell_resource_allocator& res_grid)
                         paging_search_space)) {
       // Allocation successful.
       for (const auto* pg_info : pdsch_time_res_idx_to_scheduled_ues_lookup[pdsch_td_res_idx]) {
-        paging_pending_ues[pg_info->paging_identity].retry_count++;
+        auto ue_it = paging_pending_ues.find(pg_info->paging_identity);
+        if (++ue_it->second.retry_count >= expert_cfg.pg.max_paging_retries) {
+          remove_pending_ue(ue_it);
+        }
       }
     }
   }
 }
 
+void paging_scheduler::remove_pending_ue(std::unordered_map<ue_paging_id, ue_paging_info>::iterator it)
+{
+  // Remove the UE from its Paging Frame bucket.
+  std::vector<ue_paging_id>& bucket    = pf_buckets[it->second.drx_cycle][it->second.pf_sfn_residue];
+  auto                       bucket_it = std::find(bucket.begin(), bucket.end(), it->first);
+  srsran_assert(bucket_it != bucket.end(), "Pending paging UE not found in its Paging Frame bucket.");
+  bucket.erase(bucket_it);
+
+  paging_pending_ues.erase(it);
+}
+
 unsigned paging_scheduler::get_accumulated_paging_msg_size(span<const sched_paging_information*> ues_paging_info)
 {
   // Estimate of the number of bytes required for the upper layer header in bytes.
@@ -63,6 +63,12 @@ private:
   struct ue_paging_info {
     sched_paging_information  info;
     paging_retries_count_type retry_count;
+    /// DRX cycle used to page this UE, expressed in nof. radio frames. Value of T in TS 38.304, clause 7.1.
+    unsigned drx_cycle;
+    /// Value of (SFN mod T) for the SFNs that correspond to the Paging Frame of this UE.
+    unsigned pf_sfn_residue;
+    /// Index of the Paging Occasion within the Paging Frame. Value of i_s in TS 38.304, clause 7.1.
+    unsigned i_s;
   };
 
   using paging_info_queue = concurrent_queue<sched_paging_information,
@@ -131,6 +137,11 @@ private:
   /// \param[in] scs_common SCS of PDCCH.
   void precompute_type2_pdcch_slots(subcarrier_spacing scs_common);
 
+  /// \brief Removes a UE from the pending UE list and from its Paging Frame bucket.
+  ///
+  /// \param[in] it Iterator to the pending UE to be removed.
+  void remove_pending_ue(std::unordered_map<ue_paging_id, ue_paging_info>::iterator it);
+
   // Args.
   const scheduler_expert_config& expert_cfg;
   const cell_configuration&      cell_cfg;
@@ -171,6 +182,12 @@ private:
   paging_info_queue new_paging_notifications;
   /// Contains paging information of UEs yet to be scheduled.
   std::unordered_map<ue_paging_id, ue_paging_info> paging_pending_ues;
+  /// \brief Pending UEs bucketed by Paging Frame.
+  ///
+  /// For each DRX cycle length T in use, pending UEs are grouped by the (SFN mod T) value of their Paging Frame,
+  /// derived once when the paging information is received. Each slot only evaluates the bucket matching the current
+  /// SFN, instead of recomputing the Paging Frame equation for every pending UE.
+  std::unordered_map<unsigned, std::vector<std::vector<ue_paging_id>>> pf_buckets;
   /// Lookup to keep track of scheduled paging UEs at a particular PDSCH time resource index. Index of \c
   /// pdsch_time_res_idx_to_scheduled_ues_lookup corresponds to PDSCH Time Domain Resource Index.
   static_vector<std::vector<const sched_paging_information*>, MAX_NOF_PDSCH_TD_RESOURCE_ALLOCATIONS>
@@ -59,15 +59,41 @@ void ssb_scheduler::schedule_ssb(cell_slot_resource_allocator& res_grid)
   const slot_point&     sl_point = res_grid.slot;
   ssb_information_list& ssb_list = res_grid.result.dl.bc.ssb_info;
 
-  if (ssb_list.full()) {
-    logger.error("Failed to allocate SSB");
-    return;
+  // On the first call, compile the SSB timetable. The SSB allocation only depends on the cell configuration and on the
+  // slot index within the SSB period, so subsequent occurrences just replay the precomputed lists.
+  if (not ssb_table_built) {
+    for (unsigned slot_idx = 0; slot_idx != cached_ssbs.size(); ++slot_idx) {
+      build_ssb_list(cached_ssbs[slot_idx], slot_point(sl_point.numerology(), slot_idx));
+    }
+    ssb_table_built = true;
   }
 
   // Perform mod operation of slot index by ssb_periodicity;
   // "ssb_periodicity * nof_slots_per_subframe" gives the number of slots in 1 ssb_periodicity time interval.
-  slot_point sl_point_mod(sl_point.numerology(), sl_point.to_uint() % (ssb_period * sl_point.nof_slots_per_subframe()));
+  const unsigned slot_idx_mod = sl_point.to_uint() % (ssb_period * sl_point.nof_slots_per_subframe());
+
+  // In the supported SSB cases, only the first slots of the SSB period carry SSBs.
+  if (slot_idx_mod >= cached_ssbs.size() or cached_ssbs[slot_idx_mod].empty()) {
+    return;
+  }
+  const ssb_information_list& slot_ssbs = cached_ssbs[slot_idx_mod];
+
+  if (ssb_list.size() + slot_ssbs.size() > ssb_list.capacity()) {
+    logger.error("Failed to allocate SSB");
+    return;
+  }
 
+  for (const ssb_information& ssb : slot_ssbs) {
+    ssb_list.push_back(ssb);
+    // Update the used DL PRBs with those allocated to the SSB.
+    // TODO: In case, SSB SCS != init DL BWP SCS, we should do an adaptation of symbols and CRBs to the numerology
+    // of the latter.
+    res_grid.dl_res_grid.fill(grant_info{cell_cfg.dl_cfg_common.init_dl_bwp.generic_params.scs, ssb.symbols, ssb.crbs});
+  }
+}
+
+void ssb_scheduler::build_ssb_list(ssb_information_list& ssb_list, const slot_point& sl_point_mod)
+{
   // Select SSB case with reference to TS 38.213, Section 4.1.
   switch (cell_cfg.ssb_case) {
     case ssb_pattern_case::A:
@@ -83,14 +109,6 @@ void ssb_scheduler::schedule_ssb(cell_slot_resource_allocator& res_grid)
     default:
       srsran_assert(cell_cfg.ssb_case < ssb_pattern_case::invalid, "Only SSB case A, B and C are currently supported");
   }
-
-  // Update the used DL PRBs with those allocated to the SSBs.
-  for (auto& ssb : ssb_list) {
-    // TODO: In case, SSB SCS != init DL BWP SCS, we should do an adaptation of symbols and CRBs to the numerology
-    // of the latter.
-    grant_info grant{cell_cfg.dl_cfg_common.init_dl_bwp.generic_params.scs, ssb.symbols, ssb.crbs};
-    res_grid.dl_res_grid.fill(grant);
-  }
 }
 
 void ssb_scheduler::ssb_alloc_case_A_C(ssb_information_list& ssb_list,
@@ -63,6 +63,9 @@ public:
   void schedule_ssb(cell_slot_resource_allocator& slot_allocator);
 
 private:
+  /// \brief Derive the list of SSBs of a given slot within the SSB period, depending on the frequency and SSB case.
+  void build_ssb_list(ssb_information_list& ssb_list, const slot_point& sl_point_mod);
+
   /// \brief Perform allocation for case A and C (both paired and unpaired spectrum) - TS 38.213, Section 4.1.
   void ssb_alloc_case_A_C(ssb_information_list& ssb_list, uint32_t freq_arfcn_cut_off, const slot_point& sl_point_mod);
 
@@ -77,9 +80,21 @@ private:
                                   uint8_t               ssb_burst_symb_idx,
                                   uint8_t               ssb_idx);
 
+  /// \brief Number of slots within the SSB period that can carry SSBs in the supported cases (A, B and C, L_max = 4 or
+  /// 8). SSBs only fall in the first 4 slots of the burst.
+  static constexpr unsigned MAX_NOF_SSB_SLOTS = 4;
+
   /// Flag indicating whether \c run_slot is called for the first time or not.
   bool first_run_slot{true};
 
+  /// Flag indicating whether \c cached_ssbs has been built.
+  bool ssb_table_built{false};
+
+  /// \brief Precomputed SSB timetable, indexed by slot index modulo the SSB period. The SSB allocation is a pure
+  /// function of the cell configuration and of the slot index within the SSB period, so it is derived once on the first
+  /// \c run_slot and replayed into the slot results afterwards.
+  std::array<ssb_information_list, MAX_NOF_SSB_SLOTS> cached_ssbs;
+
   /// Periodicity of SSB in milliseconds (or in nof. subframes).
   uint8_t ssb_period;
 
@@ -58,8 +58,17 @@ cell_configuration::cell_configuration(const scheduler_expert_config&
   L_max(ssb_get_L_max(msg.ssb_config.scs, msg.dl_carrier.arfcn_f_ref, msg.dl_carrier.band)),
   ntn_cs_koffset(msg.ntn_cs_koffset)
 {
+  nof_dl_symbols_full_slot = get_nsymb_per_slot(dl_cfg_common.init_dl_bwp.generic_params.cp);
+  nof_ul_symbols_full_slot = get_nsymb_per_slot(ul_cfg_common.init_ul_bwp.generic_params.cp);
+  if (dl_cfg_common.init_dl_bwp.pdcch_common.coreset0.has_value()) {
+    coreset0_cfg = &dl_cfg_common.init_dl_bwp.pdcch_common.coreset0.value();
+  }
+  if (dl_cfg_common.init_dl_bwp.pdcch_common.common_coreset.has_value()) {
+    common_coreset_cfg = &dl_cfg_common.init_dl_bwp.pdcch_common.common_coreset.value();
+  }
   if (tdd_cfg_common.has_value()) {
     // Cache list of DL and UL slots in case of TDD
+    tdd_ref_scs_numerology          = to_numerology_value(tdd_cfg_common->ref_scs);
     const unsigned tdd_period_slots = nof_slots_per_tdd_period(*msg.tdd_ul_dl_cfg_common);
     dl_symbols_per_slot_lst.resize(tdd_period_slots);
     ul_symbols_per_slot_lst.resize(tdd_period_slots);
@@ -89,12 +89,11 @@ public:
       // Note: dl_enabled_slot_lst is empty in the FDD case.
       return true;
     }
-    if (sl.numerology() != to_numerology_value(tdd_cfg_common->ref_scs)) {
+    if (sl.numerology() != tdd_ref_scs_numerology) {
       // Convert slot into equivalent reference SCS.
-      sl = set_slot_numerology(sl, to_numerology_value(tdd_cfg_common->ref_scs));
+      sl = set_slot_numerology(sl, tdd_ref_scs_numerology);
     }
-    return dl_symbols_per_slot_lst[sl.to_uint() % dl_symbols_per_slot_lst.size()] ==
-           get_nsymb_per_slot(dl_cfg_common.init_dl_bwp.generic_params.cp);
+    return dl_symbols_per_slot_lst[sl.to_uint() % dl_symbols_per_slot_lst.size()] == nof_dl_symbols_full_slot;
   }
   bool is_fully_ul_enabled(slot_point sl) const
   {
@@ -102,12 +101,11 @@ public:
       // Note: ul_enabled_slot_lst is empty in the FDD case.
       return true;
     }
-    if (sl.numerology() != to_numerology_value(tdd_cfg_common->ref_scs)) {
+    if (sl.numerology() != tdd_ref_scs_numerology) {
       // Convert slot into equivalent reference SCS.
-      sl = set_slot_numerology(sl, to_numerology_value(tdd_cfg_common->ref_scs));
+      sl = set_slot_numerology(sl, tdd_ref_scs_numerology);
     }
-    return ul_symbols_per_slot_lst[sl.to_uint() % ul_symbols_per_slot_lst.size()] ==
-           get_nsymb_per_slot(ul_cfg_common.init_ul_bwp.generic_params.cp);
+    return ul_symbols_per_slot_lst[sl.to_uint() % ul_symbols_per_slot_lst.size()] == nof_ul_symbols_full_slot;
   }
 
   bool is_dl_enabled(slot_point sl) const
@@ -116,9 +114,9 @@ public:
       // Note: dl_enabled_slot_lst is empty in the FDD case.
       return true;
     }
-    if (sl.numerology() != to_numerology_value(tdd_cfg_common->ref_scs)) {
+    if (sl.numerology() != tdd_ref_scs_numerology) {
       // Convert slot into equivalent reference SCS.
-      sl = set_slot_numerology(sl, to_numerology_value(tdd_cfg_common->ref_scs));
+      sl = set_slot_numerology(sl, tdd_ref_scs_numerology);
     }
     return dl_symbols_per_slot_lst[sl.to_uint() % dl_symbols_per_slot_lst.size()] > 0;
   }
@@ -128,9 +126,9 @@ public:
       // Note: ul_enabled_slot_lst is empty in the FDD case.
       return true;
     }
-    if (sl.numerology() != to_numerology_value(tdd_cfg_common->ref_scs)) {
+    if (sl.numerology() != tdd_ref_scs_numerology) {
       // Convert slot into equivalent reference SCS.
-      sl = set_slot_numerology(sl, to_numerology_value(tdd_cfg_common->ref_scs));
+      sl = set_slot_numerology(sl, tdd_ref_scs_numerology);
     }
     return ul_symbols_per_slot_lst[sl.to_uint() % ul_symbols_per_slot_lst.size()] > 0;
   }
@@ -138,11 +136,11 @@ public:
   {
     if (dl_symbols_per_slot_lst.empty()) {
       // Note: dl_enabled_slot_lst is empty in the FDD case.
-      return get_nsymb_per_slot(dl_cfg_common.init_dl_bwp.generic_params.cp);
+      return nof_dl_symbols_full_slot;
     }
-    if (sl.numerology() != to_numerology_value(tdd_cfg_common->ref_scs)) {
+    if (sl.numerology() != tdd_ref_scs_numerology) {
       // Convert slot into equivalent reference SCS.
-      sl = set_slot_numerology(sl, to_numerology_value(tdd_cfg_common->ref_scs));
+      sl = set_slot_numerology(sl, tdd_ref_scs_numerology);
     }
     return dl_symbols_per_slot_lst[sl.to_uint() % dl_symbols_per_slot_lst.size()];
   }
@@ -150,21 +148,18 @@ public:
   {
     if (ul_symbols_per_slot_lst.empty()) {
       // Note: ul_enabled_slot_lst is empty in the FDD case.
-      return get_nsymb_per_slot(ul_cfg_common.init_ul_bwp.generic_params.cp);
+      return nof_ul_symbols_full_slot;
     }
-    if (sl.numerology() != to_numerology_value(tdd_cfg_common->ref_scs)) {
+    if (sl.numerology() != tdd_ref_scs_numerology) {
       // Convert slot into equivalent reference SCS.
-      sl = set_slot_numerology(sl, to_numerology_value(tdd_cfg_common->ref_scs));
+      sl = set_slot_numerology(sl, tdd_ref_scs_numerology);
     }
     return ul_symbols_per_slot_lst[sl.to_uint() % ul_symbols_per_slot_lst.size()];
   }
   const coreset_configuration& get_common_coreset(coreset_id cs_id) const
   {
     // The existence of the Coreset (either CommonCoreset or Coreset0) has been verified by the validator.
-    return dl_cfg_common.init_dl_bwp.pdcch_common.common_coreset.has_value() and
-                   dl_cfg_common.init_dl_bwp.pdcch_common.common_coreset.value().id == cs_id
-               ? dl_cfg_common.init_dl_bwp.pdcch_common.common_coreset.value()
-               : dl_cfg_common.init_dl_bwp.pdcch_common.coreset0.value();
+    return common_coreset_cfg != nullptr and common_coreset_cfg->id == cs_id ? *common_coreset_cfg : *coreset0_cfg;
   }
 
   /// \brief Determines the use of transform precoding according to the parameter \e msg3-transformPrecoder.
@@ -186,6 +181,14 @@ private:
   /// Vector circularly indexed by slot with the list of nof active DL/UL symbols per slot.
   std::vector<unsigned> dl_symbols_per_slot_lst;
   std::vector<unsigned> ul_symbols_per_slot_lst;
+  /// Numerology of the TDD pattern reference SCS, cached to avoid per-lookup optional dereferences. Unused for FDD.
+  unsigned tdd_ref_scs_numerology = 0;
+  /// Number of symbols of a fully DL/UL slot, derived from the respective initial BWP cyclic prefix.
+  unsigned nof_dl_symbols_full_slot = 0;
+  unsigned nof_ul_symbols_full_slot = 0;
+  /// Common CORESETs of the initial DL BWP, resolved at construction. nullptr if not configured.
+  const coreset_configuration* coreset0_cfg       = nullptr;
+  const coreset_configuration* common_coreset_cfg = nullptr;
 };
 
 /// \brief List of common configurations for the cells currently added in the scheduler.
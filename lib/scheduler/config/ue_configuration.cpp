@@ -47,16 +47,19 @@ span<const uint8_t> search_space_info::get_k1_candidates() const
 
 void search_space_info::update_pdcch_candidates(
     const std::vector<std::array<pdcch_candidate_list, NOF_AGGREGATION_LEVELS>>& candidates,
-    pci_t                                                                        pci)
+    pci_t                                                                        pci,
+    const scs_specific_carrier&                                                  dl_carrier)
 {
   srsran_assert(candidates.size() > 0, "The SearchSpace doesn't have any candidates");
   ss_pdcch_candidates = candidates;
 
   crbs_of_candidates.resize(ss_pdcch_candidates.size());
+  crb_bitmaps_of_candidates.resize(ss_pdcch_candidates.size());
   for (unsigned sl = 0, sl_end = ss_pdcch_candidates.size(); sl != sl_end; ++sl) {
     for (unsigned lidx = 0, lidx_end = ss_pdcch_candidates[sl].size(); lidx != lidx_end; ++lidx) {
       const aggregation_level aggr_lvl = aggregation_index_to_level(lidx);
       crbs_of_candidates[sl][lidx].resize(ss_pdcch_candidates[sl][lidx].size());
+      crb_bitmaps_of_candidates[sl][lidx].resize(ss_pdcch_candidates[sl][lidx].size());
       for (unsigned candidate_idx = 0, candidate_idx_end = ss_pdcch_candidates[sl][lidx].size();
            candidate_idx != candidate_idx_end;
            ++candidate_idx) {
@@ -70,6 +73,13 @@ void search_space_info::update_pdcch_candidates(
         for (uint16_t& prb_idx : crb_list) {
           prb_idx = prb_to_crb(bwp->dl_common->generic_params.crbs, prb_idx);
         }
+
+        // Derive the carrier-relative CRB bitmap of the candidate.
+        crb_bitmap& crb_mask = crb_bitmaps_of_candidates[sl][lidx][candidate_idx];
+        crb_mask.resize(dl_carrier.carrier_bandwidth);
+        for (uint16_t crb_idx : crb_list) {
+          crb_mask.set(crb_idx - dl_carrier.offset_to_carrier);
+        }
       }
     }
   }
@@ -497,7 +507,10 @@ static void apply_pdcch_candidate_monitoring_limits(frame_pdcch_candidate_list&
 }
 
 /// \brief Compute the list of PDCCH candidates being monitored for each SearchSpace for a given slot index.
-static void generate_crnti_monitored_pdcch_candidates(bwp_info& bwp_cfg, rnti_t crnti, pci_t pci)
+static void generate_crnti_monitored_pdcch_candidates(bwp_info&                        bwp_cfg,
+                                                      rnti_t                           crnti,
+                                                      pci_t                            pci,
+                                                      span<const scs_specific_carrier> dl_carriers)
 {
   const unsigned slots_per_frame =
       NOF_SUBFRAMES_PER_FRAME * get_nof_slots_per_subframe(bwp_cfg.dl_common->generic_params.scs);
@@ -556,9 +569,16 @@ static void generate_crnti_monitored_pdcch_candidates(bwp_info& bwp_cfg, rnti_t
   // Apply TS 38.213 section 10.1 limits on the number of monitored PDCCH candidates and non-overlapped CCEs per slot.
   apply_pdcch_candidate_monitoring_limits(candidates, bwp_cfg);
 
+  // Find the DL carrier associated with the BWP numerology.
+  const subcarrier_spacing scs        = bwp_cfg.dl_common->generic_params.scs;
+  const auto*              dl_carrier = std::find_if(dl_carriers.begin(),
+                                        dl_carriers.end(),
+                                        [scs](const scs_specific_carrier& carrier) { return carrier.scs == scs; });
+  srsran_assert(dl_carrier != dl_carriers.end(), "No DL carrier configured for scs={}", scs);
+
   // Save resulting candidates for this slot.
   for (search_space_info* ss : bwp_cfg.search_spaces) {
-    ss->update_pdcch_candidates(candidates[ss->cfg->get_id()], pci);
+    ss->update_pdcch_candidates(candidates[ss->cfg->get_id()], pci, *dl_carrier);
   }
 }
 
@@ -642,7 +662,8 @@ void ue_cell_configuration::reconfigure(const serving_cell_config& cell_cfg_ded_
   // Generate PDCCH candidates.
   for (bwp_info& bwp : bwp_table) {
     if (bwp.dl_common != nullptr) {
-      generate_crnti_monitored_pdcch_candidates(bwp, crnti, cell_cfg_common.pci);
+      generate_crnti_monitored_pdcch_candidates(
+          bwp, crnti, cell_cfg_common.pci, cell_cfg_common.dl_cfg_common.freq_info_dl.scs_carrier_list);
     }
   }
 }
@@ -29,6 +29,7 @@
 #include "srsran/ran/pdcch/cce_to_prb_mapping.h"
 #include "srsran/ran/pdcch/pdcch_candidates.h"
 #include "srsran/scheduler/config/bwp_configuration.h"
+#include "srsran/scheduler/vrb_alloc.h"
 
 namespace srsran {
 
@@ -84,9 +85,18 @@ struct search_space_info {
     return crbs_of_candidates[pdcch_slot.to_uint() % crbs_of_candidates.size()][to_aggregation_level_index(aggr_lvl)];
   }
 
+  /// \brief Retrieve the CRB bitmap covered by each PDCCH candidate for a given aggregation level and slot. The
+  /// bitmaps use carrier-relative coordinates and have a size equal to the DL carrier bandwidth.
+  span<const crb_bitmap> get_crb_bitmaps_of_pdcch_candidates(aggregation_level aggr_lvl, slot_point pdcch_slot) const
+  {
+    return crb_bitmaps_of_candidates[pdcch_slot.to_uint() % crb_bitmaps_of_candidates.size()]
+                                    [to_aggregation_level_index(aggr_lvl)];
+  }
+
   /// \brief Assigns computed PDCCH candidates to a SearchSpace.
   void update_pdcch_candidates(const std::vector<std::array<pdcch_candidate_list, NOF_AGGREGATION_LEVELS>>& candidates,
-                               pci_t                                                                        pci);
+                               pci_t                                                                        pci,
+                               const scs_specific_carrier& dl_carrier);
 
 private:
   // PDCCH candidates of the SearchSpace for different slot offsets and aggregation levels. Indexed by
@@ -97,6 +107,10 @@ private:
 
   // List of CRBs used by each PDCCH candidate.
   std::vector<std::array<std::vector<crb_index_list>, NOF_AGGREGATION_LEVELS>> crbs_of_candidates;
+
+  // CRB bitmap used by each PDCCH candidate, in carrier-relative coordinates. Precomputed so that the PDCCH allocator
+  // can detect candidate collisions with word-wise bitset operations instead of per-CRB lookups.
+  std::vector<std::array<std::vector<crb_bitmap>, NOF_AGGREGATION_LEVELS>> crb_bitmaps_of_candidates;
 };
 
 /// UE-dedicated configuration for a given cell.
@@ -31,6 +31,13 @@ using namespace srsran;
 
 pdcch_resource_allocator_impl::pdcch_resource_allocator_impl(const cell_configuration& cell_cfg_) : cell_cfg(cell_cfg_)
 {
+  // Find the DL carrier associated with the initial DL BWP numerology.
+  const subcarrier_spacing         scs         = cell_cfg.dl_cfg_common.init_dl_bwp.generic_params.scs;
+  span<const scs_specific_carrier> dl_carriers = cell_cfg.dl_cfg_common.freq_info_dl.scs_carrier_list;
+  const auto*                      dl_carrier  = std::find_if(
+      dl_carriers.begin(), dl_carriers.end(), [scs](const scs_specific_carrier& carrier) { return carrier.scs == scs; });
+  srsran_assert(dl_carrier != dl_carriers.end(), "No DL carrier configured for scs={}", scs);
+
   for (const search_space_configuration& ss : cell_cfg.dl_cfg_common.init_dl_bwp.pdcch_common.search_spaces) {
     pdcch_common_candidates.emplace(ss.get_id());
     const coreset_configuration& cs_cfg = (ss.get_coreset_id() == to_coreset_id(0))
@@ -45,6 +52,7 @@ pdcch_resource_allocator_impl::pdcch_resource_allocator_impl(const cell_configur
       aggr_lvl_candidates.candidates = pdcch_candidates_common_ss_get_lowest_cce(
           pdcch_candidates_common_ss_configuration{aggr_lvl, nof_candidates, cs_cfg.get_nof_cces()});
       aggr_lvl_candidates.candidate_crbs.resize(aggr_lvl_candidates.candidates.size());
+      aggr_lvl_candidates.candidate_crb_masks.resize(aggr_lvl_candidates.candidates.size());
       for (unsigned i = 0, e = aggr_lvl_candidates.candidates.size(); i != e; ++i) {
         aggr_lvl_candidates.candidate_crbs[i] = pdcch_helper::cce_to_prb_mapping(
             cell_cfg.dl_cfg_common.init_dl_bwp.generic_params, cs_cfg, cell_cfg.pci, aggr_lvl, i);
@@ -53,6 +61,13 @@ pdcch_resource_allocator_impl::pdcch_resource_allocator_impl(const cell_configur
         for (uint16_t& prb_idx : aggr_lvl_candidates.candidate_crbs[i]) {
           prb_idx = crb_to_prb(cell_cfg.dl_cfg_common.init_dl_bwp.generic_params, prb_idx);
         }
+
+        // Derive the carrier-relative CRB bitmap of the candidate.
+        crb_bitmap& crb_mask = aggr_lvl_candidates.candidate_crb_masks[i];
+        crb_mask.resize(dl_carrier->carrier_bandwidth);
+        for (uint16_t crb_idx : aggr_lvl_candidates.candidate_crbs[i]) {
+          crb_mask.set(crb_idx - dl_carrier->offset_to_carrier);
+        }
       }
     }
   }
@@ -95,7 +110,8 @@ pdcch_dl_information* pdcch_resource_allocator_impl::alloc_dl_pdcch_common(cell_
                                ss_cfg,
                                aggr_lvl,
                                pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidates,
-                               pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidate_crbs);
+                               pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidate_crbs,
+                               pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidate_crb_masks);
 }
 
 pdcch_ul_information* pdcch_resource_allocator_impl::alloc_ul_pdcch_common(cell_slot_resource_allocator& slot_alloc,
@@ -118,7 +134,8 @@ pdcch_ul_information* pdcch_resource_allocator_impl::alloc_ul_pdcch_common(cell_
                                ss_cfg,
                                aggr_lvl,
                                pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidates,
-                               pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidate_crbs);
+                               pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidate_crbs,
+                               pdcch_common_candidates[ss_id][to_aggregation_level_index(aggr_lvl)].candidate_crb_masks);
 }
 
 pdcch_dl_information* pdcch_resource_allocator_impl::alloc_dl_pdcch_ue(cell_slot_resource_allocator& slot_alloc,
@@ -132,9 +149,10 @@ pdcch_dl_information* pdcch_resource_allocator_impl::alloc_dl_pdcch_ue(cell_slot
   const bwp_configuration&   bwp_cfg        = ss_cfg.bwp->dl_common->generic_params;
   span<const uint8_t>        candidates     = ss_cfg.get_pdcch_candidates(aggr_lvl, slot_alloc.slot);
   span<const crb_index_list> candidate_crbs = ss_cfg.get_crb_list_of_pdcch_candidates(aggr_lvl, slot_alloc.slot);
+  span<const crb_bitmap>     candidate_crb_masks = ss_cfg.get_crb_bitmaps_of_pdcch_candidates(aggr_lvl, slot_alloc.slot);
 
   return alloc_dl_pdcch_helper(
-      slot_alloc, rnti, bwp_cfg, *ss_cfg.coreset, *ss_cfg.cfg, aggr_lvl, candidates, candidate_crbs);
+      slot_alloc, rnti, bwp_cfg, *ss_cfg.coreset, *ss_cfg.cfg, aggr_lvl, candidates, candidate_crbs, candidate_crb_masks);
 }
 
 pdcch_ul_information* pdcch_resource_allocator_impl::alloc_ul_pdcch_ue(cell_slot_resource_allocator& slot_alloc,
@@ -148,9 +166,10 @@ pdcch_ul_information* pdcch_resource_allocator_impl::alloc_ul_pdcch_ue(cell_slot
   const bwp_configuration&         bwp_cfg        = ss_cfg.bwp->ul_common->generic_params;
   span<const pdcch_candidate_type> candidates     = ss_cfg.get_pdcch_candidates(aggr_lvl, slot_alloc.slot);
   span<const crb_index_list>       candidate_crbs = ss_cfg.get_crb_list_of_pdcch_candidates(aggr_lvl, slot_alloc.slot);
+  span<const crb_bitmap> candidate_crb_masks      = ss_cfg.get_crb_bitmaps_of_pdcch_candidates(aggr_lvl, slot_alloc.slot);
 
   return alloc_ul_pdcch_helper(
-      slot_alloc, rnti, bwp_cfg, *ss_cfg.coreset, *ss_cfg.cfg, aggr_lvl, candidates, candidate_crbs);
+      slot_alloc, rnti, bwp_cfg, *ss_cfg.coreset, *ss_cfg.cfg, aggr_lvl, candidates, candidate_crbs, candidate_crb_masks);
 }
 
 pdcch_ul_information* pdcch_resource_allocator_impl::alloc_ul_pdcch_helper(cell_slot_resource_allocator&     slot_alloc,
@@ -160,7 +179,8 @@ pdcch_ul_information* pdcch_resource_allocator_impl::alloc_ul_pdcch_helper(cell_
                                                                            const search_space_configuration& ss_cfg,
                                                                            aggregation_level                 aggr_lvl,
                                                                            span<const pdcch_candidate_type>  candidates,
-                                                                           span<const crb_index_list> candidate_crbs)
+                                                                           span<const crb_index_list>        candidate_crbs,
+                                                                           span<const crb_bitmap>            candidate_crb_masks)
 {
   if (not pdcch_helper::is_pdcch_monitoring_active(slot_alloc.slot, ss_cfg)) {
     // PDCCH monitoring is not active in this slot.
@@ -195,7 +215,7 @@ pdcch_ul_information* pdcch_resource_allocator_impl::alloc_ul_pdcch_helper(cell_
 
   // Allocate a position for UL PDCCH in CORESET.
   pdcch_slot_allocator& pdcch_alloc = get_pdcch_slot_alloc(slot_alloc.slot);
-  if (not pdcch_alloc.alloc_pdcch(pdcch.ctx, slot_alloc, ss_cfg, candidates, candidate_crbs)) {
+  if (not pdcch_alloc.alloc_pdcch(pdcch.ctx, slot_alloc, ss_cfg, candidates, candidate_crbs, candidate_crb_masks)) {
     slot_alloc.result.dl.ul_pdcchs.pop_back();
     return nullptr;
   }
@@ -209,7 +229,8 @@ pdcch_dl_information* pdcch_resource_allocator_impl::alloc_dl_pdcch_helper(cell_
                                                                            const search_space_configuration& ss_cfg,
                                                                            aggregation_level                 aggr_lvl,
                                                                            span<const pdcch_candidate_type>  candidates,
-                                                                           span<const crb_index_list> candidate_crbs)
+                                                                           span<const crb_index_list>        candidate_crbs,
+                                                                           span<const crb_bitmap>            candidate_crb_masks)
 {
   if (not pdcch_helper::is_pdcch_monitoring_active(slot_alloc.slot, ss_cfg)) {
     // PDCCH monitoring is not active in this slot.
@@ -244,7 +265,7 @@ pdcch_dl_information* pdcch_resource_allocator_impl::alloc_dl_pdcch_helper(cell_
 
   // Allocate a position for DL PDCCH in CORESET.
   pdcch_slot_allocator& pdcch_alloc = get_pdcch_slot_alloc(slot_alloc.slot);
-  if (not pdcch_alloc.alloc_pdcch(pdcch.ctx, slot_alloc, ss_cfg, candidates, candidate_crbs)) {
+  if (not pdcch_alloc.alloc_pdcch(pdcch.ctx, slot_alloc, ss_cfg, candidates, candidate_crbs, candidate_crb_masks)) {
     slot_alloc.result.dl.dl_pdcchs.pop_back();
     return nullptr;
   }
@@ -74,6 +74,8 @@ private:
   struct pdcch_candidate_info {
     pdcch_candidate_list                                       candidates;
     static_vector<crb_index_list, PDCCH_MAX_NOF_CANDIDATES_SS> candidate_crbs;
+    /// CRB bitmap of each candidate, in carrier-relative coordinates, used for word-wise collision checks.
+    static_vector<crb_bitmap, PDCCH_MAX_NOF_CANDIDATES_SS> candidate_crb_masks;
   };
 
   pdcch_slot_allocator& get_pdcch_slot_alloc(slot_point sl);
@@ -85,7 +87,8 @@ private:
                                               const search_space_configuration& ss_cfg,
                                               aggregation_level                 aggr_lvl,
                                               span<const pdcch_candidate_type>  candidates,
-                                              span<const crb_index_list>        candidate_crbs);
+                                              span<const crb_index_list>        candidate_crbs,
+                                              span<const crb_bitmap>            candidate_crb_masks);
 
   pdcch_ul_information* alloc_ul_pdcch_helper(cell_slot_resource_allocator&     slot_alloc,
                                               rnti_t                            rnti,
@@ -94,7 +97,8 @@ private:
                                               const search_space_configuration& ss_cfg,
                                               aggregation_level                 aggr_lvl,
                                               span<const pdcch_candidate_type>  candidates,
-                                              span<const crb_index_list>        candidate_crbs);
+                                              span<const crb_index_list>        candidate_crbs,
+                                              span<const crb_bitmap>            candidate_crb_masks);
 
   const cell_configuration& cell_cfg;
 
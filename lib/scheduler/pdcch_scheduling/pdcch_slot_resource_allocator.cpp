@@ -40,17 +40,19 @@ bool pdcch_slot_allocator::alloc_pdcch(dci_context_information&          pdcch_c
                                        cell_slot_resource_allocator&     slot_alloc,
                                        const search_space_configuration& ss_cfg,
                                        span<const pdcch_candidate_type>  ss_candidates,
-                                       span<const prb_index_list>        ss_candidate_crbs)
+                                       span<const prb_index_list>        ss_candidate_crbs,
+                                       span<const crb_bitmap>            ss_candidate_crb_masks)
 {
   saved_dfs_tree.clear();
 
   // Create an DL Allocation Record.
   alloc_record record{};
-  record.is_dl                = true;
-  record.pdcch_ctx            = &pdcch_ctx;
-  record.ss_cfg               = &ss_cfg;
-  record.pdcch_candidates     = ss_candidates;
-  record.pdcch_candidate_crbs = ss_candidate_crbs;
+  record.is_dl                     = true;
+  record.pdcch_ctx                 = &pdcch_ctx;
+  record.ss_cfg                    = &ss_cfg;
+  record.pdcch_candidates          = ss_candidates;
+  record.pdcch_candidate_crbs      = ss_candidate_crbs;
+  record.pdcch_candidate_crb_masks = ss_candidate_crb_masks;
 
   // Try to allocate PDCCH for one of the possible CCE positions. If this operation fails, retry it, but using a
   // different permutation of past grant CCE positions.
@@ -167,9 +169,11 @@ bool pdcch_slot_allocator::allocate_cce(cell_slot_resource_allocator& slot_alloc
   grant_info                   grant;
   grant.scs = bwp_cfg.scs;
 
-  // Check the current CCE position collides with an existing one.
+  // Check the current CCE position collides with an existing one, using the precomputed CRB bitmap of the candidate
+  // so that the check operates on whole bitset words.
   ofdm_symbol_range symbols{0, (uint8_t)cs_cfg.duration};
-  if (slot_alloc.dl_res_grid.collides(record.pdcch_ctx->bwp_cfg->scs, symbols, pdcch_crbs)) {
+  if (slot_alloc.dl_res_grid.collides(
+          record.pdcch_ctx->bwp_cfg->scs, symbols, record.pdcch_candidate_crb_masks[dci_iter_index])) {
     // Collision detected. Try another CCE position.
     return false;
   }
@@ -26,6 +26,7 @@
 #include "srsran/ran/pdcch/pdcch_candidates.h"
 #include "srsran/scheduler/scheduler_dci.h"
 #include "srsran/scheduler/scheduler_slot_handler.h"
+#include "srsran/scheduler/vrb_alloc.h"
 
 namespace srsran {
 
@@ -45,6 +46,7 @@ public:
     const search_space_configuration* ss_cfg;
     span<const uint8_t>               pdcch_candidates;
     span<const crb_index_list>        pdcch_candidate_crbs;
+    span<const crb_bitmap>            pdcch_candidate_crb_masks;
   };
 
   /// DFS decision tree node.
@@ -65,7 +67,8 @@ public:
                    cell_slot_resource_allocator&     slot_alloc,
                    const search_space_configuration& ss_cfg,
                    span<const pdcch_candidate_type>  ss_candidates,
-                   span<const crb_index_list>        ss_candidate_crbs);
+                   span<const crb_index_list>        ss_candidate_crbs,
+                   span<const crb_bitmap>            ss_candidate_crb_masks);
 
   /// Deallocates the last PDCCH CCE space reservation.
   bool cancel_last_pdcch(cell_slot_resource_allocator& slot_alloc);
@@ -55,8 +55,10 @@ void scheduler_time_pf::dl_sched(ue_pdsch_allocator&          pdsch_alloc,
     }
     ue_ctxt& ctxt = ue_history_db[u.ue_index()];
     ctxt.compute_dl_prio(u, slice_candidate.id());
-    dl_queue.push(&ctxt);
+    dl_queue.push_unsorted(&ctxt);
   }
+  // Build the heap in a single pass over the candidates.
+  dl_queue.heapify();
 
   alloc_result alloc_result = {alloc_status::invalid_params};
   unsigned     rem_rbs      = slice_candidate.remaining_rbs();
@@ -101,8 +103,10 @@ void scheduler_time_pf::ul_sched(ue_pusch_allocator&          pusch_alloc,
     }
     ue_ctxt& ctxt = ue_history_db[u.ue_index()];
     ctxt.compute_ul_prio(u, res_grid, slice_candidate.id());
-    ul_queue.push(&ctxt);
+    ul_queue.push_unsorted(&ctxt);
   }
+  // Build the heap in a single pass over the candidates.
+  ul_queue.heapify();
 
   alloc_result alloc_result = {alloc_status::invalid_params};
   unsigned     rem_rbs      = slice_candidate.remaining_rbs();
@@ -255,7 +259,16 @@ void scheduler_time_pf::ue_ctxt::compute_dl_prio(const slice_ue& u, ran_slice_id
 
     // Calculate DL PF priority.
     // NOTE: Estimated instantaneous DL rate is calculated assuming entire BWP CRBs are allocated to UE.
-    const double estimated_rate   = ue_cc->get_estimated_dl_rate(pdsch_cfg, mcs.value(), ss_info->dl_crb_lims.length());
+    // The rate estimate is only recomputed when one of its inputs changed since the last slot.
+    const unsigned nof_layers = ue_cc->channel_state_manager().get_nof_dl_layers();
+    const unsigned nof_prbs   = ss_info->dl_crb_lims.length();
+    if (mcs != cached_dl_mcs or nof_layers != cached_dl_nof_layers or nof_prbs != cached_dl_nof_prbs) {
+      cached_dl_rate       = ue_cc->get_estimated_dl_rate(pdsch_cfg, mcs.value(), nof_prbs);
+      cached_dl_mcs        = mcs;
+      cached_dl_nof_layers = nof_layers;
+      cached_dl_nof_prbs   = nof_prbs;
+    }
+    const double estimated_rate   = cached_dl_rate;
     const double current_avg_rate = dl_avg_rate();
     if (current_avg_rate != 0) {
       dl_prio = estimated_rate / pow(current_avg_rate, parent->fairness_coeff);
@@ -342,7 +355,18 @@ void scheduler_time_pf::ue_ctxt::compute_ul_prio(const slice_ue&              u,
 
     // Calculate UL PF priority.
     // NOTE: Estimated instantaneous UL rate is calculated assuming entire BWP CRBs are allocated to UE.
-    const double estimated_rate   = ue_cc->get_estimated_ul_rate(pusch_cfg, mcs.value(), ss_info->ul_crb_lims.length());
+    // The rate estimate is only recomputed when one of its inputs changed since the last slot.
+    const unsigned nof_layers = ue_cc->channel_state_manager().get_nof_ul_layers();
+    const unsigned nof_prbs   = ss_info->ul_crb_lims.length();
+    if (mcs != cached_ul_mcs or nof_layers != cached_ul_nof_layers or nof_prbs != cached_ul_nof_prbs or
+        is_csi_report_slot != cached_ul_csi_slot) {
+      cached_ul_rate       = ue_cc->get_estimated_ul_rate(pusch_cfg, mcs.value(), nof_prbs);
+      cached_ul_mcs        = mcs;
+      cached_ul_nof_layers = nof_layers;
+      cached_ul_nof_prbs   = nof_prbs;
+      cached_ul_csi_slot   = is_csi_report_slot;
+    }
+    const double estimated_rate   = cached_ul_rate;
     const double current_avg_rate = ul_avg_rate();
     if (current_avg_rate != 0) {
       ul_prio = estimated_rate / pow(current_avg_rate, parent->fairness_coeff);
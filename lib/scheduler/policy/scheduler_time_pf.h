@@ -82,6 +82,21 @@ private:
     bool sr_ind_received = false;
 
   private:
+    /// \brief Cached estimated rates and the inputs they were computed for.
+    ///
+    /// The estimated achievable rate is a pure function of the MCS, number of layers, CSI reporting overhead and
+    /// number of PRBs. These inputs change sporadically (e.g. on CSI/HARQ feedback), so the TBS computation can be
+    /// skipped for the vast majority of slots.
+    std::optional<sch_mcs_index> cached_dl_mcs;
+    unsigned                     cached_dl_nof_layers = 0;
+    unsigned                     cached_dl_nof_prbs   = 0;
+    double                       cached_dl_rate       = 0;
+    std::optional<sch_mcs_index> cached_ul_mcs;
+    unsigned                     cached_ul_nof_layers = 0;
+    unsigned                     cached_ul_nof_prbs   = 0;
+    bool                         cached_ul_csi_slot   = false;
+    double                       cached_ul_rate       = 0;
+
     /// Average DL rate expressed in bytes per slot experienced by UE.
     double dl_avg_rate_ = 0;
     /// Average UL rate expressed in bytes per slot experienced by UE.
@@ -133,6 +148,19 @@ private:
       }
       base_type::push(elem);
     }
+
+    // Appends a candidate without restoring the heap property. Used during the per-slot bulk refresh, which is then
+    // finalized with a single \c heapify call in O(N), instead of the O(N log N) of individual pushes.
+    void push_unsorted(ue_ctxt* elem)
+    {
+      if (not elem->dl_retx_h.has_value() and not elem->has_empty_dl_harq) {
+        return;
+      }
+      this->c.push_back(elem);
+    }
+
+    // Restores the heap property after a sequence of push_unsorted calls.
+    void heapify() { std::make_heap(this->c.begin(), this->c.end(), this->comp); }
   };
 
   // Note: the std::priority_queue makes its underlying container protected, so it seems that they are ok with
@@ -158,6 +186,19 @@ private:
       }
       base_type::push(elem);
     }
+
+    // Appends a candidate without restoring the heap property. Used during the per-slot bulk refresh, which is then
+    // finalized with a single \c heapify call in O(N), instead of the O(N log N) of individual pushes.
+    void push_unsorted(ue_ctxt* elem)
+    {
+      if (not elem->ul_retx_h.has_value() and not elem->has_empty_ul_harq) {
+        return;
+      }
+      this->c.push_back(elem);
+    }
+
+    // Restores the heap property after a sequence of push_unsorted calls.
+    void heapify() { std::make_heap(this->c.begin(), this->c.end(), this->comp); }
   };
 
   /// Priority queue of UEs to be scheduled in DL. The UE in front of the queue has highest priority and vice versa.
@@ -1429,8 +1429,8 @@ pucch_allocator_impl::multiplex_and_allocate_pucch(cell_slot_resource_allocator&
     return std::nullopt;
   }
 
-  pucch_grant_list grants_to_tx =
-      multiplex_resources(sl_ack, current_grants.rnti, candidate_grants.value(), ue_cell_cfg, preserve_res_indicator);
+  pucch_grant_list grants_to_tx = multiplex_resources(
+      sl_ack, current_grants.rnti, candidate_grants.value(), ue_cell_cfg, preserve_res_indicator, pucch_slot_alloc.scratch());
 
   if (grants_to_tx.is_emtpy()) {
     return std::nullopt;
@@ -1733,14 +1733,17 @@ pucch_allocator_impl::multiplex_resources(slot_point                   sl_tx,
                                           rnti_t                       crnti,
                                           pucch_grant_list             candidate_grants,
                                           const ue_cell_configuration& ue_cell_cfg,
-                                          std::optional<uint8_t>       preserve_res_indicator)
+                                          std::optional<uint8_t>       preserve_res_indicator,
+                                          slot_arena&                  scratch)
 {
   // This function implements the multiplexing pseudo-code for PUCCH resources defined in Section 9.2.5, TS 38.213.
   // Refer to paragraph starting as "Set Q to the set of resources for transmission of corresponding PUCCHs in a single
   // slot without repetitions where".
   pucch_grant_list mplexed_grants;
 
-  std::vector<pucch_grant> resource_set_q;
+  // The resource set Q is slot-lifetime scratch; its storage is reclaimed on the next slot boundary.
+  slot_arena_vector<pucch_grant> resource_set_q(scratch.make_allocator<pucch_grant>(slot_arena::client::scheduler));
+  resource_set_q.reserve(4);
 
   // Build the resource set Q. Refer to Section 9.2.5, TS 38.213.
   if (candidate_grants.harq_resource.has_value()) {
@@ -202,7 +202,8 @@ private:
                                        rnti_t                       crnti,
                                        pucch_grant_list             candidate_grants,
                                        const ue_cell_configuration& ue_cell_cfg,
-                                       std::optional<uint8_t>       preserve_res_indicator);
+                                       std::optional<uint8_t>       preserve_res_indicator,
+                                       slot_arena&                  scratch);
 
   // Applies the multiplexing rules depending on the PUCCH resource format, as per TS 38.213, Section 9.2.5.1/2.
   std::optional<pucch_grant> merge_pucch_resources(span<const pucch_grant> resources_to_merge,
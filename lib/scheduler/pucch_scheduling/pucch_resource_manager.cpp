@@ -50,6 +50,55 @@ static int get_pucch_res_idx_for_csi(const ue_cell_configuration& ue_cell_cfg)
   return -1;
 }
 
+/////////////   Slot record methods   /////////////
+
+void pucch_resource_manager::rnti_pucch_res_id_slot_record::reserve_res(unsigned             res_idx,
+                                                                        rnti_t               crnti,
+                                                                        pucch_resource_usage usage)
+{
+  resource_tracker& res = ues_using_pucch_res[res_idx];
+  // Only record entries transitioning from "unused"; a resource re-reserved by the same UE is already recorded.
+  if (res.rnti == rnti_t::INVALID_RNTI) {
+    if (not touched_res_ids.full()) {
+      touched_res_ids.push_back(static_cast<uint16_t>(res_idx));
+    } else {
+      sweep_required = true;
+    }
+  }
+  res.rnti           = crnti;
+  res.resource_usage = usage;
+}
+
+void pucch_resource_manager::rnti_pucch_res_id_slot_record::reserve_common_res(unsigned r_pucch)
+{
+  // Common resources are only released at the slot boundary, so each index is recorded at most once.
+  if (not used_common_resources[r_pucch]) {
+    touched_common_res_ids.push_back(static_cast<uint8_t>(r_pucch));
+    used_common_resources[r_pucch] = true;
+  }
+}
+
+void pucch_resource_manager::rnti_pucch_res_id_slot_record::reset()
+{
+  if (sweep_required) {
+    for (auto& ue_rec : ues_using_pucch_res) {
+      ue_rec.rnti           = rnti_t::INVALID_RNTI;
+      ue_rec.resource_usage = pucch_resource_usage::NOT_USED;
+    }
+    sweep_required = false;
+  } else {
+    for (const uint16_t res_idx : touched_res_ids) {
+      ues_using_pucch_res[res_idx].rnti           = rnti_t::INVALID_RNTI;
+      ues_using_pucch_res[res_idx].resource_usage = pucch_resource_usage::NOT_USED;
+    }
+  }
+  touched_res_ids.clear();
+  for (const uint8_t r_pucch : touched_common_res_ids) {
+    used_common_resources[r_pucch] = false;
+  }
+  touched_common_res_ids.clear();
+}
+
 /////////////   Public methods   /////////////
 
 pucch_resource_manager::pucch_resource_manager()
@@ -75,15 +124,8 @@ void pucch_resource_manager::slot_indication(slot_point slot_tx)
   // Update Slot.
   last_sl_ind = slot_tx;
 
-  rnti_pucch_res_id_slot_record& res_counter = get_slot_resource_counter(last_sl_ind - 1);
-
-  for (auto& ue_rec : res_counter.ues_using_pucch_res) {
-    ue_rec.rnti           = rnti_t::INVALID_RNTI;
-    ue_rec.resource_usage = pucch_resource_usage::NOT_USED;
-  }
-  for (auto& res : res_counter.used_common_resources) {
-    res = false;
-  }
+  // Release all resources of the returning ring-buffer slot in one operation.
+  get_slot_resource_counter(last_sl_ind - 1).reset();
 }
 
 bool pucch_resource_manager::is_common_resource_available(slot_point sl, size_t r_pucch)
@@ -95,7 +137,7 @@ bool pucch_resource_manager::is_common_resource_available(slot_point sl, size_t
 void pucch_resource_manager::reserve_common_resource(slot_point sl, size_t r_pucch)
 {
   srsran_assert(r_pucch < 16, "r_PUCCH must be less than 16");
-  get_slot_resource_counter(sl).used_common_resources[r_pucch] = true;
+  get_slot_resource_counter(sl).reserve_common_res(r_pucch);
 }
 
 pucch_harq_resource_alloc_record
@@ -167,8 +209,7 @@ const pucch_resource* pucch_resource_manager::reserve_csi_resource(slot_point
   // If the PUCCH res with correct ID was not allocated to the UE's RNTI, allocate it to this RNTI; otherwise, it means
   // the resource had already been allocated, just return it.
   if (slot_record.ues_using_pucch_res[csi_pucch_res_idx].rnti != crnti) {
-    slot_record.ues_using_pucch_res[csi_pucch_res_idx].rnti           = crnti;
-    slot_record.ues_using_pucch_res[csi_pucch_res_idx].resource_usage = pucch_resource_usage::CSI;
+    slot_record.reserve_res(csi_pucch_res_idx, crnti, pucch_resource_usage::CSI);
   }
 
   return res_cfg;
@@ -205,8 +246,7 @@ pucch_resource_manager::reserve_sr_res_available(slot_point slot_sr, rnti_t crnt
   // If the PUCCH res with correct ID was not allocated to the UE's RNTI, allocate it to this RNTI; otherwise, it means
   // the resource had already been allocated, just return it.
   if (slot_record.ues_using_pucch_res[sr_pucch_res_id].rnti != crnti and res_cfg != pucch_res_list.end()) {
-    slot_record.ues_using_pucch_res[sr_pucch_res_id].rnti           = crnti;
-    slot_record.ues_using_pucch_res[sr_pucch_res_id].resource_usage = pucch_resource_usage::SR;
+    slot_record.reserve_res(sr_pucch_res_id, crnti, pucch_resource_usage::SR);
   }
 
   return res_cfg;
@@ -422,9 +462,10 @@ pucch_harq_resource_alloc_record pucch_resource_manager::reserve_next_harq_res_a
 
     // If so, allocate it.
     if (res_cfg != pucch_res_list.end()) {
-      available_resource->rnti = crnti;
-      available_resource->resource_usage =
-          res_set_idx == pucch_res_set_idx::set_0 ? pucch_resource_usage::HARQ_SET_0 : pucch_resource_usage::HARQ_SET_1;
+      res_counter.reserve_res(ue_first_res_id + pucch_res_indicator,
+                              crnti,
+                              res_set_idx == pucch_res_set_idx::set_0 ? pucch_resource_usage::HARQ_SET_0
+                                                                      : pucch_resource_usage::HARQ_SET_1);
       return pucch_harq_resource_alloc_record{.pucch_res = res_cfg, .pucch_res_indicator = pucch_res_indicator};
     }
   }
@@ -495,9 +536,10 @@ const pucch_resource* pucch_resource_manager::reserve_harq_res_by_res_indicator(
 
   // If the PUCCH res with correct ID is found and previously not used by given UE's RNTI, then allocate it this RNTI.
   if (pucch_res_tracker.rnti == rnti_t::INVALID_RNTI) {
-    pucch_res_tracker.rnti = crnti;
-    pucch_res_tracker.resource_usage =
-        res_set_idx == pucch_res_set_idx::set_0 ? pucch_resource_usage::HARQ_SET_0 : pucch_resource_usage::HARQ_SET_1;
+    res_counter.reserve_res(pucch_cell_res_id,
+                            crnti,
+                            res_set_idx == pucch_res_set_idx::set_0 ? pucch_resource_usage::HARQ_SET_0
+                                                                    : pucch_resource_usage::HARQ_SET_1);
   }
   return res_cfg;
 }
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "../config/ue_configuration.h"
+#include "srsran/adt/static_vector.h"
 #include "srsran/ran/pucch/pucch_constants.h"
 
 namespace srsran {
@@ -180,6 +181,19 @@ private:
   struct rnti_pucch_res_id_slot_record {
     common_res_record_array used_common_resources;
     pucch_res_record_array  ues_using_pucch_res;
+    // Indices of the entries reserved since the last reset; allows the slot boundary to release only the touched
+    // entries instead of sweeping the full capacity-sized arrays.
+    static_vector<uint16_t, pucch_constants::MAX_NOF_CELL_PUCCH_RESOURCES>      touched_res_ids;
+    static_vector<uint8_t, pucch_constants::MAX_NOF_CELL_COMMON_PUCCH_RESOURCES> touched_common_res_ids;
+    // Set when the touched list overflows (repeated reserve/release churn); forces a full sweep on the next reset.
+    bool sweep_required = false;
+
+    // Marks the cell PUCCH resource at res_idx as used by the given RNTI and records the entry for the next reset().
+    void reserve_res(unsigned res_idx, rnti_t crnti, pucch_resource_usage usage);
+    // Marks the common PUCCH resource indexed by r_pucch as used and records the entry for the next reset().
+    void reserve_common_res(unsigned r_pucch);
+    // Releases all resources of the slot in one operation, by resetting only the entries touched since last reset().
+    void reset();
   };
 
   // Keeps track of which PUCCH cell resources have been allocated to a UE at the current slot.
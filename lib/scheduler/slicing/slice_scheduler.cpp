@@ -95,6 +95,26 @@ void slice_scheduler::slot_indication(slot_point slot_tx, const cell_resource_al
     slice.inst.slot_indication(slot_tx);
   }
 
+  // Determine which valid PUSCH time domain resources still have RBs left to allocate. This does not depend on the
+  // slice, so it is computed once instead of per slice.
+  // TODO: Revisit when PUSCH time domain resource list is also defined in UE dedicated configuration.
+  span<const pusch_time_domain_resource_allocation> pusch_time_domain_list =
+      cell_cfg.ul_cfg_common.init_ul_bwp.pusch_cfg_common.value().pusch_td_alloc_list;
+  static_vector<unsigned, pusch_constants::MAX_NOF_PUSCH_TD_RES_ALLOCS> schedulable_pusch_td_list;
+  for (const unsigned pusch_td_res_idx :
+       valid_pusch_td_list_per_slot[slot_tx.to_uint() % valid_pusch_td_list_per_slot.size()]) {
+    const cell_slot_resource_allocator& pusch_alloc = res_grid[pusch_time_domain_list[pusch_td_res_idx].k2];
+    const crb_bitmap                    pusch_used_crbs =
+        pusch_alloc.ul_res_grid.used_crbs(cell_cfg.ul_cfg_common.init_ul_bwp.generic_params.scs,
+                                          cell_cfg.ul_cfg_common.init_ul_bwp.generic_params.crbs,
+                                          pusch_time_domain_list[pusch_td_res_idx].symbols);
+    if (pusch_used_crbs.all()) {
+      // No more RBs left to allocate so skip adding slice candidates for this resource.
+      continue;
+    }
+    schedulable_pusch_td_list.push_back(pusch_td_res_idx);
+  }
+
   // Recompute the priority queues.
   dl_prio_queue.clear();
   ul_prio_queue.clear();
@@ -107,21 +127,7 @@ void slice_scheduler::slot_indication(slot_point slot_tx, const cell_resource_al
                                                {slice.inst.pdsch_rb_count, max_rbs},
                                                slot_tx});
 
-    // TODO: Revisit when PUSCH time domain resource list is also defined in UE dedicated configuration.
-    span<const pusch_time_domain_resource_allocation> pusch_time_domain_list =
-        cell_cfg.ul_cfg_common.init_ul_bwp.pusch_cfg_common.value().pusch_td_alloc_list;
-    for (const unsigned pusch_td_res_idx :
-         valid_pusch_td_list_per_slot[slot_tx.to_uint() % valid_pusch_td_list_per_slot.size()]) {
-      const cell_slot_resource_allocator& pusch_alloc = res_grid[pusch_time_domain_list[pusch_td_res_idx].k2];
-      const crb_bitmap                    pusch_used_crbs =
-          pusch_alloc.ul_res_grid.used_crbs(cell_cfg.ul_cfg_common.init_ul_bwp.generic_params.scs,
-                                            cell_cfg.ul_cfg_common.init_ul_bwp.generic_params.crbs,
-                                            pusch_time_domain_list[pusch_td_res_idx].symbols);
-      if (pusch_used_crbs.all()) {
-        // No more RBs left to allocated so skip adding slice candidate.
-        continue;
-      }
-
+    for (const unsigned pusch_td_res_idx : schedulable_pusch_td_list) {
       slot_point pusch_slot     = slot_tx + pusch_time_domain_list[pusch_td_res_idx].k2;
       unsigned   pusch_rb_count = slice.inst.nof_pusch_rbs_allocated(pusch_slot);
       max_rbs = pusch_rb_count <= slice.inst.cfg.min_prb and slice.inst.cfg.min_prb > 0 ? slice.inst.cfg.min_prb
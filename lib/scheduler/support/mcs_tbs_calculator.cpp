@@ -234,6 +234,41 @@ std::optional<sch_mcs_tbs> srsran::compute_dl_mcs_tbs(const pdsch_config_params&
   return std::optional<sch_mcs_tbs>{sch_mcs_tbs{.mcs = mcs, .tbs = tbs_bytes}};
 }
 
+std::optional<sch_mcs_tbs> srsran::compute_dl_mcs_tbs(const pdsch_config_params& pdsch_params,
+                                                      sch_mcs_index              max_mcs,
+                                                      unsigned                   nof_prbs,
+                                                      bool                       contains_dc,
+                                                      dl_mcs_tbs_cache&          cache)
+{
+  // Return the cached result if all the inputs the computation depends on match those of the last call.
+  if (cache.valid and cache.max_mcs == max_mcs and cache.nof_prbs == nof_prbs and cache.contains_dc == contains_dc and
+      cache.mcs_table == pdsch_params.mcs_table and cache.symbols == pdsch_params.symbols and
+      cache.nof_oh_prb == pdsch_params.nof_oh_prb and cache.tb_scaling_field == pdsch_params.tb_scaling_field and
+      cache.nof_layers == pdsch_params.nof_layers and cache.dmrs_symb_pos == pdsch_params.dmrs.dmrs_symb_pos and
+      cache.dmrs_cfg_type == pdsch_params.dmrs.config_type and
+      cache.nof_cdm_grps_no_data == pdsch_params.dmrs.num_dmrs_cdm_grps_no_data) {
+    return cache.result;
+  }
+
+  const std::optional<sch_mcs_tbs> result = compute_dl_mcs_tbs(pdsch_params, max_mcs, nof_prbs, contains_dc);
+
+  cache.mcs_table            = pdsch_params.mcs_table;
+  cache.symbols              = pdsch_params.symbols;
+  cache.nof_oh_prb           = pdsch_params.nof_oh_prb;
+  cache.tb_scaling_field     = pdsch_params.tb_scaling_field;
+  cache.nof_layers           = pdsch_params.nof_layers;
+  cache.dmrs_symb_pos        = pdsch_params.dmrs.dmrs_symb_pos;
+  cache.dmrs_cfg_type        = pdsch_params.dmrs.config_type;
+  cache.nof_cdm_grps_no_data = pdsch_params.dmrs.num_dmrs_cdm_grps_no_data;
+  cache.max_mcs              = max_mcs;
+  cache.nof_prbs             = nof_prbs;
+  cache.contains_dc          = contains_dc;
+  cache.result               = result;
+  cache.valid                = true;
+
+  return result;
+}
+
 std::optional<sch_mcs_tbs> srsran::compute_ul_mcs_tbs(const pusch_config_params&   pusch_cfg,
                                                       const ue_cell_configuration* ue_cell_cfg,
                                                       sch_mcs_index                max_mcs,
@@ -292,3 +327,49 @@ std::optional<sch_mcs_tbs> srsran::compute_ul_mcs_tbs(const pusch_config_params&
 
   return std::optional<sch_mcs_tbs>{sch_mcs_tbs{.mcs = mcs, .tbs = tbs_bytes}};
 }
+
+std::optional<sch_mcs_tbs> srsran::compute_ul_mcs_tbs(const pusch_config_params&   pusch_cfg,
+                                                      const ue_cell_configuration* ue_cell_cfg,
+                                                      sch_mcs_index                max_mcs,
+                                                      unsigned                     nof_prbs,
+                                                      bool                         contains_dc,
+                                                      ul_mcs_tbs_cache&            cache)
+{
+  // Return the cached result if all the inputs the computation depends on match those of the last call. The UCI beta
+  // offsets and alpha scaling of \c ue_cell_cfg are not part of the key; the caller resets the cache when they change.
+  if (cache.valid and cache.max_mcs == max_mcs and cache.nof_prbs == nof_prbs and cache.contains_dc == contains_dc and
+      cache.mcs_table == pusch_cfg.mcs_table and cache.symbols == pusch_cfg.symbols and
+      cache.nof_oh_prb == pusch_cfg.nof_oh_prb and cache.tb_scaling_field == pusch_cfg.tb_scaling_field and
+      cache.nof_layers == pusch_cfg.nof_layers and cache.tp_pi2bpsk_present == pusch_cfg.tp_pi2bpsk_present and
+      cache.use_transform_precoder == pusch_cfg.use_transform_precoder and
+      cache.dmrs_symb_pos == pusch_cfg.dmrs.dmrs_symb_pos and cache.dmrs_cfg_type == pusch_cfg.dmrs.config_type and
+      cache.nof_cdm_grps_no_data == pusch_cfg.dmrs.num_dmrs_cdm_grps_no_data and
+      cache.nof_harq_ack_bits == pusch_cfg.nof_harq_ack_bits and
+      cache.nof_csi_part1_bits == pusch_cfg.nof_csi_part1_bits and
+      cache.max_nof_csi_part2_bits == pusch_cfg.max_nof_csi_part2_bits) {
+    return cache.result;
+  }
+
+  const std::optional<sch_mcs_tbs> result = compute_ul_mcs_tbs(pusch_cfg, ue_cell_cfg, max_mcs, nof_prbs, contains_dc);
+
+  cache.mcs_table              = pusch_cfg.mcs_table;
+  cache.symbols                = pusch_cfg.symbols;
+  cache.nof_oh_prb             = pusch_cfg.nof_oh_prb;
+  cache.tb_scaling_field       = pusch_cfg.tb_scaling_field;
+  cache.nof_layers             = pusch_cfg.nof_layers;
+  cache.tp_pi2bpsk_present     = pusch_cfg.tp_pi2bpsk_present;
+  cache.use_transform_precoder = pusch_cfg.use_transform_precoder;
+  cache.dmrs_symb_pos          = pusch_cfg.dmrs.dmrs_symb_pos;
+  cache.dmrs_cfg_type          = pusch_cfg.dmrs.config_type;
+  cache.nof_cdm_grps_no_data   = pusch_cfg.dmrs.num_dmrs_cdm_grps_no_data;
+  cache.nof_harq_ack_bits      = pusch_cfg.nof_harq_ack_bits;
+  cache.nof_csi_part1_bits     = pusch_cfg.nof_csi_part1_bits;
+  cache.max_nof_csi_part2_bits = pusch_cfg.max_nof_csi_part2_bits;
+  cache.max_mcs                = max_mcs;
+  cache.nof_prbs               = nof_prbs;
+  cache.contains_dc            = contains_dc;
+  cache.result                 = result;
+  cache.valid                  = true;
+
+  return result;
+}
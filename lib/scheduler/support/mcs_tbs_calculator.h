@@ -23,6 +23,8 @@
 #pragma once
 
 #include "srsran/adt/optional.h"
+#include "srsran/ran/pdsch/pdsch_mcs.h"
+#include "srsran/ran/pusch/pusch_mcs.h"
 #include "srsran/ran/sch/sch_mcs.h"
 #include "srsran/scheduler/scheduler_slot_handler.h"
 
@@ -40,6 +42,58 @@ struct sch_mcs_tbs {
   unsigned tbs;
 };
 
+/// \brief Cache of the last PDSCH MCS and TBS computation for a UE.
+///
+/// For UEs with a steady traffic pattern, the scheduler re-derives the MCS and TBS for the same MCS/PRB combination
+/// slot after slot. This cache stores the inputs and result of the last call to \ref compute_dl_mcs_tbs, so that
+/// repeated calls skip the TBS and effective code rate recomputation.
+struct dl_mcs_tbs_cache {
+  pdsch_mcs_table            mcs_table;
+  ofdm_symbol_range          symbols;
+  unsigned                   nof_oh_prb;
+  unsigned                   tb_scaling_field;
+  unsigned                   nof_layers;
+  dmrs_symbol_mask           dmrs_symb_pos;
+  dmrs_config_type           dmrs_cfg_type;
+  uint8_t                    nof_cdm_grps_no_data;
+  sch_mcs_index              max_mcs;
+  unsigned                   nof_prbs;
+  bool                       contains_dc;
+  std::optional<sch_mcs_tbs> result;
+  bool                       valid = false;
+
+  /// Invalidates the cached result.
+  void reset() { valid = false; }
+};
+
+/// \brief Cache of the last PUSCH MCS and TBS computation for a UE.
+///
+/// Counterpart of \ref dl_mcs_tbs_cache for \ref compute_ul_mcs_tbs. Since the result also depends on the UCI beta
+/// offsets and alpha scaling of the UE dedicated configuration, the cache must be reset on UE reconfigurations.
+struct ul_mcs_tbs_cache {
+  pusch_mcs_table            mcs_table;
+  ofdm_symbol_range          symbols;
+  unsigned                   nof_oh_prb;
+  unsigned                   tb_scaling_field;
+  unsigned                   nof_layers;
+  bool                       tp_pi2bpsk_present;
+  bool                       use_transform_precoder;
+  dmrs_symbol_mask           dmrs_symb_pos;
+  dmrs_config_type           dmrs_cfg_type;
+  uint8_t                    nof_cdm_grps_no_data;
+  unsigned                   nof_harq_ack_bits;
+  unsigned                   nof_csi_part1_bits;
+  unsigned                   max_nof_csi_part2_bits;
+  sch_mcs_index              max_mcs;
+  unsigned                   nof_prbs;
+  bool                       contains_dc;
+  std::optional<sch_mcs_tbs> result;
+  bool                       valid = false;
+
+  /// Invalidates the cached result.
+  void reset() { valid = false; }
+};
+
 /// \brief Computes the PDSCH MCS and TBS such that the effective code rate does not exceed 0.95.
 ///
 /// \param[in] pdsch_params PDSCH parameters needed to compute the MCS and TBS.
@@ -52,6 +106,16 @@ struct sch_mcs_tbs {
 std::optional<sch_mcs_tbs>
 compute_dl_mcs_tbs(const pdsch_config_params& pdsch_params, sch_mcs_index max_mcs, unsigned nof_prbs, bool contains_dc);
 
+/// \brief Memoized variant of \ref compute_dl_mcs_tbs.
+///
+/// Returns the cached result when all inputs match those of the last call with the same \c cache; otherwise, runs the
+/// computation and updates the cache.
+std::optional<sch_mcs_tbs> compute_dl_mcs_tbs(const pdsch_config_params& pdsch_params,
+                                              sch_mcs_index              max_mcs,
+                                              unsigned                   nof_prbs,
+                                              bool                       contains_dc,
+                                              dl_mcs_tbs_cache&          cache);
+
 /// \brief Computes the PUSCH MCS and TBS such that the effective code rate does not exceed 0.95.
 ///
 /// \param[in] pusch_params PUSCH parameters needed to compute the MCS and TBS.
@@ -68,4 +132,16 @@ std::optional<sch_mcs_tbs> compute_ul_mcs_tbs(const pusch_config_params&   pusch
                                               unsigned                     nof_prbs,
                                               bool                         contains_dc);
 
+/// \brief Memoized variant of \ref compute_ul_mcs_tbs.
+///
+/// Returns the cached result when all inputs match those of the last call with the same \c cache; otherwise, runs the
+/// computation and updates the cache. The caller is responsible for resetting the cache when the beta offsets or alpha
+/// scaling of \c ue_cell_cfg change.
+std::optional<sch_mcs_tbs> compute_ul_mcs_tbs(const pusch_config_params&   pusch_params,
+                                              const ue_cell_configuration* ue_cell_cfg,
+                                              sch_mcs_index                max_mcs,
+                                              unsigned                     nof_prbs,
+                                              bool                         contains_dc,
+                                              ul_mcs_tbs_cache&            cache);
+
 } // namespace srsran
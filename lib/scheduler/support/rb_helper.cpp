@@ -39,6 +39,15 @@ rb_helper::find_next_empty_interval(const prb_bitmap& used_rb_bitmap, size_t sta
 crb_interval
 rb_helper::find_empty_interval_of_length(const prb_bitmap& used_rb_bitmap, size_t nof_rbs, uint32_t start_crb_idx)
 {
+  // Fast path: word-level search for the first gap that fits the requested length.
+  if ((nof_rbs > 0) and (start_crb_idx < used_rb_bitmap.size())) {
+    int rb_start = used_rb_bitmap.find_lowest_run(start_crb_idx, used_rb_bitmap.size(), nof_rbs, false);
+    if (rb_start >= 0) {
+      return {(uint32_t)rb_start, (uint32_t)(rb_start + nof_rbs)};
+    }
+  }
+
+  // No gap fits the requested length. Return the largest gap found.
   crb_interval max_interv;
   do {
     crb_interval interv = find_next_empty_interval(used_rb_bitmap, start_crb_idx, used_rb_bitmap.size());
@@ -21,7 +21,7 @@
  */
 
 #include "ta_manager.h"
-#include <numeric>
+#include <cmath>
 
 using namespace srsran;
 
@@ -95,16 +95,16 @@ int64_t ta_manager::compute_avg_n_ta_difference(uint8_t tag_id)
 
   const span<int64_t> n_ta_diff_meas = tag_n_ta_diff_measurements[tag_id];
 
-  // Compute mean.
-  const double sum  = std::accumulate(n_ta_diff_meas.begin(), n_ta_diff_meas.end(), 0.0);
-  const double mean = sum / static_cast<double>(n_ta_diff_meas.size());
-
-  // Compute standard deviation.
-  std::vector<double> diff(n_ta_diff_meas.size());
-  std::transform(
-      n_ta_diff_meas.begin(), n_ta_diff_meas.end(), diff.begin(), [mean](double value) { return value - mean; });
-  const double sq_sum  = std::inner_product(diff.begin(), diff.end(), diff.begin(), 0.0);
-  const double std_dev = std::sqrt(sq_sum / static_cast<double>(n_ta_diff_meas.size()));
+  // Compute mean and standard deviation in a single pass, using Var(X) = E[X^2] - E[X]^2.
+  double sum    = 0.0;
+  double sq_sum = 0.0;
+  for (const int64_t meas : n_ta_diff_meas) {
+    sum += static_cast<double>(meas);
+    sq_sum += static_cast<double>(meas) * static_cast<double>(meas);
+  }
+  const double mean     = sum / static_cast<double>(n_ta_diff_meas.size());
+  const double variance = std::max(sq_sum / static_cast<double>(n_ta_diff_meas.size()) - mean * mean, 0.0);
+  const double std_dev  = std::sqrt(variance);
 
   int64_t  sum_n_ta_difference = 0;
   unsigned count               = 0;
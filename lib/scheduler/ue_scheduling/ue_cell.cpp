@@ -83,6 +83,10 @@ void ue_cell::deactivate()
 void ue_cell::handle_reconfiguration_request(const ue_cell_configuration& ue_cell_cfg)
 {
   ue_cfg = &ue_cell_cfg;
+
+  // The MCS/TBS caches may depend on parameters of the UE dedicated configuration (e.g. UCI beta offsets).
+  dl_mcs_tbs_memo.reset();
+  ul_mcs_tbs_memo.reset();
 }
 
 void ue_cell::set_fallback_state(bool set_fallback)
@@ -25,6 +25,7 @@
 #include "../cell/cell_harq_manager.h"
 #include "../config/ue_configuration.h"
 #include "../support/bwp_helpers.h"
+#include "../support/mcs_tbs_calculator.h"
 #include "../support/sch_pdu_builder.h"
 #include "ue_channel_state_manager.h"
 #include "ue_link_adaptation_controller.h"
@@ -68,6 +69,11 @@ public:
   // Slot at which PUSCH was allocated in the past for this UE in this cell.
   slot_point last_pusch_allocated_slot;
 
+  // Cache of the last PDSCH MCS/TBS derivation for this UE, reused across slots when the grant parameters repeat.
+  dl_mcs_tbs_cache dl_mcs_tbs_memo;
+  // Cache of the last PUSCH MCS/TBS derivation for this UE.
+  ul_mcs_tbs_cache ul_mcs_tbs_memo;
+
   rnti_t rnti() const { return crnti_; }
 
   bwp_id_t active_bwp_id() const { return to_bwp_id(0); }
@@ -361,7 +361,7 @@ alloc_result ue_cell_grid_allocator::allocate_dl_grant(const ue_pdsch_grant& gra
             cell_cfg.dl_cfg_common.freq_info_dl.scs_carrier_list.back().tx_direct_current_location.value(), crbs);
       }
 
-      mcs_tbs_info = compute_dl_mcs_tbs(pdsch_cfg, adjusted_mcs, crbs.length(), contains_dc);
+      mcs_tbs_info = compute_dl_mcs_tbs(pdsch_cfg, adjusted_mcs, crbs.length(), contains_dc, ue_cc->dl_mcs_tbs_memo);
     } else {
       // It is a retx.
       mcs_tbs_info.emplace(sch_mcs_tbs{.mcs = h_dl->get_grant_params().mcs, .tbs = h_dl->get_grant_params().tbs_bytes});
@@ -820,7 +820,8 @@ ue_cell_grid_allocator::allocate_ul_grant(const ue_pusch_grant& grant, ran_slice
       bool contains_dc =
           dc_offset_helper::is_contained(cell_cfg.expert_cfg.ue.initial_ul_dc_offset, cell_cfg.nof_ul_prbs, crbs);
 
-      mcs_tbs_info = compute_ul_mcs_tbs(pusch_cfg, &ue_cell_cfg, mcs_prbs.mcs, crbs.length(), contains_dc);
+      mcs_tbs_info = compute_ul_mcs_tbs(
+          pusch_cfg, &ue_cell_cfg, mcs_prbs.mcs, crbs.length(), contains_dc, ue_cc->ul_mcs_tbs_memo);
     }
     // If it's a reTx, fetch the MCS, TBS and number of layers from the previous transmission.
     else {
@@ -136,6 +136,9 @@ ue_event_manager::~ue_event_manager() {}
 
 void ue_event_manager::handle_ue_creation(ue_config_update_event ev)
 {
+  // Release any UE objects pending destruction while in the configuration execution context.
+  ue_db.destroy_pending_ue_objects();
+
   // Create UE object outside the scheduler slot indication handler to minimize latency.
   std::unique_ptr<ue> u = std::make_unique<ue>(
       ue_creation_command{ev.next_config(),
@@ -248,6 +251,9 @@ void ue_event_manager::handle_ue_reconfiguration(ue_config_update_event ev)
 
 void ue_event_manager::handle_ue_deletion(ue_config_delete_event ev)
 {
+  // Release any UE objects pending destruction while in the configuration execution context.
+  ue_db.destroy_pending_ue_objects();
+
   const du_ue_index_t ue_index = ev.ue_index();
 
   auto handle_ue_deletion_impl = [this, ev = std::move(ev)]() mutable {
@@ -735,21 +741,31 @@ void ue_event_manager::process_common(slot_point sl, du_cell_index_t cell_index)
   }
   last_sl = sl;
 
-  // Process events for UEs whose PCell matches cell_index argument.
-  common_event_t ev{MAX_NOF_DU_UES, []() {}};
-  while (common_events.try_pop(ev)) {
-    if (ev.ue_index == MAX_NOF_DU_UES) {
-      // The UE is being created.
-      ev.callback();
-    } else {
-      if (not ue_db.contains(ev.ue_index)) {
-        // Can't find UE. Log error.
-        log_invalid_ue_index(ev.ue_index);
-        continue;
+  // Process events for UEs whose PCell matches cell_index argument. The events are drained in batches to amortize the
+  // per-pop queue synchronization overhead.
+  static constexpr size_t                         event_batch_size = 32;
+  static_vector<common_event_t, event_batch_size> batch;
+  for (unsigned i = 0; i != event_batch_size; ++i) {
+    batch.emplace_back(MAX_NOF_DU_UES, []() {});
+  }
+  size_t nof_events;
+  do {
+    nof_events = common_events.try_pop_bulk(span<common_event_t>(batch.data(), batch.size()));
+    for (unsigned i = 0; i != nof_events; ++i) {
+      common_event_t& ev = batch[i];
+      if (ev.ue_index == MAX_NOF_DU_UES) {
+        // The UE is being created.
+        ev.callback();
+      } else {
+        if (not ue_db.contains(ev.ue_index)) {
+          // Can't find UE. Log error.
+          log_invalid_ue_index(ev.ue_index);
+          continue;
+        }
+        ev.callback();
       }
-      ev.callback();
     }
-  }
+  } while (nof_events == event_batch_size);
 
   // Process pending DL Buffer Occupancy reports.
   dl_bo_mng->slot_indication(sl);
@@ -757,22 +773,31 @@ void ue_event_manager::process_common(slot_point sl, du_cell_index_t cell_index)
 
 void ue_event_manager::process_cell_specific(du_cell_index_t cell_index)
 {
-  // Pop and process pending cell-specific events.
-  auto&        cell_events = cell_specific_events[cell_index];
-  cell_event_t ev{INVALID_DU_UE_INDEX, [](ue_cell&) {}, "invalid", true};
-  while (cell_events.try_pop(ev)) {
-    if (not ue_db.contains(ev.ue_index)) {
-      log_invalid_ue_index(ev.ue_index, ev.event_name, ev.warn_if_ignored);
-      continue;
-    }
-    ue&      ue    = ue_db[ev.ue_index];
-    ue_cell* ue_cc = ue.find_cell(cell_index);
-    if (ue_cc == nullptr) {
-      log_invalid_cc(ev.ue_index, cell_index);
-      continue;
-    }
-    ev.callback(*ue_cc);
+  // Pop and process pending cell-specific events in batches to amortize the per-pop queue synchronization overhead.
+  auto&                                         cell_events      = cell_specific_events[cell_index];
+  static constexpr size_t                       event_batch_size = 32;
+  static_vector<cell_event_t, event_batch_size> batch;
+  for (unsigned i = 0; i != event_batch_size; ++i) {
+    batch.emplace_back(INVALID_DU_UE_INDEX, [](ue_cell&) {}, "invalid", true);
   }
+  size_t nof_events;
+  do {
+    nof_events = cell_events.try_pop_bulk(span<cell_event_t>(batch.data(), batch.size()));
+    for (unsigned i = 0; i != nof_events; ++i) {
+      cell_event_t& ev = batch[i];
+      if (not ue_db.contains(ev.ue_index)) {
+        log_invalid_ue_index(ev.ue_index, ev.event_name, ev.warn_if_ignored);
+        continue;
+      }
+      ue&      ue    = ue_db[ev.ue_index];
+      ue_cell* ue_cc = ue.find_cell(cell_index);
+      if (ue_cc == nullptr) {
+        log_invalid_cc(ev.ue_index, cell_index);
+        continue;
+      }
+      ev.callback(*ue_cc);
+    }
+  } while (nof_events == event_batch_size);
 }
 
 void ue_event_manager::run(slot_point sl, du_cell_index_t cell_index)
@@ -101,8 +101,11 @@ void ue_repository::slot_indication(slot_point sl_tx)
       logger.error("ue={} rnti={}: UE with provided c-rnti not found in RNTI-to-UE-index lookup table.", ue_idx, crnti);
     }
 
-    // Remove UE from the repository.
+    // Remove UE from the repository. The UE object is parked in the garbage queue, so that its destruction takes
+    // place outside the slot critical path. If the queue is full, the UE is destroyed inline as a fallback.
+    std::unique_ptr<ue> removed_ue = std::move(ues[ue_idx]);
     ues.erase(ue_idx);
+    ues_to_destroy.try_push(std::move(removed_ue));
 
     // Marks UE config removal as complete.
     rem_ev.reset();
@@ -128,9 +131,21 @@ void ue_repository::add_ue(std::unique_ptr<ue> u)
   rnti_t        rnti     = u->crnti;
   ues.insert(ue_index, std::move(u));
 
-  // Update RNTI -> UE index lookup.
-  rnti_to_ue_index_lookup.emplace_back(rnti, ue_index);
-  std::sort(rnti_to_ue_index_lookup.begin(), rnti_to_ue_index_lookup.end());
+  // Update RNTI -> UE index lookup, keeping it sorted. Insertion at the lower bound avoids a full re-sort per added
+  // UE, which matters during attach storms, when this method runs once per UE on the slot critical path.
+  auto it = std::lower_bound(rnti_to_ue_index_lookup.begin(),
+                             rnti_to_ue_index_lookup.end(),
+                             rnti,
+                             [](const auto& lhs, rnti_t rnti_v) { return lhs.first < rnti_v; });
+  rnti_to_ue_index_lookup.insert(it, std::make_pair(rnti, ue_index));
+}
+
+void ue_repository::destroy_pending_ue_objects()
+{
+  std::unique_ptr<ue> removed_ue;
+  while (ues_to_destroy.try_pop(removed_ue)) {
+    removed_ue.reset();
+  }
 }
 
 void ue_repository::schedule_ue_rem(ue_config_delete_event ev)
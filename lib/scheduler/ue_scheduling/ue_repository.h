@@ -25,6 +25,7 @@
 #include "../config/sched_config_manager.h"
 #include "ue.h"
 #include "srsran/adt/ring_buffer.h"
+#include "srsran/adt/spsc_queue.h"
 #include "srsran/adt/unique_function.h"
 
 namespace srsran {
@@ -60,6 +61,14 @@ public:
   /// \brief Initiate removal of existing UE from the repository.
   void schedule_ue_rem(ue_config_delete_event ev);
 
+  /// \brief Destroy UE objects that have been removed from the repository.
+  ///
+  /// UE objects are large (HARQ entities, channel state managers), and destroying them inside \c slot_indication would
+  /// add work to the scheduler slot critical path. Instead, removed UEs are parked in a garbage queue and this method
+  /// releases them from the configuration execution context.
+  /// \remark This method must not be called from within the scheduler slot indication handler.
+  void destroy_pending_ue_objects();
+
   ue*       find(du_ue_index_t ue_index) { return ues.contains(ue_index) ? ues[ue_index].get() : nullptr; }
   const ue* find(du_ue_index_t ue_index) const { return ues.contains(ue_index) ? ues[ue_index].get() : nullptr; }
 
@@ -87,6 +96,11 @@ private:
   // carried out, and the original UE removal command.
   ring_buffer<std::pair<slot_point, ue_config_delete_event>> ues_to_rem{MAX_NOF_DU_UES};
 
+  // Queue of removed UE objects awaiting destruction outside the scheduler slot critical path. Produced by the slot
+  // indication handler and consumed by the configuration execution context.
+  concurrent_queue<std::unique_ptr<ue>, concurrent_queue_policy::lockfree_spsc, concurrent_queue_wait_policy::non_blocking>
+      ues_to_destroy{MAX_NOF_DU_UES};
+
   // Last slot indication.
   slot_point last_sl_tx;
 };
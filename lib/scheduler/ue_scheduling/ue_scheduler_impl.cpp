@@ -22,6 +22,7 @@
 
 #include "ue_scheduler_impl.h"
 #include "../logging/scheduler_metrics_handler.h"
+#include <mutex>
 
 using namespace srsran;
 
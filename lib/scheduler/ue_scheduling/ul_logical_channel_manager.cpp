@@ -33,7 +33,7 @@ ul_logical_channel_manager::ul_logical_channel_manager()
 void ul_logical_channel_manager::configure(span<const logical_channel_config> log_channels_configs)
 {
   for (unsigned i = 1; i != groups.size(); ++i) {
-    groups[i].active = false;
+    set_status(uint_to_lcg_id(i), false);
   }
   for (const logical_channel_config& lc_ch : log_channels_configs) {
     set_status(lc_ch.lc_group, true);
@@ -35,7 +35,18 @@ public:
   ul_logical_channel_manager();
 
   /// Set the status of a logical channel group.
-  void set_status(lcg_id_t lcg_id, bool active) { groups[lcg_id].active = active; }
+  void set_status(lcg_id_t lcg_id, bool active)
+  {
+    channel_group_context& ch = groups[lcg_id];
+    if (ch.active != active) {
+      ch.active = active;
+      if (active) {
+        total_active_bytes += ch.buf_st;
+      } else {
+        total_active_bytes -= ch.buf_st;
+      }
+    }
+  }
 
   /// \brief Update the configurations of the provided lists of bearers.
   void configure(span<const logical_channel_config> log_channels_configs);
@@ -53,14 +64,15 @@ public:
   }
 
   /// \brief Checks whether a logical channel has pending data.
-  bool has_pending_bytes() const
-  {
-    return std::any_of(groups.begin(), groups.end(), [](const auto& ch) { return ch.active and ch.buf_st > 0; });
-  }
+  bool has_pending_bytes() const { return total_active_bytes > 0; }
 
   /// \brief Calculates total number of UL bytes.
   unsigned pending_bytes() const
   {
+    // Fast path for the common case of a UE with empty buffers, iterated for every UE in every slot.
+    if (total_active_bytes == 0) {
+      return 0;
+    }
     unsigned bytes = 0;
     for (unsigned i = 0; i <= MAX_LCG_ID; ++i) {
       bytes += pending_bytes(uint_to_lcg_id(i));
@@ -84,7 +96,11 @@ public:
   void handle_bsr_indication(const ul_bsr_indication_message& msg)
   {
     for (const auto& lcg_report : msg.reported_lcgs) {
-      groups[lcg_report.lcg_id].buf_st = lcg_report.nof_bytes;
+      channel_group_context& ch = groups[lcg_report.lcg_id];
+      if (ch.active) {
+        total_active_bytes += lcg_report.nof_bytes - ch.buf_st;
+      }
+      ch.buf_st = lcg_report.nof_bytes;
     }
   }
 
@@ -125,7 +141,13 @@ private:
   // can be received from different cells (in different threads).
   std::atomic<bool> sr_pending{false};
 
-  std::array<channel_group_context, MAX_NOF_LCGS> groups;
+  /// \brief Sum of the reported buffer states of all active LCGs, in bytes, without upper layer header estimates.
+  /// Kept in sync with \c groups so that the per-UE pending-data checks run in every slot's UL allocation loop do not
+  /// need to traverse the LCGs.
+  unsigned total_active_bytes = 0;
+
+  /// Per-LCG state, aligned so that all groups of a UE fit in a single cache line.
+  alignas(64) std::array<channel_group_context, MAX_NOF_LCGS> groups;
 };
 
 } // namespace srsran
@@ -27,6 +27,7 @@
 #include "sdap_session_logger.h"
 #include "srsran/sdap/sdap.h"
 #include "srsran/support/timers.h"
+#include <array>
 #include <unordered_map>
 
 namespace srsran {
@@ -53,15 +54,20 @@ public:
   /// Handle the incoming SDU and redirect to mapped DRB.
   void handle_sdu(byte_buffer sdu, qos_flow_id_t qos_flow_id) final
   {
-    auto tx_it = tx_map.find(qos_flow_id);
-    if (tx_it == tx_map.end()) {
+    // The QFI is 6 bits, so the routing is resolved with a single indexed load into the flat per-QFI table.
+    const uint8_t qfi_idx = qos_flow_id_to_uint(qos_flow_id);
+    if (qfi_idx >= tx_flows.size() || tx_flows[qfi_idx] == nullptr) {
       logger.log_warning("No mapping for SDU with {}", qos_flow_id);
       return;
     }
-    tx_it->second->handle_sdu(std::move(sdu));
+    tx_flows[qfi_idx]->handle_sdu(std::move(sdu));
   }
 
-  bool is_mapped(qos_flow_id_t qfi) final { return tx_map.find(qfi) != tx_map.end(); }
+  bool is_mapped(qos_flow_id_t qfi) final
+  {
+    const uint8_t qfi_idx = qos_flow_id_to_uint(qfi);
+    return qfi_idx < tx_flows.size() && tx_flows[qfi_idx] != nullptr;
+  }
 
   void
   add_mapping(qos_flow_id_t qfi, drb_id_t drb_id, sdap_config sdap_cfg, sdap_tx_pdu_notifier& tx_pdu_notifier) final
@@ -80,7 +86,7 @@ public:
     // create TX mapping
     std::unique_ptr<sdap_entity_tx_impl> tx =
         std::make_unique<sdap_entity_tx_impl>(ue_index, psi, qfi, drb_id, tx_pdu_notifier);
-    tx_map.insert({qfi, std::move(tx)});
+    tx_flows[qos_flow_id_to_uint(qfi)] = std::move(tx);
 
     // create RX mapping
     std::unique_ptr<sdap_entity_rx_impl> rx =
@@ -91,12 +97,10 @@ public:
   void remove_mapping(drb_id_t drb_id) final
   {
     // remove TX mapping
-    for (auto tx_it = tx_map.begin(); tx_it != tx_map.end();) {
-      if (tx_it->second->get_drb_id() == drb_id) {
-        logger.log_info("Unmapping DL {} {}", tx_it->first, drb_id);
-        tx_it = tx_map.erase(tx_it);
-      } else {
-        ++tx_it;
+    for (unsigned qfi_idx = 0; qfi_idx != tx_flows.size(); ++qfi_idx) {
+      if (tx_flows[qfi_idx] != nullptr && tx_flows[qfi_idx]->get_drb_id() == drb_id) {
+        logger.log_info("Unmapping DL {} {}", uint_to_qos_flow_id(qfi_idx), drb_id);
+        tx_flows[qfi_idx] = nullptr;
       }
     }
 
@@ -111,8 +115,11 @@ private:
   pdu_session_id_t      psi;
   sdap_rx_sdu_notifier& rx_sdu_notifier;
 
-  std::unordered_map<qos_flow_id_t, std::unique_ptr<sdap_entity_tx_impl>> tx_map;
-  std::unordered_map<drb_id_t, std::unique_ptr<sdap_entity_rx_impl>>      rx_map;
+  /// Flat DL routing table indexed directly by QFI. Each entry points to the TX entity of the mapped DRB, so the
+  /// per-SDU routing decision is a single indexed load.
+  std::array<std::unique_ptr<sdap_entity_tx_impl>, MAX_NOF_QOS_FLOWS> tx_flows;
+  /// UL mapping, only looked up when wiring bearers at setup time.
+  std::unordered_map<drb_id_t, std::unique_ptr<sdap_entity_rx_impl>> rx_map;
 };
 
 } // namespace srs_cu_up
@@ -22,6 +22,7 @@
 
 #include "ciphering_engine_nea1.h"
 #include "srsran/security/ciphering.h"
+#include "srsran/security/s3g.h"
 
 using namespace srsran;
 using namespace security;
@@ -29,8 +30,13 @@ using namespace security;
 ciphering_engine_nea1::ciphering_engine_nea1(sec_128_key        k_128_enc_,
                                              uint8_t            bearer_id_,
                                              security_direction direction_) :
-  k_128_enc(k_128_enc_), bearer_id(bearer_id_), direction(direction_)
+  bearer_id(bearer_id_), direction(direction_)
 {
+  // Transform key
+  for (int i = 3; i >= 0; i--) {
+    k[i] = (k_128_enc_[4 * (3 - i) + 0] << 24) | (k_128_enc_[4 * (3 - i) + 1] << 16) |
+           (k_128_enc_[4 * (3 - i) + 2] << 8) | (k_128_enc_[4 * (3 - i) + 3]);
+  }
 }
 
 security_result ciphering_engine_nea1::apply_ciphering(byte_buffer buf, size_t offset, uint32_t count)
@@ -38,7 +44,35 @@ security_result ciphering_engine_nea1::apply_ciphering(byte_buffer buf, size_t o
   security_result  result{.buf = std::move(buf), .count = count};
   byte_buffer_view msg{result.buf.value().begin() + offset, result.buf.value().end()};
 
-  security_nea1(k_128_enc, count, bearer_id, direction, msg);
+  uint32_t len = msg.length();
+  srsran_assert(len <= sec_max_pdu_size,
+                "{}: Maximum PDU length exceeded. len={} max_len={}",
+                __FUNCTION__,
+                len,
+                sec_max_pdu_size);
+
+  // Construct iv
+  uint32_t iv[4];
+  iv[3] = count;
+  iv[2] = ((bearer_id & 0x1f) << 27) | ((to_number(direction) & 0x01) << 26);
+  iv[1] = iv[3];
+  iv[0] = iv[2];
+
+  // Generate the keystream for the whole PDU in one go.
+  S3G_STATE state;
+  s3g_initialize(&state, k, iv);
+  s3g_generate_keystream(&state, (len + 3) / 4, ks_buf.data());
+  s3g_deinitialize(&state);
+
+  // Apply the keystream segment by segment.
+  uint32_t                       pos      = 0;
+  byte_buffer_segment_span_range segments = msg.modifiable_segments();
+  for (span<uint8_t> segment : segments) {
+    for (uint8_t& byte : segment) {
+      byte ^= (ks_buf[pos / 4] >> ((3 - (pos % 4)) * 8)) & 0xff;
+      ++pos;
+    }
+  }
 
   return result;
 }
@@ -37,9 +37,14 @@ public:
   security_result apply_ciphering(byte_buffer buf, size_t offset, uint32_t count) override;
 
 private:
-  sec_128_key        k_128_enc;
   uint8_t            bearer_id;
   security_direction direction;
+
+  /// Transformed key, precomputed on construction.
+  uint32_t k[4];
+
+  /// Keystream buffer, avoids a heap allocation per PDU.
+  std::array<uint32_t, sec_max_pdu_size / 4 + 1> ks_buf;
 };
 
 } // namespace security
@@ -101,10 +101,11 @@ void backend_worker::do_work()
   constexpr std::chrono::microseconds sleep_period{100};
 
   while (running_flag) {
-    auto item = queue.try_pop();
+    // Dequeue entries in batches, so that the cost of taking the queue lock is amortized across the batch.
+    unsigned count = queue.try_pop_into({entry_batch.data(), entry_batch.size()});
 
     // Spin while there are no new entries to process.
-    if (!item.first) {
+    if (count == 0) {
       std::this_thread::sleep_for(sleep_period);
       continue;
     }
@@ -119,7 +120,9 @@ void backend_worker::do_work()
       }
     }
 
-    process_log_entry(std::move(item.second));
+    for (unsigned i = 0; i != count; ++i) {
+      process_log_entry(std::move(entry_batch[i]));
+    }
   }
 
   // When we reach here, the thread is about to terminate, last chance to
@@ -166,13 +169,15 @@ void backend_worker::process_outstanding_entries()
   assert(!running_flag && "Cannot process outstanding entries while thread is running");
 
   while (true) {
-    auto item = queue.try_pop();
+    unsigned count = queue.try_pop_into({entry_batch.data(), entry_batch.size()});
 
     // Check if the queue is empty.
-    if (!item.first) {
+    if (count == 0) {
       break;
     }
 
-    process_log_entry(std::move(item.second));
+    for (unsigned i = 0; i != count; ++i) {
+      process_log_entry(std::move(entry_batch[i]));
+    }
   }
 }
@@ -130,6 +130,10 @@ private:
   std::once_flag     start_once_flag;
   std::thread        worker_thread;
   fmt::memory_buffer fmt_buffer;
+  /// Maximum number of entries dequeued from the work queue in one go.
+  static constexpr unsigned max_batch_size = 64;
+  /// Scratch storage for batch dequeuing of log entries.
+  std::vector<detail::log_entry> entry_batch{max_batch_size};
 };
 
 } // namespace srslog
@@ -61,8 +61,8 @@ static void format_metadata(const detail::log_entry_metadata& metadata, fmt::mem
   fmt::format_to(buffer, "{:%F}T{:%H:%M:%S}.{:06} ", current_time, current_time, us_fraction);
 
   // Format optional fields if present.
-  if (!metadata.log_name.empty()) {
-    fmt::format_to(buffer, "[{: <8}] ", metadata.log_name);
+  if (metadata.log_name != nullptr && !metadata.log_name->empty()) {
+    fmt::format_to(buffer, "[{: <8}] ", *metadata.log_name);
   }
   if (metadata.log_tag != '\0') {
     fmt::format_to(buffer, "[{}] ", metadata.log_tag);
@@ -21,133 +21,53 @@
  */
 
 #include "srsran/srsvec/add.h"
-#include "srsran/srsvec/simd.h"
 
-using namespace srsran;
-using namespace srsvec;
-
-static void add_fff_simd(const float* x, const float* y, float* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_F_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_load(x + i);
-      simd_f_t b = srsran_simd_f_load(y + i);
-
-      simd_f_t r = srsran_simd_f_add(a, b);
-
-      srsran_simd_f_store(z + i, r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_loadu(x + i);
-      simd_f_t b = srsran_simd_f_loadu(y + i);
-
-      simd_f_t r = srsran_simd_f_add(a, b);
-
-      srsran_simd_f_storeu(z + i, r);
-    }
-  }
-#endif
+#define SRSVEC_SIMD_VARIANT baseline
+#include "add_impl.h"
+#undef SRSVEC_SIMD_VARIANT
 
-  for (; i != len; ++i) {
-    z[i] = x[i] + y[i];
-  }
-}
-
-static void add_ccc_simd(const cf_t* x, const cbf16_t* y, cf_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_F_SIZE
-  for (std::size_t i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
-    simd_cf_t a = srsran_simd_cfi_loadu(x + i);
-    simd_cf_t b = srsran_simd_cbf16_loadu(y + i);
-
-    simd_cf_t r = srsran_simd_cf_add(a, b);
+#include "simd_variant.h"
 
-    srsran_simd_cfi_storeu(z + i, r);
-  }
-#endif
-
-  for (; i != len; ++i) {
-    z[i] = x[i] + to_cf(y[i]);
-  }
-}
-
-static void add_sss_simd(const int16_t* x, const int16_t* y, int16_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_S_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_load(x + i);
-      simd_s_t b = srsran_simd_s_load(y + i);
-
-      simd_s_t r = srsran_simd_s_add(a, b);
-
-      srsran_simd_s_store(z + i, r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_loadu(x + i);
-      simd_s_t b = srsran_simd_s_loadu(y + i);
-
-      simd_s_t r = srsran_simd_s_add(a, b);
-
-      srsran_simd_s_storeu(z + i, r);
-    }
-  }
-#endif /* SRSRAN_SIMD_S_SIZE */
-
-  for (; i != len; ++i) {
-    z[i] = x[i] + y[i];
-  }
-}
-
-static void add_bbb_simd(const int8_t* x, const int8_t* y, int8_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_S_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_B_SIZE) * SRSRAN_SIMD_B_SIZE; i != i_end; i += SRSRAN_SIMD_B_SIZE) {
-      simd_b_t a = srsran_simd_b_load(x + i);
-      simd_b_t b = srsran_simd_b_load(y + i);
-
-      simd_b_t r = srsran_simd_b_add(a, b);
-
-      srsran_simd_b_store(z + i, r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_B_SIZE) * SRSRAN_SIMD_B_SIZE; i != i_end; i += SRSRAN_SIMD_B_SIZE) {
-      simd_b_t a = srsran_simd_b_loadu(x + i);
-      simd_b_t b = srsran_simd_b_loadu(y + i);
-
-      simd_b_t r = srsran_simd_b_add(a, b);
-
-      srsran_simd_b_storeu(z + i, r);
-    }
-  }
-#endif /* SRSRAN_SIMD_S_SIZE */
+using namespace srsran;
+using namespace srsvec;
 
-  for (; i != len; ++i) {
-    z[i] = x[i] + y[i];
-  }
-}
+#ifdef __x86_64__
+namespace srsran {
+namespace srsvec {
+namespace avx2 {
+void add_fff_simd(const float* x, const float* y, float* z, std::size_t len);
+void add_ccc_simd(const cf_t* x, const cbf16_t* y, cf_t* z, std::size_t len);
+void add_sss_simd(const int16_t* x, const int16_t* y, int16_t* z, std::size_t len);
+void add_bbb_simd(const int8_t* x, const int8_t* y, int8_t* z, std::size_t len);
+} // namespace avx2
+namespace avx512 {
+void add_fff_simd(const float* x, const float* y, float* z, std::size_t len);
+void add_ccc_simd(const cf_t* x, const cbf16_t* y, cf_t* z, std::size_t len);
+void add_sss_simd(const int16_t* x, const int16_t* y, int16_t* z, std::size_t len);
+void add_bbb_simd(const int8_t* x, const int8_t* y, int8_t* z, std::size_t len);
+} // namespace avx512
+} // namespace srsvec
+} // namespace srsran
+#endif // __x86_64__
+
+namespace {
+
+auto* const add_fff = SRSVEC_SELECT_SIMD_VARIANT(add_fff_simd);
+auto* const add_ccc = SRSVEC_SELECT_SIMD_VARIANT(add_ccc_simd);
+auto* const add_sss = SRSVEC_SELECT_SIMD_VARIANT(add_sss_simd);
+auto* const add_bbb = SRSVEC_SELECT_SIMD_VARIANT(add_bbb_simd);
+
+} // namespace
 
 void srsran::srsvec::add(span<const cf_t> x, span<const cf_t> y, span<cf_t> z)
 {
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  add_fff_simd(reinterpret_cast<const float*>(x.data()),
-               reinterpret_cast<const float*>(y.data()),
-               reinterpret_cast<float*>(z.data()),
-               2 * z.size());
+  add_fff(reinterpret_cast<const float*>(x.data()),
+          reinterpret_cast<const float*>(y.data()),
+          reinterpret_cast<float*>(z.data()),
+          2 * z.size());
 }
 
 void srsran::srsvec::add(span<const cf_t> x, span<const cbf16_t> y, span<cf_t> z)
@@ -155,7 +75,7 @@ void srsran::srsvec::add(span<const cf_t> x, span<const cbf16_t> y, span<cf_t> z
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  add_ccc_simd(x.data(), y.data(), z.data(), z.size());
+  add_ccc(x.data(), y.data(), z.data(), z.size());
 }
 
 void srsran::srsvec::add(span<const float> x, span<const float> y, span<float> z)
@@ -163,7 +83,7 @@ void srsran::srsvec::add(span<const float> x, span<const float> y, span<float> z
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  add_fff_simd(x.data(), y.data(), z.data(), z.size());
+  add_fff(x.data(), y.data(), z.data(), z.size());
 }
 
 void srsran::srsvec::add(span<const int16_t> x, span<const int16_t> y, span<int16_t> z)
@@ -171,7 +91,7 @@ void srsran::srsvec::add(span<const int16_t> x, span<const int16_t> y, span<int1
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  add_sss_simd(x.data(), y.data(), z.data(), z.size());
+  add_sss(x.data(), y.data(), z.data(), z.size());
 }
 
 void srsran::srsvec::add(span<const int8_t> x, span<const int8_t> y, span<int8_t> z)
@@ -179,5 +99,5 @@ void srsran::srsvec::add(span<const int8_t> x, span<const int8_t> y, span<int8_t
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  add_bbb_simd(x.data(), y.data(), z.data(), z.size());
+  add_bbb(x.data(), y.data(), z.data(), z.size());
 }
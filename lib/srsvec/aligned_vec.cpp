@@ -23,17 +23,114 @@
 #include "srsran/srsvec/aligned_vec.h"
 #include "srsran/srsvec/simd.h"
 #include "srsran/support/error_handling.h"
+#include <array>
 #include <cstdlib>
 
+namespace {
+
+/// Maximum size, in bytes, of a block eligible for thread-local caching.
+constexpr std::size_t max_cached_block_size = 65536;
+/// Maximum number of distinct block sizes tracked per thread.
+constexpr std::size_t max_nof_bins = 16;
+/// Maximum number of cached blocks per size.
+constexpr std::size_t max_blocks_per_bin = 8;
+
+/// \brief Thread-local cache of freed aligned blocks, keyed by their exact size.
+///
+/// Temporary SIMD buffers in the channel processors are created and destroyed with the same handful of sizes on every
+/// slot. Recycling the blocks within the thread keeps the allocator out of the hot path without any locking.
+class block_cache
+{
+public:
+  /// Takes a cached block of the given size, or returns \c nullptr if none is available.
+  void* pop(std::size_t size)
+  {
+    for (unsigned i_bin = 0; i_bin != nof_bins; ++i_bin) {
+      bin& b = bins[i_bin];
+      if ((b.size == size) && (b.count != 0)) {
+        return b.blocks[--b.count];
+      }
+    }
+    return nullptr;
+  }
+
+  /// Caches a block of the given size. Returns \c true on success, \c false if the cache is full.
+  bool push(std::size_t size, void* ptr)
+  {
+    for (unsigned i_bin = 0; i_bin != nof_bins; ++i_bin) {
+      bin& b = bins[i_bin];
+      if (b.size == size) {
+        if (b.count == max_blocks_per_bin) {
+          return false;
+        }
+        b.blocks[b.count++] = ptr;
+        return true;
+      }
+    }
+
+    // Track a new block size if there is room for another bin.
+    if (nof_bins == max_nof_bins) {
+      return false;
+    }
+    bin& b      = bins[nof_bins++];
+    b.size      = size;
+    b.count     = 1;
+    b.blocks[0] = ptr;
+    return true;
+  }
+
+  /// Releases all cached blocks when the thread terminates.
+  ~block_cache()
+  {
+    for (unsigned i_bin = 0; i_bin != nof_bins; ++i_bin) {
+      bin& b = bins[i_bin];
+      for (unsigned i_block = 0; i_block != b.count; ++i_block) {
+        ::free(b.blocks[i_block]);
+      }
+    }
+  }
+
+private:
+  /// Cached blocks of one size.
+  struct bin {
+    std::size_t                           size = 0;
+    std::size_t                           count = 0;
+    std::array<void*, max_blocks_per_bin> blocks;
+  };
+
+  std::array<bin, max_nof_bins> bins;
+  std::size_t                   nof_bins = 0;
+};
+
+thread_local block_cache cache;
+
+} // namespace
+
 void* srsran::srsvec::detail::mem_alloc(std::size_t size)
 {
+  // Reuse a block recycled by this thread if one of the right size is cached.
+  if (size <= max_cached_block_size) {
+    if (void* cached = cache.pop(size)) {
+      return cached;
+    }
+  }
+
   void* ptr = nullptr;
   int   ret = ::posix_memalign(&ptr, SIMD_BYTE_ALIGN * 8, size);
   report_fatal_error_if_not(ret == 0 && ptr, "Failed posix_memalign.");
   return ptr;
 }
 
-void srsran::srsvec::detail::mem_free(void* ptr)
+void srsran::srsvec::detail::mem_free(void* ptr, std::size_t size)
 {
+  if (ptr == nullptr) {
+    return;
+  }
+
+  // Recycle small blocks through the thread-local cache.
+  if ((size <= max_cached_block_size) && cache.push(size, ptr)) {
+    return;
+  }
+
   ::free(ptr);
 }
@@ -21,7 +21,9 @@
  */
 
 #include "srsran/srsvec/clip.h"
+#include "srsran/srsvec/simd.h"
 #include "srsran/support/math_utils.h"
+#include <numeric>
 
 using namespace srsran;
 
@@ -31,9 +33,42 @@ unsigned srsvec::clip(span<float> y, span<const float> x, float threshold)
 
   unsigned nof_clipped_samples = 0;
   unsigned len                 = x.size();
+  unsigned i                   = 0;
 
-  // Clip the output signal.
-  for (unsigned i = 0; i != len; ++i) {
+#if SRSRAN_SIMD_F_SIZE
+  if (len >= SRSRAN_SIMD_F_SIZE) {
+    simd_f_t thr_pos = srsran_simd_f_set1(threshold);
+    simd_f_t thr_neg = srsran_simd_f_set1(-threshold);
+    simd_f_t one     = srsran_simd_f_set1(1.0F);
+    simd_f_t count   = srsran_simd_f_zero();
+
+    for (unsigned simd_end = SRSRAN_SIMD_F_SIZE * (len / SRSRAN_SIMD_F_SIZE); i != simd_end;
+         i += SRSRAN_SIMD_F_SIZE) {
+      simd_f_t val = srsran_simd_f_loadu(&x[i]);
+
+      // Detect the samples that exceed the threshold in either direction.
+      simd_sel_t over  = srsran_simd_f_max(val, thr_pos);
+      simd_sel_t under = srsran_simd_f_min(val, thr_neg);
+
+      // Replace the offending samples by the threshold and count them without branching.
+      val   = srsran_simd_f_select(val, thr_pos, over);
+      val   = srsran_simd_f_select(val, thr_neg, under);
+      count = srsran_simd_f_add_sel(count, one, over);
+      count = srsran_simd_f_add_sel(count, one, under);
+
+      srsran_simd_f_storeu(&y[i], val);
+    }
+
+    // Reduce the per-lane clipped sample counters.
+    alignas(SIMD_BYTE_ALIGN) std::array<float, SRSRAN_SIMD_F_SIZE> simd_vector_count;
+    srsran_simd_f_store(simd_vector_count.data(), count);
+    nof_clipped_samples +=
+        static_cast<unsigned>(std::accumulate(simd_vector_count.begin(), simd_vector_count.end(), 0.0F));
+  }
+#endif // SRSRAN_SIMD_F_SIZE
+
+  // Clip the remaining samples.
+  for (; i != len; ++i) {
     float val = x[i];
     if (val > threshold) {
       val = threshold;
@@ -122,6 +122,39 @@ static void convert_if_simd(float* z, const int16_t* x, float scale, unsigned le
     // Store the result back to memory.
     _mm256_storeu_ps(z + i, float_vec);
   }
+#elif defined(__SSE4_1__)
+  // Load the scale factor into a vector register.
+  __m128 scale128 = _mm_set1_ps(gain);
+
+  // Process 4 elements at a time (128 bits / 32 bits per float = 4 floats).
+  for (unsigned i_end = (len / 4) * 4; i != i_end; i += 4) {
+    // Load 4 int16_t elements into the lower half of a 128-bit vector register.
+    __m128i input_vec = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(x + i));
+
+    // Convert the int16_t elements to float and scale them.
+    __m128 float_vec = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(input_vec));
+    float_vec        = _mm_mul_ps(float_vec, scale128);
+
+    // Store the result back to memory.
+    _mm_storeu_ps(z + i, float_vec);
+  }
+#elif defined(__ARM_NEON)
+  // Load the scale factor into a vector register.
+  float32x4_t scale_f32 = vdupq_n_f32(gain);
+
+  // Process 8 elements at a time (two 128-bit float registers per iteration).
+  for (unsigned i_end = (len / 8) * 8; i != i_end; i += 8) {
+    // Load 8 int16_t elements into a 128-bit vector register.
+    int16x8_t input_vec = vld1q_s16(x + i);
+
+    // Widen to int32, convert to float and scale.
+    float32x4_t float_lo = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(input_vec))), scale_f32);
+    float32x4_t float_hi = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(input_vec))), scale_f32);
+
+    // Store the result back to memory.
+    vst1q_f32(z + i, float_lo);
+    vst1q_f32(z + i + 4, float_hi);
+  }
 #endif // defined(__AVX__) && defined(__AVX2__)
 
   for (; i != len; ++i) {
@@ -0,0 +1,110 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/srsvec/copy.h"
+#include <cstring>
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif // __SSE2__
+
+using namespace srsran;
+using namespace srsvec;
+
+void srsvec::detail::copy_nt_bytes(void* dst, const void* src, std::size_t nof_bytes)
+{
+#ifdef __SSE2__
+  uint8_t*       dst_bytes = static_cast<uint8_t*>(dst);
+  const uint8_t* src_bytes = static_cast<const uint8_t*>(src);
+  std::size_t    i         = 0;
+
+  // Non-temporal stores require a 16-byte aligned destination. Copy the unaligned head normally.
+  std::size_t head = std::min<std::size_t>((16UL - (reinterpret_cast<uintptr_t>(dst_bytes) & 0xfUL)) & 0xfUL, nof_bytes);
+  if (head != 0) {
+    std::memcpy(dst_bytes, src_bytes, head);
+    i = head;
+  }
+
+#if defined(__AVX__) && defined(__AVX2__)
+  if (((reinterpret_cast<uintptr_t>(dst_bytes + i) & 0x1fUL) == 0)) {
+    for (std::size_t i_end = i + ((nof_bytes - i) / 32) * 32; i != i_end; i += 32) {
+      __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_bytes + i));
+      _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_bytes + i), value);
+    }
+  }
+#endif // defined(__AVX__) && defined(__AVX2__)
+
+  for (std::size_t i_end = i + ((nof_bytes - i) / 16) * 16; i != i_end; i += 16) {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_bytes + i));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst_bytes + i), value);
+  }
+
+  // Copy the remaining tail normally.
+  if (i != nof_bytes) {
+    std::memcpy(dst_bytes + i, src_bytes + i, nof_bytes - i);
+  }
+
+  // Make the non-temporal stores visible before any subsequent store.
+  _mm_sfence();
+#else  // __SSE2__
+  std::memcpy(dst, src, nof_bytes);
+#endif // __SSE2__
+}
+
+void srsvec::detail::zero_nt_bytes(void* dst, std::size_t nof_bytes)
+{
+#ifdef __SSE2__
+  uint8_t*    dst_bytes = static_cast<uint8_t*>(dst);
+  std::size_t i         = 0;
+
+  // Non-temporal stores require a 16-byte aligned destination. Zero the unaligned head normally.
+  std::size_t head = std::min<std::size_t>((16UL - (reinterpret_cast<uintptr_t>(dst_bytes) & 0xfUL)) & 0xfUL, nof_bytes);
+  if (head != 0) {
+    std::memset(dst_bytes, 0, head);
+    i = head;
+  }
+
+#if defined(__AVX__) && defined(__AVX2__)
+  if (((reinterpret_cast<uintptr_t>(dst_bytes + i) & 0x1fUL) == 0)) {
+    const __m256i zero256 = _mm256_setzero_si256();
+    for (std::size_t i_end = i + ((nof_bytes - i) / 32) * 32; i != i_end; i += 32) {
+      _mm256_stream_si256(reinterpret_cast<__m256i*>(dst_bytes + i), zero256);
+    }
+  }
+#endif // defined(__AVX__) && defined(__AVX2__)
+
+  const __m128i zero128 = _mm_setzero_si128();
+  for (std::size_t i_end = i + ((nof_bytes - i) / 16) * 16; i != i_end; i += 16) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst_bytes + i), zero128);
+  }
+
+  // Zero the remaining tail normally.
+  if (i != nof_bytes) {
+    std::memset(dst_bytes + i, 0, nof_bytes - i);
+  }
+
+  // Make the non-temporal stores visible before any subsequent store.
+  _mm_sfence();
+#else  // __SSE2__
+  std::memset(dst, 0, nof_bytes);
+#endif // __SSE2__
+}
@@ -21,105 +21,54 @@
  */
 
 #include "srsran/srsvec/dot_prod.h"
-#include "srsran/srsvec/simd.h"
+
+#define SRSVEC_SIMD_VARIANT baseline
+#include "dot_prod_impl.h"
+#undef SRSVEC_SIMD_VARIANT
+
+#include "simd_variant.h"
 
 using namespace srsran;
 using namespace srsvec;
 
+#ifdef __x86_64__
+namespace srsran {
+namespace srsvec {
+namespace avx2 {
+cf_t  dot_prod_ccc_simd(span<const cf_t> x, span<const cf_t> y);
+float average_power_cf_simd(span<const cf_t> x);
+float average_power_cbf16_simd(span<const cbf16_t> x);
+} // namespace avx2
+namespace avx512 {
+cf_t  dot_prod_ccc_simd(span<const cf_t> x, span<const cf_t> y);
+float average_power_cf_simd(span<const cf_t> x);
+float average_power_cbf16_simd(span<const cbf16_t> x);
+} // namespace avx512
+} // namespace srsvec
+} // namespace srsran
+#endif // __x86_64__
+
+namespace {
+
+auto* const dot_prod_ccc        = SRSVEC_SELECT_SIMD_VARIANT(dot_prod_ccc_simd);
+auto* const average_power_cf    = SRSVEC_SELECT_SIMD_VARIANT(average_power_cf_simd);
+auto* const average_power_cbf16 = SRSVEC_SELECT_SIMD_VARIANT(average_power_cbf16_simd);
+
+} // namespace
+
 cf_t srsran::srsvec::dot_prod(span<const cf_t> x, span<const cf_t> y)
 {
   srsran_srsvec_assert_size(x, y);
 
-  cf_t     result = 0;
-  unsigned i      = 0;
-  unsigned len    = x.size();
-
-#if SRSRAN_SIMD_CF_SIZE
-  if (len >= SRSRAN_SIMD_CF_SIZE) {
-    simd_cf_t simd_result = srsran_simd_cf_zero();
-    for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end;
-         i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t simd_x = srsran_simd_cfi_loadu(x.data() + i);
-      simd_cf_t simd_y = srsran_simd_cfi_loadu(y.data() + i);
-
-      simd_result = srsran_simd_cf_add(srsran_simd_cf_conjprod(simd_x, simd_y), simd_result);
-    }
-
-    alignas(SIMD_BYTE_ALIGN) std::array<cf_t, SRSRAN_SIMD_CF_SIZE> simd_vector_sum;
-    srsran_simd_cfi_store(simd_vector_sum.data(), simd_result);
-    result = std::accumulate(simd_vector_sum.begin(), simd_vector_sum.end(), cf_t());
-  }
-#endif // SRSRAN_SIMD_CF_SIZE
-
-  for (; i != len; ++i) {
-    result += x[i] * std::conj(y[i]);
-  }
-
-  return result;
+  return dot_prod_ccc(x, y);
 }
 
 float srsran::srsvec::average_power(span<const cf_t> x)
 {
-  float    result = 0;
-  unsigned i      = 0;
-  unsigned len    = x.size();
-
-  if (len == 0) {
-    return 0.0F;
-  }
-
-#if SRSRAN_SIMD_CF_SIZE
-  if (len >= SRSRAN_SIMD_CF_SIZE) {
-    simd_f_t simd_result = srsran_simd_f_zero();
-    for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end;
-         i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t simd_x = srsran_simd_cfi_loadu(x.data() + i);
-
-      simd_result = srsran_simd_f_add(srsran_simd_cf_norm_sq(simd_x), simd_result);
-    }
-
-    alignas(SIMD_BYTE_ALIGN) std::array<float, SRSRAN_SIMD_F_SIZE> simd_vector_sum;
-    srsran_simd_f_store(simd_vector_sum.data(), simd_result);
-    result = std::accumulate(simd_vector_sum.begin(), simd_vector_sum.end(), 0.0F);
-  }
-#endif // SRSRAN_SIMD_CF_SIZE
-
-  for (; i != len; ++i) {
-    result += std::norm(x[i]);
-  }
-
-  return result / static_cast<float>(len);
+  return average_power_cf(x);
 }
 
 float srsran::srsvec::average_power(span<const cbf16_t> x)
 {
-  float    result = 0;
-  unsigned i      = 0;
-  unsigned len    = x.size();
-
-  if (len == 0) {
-    return 0.0F;
-  }
-
-#if SRSRAN_SIMD_CF_SIZE
-  if (len >= SRSRAN_SIMD_CF_SIZE) {
-    simd_f_t simd_result = srsran_simd_f_zero();
-    for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end;
-         i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t simd_x = srsran_simd_cbf16_loadu(x.data() + i);
-
-      simd_result = srsran_simd_f_add(srsran_simd_cf_norm_sq(simd_x), simd_result);
-    }
-
-    alignas(SIMD_BYTE_ALIGN) std::array<float, SRSRAN_SIMD_F_SIZE> simd_vector_sum;
-    srsran_simd_f_store(simd_vector_sum.data(), simd_result);
-    result = std::accumulate(simd_vector_sum.begin(), simd_vector_sum.end(), 0.0F);
-  }
-#endif // SRSRAN_SIMD_CF_SIZE
-
-  for (; i != len; ++i) {
-    result += std::norm(to_cf(x[i]));
-  }
-
-  return result / static_cast<float>(len);
+  return average_power_cbf16(x);
 }
@@ -0,0 +1,137 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief Dot product and average power kernels, compiled once per instruction-set variant.
+///
+/// Included by one translation unit per instruction set, each defining \c SRSVEC_SIMD_VARIANT to the namespace that
+/// identifies the variant (see simd_variant.h).
+
+#pragma once
+
+#include "srsran/srsvec/dot_prod.h"
+#include "srsran/srsvec/simd.h"
+#include <numeric>
+
+namespace srsran {
+namespace srsvec {
+namespace SRSVEC_SIMD_VARIANT {
+
+cf_t dot_prod_ccc_simd(span<const cf_t> x, span<const cf_t> y)
+{
+  cf_t     result = 0;
+  unsigned i      = 0;
+  unsigned len    = x.size();
+
+#if SRSRAN_SIMD_CF_SIZE
+  if (len >= SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t simd_result = srsran_simd_cf_zero();
+    for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end;
+         i += SRSRAN_SIMD_CF_SIZE) {
+      simd_cf_t simd_x = srsran_simd_cfi_loadu(x.data() + i);
+      simd_cf_t simd_y = srsran_simd_cfi_loadu(y.data() + i);
+
+      simd_result = srsran_simd_cf_add(srsran_simd_cf_conjprod(simd_x, simd_y), simd_result);
+    }
+
+    alignas(SIMD_BYTE_ALIGN) std::array<cf_t, SRSRAN_SIMD_CF_SIZE> simd_vector_sum;
+    srsran_simd_cfi_store(simd_vector_sum.data(), simd_result);
+    result = std::accumulate(simd_vector_sum.begin(), simd_vector_sum.end(), cf_t());
+  }
+#endif // SRSRAN_SIMD_CF_SIZE
+
+  for (; i != len; ++i) {
+    result += x[i] * std::conj(y[i]);
+  }
+
+  return result;
+}
+
+float average_power_cf_simd(span<const cf_t> x)
+{
+  float    result = 0;
+  unsigned i      = 0;
+  unsigned len    = x.size();
+
+  if (len == 0) {
+    return 0.0F;
+  }
+
+#if SRSRAN_SIMD_CF_SIZE
+  if (len >= SRSRAN_SIMD_CF_SIZE) {
+    simd_f_t simd_result = srsran_simd_f_zero();
+    for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end;
+         i += SRSRAN_SIMD_CF_SIZE) {
+      simd_cf_t simd_x = srsran_simd_cfi_loadu(x.data() + i);
+
+      simd_result = srsran_simd_f_add(srsran_simd_cf_norm_sq(simd_x), simd_result);
+    }
+
+    alignas(SIMD_BYTE_ALIGN) std::array<float, SRSRAN_SIMD_F_SIZE> simd_vector_sum;
+    srsran_simd_f_store(simd_vector_sum.data(), simd_result);
+    result = std::accumulate(simd_vector_sum.begin(), simd_vector_sum.end(), 0.0F);
+  }
+#endif // SRSRAN_SIMD_CF_SIZE
+
+  for (; i != len; ++i) {
+    result += std::norm(x[i]);
+  }
+
+  return result / static_cast<float>(len);
+}
+
+float average_power_cbf16_simd(span<const cbf16_t> x)
+{
+  float    result = 0;
+  unsigned i      = 0;
+  unsigned len    = x.size();
+
+  if (len == 0) {
+    return 0.0F;
+  }
+
+#if SRSRAN_SIMD_CF_SIZE
+  if (len >= SRSRAN_SIMD_CF_SIZE) {
+    simd_f_t simd_result = srsran_simd_f_zero();
+    for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end;
+         i += SRSRAN_SIMD_CF_SIZE) {
+      simd_cf_t simd_x = srsran_simd_cbf16_loadu(x.data() + i);
+
+      simd_result = srsran_simd_f_add(srsran_simd_cf_norm_sq(simd_x), simd_result);
+    }
+
+    alignas(SIMD_BYTE_ALIGN) std::array<float, SRSRAN_SIMD_F_SIZE> simd_vector_sum;
+    srsran_simd_f_store(simd_vector_sum.data(), simd_result);
+    result = std::accumulate(simd_vector_sum.begin(), simd_vector_sum.end(), 0.0F);
+  }
+#endif // SRSRAN_SIMD_CF_SIZE
+
+  for (; i != len; ++i) {
+    result += std::norm(to_cf(x[i]));
+  }
+
+  return result / static_cast<float>(len);
+}
+
+} // namespace SRSVEC_SIMD_VARIANT
+} // namespace srsvec
+} // namespace srsran
@@ -21,43 +21,38 @@
  */
 
 #include "srsran/srsvec/modulus_square.h"
-#include "srsran/srsvec/simd.h"
 
-using namespace srsran;
-using namespace srsvec;
-
-static void modulus_square_simd(float* result, const cf_t* input, std::size_t len)
-{
-  std::size_t i = 0;
+#define SRSVEC_SIMD_VARIANT baseline
+#include "modulus_square_impl.h"
+#undef SRSVEC_SIMD_VARIANT
 
-#if SRSRAN_SIMD_CF_SIZE
-  for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end; i += SRSRAN_SIMD_CF_SIZE) {
-    // Load 2 SIMD words of floats.
-    simd_f_t simd_input1 = srsran_simd_f_loadu(reinterpret_cast<const float*>(input + i));
-    simd_f_t simd_input2 = srsran_simd_f_loadu(reinterpret_cast<const float*>(input + i + SRSRAN_SIMD_CF_SIZE / 2));
+#include "simd_variant.h"
 
-    // Calculates the squares.
-    simd_f_t simd_mul1 = srsran_simd_f_mul(simd_input1, simd_input1);
-    simd_f_t simd_mul2 = srsran_simd_f_mul(simd_input2, simd_input2);
+using namespace srsran;
+using namespace srsvec;
 
-    // Horizontally add the values in pair, it results in adding the squared real and imaginary parts.
-    simd_f_t simd_abs2 = srsran_simd_f_hadd(simd_mul1, simd_mul2);
+#ifdef __x86_64__
+namespace srsran {
+namespace srsvec {
+namespace avx2 {
+void modulus_square_simd(float* result, const cf_t* input, std::size_t len);
+} // namespace avx2
+namespace avx512 {
+void modulus_square_simd(float* result, const cf_t* input, std::size_t len);
+} // namespace avx512
+} // namespace srsvec
+} // namespace srsran
+#endif // __x86_64__
 
-    srsran_simd_f_storeu(result + i, simd_abs2);
-  }
-#endif // SRSRAN_SIMD_CF_SIZE
+namespace {
 
-  for (; i != len; ++i) {
-    float real = std::real(input[i]);
-    float imag = std::imag(input[i]);
+auto* const modulus_square_impl = SRSVEC_SELECT_SIMD_VARIANT(modulus_square_simd);
 
-    result[i] = real * real + imag * imag;
-  }
-}
+} // namespace
 
 void srsran::srsvec::modulus_square(span<float> result, span<const srsran::cf_t> input)
 {
   srsran_srsvec_assert_size(result, input);
 
-  modulus_square_simd(result.data(), input.data(), input.size());
+  modulus_square_impl(result.data(), input.data(), input.size());
 }
@@ -0,0 +1,69 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief Modulus square kernel, compiled once per instruction-set variant.
+///
+/// Included by one translation unit per instruction set, each defining \c SRSVEC_SIMD_VARIANT to the namespace that
+/// identifies the variant (see simd_variant.h).
+
+#pragma once
+
+#include "srsran/srsvec/modulus_square.h"
+#include "srsran/srsvec/simd.h"
+
+namespace srsran {
+namespace srsvec {
+namespace SRSVEC_SIMD_VARIANT {
+
+void modulus_square_simd(float* result, const cf_t* input, std::size_t len)
+{
+  std::size_t i = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  for (unsigned simd_end = SRSRAN_SIMD_CF_SIZE * (len / SRSRAN_SIMD_CF_SIZE); i != simd_end; i += SRSRAN_SIMD_CF_SIZE) {
+    // Load 2 SIMD words of floats.
+    simd_f_t simd_input1 = srsran_simd_f_loadu(reinterpret_cast<const float*>(input + i));
+    simd_f_t simd_input2 = srsran_simd_f_loadu(reinterpret_cast<const float*>(input + i + SRSRAN_SIMD_CF_SIZE / 2));
+
+    // Calculates the squares.
+    simd_f_t simd_mul1 = srsran_simd_f_mul(simd_input1, simd_input1);
+    simd_f_t simd_mul2 = srsran_simd_f_mul(simd_input2, simd_input2);
+
+    // Horizontally add the values in pair, it results in adding the squared real and imaginary parts.
+    simd_f_t simd_abs2 = srsran_simd_f_hadd(simd_mul1, simd_mul2);
+
+    srsran_simd_f_storeu(result + i, simd_abs2);
+  }
+#endif // SRSRAN_SIMD_CF_SIZE
+
+  for (; i != len; ++i) {
+    float real = std::real(input[i]);
+    float imag = std::imag(input[i]);
+
+    result[i] = real * real + imag * imag;
+  }
+}
+
+} // namespace SRSVEC_SIMD_VARIANT
+} // namespace srsvec
+} // namespace srsran
@@ -21,142 +21,50 @@
  */
 
 #include "srsran/srsvec/prod.h"
-#include "srsran/srsvec/simd.h"
-#include <cmath>
 
-using namespace srsran;
-using namespace srsvec;
-
-static void prod_fff_simd(const float* x, const float* y, float* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_F_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (; i + SRSRAN_SIMD_F_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_load(x + i);
-      simd_f_t b = srsran_simd_f_load(y + i);
+#define SRSVEC_SIMD_VARIANT baseline
+#include "prod_impl.h"
+#undef SRSVEC_SIMD_VARIANT
 
-      simd_f_t r = srsran_simd_f_mul(a, b);
-
-      srsran_simd_f_store(z + i, r);
-    }
-  } else {
-    for (; i + SRSRAN_SIMD_F_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_loadu(x + i);
-      simd_f_t b = srsran_simd_f_loadu(y + i);
-
-      simd_f_t r = srsran_simd_f_mul(a, b);
-
-      srsran_simd_f_storeu(z + i, r);
-    }
-  }
-#endif
-
-  for (; i != len; ++i) {
-    z[i] = x[i] * y[i];
-  }
-}
-
-static void prod_sss_simd(const int16_t* x, const int16_t* y, int16_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_S_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (; i + SRSRAN_SIMD_S_SIZE < len + 1; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_load(x + i);
-      simd_s_t b = srsran_simd_s_load(y + i);
-
-      simd_s_t r = srsran_simd_s_mul(a, b);
-
-      srsran_simd_s_store(z + i, r);
-    }
-  } else {
-    for (; i + SRSRAN_SIMD_S_SIZE < len + 1; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_loadu(x + i);
-      simd_s_t b = srsran_simd_s_loadu(y + i);
-
-      simd_s_t r = srsran_simd_s_mul(a, b);
-
-      srsran_simd_s_storeu(z + i, r);
-    }
-  }
-#endif
-
-  for (; i != len; ++i) {
-    z[i] = x[i] * y[i];
-  }
-}
+#include "simd_variant.h"
 
-static void prod_ccc_simd(const cf_t* x, const cf_t* y, cf_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_CF_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_CF_SIZE) * SRSRAN_SIMD_CF_SIZE; i != i_end; i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t a = srsran_simd_cfi_load(x + i);
-      simd_cf_t b = srsran_simd_cfi_load(y + i);
-
-      simd_cf_t r = srsran_simd_cf_prod(a, b);
-
-      srsran_simd_cfi_store(z + i, r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_CF_SIZE) * SRSRAN_SIMD_CF_SIZE; i != i_end; i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t a = srsran_simd_cfi_loadu(x + i);
-      simd_cf_t b = srsran_simd_cfi_loadu(y + i);
-
-      simd_cf_t r = srsran_simd_cf_prod(a, b);
-
-      srsran_simd_cfi_storeu(z + i, r);
-    }
-  }
-#endif
-
-  for (; i != len; ++i) {
-    z[i] = x[i] * y[i];
-  }
-}
-
-static void prod_conj_ccc_simd(const cf_t* x, const cf_t* y, cf_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_CF_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_CF_SIZE) * SRSRAN_SIMD_CF_SIZE; i != i_end; i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t a = srsran_simd_cfi_load(x + i);
-      simd_cf_t b = srsran_simd_cfi_load(y + i);
-
-      simd_cf_t r = srsran_simd_cf_conjprod(a, b);
-
-      srsran_simd_cfi_store(z + i, r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_CF_SIZE) * SRSRAN_SIMD_CF_SIZE; i != i_end; i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t a = srsran_simd_cfi_loadu(x + i);
-      simd_cf_t b = srsran_simd_cfi_loadu(y + i);
-
-      simd_cf_t r = srsran_simd_cf_conjprod(a, b);
-
-      srsran_simd_cfi_storeu(z + i, r);
-    }
-  }
-#endif
+using namespace srsran;
+using namespace srsvec;
 
-  for (; i != len; ++i) {
-    z[i] = x[i] * std::conj(y[i]);
-  }
-}
+#ifdef __x86_64__
+namespace srsran {
+namespace srsvec {
+namespace avx2 {
+void prod_fff_simd(const float* x, const float* y, float* z, std::size_t len);
+void prod_sss_simd(const int16_t* x, const int16_t* y, int16_t* z, std::size_t len);
+void prod_ccc_simd(const cf_t* x, const cf_t* y, cf_t* z, std::size_t len);
+void prod_conj_ccc_simd(const cf_t* x, const cf_t* y, cf_t* z, std::size_t len);
+} // namespace avx2
+namespace avx512 {
+void prod_fff_simd(const float* x, const float* y, float* z, std::size_t len);
+void prod_sss_simd(const int16_t* x, const int16_t* y, int16_t* z, std::size_t len);
+void prod_ccc_simd(const cf_t* x, const cf_t* y, cf_t* z, std::size_t len);
+void prod_conj_ccc_simd(const cf_t* x, const cf_t* y, cf_t* z, std::size_t len);
+} // namespace avx512
+} // namespace srsvec
+} // namespace srsran
+#endif // __x86_64__
+
+namespace {
+
+auto* const prod_fff      = SRSVEC_SELECT_SIMD_VARIANT(prod_fff_simd);
+auto* const prod_sss      = SRSVEC_SELECT_SIMD_VARIANT(prod_sss_simd);
+auto* const prod_ccc      = SRSVEC_SELECT_SIMD_VARIANT(prod_ccc_simd);
+auto* const prod_conj_ccc = SRSVEC_SELECT_SIMD_VARIANT(prod_conj_ccc_simd);
+
+} // namespace
 
 void srsran::srsvec::prod(span<const cf_t> x, span<const cf_t> y, span<cf_t> z)
 {
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  prod_ccc_simd(x.data(), y.data(), z.data(), x.size());
+  prod_ccc(x.data(), y.data(), z.data(), x.size());
 }
 
 void srsran::srsvec::prod(span<const float> x, span<const float> y, span<float> z)
@@ -164,7 +72,7 @@ void srsran::srsvec::prod(span<const float> x, span<const float> y, span<float>
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  prod_fff_simd(x.data(), y.data(), z.data(), x.size());
+  prod_fff(x.data(), y.data(), z.data(), x.size());
 }
 
 void srsran::srsvec::prod(span<const int16_t> x, span<const int16_t> y, span<int16_t> z)
@@ -172,7 +80,7 @@ void srsran::srsvec::prod(span<const int16_t> x, span<const int16_t> y, span<int
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  prod_sss_simd(x.data(), y.data(), z.data(), x.size());
+  prod_sss(x.data(), y.data(), z.data(), x.size());
 }
 
 void srsran::srsvec::prod_conj(span<const cf_t> x, span<const cf_t> y, span<cf_t> z)
@@ -180,5 +88,5 @@ void srsran::srsvec::prod_conj(span<const cf_t> x, span<const cf_t> y, span<cf_t
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  prod_conj_ccc_simd(x.data(), y.data(), z.data(), x.size());
+  prod_conj_ccc(x.data(), y.data(), z.data(), x.size());
 }
@@ -21,152 +21,75 @@
  */
 
 #include "srsran/srsvec/sc_prod.h"
-#include "srsran/srsvec/simd.h"
 
-using namespace srsran;
-using namespace srsvec;
-
-static void sc_prod_fff_simd(const float* x, float h, float* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_F_SIZE
-  simd_f_t b = srsran_simd_f_set1(h);
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(z)) {
-    for (unsigned i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_load(x + i);
-
-      simd_f_t r = srsran_simd_f_mul(a, b);
-
-      srsran_simd_f_store(z + i, r);
-    }
-  } else {
-    for (unsigned i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_loadu(x + i);
-
-      simd_f_t r = srsran_simd_f_mul(a, b);
-
-      srsran_simd_f_storeu(z + i, r);
-    }
-  }
-#endif
+#define SRSVEC_SIMD_VARIANT baseline
+#include "sc_prod_impl.h"
+#undef SRSVEC_SIMD_VARIANT
 
-  for (; i != len; ++i) {
-    z[i] = x[i] * h;
-  }
-}
-
-static void sc_prod_ccc_simd(const cf_t* x, cf_t h, cf_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_CF_SIZE
-  simd_cf_t b = srsran_simd_cf_set1(h);
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(z)) {
-    for (; i + SRSRAN_SIMD_CF_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
-      simd_cf_t a = srsran_simd_cfi_load(x + i);
-
-      simd_cf_t r = srsran_simd_cf_prod(a, b);
+#include "simd_variant.h"
 
-      srsran_simd_cfi_store(z + i, r);
-    }
-  } else {
-    for (; i + SRSRAN_SIMD_CF_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
-      simd_cf_t a = srsran_simd_cfi_loadu(x + i);
-
-      simd_cf_t r = srsran_simd_cf_prod(a, b);
-
-      srsran_simd_cfi_storeu(z + i, r);
-    }
-  }
-#endif
-
-  for (; i != len; ++i) {
-    z[i] = x[i] * h;
-  }
-}
-
-static void sc_prod_ccc_simd(const cbf16_t* x, cf_t h, cbf16_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_CF_SIZE
-  simd_cf_t b = srsran_simd_cf_set1(h);
-  for (; i + SRSRAN_SIMD_CF_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
-    simd_cf_t a = srsran_simd_cbf16_loadu(x + i);
-
-    simd_cf_t r = srsran_simd_cf_prod(a, b);
-
-    srsran_simd_cbf16_storeu(z + i, r);
-  }
-#endif
-
-  for (; i != len; ++i) {
-    z[i] = to_cbf16(to_cf(x[i]) * h);
-  }
-}
-
-static void sc_prod_sss_simd(const int16_t* x, int16_t h, int16_t* z, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_S_SIZE
-  simd_s_t b = srsran_simd_s_set1(h);
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(z)) {
-    for (unsigned i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_load(x + i);
-
-      simd_s_t r = srsran_simd_s_mul(a, b);
-
-      srsran_simd_s_store(z + i, r);
-    }
-  } else {
-    for (unsigned i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_loadu(x + i);
-
-      simd_s_t r = srsran_simd_s_mul(a, b);
-
-      srsran_simd_s_storeu(z + i, r);
-    }
-  }
-#endif
+using namespace srsran;
+using namespace srsvec;
 
-  for (; i != len; ++i) {
-    z[i] = x[i] * h;
-  }
-}
+#ifdef __x86_64__
+namespace srsran {
+namespace srsvec {
+namespace avx2 {
+void sc_prod_fff_simd(const float* x, float h, float* z, std::size_t len);
+void sc_prod_ccc_simd(const cf_t* x, cf_t h, cf_t* z, std::size_t len);
+void sc_prod_cbc_simd(const cbf16_t* x, cf_t h, cbf16_t* z, std::size_t len);
+void sc_prod_sss_simd(const int16_t* x, int16_t h, int16_t* z, std::size_t len);
+} // namespace avx2
+namespace avx512 {
+void sc_prod_fff_simd(const float* x, float h, float* z, std::size_t len);
+void sc_prod_ccc_simd(const cf_t* x, cf_t h, cf_t* z, std::size_t len);
+void sc_prod_cbc_simd(const cbf16_t* x, cf_t h, cbf16_t* z, std::size_t len);
+void sc_prod_sss_simd(const int16_t* x, int16_t h, int16_t* z, std::size_t len);
+} // namespace avx512
+} // namespace srsvec
+} // namespace srsran
+#endif // __x86_64__
+
+namespace {
+
+auto* const sc_prod_fff = SRSVEC_SELECT_SIMD_VARIANT(sc_prod_fff_simd);
+auto* const sc_prod_ccc = SRSVEC_SELECT_SIMD_VARIANT(sc_prod_ccc_simd);
+auto* const sc_prod_cbc = SRSVEC_SELECT_SIMD_VARIANT(sc_prod_cbc_simd);
+auto* const sc_prod_sss = SRSVEC_SELECT_SIMD_VARIANT(sc_prod_sss_simd);
+
+} // namespace
 
 void srsran::srsvec::sc_prod(span<const cf_t> x, cf_t h, span<cf_t> z)
 {
   srsran_srsvec_assert_size(x, z);
 
-  sc_prod_ccc_simd(x.data(), h, z.data(), x.size());
+  sc_prod_ccc(x.data(), h, z.data(), x.size());
 }
 
 void srsran::srsvec::sc_prod(span<const cf_t> x, float h, span<cf_t> z)
 {
   srsran_srsvec_assert_size(x, z);
 
-  sc_prod_fff_simd(reinterpret_cast<const float*>(x.data()), h, reinterpret_cast<float*>(z.data()), 2 * x.size());
+  sc_prod_fff(reinterpret_cast<const float*>(x.data()), h, reinterpret_cast<float*>(z.data()), 2 * x.size());
 }
 
 void srsran::srsvec::sc_prod(span<const float> x, float h, span<float> z)
 {
   srsran_srsvec_assert_size(x, z);
 
-  sc_prod_fff_simd(x.data(), h, z.data(), x.size());
+  sc_prod_fff(x.data(), h, z.data(), x.size());
 }
 
 void srsran::srsvec::sc_prod(span<const cbf16_t> x, cf_t h, span<cbf16_t> z)
 {
   srsran_srsvec_assert_size(x, z);
 
-  sc_prod_ccc_simd(x.data(), h, z.data(), x.size());
+  sc_prod_cbc(x.data(), h, z.data(), x.size());
 }
 
 void srsran::srsvec::sc_prod(span<const int16_t> x, int16_t h, span<int16_t> z)
 {
   srsran_srsvec_assert_size(x, z);
 
-  sc_prod_sss_simd(x.data(), h, z.data(), x.size());
+  sc_prod_sss(x.data(), h, z.data(), x.size());
 }
@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief Scalar product kernels, compiled once per instruction-set variant.
+///
+/// Included by one translation unit per instruction set, each defining \c SRSVEC_SIMD_VARIANT to the namespace that
+/// identifies the variant (see simd_variant.h).
+
+#pragma once
+
+#include "srsran/srsvec/sc_prod.h"
+#include "srsran/srsvec/simd.h"
+
+namespace srsran {
+namespace srsvec {
+namespace SRSVEC_SIMD_VARIANT {
+
+void sc_prod_fff_simd(const float* x, float h, float* z, std::size_t len)
+{
+  std::size_t i = 0;
+
+#if SRSRAN_SIMD_F_SIZE
+  simd_f_t b = srsran_simd_f_set1(h);
+  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(z)) {
+    for (unsigned i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
+      simd_f_t a = srsran_simd_f_load(x + i);
+
+      simd_f_t r = srsran_simd_f_mul(a, b);
+
+      srsran_simd_f_store(z + i, r);
+    }
+  } else {
+    for (unsigned i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
+      simd_f_t a = srsran_simd_f_loadu(x + i);
+
+      simd_f_t r = srsran_simd_f_mul(a, b);
+
+      srsran_simd_f_storeu(z + i, r);
+    }
+  }
+#endif
+
+  for (; i != len; ++i) {
+    z[i] = x[i] * h;
+  }
+}
+
+void sc_prod_ccc_simd(const cf_t* x, cf_t h, cf_t* z, std::size_t len)
+{
+  std::size_t i = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  simd_cf_t b = srsran_simd_cf_set1(h);
+  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(z)) {
+    for (; i + SRSRAN_SIMD_CF_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
+      simd_cf_t a = srsran_simd_cfi_load(x + i);
+
+      simd_cf_t r = srsran_simd_cf_prod(a, b);
+
+      srsran_simd_cfi_store(z + i, r);
+    }
+  } else {
+    for (; i + SRSRAN_SIMD_CF_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
+      simd_cf_t a = srsran_simd_cfi_loadu(x + i);
+
+      simd_cf_t r = srsran_simd_cf_prod(a, b);
+
+      srsran_simd_cfi_storeu(z + i, r);
+    }
+  }
+#endif
+
+  for (; i != len; ++i) {
+    z[i] = x[i] * h;
+  }
+}
+
+void sc_prod_cbc_simd(const cbf16_t* x, cf_t h, cbf16_t* z, std::size_t len)
+{
+  std::size_t i = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  simd_cf_t b = srsran_simd_cf_set1(h);
+  for (; i + SRSRAN_SIMD_CF_SIZE < len + 1; i += SRSRAN_SIMD_F_SIZE) {
+    simd_cf_t a = srsran_simd_cbf16_loadu(x + i);
+
+    simd_cf_t r = srsran_simd_cf_prod(a, b);
+
+    srsran_simd_cbf16_storeu(z + i, r);
+  }
+#endif
+
+  for (; i != len; ++i) {
+    z[i] = to_cbf16(to_cf(x[i]) * h);
+  }
+}
+
+void sc_prod_sss_simd(const int16_t* x, int16_t h, int16_t* z, std::size_t len)
+{
+  std::size_t i = 0;
+
+#if SRSRAN_SIMD_S_SIZE
+  simd_s_t b = srsran_simd_s_set1(h);
+  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(z)) {
+    for (unsigned i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
+      simd_s_t a = srsran_simd_s_load(x + i);
+
+      simd_s_t r = srsran_simd_s_mul(a, b);
+
+      srsran_simd_s_store(z + i, r);
+    }
+  } else {
+    for (unsigned i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
+      simd_s_t a = srsran_simd_s_loadu(x + i);
+
+      simd_s_t r = srsran_simd_s_mul(a, b);
+
+      srsran_simd_s_storeu(z + i, r);
+    }
+  }
+#endif
+
+  for (; i != len; ++i) {
+    z[i] = x[i] * h;
+  }
+}
+
+} // namespace SRSVEC_SIMD_VARIANT
+} // namespace srsvec
+} // namespace srsran
@@ -0,0 +1,95 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief Runtime selection of ISA-specific vector kernel variants.
+///
+/// Kernels written on top of the \c srsran/srsvec/simd.h abstraction layer are compiled once per instruction set: the
+/// shared kernel bodies live in a <tt>*_impl.h</tt> file that is included by the baseline translation unit and by the
+/// AVX2/AVX512 translation units, each defining \c SRSVEC_SIMD_VARIANT to a distinct namespace. On x86-64 the
+/// dispatching translation unit picks, once at start-up, the widest variant that both improves on the compile-time
+/// baseline and is supported by the CPU the process runs on. On other architectures, and when the baseline is already
+/// compiled with the widest instruction set (e.g., <tt>-march=native</tt> builds), the selection collapses to a direct
+/// call into the baseline kernel.
+
+#pragma once
+
+#include "srsran/support/cpu_features.h"
+
+namespace srsran {
+namespace srsvec {
+namespace detail {
+
+#ifdef __x86_64__
+
+/// Returns true if the CPU supports executing the AVX2-compiled kernel variants.
+inline bool cpu_supports_avx2_variants()
+{
+  static const bool supported = cpu_supports_feature(cpu_feature::avx2) && cpu_supports_feature(cpu_feature::fma);
+  return supported;
+}
+
+/// Returns true if the CPU supports executing the AVX512-compiled kernel variants.
+inline bool cpu_supports_avx512_variants()
+{
+  static const bool supported = cpu_supports_feature(cpu_feature::avx512f) &&
+                                cpu_supports_feature(cpu_feature::avx512bw) &&
+                                cpu_supports_feature(cpu_feature::avx512vl) &&
+                                cpu_supports_feature(cpu_feature::avx512cd) &&
+                                cpu_supports_feature(cpu_feature::avx512dq);
+  return supported;
+}
+
+/// \brief Selects the widest kernel variant that improves on the compile-time baseline and runs on this CPU.
+///
+/// Variants that the baseline translation unit already includes (detected through the compiler ISA macros) are
+/// discarded at compile time, so a build targeting the native ISA keeps calling the baseline kernels directly.
+template <typename Func>
+Func* select_simd_variant(Func* baseline_func, Func* avx2_func, Func* avx512_func)
+{
+#ifndef __AVX512F__
+  if (cpu_supports_avx512_variants()) {
+    return avx512_func;
+  }
+#endif // __AVX512F__
+#ifndef __AVX2__
+  if (cpu_supports_avx2_variants()) {
+    return avx2_func;
+  }
+#endif // __AVX2__
+  return baseline_func;
+}
+
+/// Expands to the address of the best available variant of the given kernel.
+#define SRSVEC_SELECT_SIMD_VARIANT(kernel)                                                                             \
+  ::srsran::srsvec::detail::select_simd_variant(&baseline::kernel, &avx2::kernel, &avx512::kernel)
+
+#else // __x86_64__
+
+/// Only the baseline kernels are compiled on non-x86 architectures.
+#define SRSVEC_SELECT_SIMD_VARIANT(kernel) (&baseline::kernel)
+
+#endif // __x86_64__
+
+} // namespace detail
+} // namespace srsvec
+} // namespace srsran
@@ -0,0 +1,38 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief AVX2 instantiation of the vector kernels that are compiled once per instruction set.
+///
+/// This translation unit is compiled with the AVX2 flags (see CMakeLists.txt) so that the kernels written on top of
+/// the \c srsran/srsvec/simd.h abstraction layer pick up the AVX2 code paths regardless of the baseline instruction
+/// set of the build. The resulting symbols are selected at runtime by the dispatching translation units (see
+/// simd_variant.h).
+
+#define SRSVEC_SIMD_VARIANT avx2
+
+#include "add_impl.h"
+#include "dot_prod_impl.h"
+#include "modulus_square_impl.h"
+#include "prod_impl.h"
+#include "sc_prod_impl.h"
+#include "subtract_impl.h"
@@ -21,113 +21,50 @@
  */
 
 #include "srsran/srsvec/subtract.h"
-#include "srsran/srsvec/simd.h"
 
-using namespace srsran;
-using namespace srsvec;
-
-static void subtract_fff_simd(float* z, const float* x, const float* y, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_F_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_load(&x[i]);
-      simd_f_t b = srsran_simd_f_load(&y[i]);
-
-      simd_f_t r = srsran_simd_f_sub(a, b);
-
-      srsran_simd_f_store(&z[i], r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE; i != i_end; i += SRSRAN_SIMD_F_SIZE) {
-      simd_f_t a = srsran_simd_f_loadu(&x[i]);
-      simd_f_t b = srsran_simd_f_loadu(&y[i]);
-
-      simd_f_t r = srsran_simd_f_sub(a, b);
-
-      srsran_simd_f_storeu(&z[i], r);
-    }
-  }
-#endif
-
-  for (; i != len; ++i) {
-    z[i] = x[i] - y[i];
-  }
-}
-
-static void subtract_sss_simd(int16_t* z, const int16_t* x, const int16_t* y, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_S_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_load(&x[i]);
-      simd_s_t b = srsran_simd_s_load(&y[i]);
+#define SRSVEC_SIMD_VARIANT baseline
+#include "subtract_impl.h"
+#undef SRSVEC_SIMD_VARIANT
 
-      simd_s_t r = srsran_simd_s_sub(a, b);
+#include "simd_variant.h"
 
-      srsran_simd_s_store(&z[i], r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_S_SIZE) * SRSRAN_SIMD_S_SIZE; i != i_end; i += SRSRAN_SIMD_S_SIZE) {
-      simd_s_t a = srsran_simd_s_loadu(&x[i]);
-      simd_s_t b = srsran_simd_s_loadu(&y[i]);
-
-      simd_s_t r = srsran_simd_s_sub(a, b);
-
-      srsran_simd_s_storeu(&z[i], r);
-    }
-  }
-#endif /* SRSRAN_SIMD_S_SIZE */
-
-  for (; i != len; ++i) {
-    z[i] = x[i] - y[i];
-  }
-}
-
-static void subtract_bbb_simd(int8_t* z, const int8_t* x, const int8_t* y, std::size_t len)
-{
-  std::size_t i = 0;
-
-#if SRSRAN_SIMD_S_SIZE
-  if (SIMD_IS_ALIGNED(x) && SIMD_IS_ALIGNED(y) && SIMD_IS_ALIGNED(z)) {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_B_SIZE) * SRSRAN_SIMD_B_SIZE; i != i_end; i += SRSRAN_SIMD_B_SIZE) {
-      simd_b_t a = srsran_simd_b_load(&x[i]);
-      simd_b_t b = srsran_simd_b_load(&y[i]);
-
-      simd_b_t r = srsran_simd_b_sub(a, b);
-
-      srsran_simd_b_store(&z[i], r);
-    }
-  } else {
-    for (std::size_t i_end = (len / SRSRAN_SIMD_B_SIZE) * SRSRAN_SIMD_B_SIZE; i != i_end; i += SRSRAN_SIMD_B_SIZE) {
-      simd_b_t a = srsran_simd_b_loadu(&x[i]);
-      simd_b_t b = srsran_simd_b_loadu(&y[i]);
-
-      simd_b_t r = srsran_simd_b_sub(a, b);
-
-      srsran_simd_b_storeu(&z[i], r);
-    }
-  }
-#endif /* SRSRAN_SIMD_S_SIZE */
+using namespace srsran;
+using namespace srsvec;
 
-  for (; i != len; ++i) {
-    z[i] = x[i] - y[i];
-  }
-}
+#ifdef __x86_64__
+namespace srsran {
+namespace srsvec {
+namespace avx2 {
+void subtract_fff_simd(float* z, const float* x, const float* y, std::size_t len);
+void subtract_sss_simd(int16_t* z, const int16_t* x, const int16_t* y, std::size_t len);
+void subtract_bbb_simd(int8_t* z, const int8_t* x, const int8_t* y, std::size_t len);
+} // namespace avx2
+namespace avx512 {
+void subtract_fff_simd(float* z, const float* x, const float* y, std::size_t len);
+void subtract_sss_simd(int16_t* z, const int16_t* x, const int16_t* y, std::size_t len);
+void subtract_bbb_simd(int8_t* z, const int8_t* x, const int8_t* y, std::size_t len);
+} // namespace avx512
+} // namespace srsvec
+} // namespace srsran
+#endif // __x86_64__
+
+namespace {
+
+auto* const subtract_fff = SRSVEC_SELECT_SIMD_VARIANT(subtract_fff_simd);
+auto* const subtract_sss = SRSVEC_SELECT_SIMD_VARIANT(subtract_sss_simd);
+auto* const subtract_bbb = SRSVEC_SELECT_SIMD_VARIANT(subtract_bbb_simd);
+
+} // namespace
 
 void srsran::srsvec::subtract(span<cf_t> z, span<const cf_t> x, span<const cf_t> y)
 {
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  subtract_fff_simd(reinterpret_cast<float*>(z.data()),
-                    reinterpret_cast<const float*>(x.data()),
-                    reinterpret_cast<const float*>(y.data()),
-                    2 * z.size());
+  subtract_fff(reinterpret_cast<float*>(z.data()),
+               reinterpret_cast<const float*>(x.data()),
+               reinterpret_cast<const float*>(y.data()),
+               2 * z.size());
 }
 
 void srsran::srsvec::subtract(span<float> z, span<const float> x, span<const float> y)
@@ -135,7 +72,7 @@ void srsran::srsvec::subtract(span<float> z, span<const float> x, span<const flo
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  subtract_fff_simd(z.data(), x.data(), y.data(), z.size());
+  subtract_fff(z.data(), x.data(), y.data(), z.size());
 }
 
 void srsran::srsvec::subtract(span<int16_t> z, span<const int16_t> x, span<const int16_t> y)
@@ -143,7 +80,7 @@ void srsran::srsvec::subtract(span<int16_t> z, span<const int16_t> x, span<const
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  subtract_sss_simd(z.data(), x.data(), y.data(), z.size());
+  subtract_sss(z.data(), x.data(), y.data(), z.size());
 }
 
 void srsran::srsvec::subtract(span<int8_t> z, span<const int8_t> x, span<const int8_t> y)
@@ -151,5 +88,5 @@ void srsran::srsvec::subtract(span<int8_t> z, span<const int8_t> x, span<const i
   srsran_srsvec_assert_size(x, y);
   srsran_srsvec_assert_size(x, z);
 
-  subtract_bbb_simd(z.data(), x.data(), y.data(), z.size());
+  subtract_bbb(z.data(), x.data(), y.data(), z.size());
 }
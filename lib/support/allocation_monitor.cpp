@@ -0,0 +1,159 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/support/allocation_monitor.h"
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#ifdef SRSRAN_ALLOC_MONITOR_HOOKS
+#include <execinfo.h>
+#endif // SRSRAN_ALLOC_MONITOR_HOOKS
+
+using namespace srsran;
+
+/// Number of slots of the event ring. Must be a power of two.
+static constexpr unsigned alloc_event_ring_size = 1024;
+
+/// Nesting level of allocation-forbidden marks of the current thread.
+static thread_local unsigned forbid_alloc_depth = 0;
+
+/// Ring of recorded events and, per slot, the sequence number (plus one) of the event it holds. Writers reserve a
+/// slot with an atomic increment of \c alloc_event_write_count and publish it by storing the sequence number, so the
+/// recording path never takes a lock.
+static std::array<forbidden_alloc_event, alloc_event_ring_size>  alloc_event_ring;
+static std::array<std::atomic<uint64_t>, alloc_event_ring_size>  alloc_event_seq{};
+static std::atomic<uint64_t>                                     alloc_event_write_count{0};
+static std::atomic<uint64_t>                                     alloc_event_total_count{0};
+
+/// Reader cursor, protected against concurrent readers.
+static std::mutex alloc_event_read_mutex;
+static uint64_t   alloc_event_read_count = 0;
+
+void srsran::mark_this_thread_allocations_forbidden()
+{
+  ++forbid_alloc_depth;
+}
+
+void srsran::mark_this_thread_allocations_allowed()
+{
+  if (forbid_alloc_depth != 0) {
+    --forbid_alloc_depth;
+  }
+}
+
+uint64_t srsran::get_nof_forbidden_alloc_events()
+{
+  return alloc_event_total_count.load(std::memory_order_relaxed);
+}
+
+unsigned srsran::pop_forbidden_alloc_events(span<forbidden_alloc_event> out)
+{
+  std::lock_guard<std::mutex> lock(alloc_event_read_mutex);
+
+  uint64_t write_count = alloc_event_write_count.load(std::memory_order_acquire);
+
+  // Skip events that were already overwritten.
+  if (write_count > alloc_event_read_count + alloc_event_ring_size) {
+    alloc_event_read_count = write_count - alloc_event_ring_size;
+  }
+
+  unsigned count = 0;
+  while (count != out.size() && alloc_event_read_count != write_count) {
+    unsigned slot = alloc_event_read_count % alloc_event_ring_size;
+    if (alloc_event_seq[slot].load(std::memory_order_acquire) != alloc_event_read_count + 1) {
+      // The event is not published yet.
+      break;
+    }
+    out[count] = alloc_event_ring[slot];
+    // Discard the copy if the slot was overwritten while reading it.
+    if (alloc_event_seq[slot].load(std::memory_order_acquire) == alloc_event_read_count + 1) {
+      ++count;
+    }
+    ++alloc_event_read_count;
+  }
+  return count;
+}
+
+#ifdef SRSRAN_ALLOC_MONITOR_HOOKS
+
+/// Flag avoiding recursion when the recording path itself allocates (e.g. the first backtrace() call loads libgcc).
+static thread_local bool in_alloc_hook = false;
+
+static void record_forbidden_alloc(std::size_t size)
+{
+  alloc_event_total_count.fetch_add(1, std::memory_order_relaxed);
+
+  uint64_t               idx  = alloc_event_write_count.fetch_add(1, std::memory_order_relaxed);
+  unsigned               slot = idx % alloc_event_ring_size;
+  forbidden_alloc_event& ev   = alloc_event_ring[slot];
+
+  ev.size       = size;
+  int nof_frames = ::backtrace(ev.frames.data(), forbidden_alloc_event_max_frames);
+  ev.nof_frames  = nof_frames > 0 ? static_cast<unsigned>(nof_frames) : 0;
+
+  alloc_event_seq[slot].store(idx + 1, std::memory_order_release);
+}
+
+static void* monitored_alloc(std::size_t size)
+{
+  if (forbid_alloc_depth != 0 && !in_alloc_hook) {
+    in_alloc_hook = true;
+    record_forbidden_alloc(size);
+    in_alloc_hook = false;
+  }
+  // Mimic the default operator new, which never returns nullptr for zero-sized requests.
+  return std::malloc(size != 0 ? size : 1);
+}
+
+// Global operator new overrides. The matching operator delete is not overridden: the default implementation releases
+// with free(), which matches the malloc() used here.
+
+void* operator new(std::size_t size)
+{
+  void* mem = monitored_alloc(size);
+  if (mem == nullptr) {
+    throw std::bad_alloc();
+  }
+  return mem;
+}
+
+void* operator new[](std::size_t size)
+{
+  void* mem = monitored_alloc(size);
+  if (mem == nullptr) {
+    throw std::bad_alloc();
+  }
+  return mem;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return monitored_alloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return monitored_alloc(size);
+}
+
+#endif // SRSRAN_ALLOC_MONITOR_HOOKS
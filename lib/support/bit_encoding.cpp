@@ -22,44 +22,90 @@
 
 #include "srsran/support/bit_encoding.h"
 #include "srsran/support/math_utils.h"
+#include <array>
 
 using namespace srsran;
 
+namespace {
+
+/// \brief Appends a range of bytes to a writer whose last byte is partially packed.
+///
+/// Consecutive input bytes are combined into whole output bytes and appended in bulk chunks, instead of packing the
+/// input bit by bit. The writer bit offset is unchanged, as whole bytes are appended.
+template <typename ByteRange>
+bool pack_bytes_unaligned(byte_buffer_writer& writer, uint32_t offset, const ByteRange& bytes)
+{
+  const uint32_t          rem = 8U - offset;
+  std::array<uint8_t, 64> chunk;
+  uint32_t                chunk_len = 0;
+  uint8_t                 prev      = 0;
+  bool                    first     = true;
+
+  for (uint8_t byte : bytes) {
+    if (first) {
+      // The first input byte fills the remainder of the current partially packed byte.
+      writer.back() += static_cast<uint8_t>(byte >> offset);
+      first = false;
+    } else {
+      chunk[chunk_len++] = static_cast<uint8_t>(prev << rem) | static_cast<uint8_t>(byte >> offset);
+      if (chunk_len == chunk.size()) {
+        if (not writer.append(span<const uint8_t>(chunk.data(), chunk_len))) {
+          return false;
+        }
+        chunk_len = 0;
+      }
+    }
+    prev = byte;
+  }
+
+  // Append the trailing partially packed byte holding the last offset bits.
+  chunk[chunk_len++] = static_cast<uint8_t>(prev << rem);
+  return writer.append(span<const uint8_t>(chunk.data(), chunk_len));
+}
+
+} // namespace
+
 bool bit_encoder::pack(uint64_t val, uint32_t n_bits)
 {
   srsran_assert(n_bits <= 64U, "Invalid number of bits={} passed to pack()", n_bits);
 
-  while (n_bits > 0U) {
-    if (offset == 0U) {
-      if (not writer.append(0U)) {
-        return false;
-      }
-    }
+  if (n_bits == 0U) {
+    return true;
+  }
 
-    // Apply mask if required.
-    if (n_bits < 64U) {
-      // Bitmap of n_bits ones. (UB if n_bits == 64).
-      uint64_t mask = (1UL << n_bits) - 1UL;
-      val           = val & mask;
-    }
+  // Apply mask if required.
+  if (n_bits < 64U) {
+    // Bitmap of n_bits ones. (UB if n_bits == 64).
+    uint64_t mask = (1UL << n_bits) - 1UL;
+    val           = val & mask;
+  }
 
-    // In case n_bits < number of bits left in current byte (ie, last iteration).
-    if (static_cast<uint32_t>(8U - offset) > n_bits) {
-      auto shifted_val = static_cast<uint8_t>(val << (8U - offset - n_bits));
-      writer.back() += shifted_val;
+  // Fill the remainder of the current partially packed byte.
+  if (offset != 0U) {
+    uint32_t space = 8U - offset;
+    if (n_bits < space) {
+      writer.back() += static_cast<uint8_t>(val << (space - n_bits));
       offset += n_bits;
-      n_bits = 0U;
-      continue;
+      return true;
     }
-
-    // In case, space in current byte is lower or equal to n_bits (ie, not the last iteration).
-    auto shifted_val = static_cast<uint8_t>(val >> (n_bits - 8U + offset));
-    writer.back() += shifted_val;
-    n_bits -= 8U - offset;
+    writer.back() += static_cast<uint8_t>(val >> (n_bits - space));
+    n_bits -= space;
     offset = 0U;
+    if (n_bits == 0U) {
+      return true;
+    }
   }
 
-  return true;
+  // Pack the remaining bits, most significant first, with a single bulk append instead of one append per byte.
+  std::array<uint8_t, 8> bytes;
+  uint32_t               nof_bytes = divide_ceil(n_bits, 8U);
+  for (uint32_t i = 0; i != nof_bytes; ++i) {
+    uint32_t rem_bits = n_bits - 8U * i;
+    bytes[i]          = (rem_bits >= 8U) ? static_cast<uint8_t>(val >> (rem_bits - 8U))
+                                         : static_cast<uint8_t>(val << (8U - rem_bits));
+  }
+  offset = n_bits % 8U;
+  return writer.append(span<const uint8_t>(bytes.data(), nof_bytes));
 }
 
 bool bit_encoder::pack_bytes(span<const uint8_t> bytes)
@@ -73,7 +119,7 @@ bool bit_encoder::pack_bytes(span<const uint8_t> bytes)
     return writer.append(bytes);
   }
 
-  return std::all_of(bytes.begin(), bytes.end(), [this](auto byte) { return pack(byte, 8U); });
+  return pack_bytes_unaligned(writer, offset, bytes);
 }
 
 bool bit_encoder::pack_bytes(byte_buffer_view bytes)
@@ -87,7 +133,7 @@ bool bit_encoder::pack_bytes(byte_buffer_view bytes)
     return writer.append(bytes);
   }
 
-  return std::all_of(bytes.begin(), bytes.end(), [this](auto byte) { return pack(byte, 8U); });
+  return pack_bytes_unaligned(writer, offset, bytes);
 }
 
 bool bit_decoder::advance_bits(uint32_t n_bits)
@@ -24,6 +24,8 @@
 #include "srsran/adt/detail/byte_buffer_segment_pool.h"
 #include "srsran/srslog/srslog.h"
 #include "srsran/support/memory_pool/linear_memory_allocator.h"
+#include <atomic>
+#include <chrono>
 
 using namespace srsran;
 
@@ -589,8 +591,25 @@ bool byte_buffer::resize(size_t new_sz)
 
 void byte_buffer::warn_alloc_failure()
 {
+  using namespace std::chrono;
   static srslog::basic_logger& logger = srslog::fetch_basic_logger("ALL");
-  logger.warning("POOL: Failure to allocate byte buffer segment");
+
+  // Limit the rate of pool exhaustion warnings. A sustained traffic burst fails many allocations in a row and would
+  // otherwise flood the log.
+  static constexpr steady_clock::duration min_warn_period = seconds(1);
+  static std::atomic<steady_clock::rep>   last_warn_tp{0};
+
+  steady_clock::rep now  = steady_clock::now().time_since_epoch().count();
+  steady_clock::rep last = last_warn_tp.load(std::memory_order_relaxed);
+  if ((now - last < min_warn_period.count()) or
+      not last_warn_tp.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+    return;
+  }
+
+  logger.warning("POOL: Failure to allocate byte buffer segment. There are {} of {} segments available in the caches "
+                 "visible to this thread.",
+                 get_byte_buffer_segment_pool_current_size_approx(),
+                 get_byte_buffer_segment_pool_capacity());
 }
 
 expected<byte_buffer> srsran::make_byte_buffer(const std::string& hex_str)
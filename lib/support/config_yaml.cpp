@@ -37,8 +37,10 @@ public:
   std::vector<CLI::ConfigItem> from_config(std::istream& input) const override;
 
 private:
-  std::vector<CLI::ConfigItem> from_config_impl(const YAML::Node&               config,
-                                                const std::vector<std::string>& prefix = {}) const;
+  /// Appends the items of the given YAML node to \c results, to avoid copying sub-results at every nesting level.
+  void from_config_impl(const YAML::Node&               config,
+                        std::vector<CLI::ConfigItem>&   results,
+                        const std::vector<std::string>& prefix = {}) const;
 };
 
 } // namespace
@@ -114,14 +116,15 @@ std::vector<CLI::ConfigItem> yaml_config_parser::from_config(std::istream& input
     throw CLI::FileError(std::string("Error parsing YAML configuration file: ") + ex.what());
   }
 
-  return from_config_impl(config);
+  std::vector<CLI::ConfigItem> results;
+  from_config_impl(config, results);
+  return results;
 }
 
-std::vector<CLI::ConfigItem> yaml_config_parser::from_config_impl(const YAML::Node&               config,
-                                                                  const std::vector<std::string>& prefix) const
+void yaml_config_parser::from_config_impl(const YAML::Node&               config,
+                                          std::vector<CLI::ConfigItem>&   results,
+                                          const std::vector<std::string>& prefix) const
 {
-  std::vector<CLI::ConfigItem> results;
-
   // Opening ConfigItem that enables subcommand callbacks.
   // This block inserts an especial ConfigItem in CLI that enables the subcommand to execute callbacks (preparse, parse
   // and finish CLI callbacks). It is done by surrounding the subcommand with an ConfigItem with name '++' before the
@@ -152,8 +155,7 @@ std::vector<CLI::ConfigItem> yaml_config_parser::from_config_impl(const YAML::No
       auto copy_prefix = prefix;
       copy_prefix.push_back(key_name);
 
-      auto sub_results = from_config_impl(value, copy_prefix);
-      results.insert(results.end(), sub_results.begin(), sub_results.end());
+      from_config_impl(value, results, copy_prefix);
       continue;
     }
     // Sequences are stored as a vector of strings.
@@ -176,8 +178,6 @@ std::vector<CLI::ConfigItem> yaml_config_parser::from_config_impl(const YAML::No
     res.parents          = prefix;
     res.inputs           = {};
   }
-
-  return results;
 }
 
 std::unique_ptr<CLI::Config> srsran::create_yaml_config_parser()
@@ -58,6 +58,73 @@ static interval<unsigned, true> parse_cpu_range(const std::string& value)
   return {range[0], range[1]};
 }
 
+/// \brief Reads the CPU list files "/sys/devices/system/cpu/cpu*/<subpath>", deduplicates them and converts each
+/// distinct list into a bitmask of CPUs.
+///
+/// The resulting masks are sorted by the index of their first CPU.
+static std::vector<bounded_bitset<1024>> parse_cpu_sibling_lists(const std::string& subpath)
+{
+  auto sort_function = [](const std::string& a, const std::string& b) {
+    auto get_first_cpu = [](const std::string& line) {
+      std::string        str;
+      std::istringstream iss(line);
+      std::getline(iss, str, ',');
+      if (str.find('-') != std::string::npos) {
+        std::getline(iss, str, '-');
+      }
+      return parse_one_cpu(str);
+    };
+    unsigned cpu_id_a = get_first_cpu(a);
+    unsigned cpu_id_b = get_first_cpu(b);
+    return cpu_id_a < cpu_id_b;
+  };
+  std::set<std::string, decltype(sort_function)> cpu_lists_set(sort_function);
+  std::string                                    cpu_system_path = "/sys/devices/system/cpu";
+  ::DIR*                                         dir             = ::opendir(cpu_system_path.c_str());
+  if (dir) {
+    ::dirent*     entry;
+    struct ::stat info;
+
+    while ((entry = ::readdir(dir))) {
+      const std::regex re("^cpu[0-9]+");
+      std::string      cpu_name = entry->d_name;
+      if (!std::regex_match(cpu_name, re)) {
+        continue;
+      }
+      std::string cpu_list_path = fmt::format("{}/{}/{}", cpu_system_path, cpu_name, subpath);
+      if (::stat(cpu_list_path.c_str(), &info) < 0) {
+        continue;
+      }
+      std::ifstream file(cpu_list_path);
+      std::string   str_mask;
+      std::getline(file, str_mask);
+      cpu_lists_set.insert(str_mask);
+    }
+    ::closedir(dir);
+  }
+
+  std::vector<bounded_bitset<1024>> cpu_lists;
+  for (const auto& mask : cpu_lists_set) {
+    cpu_lists.emplace_back();
+    auto& bitmask = cpu_lists.back();
+    bitmask.resize(CPU_SETSIZE);
+
+    std::istringstream iss(mask);
+    while (iss.good()) {
+      std::string str;
+      std::getline(iss, str, ',');
+      if (str.find('-') != std::string::npos) {
+        auto range = parse_cpu_range(str);
+        bitmask.fill(range.start(), range.stop() + 1);
+      } else {
+        auto cpu_idx = parse_one_cpu(str);
+        bitmask.set(cpu_idx);
+      }
+    }
+  }
+  return cpu_lists;
+}
+
 /// Obtain CPU description at the start of the application. This value is affected by commands or tools like taskset,
 /// which limit the number of cores available to the application. However, frameworks (e.g. DPDK) that affect the
 /// affinities of the main thread in the main() function will not affect this value.
@@ -120,62 +187,12 @@ cpu_architecture_info::cpu_description cpu_architecture_info::discover_cpu_archi
 
   // Parse /sys/devices/system/cpu/cpu*/topology/thread_siblings_list to get the lists of logical cores belonging to
   // the same physical core.
-  auto sort_function = [](const std::string& a, const std::string& b) {
-    auto get_first_cpu = [](const std::string& line) {
-      std::string        str;
-      std::istringstream iss(line);
-      std::getline(iss, str, ',');
-      if (str.find('-') != std::string::npos) {
-        std::getline(iss, str, '-');
-      }
-      return parse_one_cpu(str);
-    };
-    unsigned cpu_id_a = get_first_cpu(a);
-    unsigned cpu_id_b = get_first_cpu(b);
-    return cpu_id_a < cpu_id_b;
-  };
-  std::set<std::string, decltype(sort_function)> thread_siblings_set(sort_function);
-  std::string                                    cpu_system_path = "/sys/devices/system/cpu";
-  ::DIR*                                         dir             = ::opendir(cpu_system_path.c_str());
-  if (dir) {
-    ::dirent*     entry;
-    struct ::stat info;
+  cpuinfo.logical_cpu_lists = parse_cpu_sibling_lists("topology/thread_siblings_list");
 
-    while ((entry = ::readdir(dir))) {
-      const std::regex re("^cpu[0-9]+");
-      std::string      cpu_name = entry->d_name;
-      if (!std::regex_match(cpu_name, re)) {
-        continue;
-      }
-      std::string cpu_siblings_path = fmt::format("{}/{}/topology/thread_siblings_list", cpu_system_path, cpu_name);
-      if (::stat(cpu_siblings_path.c_str(), &info) < 0) {
-        continue;
-      }
-      std::ifstream file(cpu_siblings_path);
-      std::string   str_mask;
-      std::getline(file, str_mask);
-      thread_siblings_set.insert(str_mask);
-    }
-    ::closedir(dir);
-  }
-  for (const auto& mask : thread_siblings_set) {
-    cpuinfo.logical_cpu_lists.emplace_back();
-    auto& bitmask = cpuinfo.logical_cpu_lists.back();
-    bitmask.resize(CPU_SETSIZE);
-
-    std::istringstream iss(mask);
-    while (iss.good()) {
-      std::string str;
-      std::getline(iss, str, ',');
-      if (str.find('-') != std::string::npos) {
-        auto range = parse_cpu_range(str);
-        bitmask.fill(range.start(), range.stop() + 1);
-      } else {
-        auto cpu_idx = parse_one_cpu(str);
-        bitmask.set(cpu_idx);
-      }
-    }
-  }
+  // Parse /sys/devices/system/cpu/cpu*/cache/index3/shared_cpu_list to get the lists of CPUs sharing each last-level
+  // cache domain (e.g. one list per core complex on AMD EPYC). On systems without an L3 cache no such files exist and
+  // the list of LLC domains remains empty.
+  cpuinfo.llc_cpu_lists = parse_cpu_sibling_lists("cache/index3/shared_cpu_list");
 
 #ifdef NUMA_SUPPORT
   if (::numa_available() == -1) {
@@ -196,7 +213,7 @@ cpu_architecture_info::cpu_description cpu_architecture_info::discover_cpu_archi
   }
 #else
   std::string node_system_path = "/sys/devices/system/node";
-  dir                          = ::opendir(node_system_path.c_str());
+  ::DIR*      dir              = ::opendir(node_system_path.c_str());
   if (dir) {
     ::dirent* entry;
     while ((entry = ::readdir(dir))) {
@@ -245,6 +262,14 @@ void cpu_architecture_info::print_cpu_info(srslog::basic_logger& logger) const
   fmt::format_to(fmt_buf, "\n}}\n");
 #endif
 
+  if (not cpu_desc.llc_cpu_lists.empty()) {
+    fmt::format_to(fmt_buf, "CPUs per last-level cache domain:\n{{");
+    for (unsigned llc_id = 0, e = cpu_desc.llc_cpu_lists.size(); llc_id != e; ++llc_id) {
+      fmt::format_to(fmt_buf, "\n   LLC {} CPUs: {}", llc_id, print_cpus_list(cpu_desc.llc_cpu_lists[llc_id]));
+    }
+    fmt::format_to(fmt_buf, "\n}}\n");
+  }
+
   fmt::format_to(fmt_buf, "CPUs per each physical CPU core:\n{{");
   for (unsigned core_id = 0, e = cpu_desc.logical_cpu_lists.size(); core_id != e; ++core_id) {
     fmt::format_to(fmt_buf, "\n   {}: {}", core_id, print_cpus_list(cpu_desc.logical_cpu_lists[core_id]));
@@ -273,6 +298,16 @@ bounded_bitset<1024> cpu_architecture_info::get_node_cpu_mask(unsigned node_id)
 #endif
 }
 
+bounded_bitset<1024> cpu_architecture_info::get_llc_cpu_mask(unsigned llc_id) const
+{
+  if (llc_id >= cpu_desc.llc_cpu_lists.size()) {
+    srslog::fetch_basic_logger("GNB").debug(
+        "Requested LLC ID exceeds number of last-level cache domains discovered in the system");
+    return {};
+  }
+  return cpu_desc.llc_cpu_lists[llc_id];
+}
+
 bool cpu_architecture_info::run_on_numa_node(unsigned node_id) const
 {
 #ifndef NUMA_SUPPORT
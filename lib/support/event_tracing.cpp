@@ -118,6 +118,8 @@ struct timestamp_data {
 static trace_point run_epoch = trace_clock::now();
 /// Unique event trace file writer.
 static std::unique_ptr<event_trace_writer> trace_file_writer;
+/// Bitmask of trace categories that are currently enabled at runtime. All categories start enabled.
+static std::atomic<unsigned> enabled_trace_categories{~0U};
 
 static timestamp_data get_timestamp(trace_point tp)
 {
@@ -156,6 +158,20 @@ bool srsran::is_trace_file_open()
   return trace_file_writer != nullptr;
 }
 
+void srsran::set_trace_category_enabled(trace_category cat, bool enabled)
+{
+  if (enabled) {
+    enabled_trace_categories.fetch_or(1U << static_cast<unsigned>(cat), std::memory_order_relaxed);
+  } else {
+    enabled_trace_categories.fetch_and(~(1U << static_cast<unsigned>(cat)), std::memory_order_relaxed);
+  }
+}
+
+bool srsran::is_trace_category_enabled(trace_category cat)
+{
+  return (enabled_trace_categories.load(std::memory_order_relaxed) & (1U << static_cast<unsigned>(cat))) != 0;
+}
+
 namespace fmt {
 
 template <>
@@ -207,10 +223,16 @@ struct formatter<instant_trace_event_extended> : public basic_fmt_parser {
 
 } // namespace fmt
 
+template <>
+bool file_event_tracer<true>::is_enabled() const
+{
+  return is_trace_category_enabled(cat);
+}
+
 template <>
 void file_event_tracer<true>::operator<<(const trace_event& event) const
 {
-  if (not is_trace_file_open()) {
+  if (not is_enabled() or not is_trace_file_open()) {
     return;
   }
   const auto dur = std::chrono::duration_cast<trace_duration>(now() - event.start_tp);
@@ -220,7 +242,7 @@ void file_event_tracer<true>::operator<<(const trace_event& event) const
 template <>
 void file_event_tracer<true>::operator<<(const trace_thres_event& event) const
 {
-  if (not is_trace_file_open()) {
+  if (not is_enabled() or not is_trace_file_open()) {
     return;
   }
   const auto dur = std::chrono::duration_cast<trace_duration>(now() - event.start_tp);
@@ -232,7 +254,7 @@ void file_event_tracer<true>::operator<<(const trace_thres_event& event) const
 template <>
 void file_event_tracer<true>::operator<<(const instant_trace_event& event) const
 {
-  if (not is_trace_file_open()) {
+  if (not is_enabled() or not is_trace_file_open()) {
     return;
   }
   trace_file_writer->write_trace(instant_trace_event_extended{event});
@@ -113,6 +113,21 @@ bool detail::priority_task_queue::try_push(task_priority prio, unique_task task)
   return queues[idx].try_push(std::move(task));
 }
 
+unique_task detail::priority_task_queue::make_deadline_task(task_priority prio, task_deadline deadline, unique_task task)
+{
+  return [this, prio, deadline, t = std::move(task)]() {
+    if (std::chrono::steady_clock::now() > deadline) {
+      // The deadline expired while the task was sitting in the queue. Running it would waste cycles computing a
+      // result that arrives too late to be used (e.g. a symbol past its transmission window), so discard it.
+      if (missed_deadline_handler) {
+        missed_deadline_handler(prio);
+      }
+      return;
+    }
+    t();
+  };
+}
+
 bool detail::priority_task_queue::try_pop(unique_task& t)
 {
   // Iterate through all priority levels, starting from the max priority, and try to pop a task from the queue.
@@ -124,6 +139,18 @@ bool detail::priority_task_queue::try_pop(unique_task& t)
   return false;
 }
 
+unsigned detail::priority_task_queue::try_pop_bulk(span<unique_task> tasks)
+{
+  unsigned count = 0;
+  // Iterate through all priority levels, starting from the max priority, and drain each queue until the batch is full.
+  for (unsigned prio_idx = 0; prio_idx != queues.size() and count != tasks.size(); ++prio_idx) {
+    while (count != tasks.size() and queues[prio_idx].try_pop(tasks[count])) {
+      ++count;
+    }
+  }
+  return count;
+}
+
 bool detail::priority_task_queue::pop_blocking(unique_task& t)
 {
   while (running.load(std::memory_order_relaxed)) {
@@ -44,14 +44,23 @@ void priority_task_worker::stop()
 
 void priority_task_worker::run_pop_task_loop()
 {
-  unique_task t;
+  // Maximum number of tasks popped in one queue scan and run back-to-back. Tasks pushed while a batch runs wait for
+  // at most one batch of short tasks, and each batch is re-composed in priority order.
+  static constexpr unsigned max_batch_size = 16;
 
-  while (task_queue.pop_blocking(t)) {
-    // Run popped task
-    t();
+  std::array<unique_task, max_batch_size> batch;
 
-    // Note: Important to clear the task in case it has any RAII object.
-    t = {};
+  while (task_queue.pop_blocking(batch[0])) {
+    // Complete the batch with any other pending tasks, popped in priority order in a single scan.
+    const unsigned nof_tasks = 1U + task_queue.try_pop_bulk(span<unique_task>(batch).subspan(1, max_batch_size - 1));
+
+    for (unsigned i = 0; i != nof_tasks; ++i) {
+      // Run popped task.
+      batch[i]();
+
+      // Note: Important to clear the task in case it has any RAII object.
+      batch[i] = {};
+    }
   }
 
   srslog::fetch_basic_logger("ALL").info("Task worker \"{}\" finished.", this_thread_name());
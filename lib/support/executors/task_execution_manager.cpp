@@ -51,6 +51,10 @@ struct execution_context_traits<priority_task_worker_pool> {
   using params = execution_config_helper::worker_pool;
 };
 template <>
+struct execution_context_traits<work_stealing_task_worker_pool> {
+  using params = execution_config_helper::worker_pool;
+};
+template <>
 struct execution_context_traits<priority_task_worker> {
   using params = execution_config_helper::priority_multiqueue_worker;
 };
@@ -121,6 +125,16 @@ public:
 
   void stop() final { this->worker.stop(); }
 
+  std::vector<std::pair<std::string, executor_metrics_recorder::metrics>> collect_metrics() final
+  {
+    std::vector<std::pair<std::string, executor_metrics_recorder::metrics>> result;
+    result.reserve(metrics_recorders.size());
+    for (auto& recorder : metrics_recorders) {
+      result.emplace_back(recorder.first, recorder.second->collect());
+    }
+    return result;
+  }
+
 protected:
   using task_executor_list = std::vector<std::pair<std::string, std::unique_ptr<task_executor>>>;
 
@@ -134,6 +148,12 @@ protected:
   {
     for (const auto& exec_params : execs) {
       auto exec = create_executor(exec_params);
+      if (exec_params.report_metrics and exec != nullptr) {
+        // Wrap the executor with a decorator that records enqueue and execution latencies.
+        auto recorder = std::make_unique<executor_metrics_recorder>();
+        exec          = make_metrics_executor_ptr(std::move(exec), *recorder);
+        metrics_recorders.emplace_back(exec_params.name, std::move(recorder));
+      }
       if (not store_executor(exec_params.name, std::move(exec))) {
         return false;
       }
@@ -238,6 +258,9 @@ protected:
   // List of execution contexts.
   std::map<std::string, std::unique_ptr<task_executor>> executor_list;
 
+  // Latency metrics recorders of the executors of this context that have metrics enabled.
+  std::vector<std::pair<std::string, std::unique_ptr<executor_metrics_recorder>>> metrics_recorders;
+
   srslog::basic_logger& logger = srslog::fetch_basic_logger("ALL");
 
   // Tracer of execution context activity.
@@ -389,6 +412,54 @@ private:
   }
 };
 
+/// Execution context for a pool of task workers with per-worker queues and work stealing.
+struct work_stealing_worker_pool_context final : public common_task_execution_context<work_stealing_task_worker_pool> {
+  using worker_type   = work_stealing_task_worker_pool;
+  using executor_type = work_stealing_task_worker_pool_executor;
+  using base_type     = common_task_execution_context<worker_type>;
+
+  work_stealing_worker_pool_context(const execution_config_helper::worker_pool& params) :
+    base_type(
+        params.tracer,
+        params.name,
+        params.nof_workers,
+        [&params]() {
+          report_error_if_not(params.queues.size() == 1, "Invalid number of queues for the type of worker");
+          report_error_if_not(params.queues[0].policy == concurrent_queue_policy::lockfree_mpmc,
+                              "Only lockfree queues are supported for work-stealing worker pools");
+          return params.queues[0].size;
+        }(),
+        params.sleep_time,
+        params.prio,
+        params.masks)
+  {
+  }
+
+  static std::unique_ptr<task_execution_context> create(const execution_config_helper::worker_pool& params)
+  {
+    auto ctxt = std::make_unique<work_stealing_worker_pool_context>(params);
+    if (ctxt == nullptr or not ctxt->add_executors(params.executors)) {
+      return nullptr;
+    }
+    return ctxt;
+  }
+
+  std::string name() const final { return this->worker.name(); }
+
+private:
+  using base_type::base_type;
+
+  std::unique_ptr<task_executor> create_executor(const execution_config_helper::executor& desc) override
+  {
+    return decorate_executor(desc, executor_type(this->worker), this->task_tracer);
+  }
+
+  typename base_type::task_executor_list create_strand_executors(const execution_config_helper::executor& desc) override
+  {
+    return this->create_strand_executors_helper(desc, executor_type(this->worker));
+  }
+};
+
 /// Execution context for a task worker pool.
 struct priority_worker_pool_context final : public common_task_execution_context<priority_task_worker_pool> {
   using worker_type   = priority_task_worker_pool;
@@ -453,9 +524,15 @@ srsran::create_execution_context(const execution_config_helper::worker_pool& par
 
   if (params.queues.size() > 1) {
     // Prioritized multiqueue task worker pool.
+    report_error_if_not(not params.work_stealing, "Work stealing is not supported for prioritized worker pools");
     return priority_worker_pool_context::create(params);
   }
 
+  if (params.work_stealing) {
+    // Pool with per-worker queues and work stealing.
+    return work_stealing_worker_pool_context::create(params);
+  }
+
   switch (params.queues[0].policy) {
     case concurrent_queue_policy::locking_mpmc:
       return worker_pool_context<concurrent_queue_policy::locking_mpmc>::create(params);
@@ -561,3 +638,16 @@ bool task_execution_manager::add_execution_context(std::unique_ptr<task_executio
 
   return true;
 }
+
+std::vector<std::pair<std::string, executor_metrics_recorder::metrics>>
+task_execution_manager::collect_executor_metrics()
+{
+  std::vector<std::pair<std::string, executor_metrics_recorder::metrics>> result;
+  for (auto& ctxt : contexts) {
+    auto ctxt_metrics = ctxt.second->collect_metrics();
+    result.insert(result.end(),
+                  std::make_move_iterator(ctxt_metrics.begin()),
+                  std::make_move_iterator(ctxt_metrics.end()));
+  }
+  return result;
+}
@@ -23,6 +23,7 @@
 #include "srsran/support/executors/task_worker_pool.h"
 #include "execution_context_description_setup.h"
 #include <future>
+#include <mutex>
 
 using namespace srsran;
 
@@ -262,3 +263,171 @@ void task_worker_pool<QueuePolicy>::wait_pending_tasks()
 // Explicit specializations of the task_worker_pool.
 template class srsran::task_worker_pool<concurrent_queue_policy::lockfree_mpmc>;
 template class srsran::task_worker_pool<concurrent_queue_policy::locking_mpmc>;
+
+// ---- work-stealing task worker pool
+
+namespace {
+
+/// Pool and worker index of the calling thread, when the thread belongs to a work-stealing pool.
+struct work_stealing_worker_ctx {
+  const work_stealing_task_worker_pool* pool = nullptr;
+  unsigned                              worker_idx = 0;
+};
+
+thread_local work_stealing_worker_ctx this_ws_worker;
+
+} // namespace
+
+work_stealing_task_worker_pool::work_stealing_task_worker_pool(std::string                 worker_pool_name,
+                                                               unsigned                    nof_workers_,
+                                                               unsigned                    qsize_,
+                                                               std::chrono::microseconds   wait_sleep_time,
+                                                               os_thread_realtime_priority prio,
+                                                               span<const os_sched_affinity_bitmask> cpu_masks) :
+  detail::base_work_stealing_task_queues(nof_workers_, qsize_, wait_sleep_time),
+  detail::base_worker_pool(
+      nof_workers_,
+      std::move(worker_pool_name),
+      [this](unsigned worker_idx) { return create_worker_task(worker_idx); },
+      prio,
+      cpu_masks)
+{
+  report_fatal_error_if_not(nof_workers_ > 0, "Number of workers of a thread pool must be greater than 0");
+}
+
+work_stealing_task_worker_pool::~work_stealing_task_worker_pool()
+{
+  stop();
+}
+
+std::function<void()> work_stealing_task_worker_pool::create_worker_task(unsigned worker_idx)
+{
+  return [this, worker_idx]() {
+    // setup worker execution context.
+    execution_context::set_execution_context_description(nof_workers(), worker_idx);
+    this_ws_worker = {this, worker_idx};
+
+    worker_queue& local_queue = *this->queues[worker_idx];
+    unique_task   job;
+    while (true) {
+      // Pop from the queue owned by this worker first.
+      if (local_queue.try_pop(job)) {
+        job();
+        continue;
+      }
+
+      // Local queue ran dry. Try to steal a task from the queue of another worker.
+      bool stolen = false;
+      for (unsigned offset = 1, nof_queues = this->queues.size(); offset != nof_queues; ++offset) {
+        if (this->queues[(worker_idx + offset) % nof_queues]->try_pop(job)) {
+          job();
+          stolen = true;
+          break;
+        }
+      }
+      if (stolen) {
+        continue;
+      }
+
+      // No pending task in any queue. Exit if the pool was stopped, otherwise wait for new tasks.
+      if (not this->running.load(std::memory_order_acquire)) {
+        break;
+      }
+      std::this_thread::sleep_for(this->sleep_time);
+    }
+  };
+}
+
+unsigned work_stealing_task_worker_pool::next_queue_index()
+{
+  // Tasks pushed from within the pool go to the queue owned by the calling worker, avoiding any inter-thread
+  // contention. Tasks pushed from outside are spread round-robin across the per-worker queues.
+  if (this_ws_worker.pool == this) {
+    return this_ws_worker.worker_idx;
+  }
+  return rr_count.fetch_add(1, std::memory_order_relaxed) % queues.size();
+}
+
+bool work_stealing_task_worker_pool::push_task(unique_task task)
+{
+  return queues[next_queue_index()]->try_push(std::move(task));
+}
+
+bool work_stealing_task_worker_pool::push_task_blocking(unique_task task)
+{
+  return queues[next_queue_index()]->push_blocking(std::move(task));
+}
+
+void work_stealing_task_worker_pool::stop()
+{
+  // Workers only exit after draining all queues, so pending tasks still get processed.
+  running.store(false, std::memory_order_release);
+  unsigned count = 0;
+  for (unique_thread& w : worker_threads) {
+    if (w.running()) {
+      w.join();
+      this->logger.info("Task worker \"{}\" finished.", worker_threads[count].get_name());
+    }
+    count++;
+  }
+}
+
+unsigned work_stealing_task_worker_pool::nof_pending_tasks() const
+{
+  unsigned count = 0;
+  for (const auto& q : queues) {
+    count += q->size();
+  }
+  return count;
+}
+
+void work_stealing_task_worker_pool::wait_pending_tasks()
+{
+  std::mutex              mutex;
+  std::condition_variable cvar_all_sync, cvar_caller_return;
+
+  // Check if there are workers still running.
+  unsigned workers_running = 0;
+  for (unsigned i = 0; i != nof_workers(); ++i) {
+    if (worker_threads[i].running()) {
+      workers_running++;
+    }
+  }
+  if (workers_running == 0) {
+    // If no worker is running, return immediately.
+    return;
+  }
+
+  // This will block all workers until all of them are running the enqueued task. One task is pushed per worker queue;
+  // a worker that runs one of the tasks blocks inside it, so each of the tasks ends up held by a distinct worker,
+  // regardless of stealing.
+  unsigned count_workers_not_sync = workers_running;
+  unsigned counter_caller         = workers_running;
+  for (unsigned i = 0; i != workers_running; ++i) {
+    if (not this->queues[i]->push_blocking(
+            [&mutex, &cvar_all_sync, &cvar_caller_return, &count_workers_not_sync, &counter_caller]() {
+              std::unique_lock<std::mutex> lock(mutex);
+
+              // Sync all workers. Only when all workers are in sync, we can carry on.
+              count_workers_not_sync--;
+              if (count_workers_not_sync > 0) {
+                cvar_all_sync.wait(lock, [&count_workers_not_sync]() { return count_workers_not_sync == 0; });
+              } else {
+                cvar_all_sync.notify_all();
+              }
+
+              // When all workers passed the condition variable, we can notify the caller.
+              if (--counter_caller == 0) {
+                cvar_caller_return.notify_one();
+              }
+            })) {
+      // Queue was deactivated.
+      std::unique_lock<std::mutex> lock(mutex);
+      count_workers_not_sync--;
+    }
+  }
+
+  // Caller blocks waiting for all workers to sync.
+  std::unique_lock<std::mutex> lock(mutex);
+  cvar_caller_return.wait(lock, [&counter_caller]() { return counter_caller == 0; });
+}
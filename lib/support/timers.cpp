@@ -118,6 +118,35 @@ private:
 
 //
 
+/// \brief Queue of commands sent by the timer front-ends to the back-end.
+///
+/// The producer side is lock-free. Commands pushed from the same thread are dequeued in order, but commands pushed
+/// from different threads may be dequeued out of order. The back-end compensates for this via the monotonically
+/// increasing cmd_id of each timer.
+class timer_manager::cmd_queue
+{
+public:
+  explicit cmd_queue(size_t capacity) : queue(capacity) {}
+
+  void push(timer_cmd cmd) { queue.enqueue(std::move(cmd)); }
+
+  /// Pops all pending commands, appending them to \c out.
+  void pop_all(std::vector<timer_cmd>& out)
+  {
+    static constexpr size_t max_batch = 256;
+
+    size_t n;
+    do {
+      n = queue.try_dequeue_bulk(std::back_inserter(out), max_batch);
+    } while (n == max_batch);
+  }
+
+private:
+  moodycamel::ConcurrentQueue<timer_cmd> queue;
+};
+
+//
+
 timer_manager::timer_manager(size_t capacity) :
   logger(srslog::fetch_basic_logger("ALL")),
   timer_pool(std::make_unique<unique_timer_pool>(*this, capacity)),
@@ -135,7 +164,7 @@ timer_manager::timer_manager(size_t capacity) :
   }
 
   const uint16_t cmds_capacity = 16384;
-  pending_cmds.reserve(cmds_capacity);
+  pending_cmds = std::make_unique<cmd_queue>(cmds_capacity);
   cmds_to_process.reserve(cmds_capacity);
 }
 
@@ -144,11 +173,8 @@ timer_manager::~timer_manager() {}
 void timer_manager::tick()
 {
   // Extract new commands from the timer front-ends to process in this tick.
-  {
-    cmds_to_process.clear();
-    std::lock_guard<std::mutex> lock(cmd_mutex);
-    pending_cmds.swap(cmds_to_process);
-  }
+  cmds_to_process.clear();
+  pending_cmds->pop_all(cmds_to_process);
 
   // Process new commands coming from the front-end.
   for (auto& event : cmds_to_process) {
@@ -159,20 +185,15 @@ void timer_manager::tick()
     }
 
     // Existing timer.
-    const cmd_t&  cmd   = std::get<cmd_t>(event);
-    timer_handle& timer = timers[static_cast<size_t>(cmd.id)];
-
-    // Update the timer backend cmd_id to match frontend.
-    timer.backend.cmd_id = cmd.cmd_id;
-
-    // Stop timer if it is currently running.
-    try_stop_timer_backend(timer, false);
+    handle_timer_command(std::get<cmd_t>(event));
+  }
 
-    if (cmd.action == cmd_t::start) {
-      // Start new timer run.
-      start_timer_backend(timer, cmd.duration);
-    } else if (cmd.action == cmd_t::destroy) {
-      destroy_timer_backend(timer);
+  // Re-attempt commands that were dequeued before the creation event of their respective timer.
+  if (SRSRAN_UNLIKELY(not postponed_cmds.empty())) {
+    std::vector<cmd_t> retry_cmds;
+    retry_cmds.swap(postponed_cmds);
+    for (const cmd_t& cmd : retry_cmds) {
+      handle_timer_command(cmd);
     }
   }
 
@@ -204,8 +225,36 @@ void timer_manager::tick()
 
 void timer_manager::push_timer_command(cmd_t cmd)
 {
-  std::lock_guard<std::mutex> lock(cmd_mutex);
-  pending_cmds.emplace_back(cmd);
+  pending_cmds->push(cmd);
+}
+
+void timer_manager::handle_timer_command(const cmd_t& cmd)
+{
+  auto timer_idx = static_cast<size_t>(cmd.id);
+  if (timer_idx >= timers.size() or timers[timer_idx].frontend == nullptr) {
+    // The creation event of this timer has not been processed yet. Postpone the command until it arrives.
+    postponed_cmds.push_back(cmd);
+    return;
+  }
+  timer_handle& timer = timers[timer_idx];
+
+  // Discard commands that were dequeued after a more recent command for the same timer.
+  if (static_cast<int32_t>(cmd.cmd_id - timer.backend.cmd_id) <= 0) {
+    return;
+  }
+
+  // Update the timer backend cmd_id to match frontend.
+  timer.backend.cmd_id = cmd.cmd_id;
+
+  // Stop timer if it is currently running.
+  try_stop_timer_backend(timer, false);
+
+  if (cmd.action == cmd_t::start) {
+    // Start new timer run.
+    start_timer_backend(timer, cmd.duration);
+  } else if (cmd.action == cmd_t::destroy) {
+    destroy_timer_backend(timer);
+  }
 }
 
 void timer_manager::create_timer_handle(std::unique_ptr<timer_frontend> timer)
@@ -340,10 +389,7 @@ timer_manager::timer_frontend& timer_manager::create_frontend_timer(task_executo
 
   // Forward created timer handle to the backend.
   // Note: This cannot fail, otherwise the created "id" cannot be reused.
-  {
-    std::lock_guard<std::mutex> lock(cmd_mutex);
-    pending_cmds.emplace_back(std::move(new_handle));
-  }
+  pending_cmds->push(std::move(new_handle));
 
   return *cached_timer;
 }
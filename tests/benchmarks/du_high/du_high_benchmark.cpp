@@ -85,6 +85,10 @@ struct bench_params {
   unsigned max_dl_rb_grant = MAX_NOF_PRBS;
   /// \brief Size of the F1-U PDU used in bytes.
   units::bytes pdu_size{1500};
+  /// \brief On/off traffic pattern, expressed as the number of slots with traffic followed by the number of slots
+  /// without traffic. Setting any of the two values to 0 disables the pattern and traffic is pushed on every slot.
+  unsigned traffic_on_slots = 0;
+  unsigned traffic_off_slots = 0;
   /// \brief Logical cores used by the "du_cell" thread.
   std::vector<unsigned> du_cell_cores = {};
   /// \brief Policy scheduler type.
@@ -94,7 +98,7 @@ struct bench_params {
 static void usage(const char* prog, const bench_params& params)
 {
   fmt::print("Usage: {} [-R repetitions] [-U nof. ues] [-D Duplex mode] [-d DL bytes per slot] [-u UL BSR] [-r Max RBs "
-             "per UE DL grant] [-a CPU affinity] [-p F1-U PDU size] [-P Policy scheduler type]\n",
+             "per UE DL grant] [-a CPU affinity] [-p F1-U PDU size] [-P Policy scheduler type] [-t traffic pattern]\n",
              prog);
   fmt::print("\t-R Repetitions [Default {}]\n", params.nof_repetitions);
   fmt::print("\t-U Nof. DU UEs for each simulation (e.g. \"1,5,10\" would run three benchmarks with 1, 5 and 10 UEs) "
@@ -111,6 +115,8 @@ static void usage(const char* prog, const bench_params& params)
   fmt::print("\t-a \"du_cell\" cores that the benchmark should use [Default \"no CPU affinity\"]\n");
   fmt::print("\t-p F1-U PDU size used [Default {}]\n", params.pdu_size);
   fmt::print("\t-P Policy scheduler the bechmark should use (\"time_rr\", \"time_pf\") [Default \"time_rr\"]\n");
+  fmt::print("\t-t On/off traffic pattern as \"on_slots,off_slots\" (e.g. \"20,80\" pushes traffic in bursts of 20 "
+             "slots followed by 80 idle slots). [Default \"constant traffic\"]\n");
   fmt::print("\t-h Show this message\n");
 }
 
@@ -129,7 +135,7 @@ static std::vector<Ret> tokenize(const std::string& s, Func&& func)
 static void parse_args(int argc, char** argv, bench_params& params)
 {
   int opt = 0;
-  while ((opt = getopt(argc, argv, "R:U:D:d:u:r:a:p:P:h")) != -1) {
+  while ((opt = getopt(argc, argv, "R:U:D:d:u:r:a:p:P:t:h")) != -1) {
     switch (opt) {
       case 'R':
         params.nof_repetitions = std::strtol(optarg, nullptr, 10);
@@ -174,6 +180,16 @@ static void parse_args(int argc, char** argv, bench_params& params)
       case 'p':
         params.pdu_size = units::bytes{(unsigned)std::strtol(optarg, nullptr, 10)};
         break;
+      case 't': {
+        std::vector<unsigned> pattern = tokenize(
+            optarg, [](const std::string& token) -> unsigned { return std::strtol(token.c_str(), nullptr, 10); });
+        if (pattern.size() != 2) {
+          usage(argv[0], params);
+          exit(0);
+        }
+        params.traffic_on_slots  = pattern[0];
+        params.traffic_off_slots = pattern[1];
+      } break;
       case 'P': {
         if (std::string(optarg) == "time_pf") {
           params.strategy_cfg = time_pf_scheduler_expert_config{};
@@ -218,6 +234,11 @@ static void print_args(const bench_params& params)
   fmt::print("- F1-U DL PDU size [bytes]: {}\n", params.pdu_size);
   fmt::print("- BSR size [bytes]: {}\n", params.ul_bsr_bytes);
   fmt::print("- Max DL RB grant size [RBs]: {}\n", params.max_dl_rb_grant);
+  if (params.traffic_on_slots != 0 and params.traffic_off_slots != 0) {
+    fmt::print("- Traffic pattern: {} slots on / {} slots off\n", params.traffic_on_slots, params.traffic_off_slots);
+  } else {
+    fmt::print("- Traffic pattern: constant\n");
+  }
   if (std::holds_alternative<time_pf_scheduler_expert_config>(params.strategy_cfg)) {
     fmt::print("- Policys scheduler: time_pf\n");
   } else {
@@ -631,12 +652,16 @@ public:
                 units::bytes                          f1u_pdu_size_,
                 span<unsigned>                        du_cell_cores,
                 const policy_scheduler_expert_config& strategy_cfg,
+                unsigned                              traffic_on_slots_,
+                unsigned                              traffic_off_slots_,
                 const cell_config_builder_params&     builder_params = {}) :
     params(builder_params),
     f1u_dl_pdu_bytes_per_slot(dl_buffer_state_bytes_),
     f1u_pdu_size(f1u_pdu_size_),
     workers(du_cell_cores),
-    ul_bsr_bytes(ul_bsr_bytes_)
+    ul_bsr_bytes(ul_bsr_bytes_),
+    traffic_on_slots(traffic_on_slots_),
+    traffic_off_slots(traffic_off_slots_)
   {
     // Set slot point based on the SCS.
     next_sl_tx = slot_point{to_numerology_value(params.scs_common), 0};
@@ -711,6 +736,16 @@ public:
   static rnti_t        du_ue_index_to_rnti(du_ue_index_t ue_idx) { return to_rnti(0x4601 + ue_idx); }
   static du_ue_index_t rnti_to_du_ue_index(rnti_t rnti) { return to_du_ue_index(static_cast<unsigned>(rnti) - 0x4601); }
 
+  /// \brief Determine whether the UEs have traffic to transmit/receive in the current slot of the traffic pattern.
+  bool traffic_active() const
+  {
+    if (traffic_on_slots == 0 or traffic_off_slots == 0) {
+      // Pattern disabled. Traffic is offered on every slot.
+      return true;
+    }
+    return (next_sl_tx.to_uint() % (traffic_on_slots + traffic_off_slots)) < traffic_on_slots;
+  }
+
   /// \brief Run a slot indication until completion.
   void run_slot()
   {
@@ -854,6 +889,11 @@ public:
       // Early return.
       return;
     }
+
+    // No DL traffic is offered during the off phase of the traffic pattern.
+    if (not traffic_active()) {
+      return;
+    }
     uint64_t bytes_to_sched = f1u_dl_total_bytes.load(std::memory_order_relaxed);
     bytes_to_sched -= std::min(bytes_to_sched, sim_phy.metrics.nof_dl_bytes);
     if (bytes_to_sched > SATURATION_DL_BS_BYTES) {
@@ -932,7 +972,7 @@ public:
           }
           // Forward positive SRs to scheduler only if UL is enabled for the benchmark, PUCCH grant is for SR and nof.
           // UL grants is 0 or scheduler stops allocating UL grants.
-          if (ul_bsr_bytes != 0 and pucch.format_1.sr_bits != sr_nof_bits::no_sr and
+          if (ul_bsr_bytes != 0 and traffic_active() and pucch.format_1.sr_bits != sr_nof_bits::no_sr and
               (sim_phy.metrics.nof_ul_grants == 0 or
                (sim_phy.metrics.nof_ul_grants ==
                 sim_phy.metrics.nof_ul_grants + sim_phy.slot_ul_result.ul_res->puschs.size()))) {
@@ -951,7 +991,7 @@ public:
           }
           // Forward positive SRs to scheduler only if UL is enabled for the benchmark, PUCCH grant is for SR and nof.
           // UL grants is 0 or scheduler stops allocating UL grants.
-          if (ul_bsr_bytes != 0 and pucch.format_2.sr_bits != sr_nof_bits::no_sr and
+          if (ul_bsr_bytes != 0 and traffic_active() and pucch.format_2.sr_bits != sr_nof_bits::no_sr and
               (sim_phy.metrics.nof_ul_grants == 0 or
                (sim_phy.metrics.nof_ul_grants ==
                 sim_phy.metrics.nof_ul_grants + sim_phy.slot_ul_result.ul_res->puschs.size()))) {
@@ -984,6 +1024,12 @@ public:
       return;
     }
 
+    // The UEs have no pending UL data during the off phase of the traffic pattern. The CRC indications for the
+    // already scheduled PUSCH grants are still delivered separately, so the HARQ loop stays consistent.
+    if (not traffic_active()) {
+      return;
+    }
+
     // Early return.
     if (sim_phy.slot_ul_result.ul_res == nullptr) {
       return;
@@ -1156,6 +1202,10 @@ public:
   /// Size of the UL Buffer status report to push for UL Tx.
   unsigned ul_bsr_bytes;
 
+  /// On/off traffic pattern in slots. When any of the two values is 0, traffic is offered on every slot.
+  unsigned traffic_on_slots;
+  unsigned traffic_off_slots;
+
   // Round-robin indexer for pushing DL PDUs to attached UEs.
   unsigned f1u_dl_rr_count = 0;
   // Sum of total F1-U DL bytes pushed into DU.
@@ -1210,7 +1260,9 @@ void benchmark_dl_ul_only_rlc_um(benchmarker&                          bm,
                                  unsigned                              max_nof_rbs_per_dl_grant,
                                  units::bytes                          dl_pdu_size,
                                  span<unsigned>                        du_cell_cores,
-                                 const policy_scheduler_expert_config& strategy_cfg)
+                                 const policy_scheduler_expert_config& strategy_cfg,
+                                 unsigned                              traffic_on_slots,
+                                 unsigned                              traffic_off_slots)
 {
   auto                benchname = fmt::format("{}{}{}, {} UEs, RLC UM",
                                dl_buffer_state_bytes > 0 ? "DL" : "",
@@ -1224,6 +1276,8 @@ void benchmark_dl_ul_only_rlc_um(benchmarker&                          bm,
                       dl_pdu_size,
                       du_cell_cores,
                       strategy_cfg,
+                      traffic_on_slots,
+                      traffic_off_slots,
                       generate_custom_cell_config_builder_params(dplx_mode)};
   for (unsigned ue_count = 0; ue_count < nof_ues; ++ue_count) {
     bench.add_ue(to_du_ue_index(ue_count));
@@ -1346,7 +1400,9 @@ int main(int argc, char** argv)
                                 params.max_dl_rb_grant,
                                 params.pdu_size,
                                 params.du_cell_cores,
-                                params.strategy_cfg);
+                                params.strategy_cfg,
+                                params.traffic_on_slots,
+                                params.traffic_off_slots);
   }
 
   if (not tracing_filename.empty()) {
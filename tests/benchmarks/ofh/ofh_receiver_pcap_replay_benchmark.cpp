@@ -0,0 +1,619 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief Open Fronthaul capture-and-replay harness.
+///
+/// Captures timestamped fronthaul frames from a network interface into a pcap file, or replays a previously captured
+/// pcap against the Open Fronthaul message receiver at original or accelerated timing. Replay reproduces RU interop
+/// performance issues on any development machine without a lab RU, reporting per-frame processing latency, the time
+/// spent in IQ decompression and the reception window statistics.
+
+#include "../../../lib/ofh/receiver/ofh_data_flow_uplane_uplink_data_impl.h"
+#include "../../../lib/ofh/receiver/ofh_data_flow_uplane_uplink_prach_impl.h"
+#include "../../../lib/ofh/receiver/ofh_message_receiver.h"
+#include "../../../lib/ofh/receiver/ofh_rx_window_checker.h"
+#include "../../../lib/ofh/receiver/ofh_sequence_id_checker_dummy_impl.h"
+#include "../../../lib/ofh/support/prach_context_repository.h"
+#include "../../../lib/ofh/support/uplink_context_repository.h"
+#include "../../../lib/ofh/support/uplink_cplane_context_repository.h"
+#include "srsran/ofh/compression/compression_factory.h"
+#include "srsran/ofh/ecpri/ecpri_factories.h"
+#include "srsran/ofh/ethernet/ethernet_factories.h"
+#include "srsran/ofh/ethernet/ethernet_frame_notifier.h"
+#include "srsran/ofh/ethernet/ethernet_properties.h"
+#include "srsran/ofh/ethernet/ethernet_receiver.h"
+#include "srsran/ofh/serdes/ofh_serdes_factories.h"
+#include "srsran/phy/generic_functions/precoding/precoding_factories.h"
+#include "srsran/phy/support/support_factories.h"
+#include "srsran/ran/bs_channel_bandwidth.h"
+#include "srsran/support/executors/task_worker.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <getopt.h>
+#include <thread>
+
+using namespace srsran;
+
+namespace {
+
+/// Number of slots of the context repository rings used during replay.
+constexpr unsigned REPLAY_RING_SIZE_SLOTS = 40U;
+
+enum class tool_mode { none, capture, replay };
+
+/// Classic pcap file magic numbers, microsecond and nanosecond timestamp resolution.
+constexpr uint32_t PCAP_MAGIC_USEC = 0xa1b2c3d4;
+constexpr uint32_t PCAP_MAGIC_NSEC = 0xa1b23c4d;
+
+/// Captured or loaded fronthaul frame with its capture timestamp.
+struct timed_frame {
+  std::vector<uint8_t> data;
+  /// Capture timestamp in nanoseconds relative to the Epoch.
+  uint64_t ts_ns;
+};
+
+/// Minimal classic-pcap file writer (LINKTYPE_ETHERNET).
+class pcap_writer
+{
+public:
+  explicit pcap_writer(const std::string& filename) : file(filename, std::ios::binary)
+  {
+    report_fatal_error_if_not(file.is_open(), "Could not open '{}' for writing", filename);
+
+    const uint32_t header[6] = {PCAP_MAGIC_NSEC, 0x00040002, 0, 0, 65535, 1};
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  }
+
+  void write_frame(span<const uint8_t> frame, uint64_t ts_ns)
+  {
+    const uint32_t record[4] = {static_cast<uint32_t>(ts_ns / 1000000000U),
+                                static_cast<uint32_t>(ts_ns % 1000000000U),
+                                static_cast<uint32_t>(frame.size()),
+                                static_cast<uint32_t>(frame.size())};
+    file.write(reinterpret_cast<const char*>(record), sizeof(record));
+    file.write(reinterpret_cast<const char*>(frame.data()), frame.size());
+  }
+
+private:
+  std::ofstream file;
+};
+
+/// Loads all frames of a classic pcap file. Only native byte order captures are supported.
+std::vector<timed_frame> load_pcap(const std::string& filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  report_fatal_error_if_not(file.is_open(), "Could not open '{}' for reading", filename);
+
+  uint32_t header[6];
+  report_fatal_error_if_not(bool(file.read(reinterpret_cast<char*>(header), sizeof(header))),
+                            "Could not read the pcap global header");
+  report_fatal_error_if_not(header[0] == PCAP_MAGIC_USEC || header[0] == PCAP_MAGIC_NSEC,
+                            "Unsupported pcap magic number '{:#x}'",
+                            header[0]);
+  const uint64_t subsec_to_ns = (header[0] == PCAP_MAGIC_USEC) ? 1000U : 1U;
+
+  std::vector<timed_frame> frames;
+  for (;;) {
+    uint32_t record[4];
+    if (!file.read(reinterpret_cast<char*>(record), sizeof(record))) {
+      break;
+    }
+
+    timed_frame frame;
+    frame.ts_ns = static_cast<uint64_t>(record[0]) * 1000000000U + static_cast<uint64_t>(record[1]) * subsec_to_ns;
+    frame.data.resize(record[2]);
+    report_fatal_error_if_not(bool(file.read(reinterpret_cast<char*>(frame.data.data()), frame.data.size())),
+                              "Truncated pcap record");
+    frames.push_back(std::move(frame));
+  }
+
+  return frames;
+}
+
+/// Ethernet receive buffer view over a loaded frame. Replayed frames outlive their injection.
+class frame_buffer_view : public ether::rx_buffer
+{
+public:
+  explicit frame_buffer_view(span<const uint8_t> view_) : view(view_) {}
+
+  span<const uint8_t> data() const override { return view; }
+
+private:
+  span<const uint8_t> view;
+};
+
+/// Frame notifier that records frames with their reception timestamp into a pcap file.
+class capture_frame_notifier : public ether::frame_notifier
+{
+public:
+  capture_frame_notifier(pcap_writer& writer_, unsigned max_frames_) : writer(writer_), max_frames(max_frames_) {}
+
+  void on_new_frame(ether::unique_rx_buffer buffer) override
+  {
+    if (nof_frames >= max_frames) {
+      return;
+    }
+
+    uint64_t ts_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    writer.write_frame(buffer.data(), ts_ns);
+    ++nof_frames;
+  }
+
+  unsigned get_nof_frames() const { return nof_frames; }
+
+private:
+  pcap_writer&          writer;
+  const unsigned        max_frames;
+  std::atomic<unsigned> nof_frames{0};
+};
+
+/// Dummy Ethernet receiver, required by the message receiver dependencies. Frames are injected directly.
+class dummy_eth_receiver : public ether::receiver
+{
+public:
+  void start(ether::frame_notifier& notifier) override {}
+  void stop() override {}
+};
+
+/// User-Plane received symbol notifier that counts the notified symbols and PRACH windows.
+class counting_uplane_notifier : public ofh::uplane_rx_symbol_notifier
+{
+public:
+  void on_new_uplink_symbol(const ofh::uplane_rx_symbol_context& context, shared_resource_grid grid) override
+  {
+    ++nof_symbols;
+  }
+
+  void on_new_prach_window_data(const prach_buffer_context& context, const prach_buffer& buffer) override
+  {
+    ++nof_prach_windows;
+  }
+
+  uint64_t get_nof_symbols() const { return nof_symbols; }
+  uint64_t get_nof_prach_windows() const { return nof_prach_windows; }
+
+private:
+  uint64_t nof_symbols       = 0;
+  uint64_t nof_prach_windows = 0;
+};
+
+/// IQ decompressor decorator that accumulates the time spent decompressing.
+class timing_iq_decompressor : public ofh::iq_decompressor
+{
+public:
+  timing_iq_decompressor(std::unique_ptr<ofh::iq_decompressor> base_,
+                         std::chrono::nanoseconds&             elapsed_,
+                         uint64_t&                             nof_calls_) :
+    base(std::move(base_)), elapsed(elapsed_), nof_calls(nof_calls_)
+  {
+  }
+
+  void
+  decompress(span<cbf16_t> iq_data, span<const uint8_t> compressed_data, const ofh::ru_compression_params& params) override
+  {
+    auto tp = std::chrono::steady_clock::now();
+    base->decompress(iq_data, compressed_data, params);
+    elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tp);
+    ++nof_calls;
+  }
+
+private:
+  std::unique_ptr<ofh::iq_decompressor> base;
+  std::chrono::nanoseconds&             elapsed;
+  uint64_t&                             nof_calls;
+};
+
+/// Classification of a capture frame obtained in the pre-scan pass.
+struct frame_info {
+  bool       is_ofh   = false;
+  bool       is_prach = false;
+  slot_point slot;
+};
+
+} // namespace
+
+static tool_mode          mode = tool_mode::none;
+static std::string        pcap_filename;
+static std::string        interface_name;
+static unsigned           max_capture_frames = 100000;
+static double             time_scale         = 0.0;
+static subcarrier_spacing scs                = subcarrier_spacing::kHz30;
+static bs_channel_bandwidth bw               = bs_channel_bandwidth::MHz100;
+static std::string        compr_method       = "bfp";
+static unsigned           compr_bit_width    = 9;
+static bool               is_static_compr    = true;
+
+static void usage(const char* prog)
+{
+  fmt::print("Usage: {} -w file -i interface [-c max frames] | -r file [options]\n", prog);
+  fmt::print("  Capture mode:\n");
+  fmt::print("\t-w Write captured fronthaul frames to the given pcap file\n");
+  fmt::print("\t-i Network interface to capture from\n");
+  fmt::print("\t-c Stop after capturing this number of frames [Default {}]\n", max_capture_frames);
+  fmt::print("  Replay mode:\n");
+  fmt::print("\t-r Replay the given pcap file against the Open Fronthaul receiver\n");
+  fmt::print("\t-a Replay time scale: 0 replays as fast as possible, 1 at the original timing, 2 twice as fast "
+             "[Default {}]\n",
+             time_scale);
+  fmt::print("\t-C Subcarrier spacing of the capture [Default {}]\n", to_string(scs));
+  fmt::print("\t-B Channel bandwidth in MHz [Default {}]\n", bs_channel_bandwidth_to_MHz(bw));
+  fmt::print("\t-T Compression method of the capture [{{'none', 'bfp'}}, default is {}]\n", compr_method);
+  fmt::print("\t-W Compression bit width of the capture [Default {}]\n", compr_bit_width);
+  fmt::print("\t-D Use a dynamic compression header instead of a static one\n");
+  fmt::print("\t-h Show this message\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "w:i:c:r:a:C:B:T:W:Dh")) != -1) {
+    switch (opt) {
+      case 'w':
+        mode          = tool_mode::capture;
+        pcap_filename = std::string(optarg);
+        break;
+      case 'i':
+        interface_name = std::string(optarg);
+        break;
+      case 'c':
+        max_capture_frames = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'r':
+        mode          = tool_mode::replay;
+        pcap_filename = std::string(optarg);
+        break;
+      case 'a':
+        time_scale = std::strtod(optarg, nullptr);
+        break;
+      case 'C':
+        scs = to_subcarrier_spacing(std::string(optarg));
+        if (scs == subcarrier_spacing::invalid) {
+          fmt::print("Invalid subcarrier spacing\n");
+          usage(argv[0]);
+          exit(0);
+        }
+        break;
+      case 'B':
+        bw = MHz_to_bs_channel_bandwidth(std::strtol(optarg, nullptr, 10));
+        break;
+      case 'T':
+        compr_method = std::string(optarg);
+        break;
+      case 'W':
+        compr_bit_width = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'D':
+        is_static_compr = false;
+        break;
+      case 'h':
+      default:
+        usage(argv[0]);
+        exit(0);
+    }
+  }
+
+  if (mode == tool_mode::none || (mode == tool_mode::capture && interface_name.empty())) {
+    usage(argv[0]);
+    exit(0);
+  }
+}
+
+/// Captures frames from the configured interface until the frame budget is reached.
+static void run_capture(srslog::basic_logger& logger)
+{
+  pcap_writer            writer(pcap_filename);
+  capture_frame_notifier notifier(writer, max_capture_frames);
+
+  task_worker                     worker("eth_rx", 128);
+  std::unique_ptr<task_executor>  executor = make_task_executor_ptr(worker);
+  std::unique_ptr<ether::receiver> receiver =
+      ether::create_receiver(interface_name, true, *executor, logger);
+  report_fatal_error_if_not(receiver, "Could not create the Ethernet receiver");
+
+  fmt::print("Capturing up to {} frames from '{}' into '{}'...\n", max_capture_frames, interface_name, pcap_filename);
+  receiver->start(notifier);
+
+  while (notifier.get_nof_frames() < max_capture_frames) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  receiver->stop();
+  worker.stop();
+
+  fmt::print("Captured {} frames\n", notifier.get_nof_frames());
+}
+
+/// Creates a User-Plane message decoder, decorating every decompressor with the given time accumulator.
+static std::unique_ptr<ofh::uplane_message_decoder> create_timed_uplane_decoder(srslog::basic_logger&     logger,
+                                                                                unsigned                  ru_nof_prbs,
+                                                                                std::chrono::nanoseconds& decompr_elapsed,
+                                                                                uint64_t&                 decompr_calls)
+{
+  std::array<std::unique_ptr<ofh::iq_decompressor>, ofh::NOF_COMPRESSION_TYPES_SUPPORTED> decompr;
+  for (unsigned i = 0; i != ofh::NOF_COMPRESSION_TYPES_SUPPORTED; ++i) {
+    decompr[i] = std::make_unique<timing_iq_decompressor>(
+        create_iq_decompressor(static_cast<ofh::compression_type>(i), logger), decompr_elapsed, decompr_calls);
+  }
+
+  ofh::ru_compression_params compr_params;
+  compr_params.type       = ofh::to_compression_type(compr_method);
+  compr_params.data_width = compr_bit_width;
+
+  return is_static_compr
+             ? ofh::create_static_compr_method_ofh_user_plane_packet_decoder(
+                   logger, scs, cyclic_prefix::NORMAL, ru_nof_prbs, create_iq_decompressor_selector(std::move(decompr)), compr_params)
+             : ofh::create_dynamic_compr_method_ofh_user_plane_packet_decoder(
+                   logger, scs, cyclic_prefix::NORMAL, ru_nof_prbs, create_iq_decompressor_selector(std::move(decompr)));
+}
+
+static void print_percentiles(span<const uint64_t> sorted_ns, double total_seconds)
+{
+  auto percentile = [&sorted_ns](double p) {
+    return sorted_ns[std::min<size_t>(sorted_ns.size() - 1, static_cast<size_t>(p * sorted_ns.size()))];
+  };
+
+  fmt::print("Per-frame processing latency: p50={}ns p90={}ns p99={}ns p99.9={}ns max={}ns\n",
+             percentile(0.50),
+             percentile(0.90),
+             percentile(0.99),
+             percentile(0.999),
+             sorted_ns.back());
+  fmt::print("Throughput: {:.3f} Mframes/s\n", static_cast<double>(sorted_ns.size()) / total_seconds * 1e-6);
+}
+
+/// Replays the loaded capture against the Open Fronthaul message receiver.
+static void run_replay(srslog::basic_logger& logger)
+{
+  std::vector<timed_frame> frames = load_pcap(pcap_filename);
+  report_fatal_error_if_not(!frames.empty(), "The capture '{}' contains no frames", pcap_filename);
+  fmt::print("Loaded {} frames from '{}'\n", frames.size(), pcap_filename);
+
+  const unsigned nof_symbols = get_nsymb_per_slot(cyclic_prefix::NORMAL);
+  const unsigned nof_prbs    = get_max_Nprb(bs_channel_bandwidth_to_MHz(bw), scs, frequency_range::FR1);
+  const std::chrono::duration<double, std::nano> symbol_duration(
+      1e6 / (nof_symbols * get_nof_slots_per_subframe(scs)));
+
+  // Pre-scan the capture: classify frames, collect the eAxC values present and derive the VLAN parameters.
+  ether::vlan_frame_params vlan_params = {};
+  static_vector<unsigned, ofh::MAX_NOF_SUPPORTED_EAXC> ul_eaxc;
+  static_vector<unsigned, ofh::MAX_NOF_SUPPORTED_EAXC> prach_eaxc;
+  std::vector<frame_info>                              info(frames.size());
+  {
+    auto vlan_decoder  = ether::create_vlan_frame_decoder(logger);
+    auto ecpri_decoder = ecpri::create_ecpri_packet_decoder_using_payload_size(logger);
+    bool first         = true;
+
+    for (unsigned i = 0, e = frames.size(); i != e; ++i) {
+      ether::vlan_frame_params eth_params;
+      span<const uint8_t>      ecpri_pdu = vlan_decoder->decode(frames[i].data, eth_params);
+      if (ecpri_pdu.empty() || eth_params.eth_type != ether::ECPRI_ETH_TYPE) {
+        continue;
+      }
+
+      ecpri::packet_parameters ecpri_params;
+      span<const uint8_t>      ofh_pdu = ecpri_decoder->decode(ecpri_pdu, ecpri_params);
+      if (ofh_pdu.empty() || ecpri_params.header.msg_type != ecpri::message_type::iq_data) {
+        continue;
+      }
+
+      ofh::filter_index_type filter = ofh::uplane_peeker::peek_filter_index(ofh_pdu);
+      if (filter == ofh::filter_index_type::reserved) {
+        continue;
+      }
+
+      ofh::slot_symbol_point symbol_point = ofh::uplane_peeker::peek_slot_symbol_point(ofh_pdu, nof_symbols, scs);
+      if (!symbol_point.is_valid()) {
+        continue;
+      }
+
+      if (first) {
+        vlan_params = eth_params;
+        first       = false;
+      }
+
+      unsigned eaxc     = std::get<ecpri::iq_data_parameters>(ecpri_params.type_params).pc_id;
+      auto&    eaxc_set = is_a_prach_message(filter) ? prach_eaxc : ul_eaxc;
+      if (std::find(eaxc_set.begin(), eaxc_set.end(), eaxc) == eaxc_set.end() && !eaxc_set.full()) {
+        eaxc_set.push_back(eaxc);
+      }
+
+      info[i].is_ofh   = true;
+      info[i].is_prach = is_a_prach_message(filter);
+      info[i].slot     = symbol_point.get_slot();
+    }
+  }
+  report_fatal_error_if_not(!ul_eaxc.empty() || !prach_eaxc.empty(),
+                            "The capture '{}' contains no Open Fronthaul User-Plane frames",
+                            pcap_filename);
+  fmt::print("Capture eAxC values: uplink data {}, PRACH {}\n",
+             span<const unsigned>(ul_eaxc),
+             span<const unsigned>(prach_eaxc));
+
+  // Resource grids for the uplink contexts.
+  auto rg_factory = create_resource_grid_factory(create_channel_precoder_factory("auto"));
+  std::vector<std::unique_ptr<resource_grid>> grids;
+  for (unsigned i = 0; i != 2 * REPLAY_RING_SIZE_SLOTS; ++i) {
+    grids.push_back(
+        rg_factory->create(std::max<unsigned>(ul_eaxc.size(), 1U), nof_symbols, nof_prbs * NOF_SUBCARRIERS_PER_RB));
+  }
+  std::unique_ptr<resource_grid_pool> rg_pool = create_generic_resource_grid_pool(std::move(grids));
+
+  // Context repositories.
+  auto ul_repo     = std::make_shared<ofh::uplink_context_repository>(REPLAY_RING_SIZE_SLOTS);
+  auto prach_repo  = std::make_shared<ofh::prach_context_repository>(REPLAY_RING_SIZE_SLOTS);
+  auto cplane_repo = std::make_shared<ofh::uplink_cplane_context_repository>(REPLAY_RING_SIZE_SLOTS);
+
+  // Reception window checker, fed with OTA symbol boundaries reconstructed from the capture timeline.
+  ofh::rx_window_timing_parameters timing_params;
+  timing_params.sym_start = 0;
+  timing_params.sym_end   = 3 * nof_symbols;
+  ofh::rx_window_checker window_checker(logger, timing_params, symbol_duration);
+
+  // Decompression time accumulators, shared by all the decompressors of the replay.
+  std::chrono::nanoseconds decompr_elapsed{0};
+  uint64_t                 decompr_calls = 0;
+
+  auto notifier = std::make_shared<counting_uplane_notifier>();
+
+  // Uplink data flow.
+  ofh::data_flow_uplane_uplink_data_impl_config data_config;
+  data_config.ul_eaxc = ul_eaxc;
+  ofh::data_flow_uplane_uplink_data_impl_dependencies data_dependencies;
+  data_dependencies.logger                 = &logger;
+  data_dependencies.notifier               = notifier;
+  data_dependencies.ul_cplane_context_repo = cplane_repo;
+  data_dependencies.ul_context_repo        = ul_repo;
+  data_dependencies.uplane_decoder = create_timed_uplane_decoder(logger, nof_prbs, decompr_elapsed, decompr_calls);
+
+  // PRACH data flow. PRACH frames are decoded but dropped, as the capture carries no PRACH buffer contexts.
+  ofh::data_flow_uplane_uplink_prach_impl_config prach_config;
+  prach_config.is_prach_cplane_enabled = false;
+  prach_config.prach_eaxcs             = prach_eaxc;
+  ofh::data_flow_uplane_uplink_prach_impl_dependencies prach_dependencies;
+  prach_dependencies.logger                 = &logger;
+  prach_dependencies.notifier               = notifier;
+  prach_dependencies.ul_cplane_context_repo = cplane_repo;
+  prach_dependencies.prach_context_repo     = prach_repo;
+  prach_dependencies.uplane_decoder = create_timed_uplane_decoder(logger, nof_prbs, decompr_elapsed, decompr_calls);
+
+  // Message receiver.
+  ofh::message_receiver_config receiver_config;
+  receiver_config.nof_symbols = nof_symbols;
+  receiver_config.scs         = scs;
+  receiver_config.vlan_params = vlan_params;
+  receiver_config.prach_eaxc  = prach_eaxc;
+  receiver_config.ul_eaxc     = ul_eaxc;
+  ofh::message_receiver_dependencies receiver_dependencies;
+  receiver_dependencies.logger            = &logger;
+  receiver_dependencies.eth_receiver      = std::make_unique<dummy_eth_receiver>();
+  receiver_dependencies.window_checker    = &window_checker;
+  receiver_dependencies.ecpri_decoder     = ecpri::create_ecpri_packet_decoder_using_payload_size(logger);
+  receiver_dependencies.eth_frame_decoder = ether::create_vlan_frame_decoder(logger);
+  receiver_dependencies.data_flow_uplink =
+      std::make_unique<ofh::data_flow_uplane_uplink_data_impl>(data_config, std::move(data_dependencies));
+  receiver_dependencies.data_flow_prach =
+      std::make_unique<ofh::data_flow_uplane_uplink_prach_impl>(prach_config, std::move(prach_dependencies));
+  receiver_dependencies.seq_id_checker = std::make_unique<ofh::sequence_id_checker_dummy_impl>();
+
+  ofh::message_receiver_impl receiver(receiver_config, std::move(receiver_dependencies));
+
+  // Replay loop. Registration of the slot contexts and OTA advancement happen outside the measured region, mimicking
+  // the work the transmitter request handler and the timing worker perform in a live system.
+  std::array<slot_point, REPLAY_RING_SIZE_SLOTS> registered_slots;
+  std::vector<uint64_t>                          latencies_ns;
+  latencies_ns.reserve(frames.size());
+
+  const uint64_t         ts0 = frames.front().ts_ns;
+  ofh::slot_symbol_point ota(info.front().slot.valid() ? info.front().slot : slot_point(scs, 0), 0, nof_symbols);
+  uint64_t               ota_elapsed_ns = 0;
+  const auto             wall_start     = std::chrono::steady_clock::now();
+  const uint64_t         symbol_ns      = static_cast<uint64_t>(symbol_duration.count());
+
+  for (unsigned i = 0, e = frames.size(); i != e; ++i) {
+    const uint64_t capture_elapsed_ns = frames[i].ts_ns - ts0;
+
+    // Advance the OTA symbol with the capture timeline.
+    while (ota_elapsed_ns + symbol_ns <= capture_elapsed_ns) {
+      ota = ota + 1;
+      ota_elapsed_ns += symbol_ns;
+      window_checker.on_new_symbol(ota);
+    }
+
+    // Register the slot contexts for uplink data frames.
+    if (info[i].is_ofh && !info[i].is_prach) {
+      slot_point slot = info[i].slot;
+      slot_point& registered = registered_slots[slot.system_slot() % REPLAY_RING_SIZE_SLOTS];
+      if (registered != slot) {
+        registered = slot;
+
+        resource_grid_context rg_context = {slot, 0};
+        ul_repo->add(rg_context, rg_pool->allocate_resource_grid(rg_context), ofdm_symbol_range(0, nof_symbols));
+
+        ofh::ul_cplane_context cp_context;
+        cp_context.radio_hdr.direction    = ofh::data_direction::uplink;
+        cp_context.radio_hdr.filter_index = ofh::filter_index_type::standard_channel_filter;
+        cp_context.radio_hdr.start_symbol = 0;
+        cp_context.radio_hdr.slot         = slot;
+        cp_context.prb_start              = 0;
+        cp_context.nof_prb                = nof_prbs;
+        cp_context.nof_symbols            = nof_symbols;
+        for (unsigned eaxc : ul_eaxc) {
+          cplane_repo->add(slot, eaxc, cp_context);
+        }
+      }
+    }
+
+    // Pace the injection when replaying at original or scaled timing.
+    if (time_scale > 0.0) {
+      std::this_thread::sleep_until(
+          wall_start + std::chrono::nanoseconds(static_cast<uint64_t>(capture_elapsed_ns / time_scale)));
+    }
+
+    auto tp = std::chrono::steady_clock::now();
+    receiver.on_new_frame(ether::unique_rx_buffer(frame_buffer_view(frames[i].data)));
+    latencies_ns.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tp).count());
+  }
+
+  const double total_seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+
+  // Report.
+  std::sort(latencies_ns.begin(), latencies_ns.end());
+  print_percentiles(latencies_ns, total_seconds);
+  if (decompr_calls != 0) {
+    fmt::print("IQ decompression: {} calls, {:.0f}ns average, {:.1f}% of the total frame processing time\n",
+               decompr_calls,
+               static_cast<double>(decompr_elapsed.count()) / decompr_calls,
+               100.0 * decompr_elapsed.count() /
+                   std::accumulate(latencies_ns.begin(), latencies_ns.end(), uint64_t(0)));
+  }
+  fmt::print("Reception window: {} on time, {} early, {} late\n",
+             window_checker.nof_on_time_messages(),
+             window_checker.nof_early_messages(),
+             window_checker.nof_late_messages());
+  fmt::print("Notified uplink symbols: {}, PRACH windows: {}\n",
+             notifier->get_nof_symbols(),
+             notifier->get_nof_prach_windows());
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  srslog::init();
+  srslog::basic_logger& logger = srslog::fetch_basic_logger("OFH", false);
+  logger.set_level(srslog::basic_levels::warning);
+
+  if (mode == tool_mode::capture) {
+    run_capture(logger);
+  } else {
+    run_replay(logger);
+  }
+
+  srslog::flush();
+
+  return 0;
+}
@@ -0,0 +1,546 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// \file
+/// \brief End-to-end PUSCH chain benchmark with realistic multi-UE slot compositions.
+///
+/// Unlike \c pusch_processor_benchmark, which measures a single PUSCH transmission at a time, this benchmark replays
+/// entire slots composed of several UEs with mixed allocation sizes and MCS, and reports the per-UE processing time,
+/// the aggregated slot processing time and the slot feasibility (processing time relative to the slot duration). The
+/// full reception chain is exercised for each UE: channel estimation, equalization, demodulation, descrambling,
+/// demultiplexing and decoding. Per-kernel numbers are available from the sibling benchmarks in this directory tree.
+
+#include "../../../lib/phy/upper/rx_buffer_pool_impl.h"
+#include "srsran/phy/support/resource_grid_reader.h"
+#include "srsran/phy/support/resource_grid_writer.h"
+#include "srsran/phy/support/support_factories.h"
+#include "srsran/phy/upper/channel_processors/pusch/factories.h"
+#include "srsran/phy/upper/channel_processors/pusch/pusch_processor_result_notifier.h"
+#include "srsran/ran/sch/tbs_calculator.h"
+#include "srsran/support/benchmark_utils.h"
+#include "srsran/support/complex_normal_random.h"
+#include "srsran/support/srsran_test.h"
+#include <chrono>
+#include <getopt.h>
+#include <random>
+
+using namespace srsran;
+
+namespace {
+
+/// Notifies the completion of the PUSCH data processing.
+class pusch_processor_result_notifier_adaptor : public pusch_processor_result_notifier
+{
+public:
+  void on_uci(const pusch_processor_result_control& uci) override {}
+
+  void on_sch(const pusch_processor_result_data& sch) override { completed = true; }
+
+  void reset() { completed = false; }
+
+  void wait_for_completion()
+  {
+    while (!completed.load()) {
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+  }
+
+private:
+  std::atomic<bool> completed = {false};
+};
+
+/// Describes a single UE transmission within a slot.
+struct ue_allocation {
+  /// Number of allocated PRB.
+  unsigned nof_prb;
+  /// Modulation and target code rate.
+  sch_mcs_description mcs;
+  /// Number of transmission layers.
+  unsigned nof_layers;
+};
+
+/// Describes a slot composition, i.e., the UE mix a slot is filled with.
+struct slot_profile {
+  /// Profile name.
+  std::string name;
+  /// Profile description.
+  std::string description;
+  /// Subcarrier spacing.
+  subcarrier_spacing scs;
+  /// Channel bandwidth in PRB.
+  unsigned nof_prb;
+  /// Number of receive ports.
+  unsigned nof_rx_ports;
+  /// UEs scheduled in the slot. Consecutive PRB allocations, must fit in \c nof_prb.
+  std::vector<ue_allocation> ues;
+};
+
+/// A prepared UE transmission: PUSCH PDU and its transport block size.
+struct ue_transmission {
+  pusch_processor::pdu_t config;
+  unsigned               tbs;
+  unsigned               nof_codeblocks;
+};
+
+} // namespace
+
+// General test configuration parameters.
+static uint64_t    nof_repetitions       = 100;
+static bool        silent                = false;
+static std::string selected_profile_name = "mixed_8ue_100MHz";
+static std::string ldpc_decoder_type     = "auto";
+
+static const dmrs_type                          dmrs                        = dmrs_type::TYPE1;
+static const unsigned                           nof_cdm_groups_without_data = 2;
+static const bounded_bitset<MAX_NSYMB_PER_SLOT> dmrs_symbol_mask =
+    {false, false, true, false, false, false, false, false, false, false, false, true, false, false};
+
+// Available slot composition profiles.
+static const std::vector<slot_profile> profile_set = {
+    {"4ue_20MHz_even",
+     "Four UEs with an even PRB split and 16-QAM over a 20 MHz cell at 15 kHz SCS.",
+     subcarrier_spacing::kHz15,
+     106,
+     1,
+     {{26, {modulation_scheme::QAM16, 658.0F}, 1},
+      {26, {modulation_scheme::QAM16, 658.0F}, 1},
+      {26, {modulation_scheme::QAM16, 658.0F}, 1},
+      {26, {modulation_scheme::QAM16, 658.0F}, 1}}},
+
+    {"mixed_8ue_100MHz",
+     "Eight UEs mixing cell-edge QPSK small allocations with cell-center 256-QAM large allocations over a 100 MHz "
+     "cell at 30 kHz SCS.",
+     subcarrier_spacing::kHz30,
+     273,
+     2,
+     {{100, {modulation_scheme::QAM256, 948.0F}, 1},
+      {60, {modulation_scheme::QAM64, 873.0F}, 1},
+      {40, {modulation_scheme::QAM16, 658.0F}, 1},
+      {25, {modulation_scheme::QAM16, 434.0F}, 1},
+      {16, {modulation_scheme::QPSK, 308.0F}, 1},
+      {16, {modulation_scheme::QPSK, 193.0F}, 1},
+      {8, {modulation_scheme::QPSK, 120.0F}, 1},
+      {8, {modulation_scheme::QPSK, 120.0F}, 1}}},
+
+    {"32ue_100MHz_small",
+     "Thirty-two UEs with small allocations and low-order modulations over a 100 MHz cell at 30 kHz SCS.",
+     subcarrier_spacing::kHz30,
+     273,
+     2,
+     std::vector<ue_allocation>(32, {8, {modulation_scheme::QPSK, 308.0F}, 1})},
+};
+
+// Profile selected during test execution.
+static slot_profile selected_profile = {};
+
+static void usage(const char* prog)
+{
+  fmt::print("Usage: {} [-m benchmark mode] [-R repetitions] [-D LDPC type] [-P profile] [-h]\n", prog);
+  fmt::print("\t-m Benchmark mode: silent or full. [Default {}]\n", silent ? "silent" : "full");
+  fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
+  fmt::print("\t-D LDPC decoder type. [Default {}]\n", ldpc_decoder_type);
+  fmt::print("\t-P Slot composition profile. [Default {}]\n", selected_profile_name);
+  for (const slot_profile& profile : profile_set) {
+    fmt::print("\t\t {:<25} {}\n", profile.name, profile.description);
+  }
+  fmt::print("\t-h Show this message\n");
+}
+
+static int parse_args(int argc, char** argv)
+{
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "R:D:P:m:h")) != -1) {
+    switch (opt) {
+      case 'R':
+        nof_repetitions = std::strtol(optarg, nullptr, 10);
+        break;
+      case 'D':
+        ldpc_decoder_type = std::string(optarg);
+        break;
+      case 'P':
+        selected_profile_name = std::string(optarg);
+        break;
+      case 'm':
+        silent = (strcmp(optarg, "silent") == 0);
+        break;
+      case 'h':
+      default:
+        usage(argv[0]);
+        exit(0);
+    }
+  }
+
+  // Search profile.
+  bool profile_found = false;
+  for (const auto& candidate_profile : profile_set) {
+    if (selected_profile_name == candidate_profile.name) {
+      selected_profile = candidate_profile;
+      profile_found    = true;
+      break;
+    }
+  }
+  if (!profile_found) {
+    usage(argv[0]);
+    fmt::print(stderr, "Invalid profile: {}.\n", selected_profile_name);
+    return -1;
+  }
+
+  return 0;
+}
+
+// Builds the PUSCH PDU of every UE in the selected profile, laying out the allocations consecutively in frequency.
+static std::vector<ue_transmission> generate_slot_transmissions(const slot_profile& profile)
+{
+  std::vector<ue_transmission> transmissions;
+
+  unsigned nof_symbols = get_nsymb_per_slot(cyclic_prefix::NORMAL);
+  unsigned prb_start   = 0;
+  unsigned rnti        = 1;
+  for (const ue_allocation& ue : profile.ues) {
+    TESTASSERT(prb_start + ue.nof_prb <= profile.nof_prb,
+               "The UE allocations of profile '{}' exceed the channel bandwidth.",
+               profile.name);
+
+    // Determine the Transport Block Size.
+    tbs_calculator_configuration tbs_config = {};
+    tbs_config.mcs_descr                    = ue.mcs;
+    tbs_config.n_prb                        = ue.nof_prb;
+    tbs_config.nof_layers                   = ue.nof_layers;
+    tbs_config.nof_symb_sh                  = nof_symbols;
+    tbs_config.nof_dmrs_prb = dmrs.nof_dmrs_per_rb() * dmrs_symbol_mask.count() * nof_cdm_groups_without_data;
+    unsigned tbs            = tbs_calculator_calculate(tbs_config);
+
+    // Build the PUSCH PDU configuration.
+    pusch_processor::pdu_t config = {};
+    config.slot                   = slot_point(to_numerology_value(profile.scs), 0);
+    config.rnti                   = rnti;
+    config.bwp_size_rb            = profile.nof_prb;
+    config.bwp_start_rb           = 0;
+    config.cp                     = cyclic_prefix::NORMAL;
+    config.mcs_descr              = ue.mcs;
+    config.codeword.emplace(pusch_processor::codeword_description{
+        0, get_ldpc_base_graph(ue.mcs.get_normalised_target_code_rate(), units::bits(tbs)), true});
+    config.uci.alpha_scaling         = 1.0;
+    config.uci.beta_offset_harq_ack  = 5.0;
+    config.uci.beta_offset_csi_part1 = 5.0;
+    config.uci.beta_offset_csi_part2 = 5.0;
+    config.uci.nof_harq_ack          = 0;
+    config.uci.nof_csi_part1         = 0;
+    config.uci.csi_part2_size        = uci_part2_size_description(0);
+    config.n_id                      = 0;
+    config.nof_tx_layers             = ue.nof_layers;
+    config.rx_ports.resize(profile.nof_rx_ports);
+    std::iota(config.rx_ports.begin(), config.rx_ports.end(), 0);
+    config.dmrs_symbol_mask   = dmrs_symbol_mask;
+    config.dmrs               = pusch_processor::dmrs_configuration{.dmrs                        = dmrs,
+                                                                    .scrambling_id               = 0,
+                                                                    .n_scid                      = false,
+                                                                    .nof_cdm_groups_without_data = nof_cdm_groups_without_data};
+    config.freq_alloc         = rb_allocation::make_type1(prb_start, ue.nof_prb);
+    config.start_symbol_index = 0;
+    config.nof_symbols        = nof_symbols;
+    config.tbs_lbrm           = tbs_lbrm_default;
+
+    unsigned nof_codeblocks = ldpc::compute_nof_codeblocks(units::bits(tbs), config.codeword.value().ldpc_base_graph);
+
+    transmissions.push_back({config, tbs, nof_codeblocks});
+
+    prb_start += ue.nof_prb;
+    ++rnti;
+  }
+
+  return transmissions;
+}
+
+// Creates the PUSCH processor and its validator. The decoder runs synchronously on the calling thread, so that the
+// reported times capture the complete chain without executor queueing noise.
+static std::tuple<std::unique_ptr<pusch_processor>, std::unique_ptr<pusch_pdu_validator>> create_processor()
+{
+  // Create pseudo-random sequence generator.
+  std::shared_ptr<pseudo_random_generator_factory> prg_factory = create_pseudo_random_generator_sw_factory();
+  TESTASSERT(prg_factory);
+
+  std::shared_ptr<low_papr_sequence_generator_factory> low_papr_sequence_gen_factory =
+      create_low_papr_sequence_generator_sw_factory();
+  TESTASSERT(low_papr_sequence_gen_factory);
+
+  // Create demodulator mapper factory.
+  std::shared_ptr<channel_modulation_factory> chan_modulation_factory = create_channel_modulation_sw_factory();
+  TESTASSERT(chan_modulation_factory);
+
+  // Create CRC calculator factory.
+  std::shared_ptr<crc_calculator_factory> crc_calc_factory = create_crc_calculator_factory_sw("auto");
+  TESTASSERT(crc_calc_factory);
+
+  std::shared_ptr<short_block_detector_factory> short_block_det_factory = create_short_block_detector_factory_sw();
+  TESTASSERT(short_block_det_factory);
+
+  std::shared_ptr<dft_processor_factory> dft_factory = create_dft_processor_factory_fftw_fast();
+  if (!dft_factory) {
+    dft_factory = create_dft_processor_factory_generic();
+  }
+  TESTASSERT(dft_factory, "Cannot create DFT factory.");
+
+  std::shared_ptr<time_alignment_estimator_factory> ta_estimator_factory =
+      create_time_alignment_estimator_dft_factory(dft_factory);
+  TESTASSERT(ta_estimator_factory, "Cannot create TA estimator factory.");
+
+  // Create port channel estimator factory.
+  std::shared_ptr<port_channel_estimator_factory> port_chan_estimator_factory =
+      create_port_channel_estimator_factory_sw(ta_estimator_factory);
+  TESTASSERT(port_chan_estimator_factory);
+
+  // Create DM-RS for PUSCH channel estimator.
+  std::shared_ptr<dmrs_pusch_estimator_factory> dmrs_pusch_chan_estimator_factory =
+      create_dmrs_pusch_estimator_factory_sw(prg_factory, low_papr_sequence_gen_factory, port_chan_estimator_factory);
+  TESTASSERT(dmrs_pusch_chan_estimator_factory);
+
+  // Create channel equalizer factory.
+  std::shared_ptr<channel_equalizer_factory> eq_factory = create_channel_equalizer_generic_factory();
+  TESTASSERT(eq_factory);
+
+  std::shared_ptr<transform_precoder_factory> precoding_factory =
+      create_dft_transform_precoder_factory(dft_factory, MAX_RB);
+  TESTASSERT(precoding_factory);
+
+  // Create PUSCH demodulator factory.
+  std::shared_ptr<pusch_demodulator_factory> pusch_demod_factory = create_pusch_demodulator_factory_sw(
+      eq_factory, precoding_factory, chan_modulation_factory, prg_factory, MAX_RB, false, false);
+  TESTASSERT(pusch_demod_factory);
+
+  // Create PUSCH demultiplexer factory.
+  std::shared_ptr<ulsch_demultiplex_factory> demux_factory = create_ulsch_demultiplex_factory_sw();
+  TESTASSERT(demux_factory);
+
+  // Create PUSCH decoder factory.
+  std::shared_ptr<ldpc_decoder_factory> ldpc_decoder_factory = create_ldpc_decoder_factory_sw(ldpc_decoder_type);
+  TESTASSERT(ldpc_decoder_factory);
+
+  std::shared_ptr<ldpc_rate_dematcher_factory> ldpc_rate_dematcher_factory =
+      create_ldpc_rate_dematcher_factory_sw("auto");
+  TESTASSERT(ldpc_rate_dematcher_factory);
+
+  std::shared_ptr<ldpc_segmenter_rx_factory> segmenter_rx_factory = create_ldpc_segmenter_rx_factory_sw();
+  TESTASSERT(segmenter_rx_factory);
+
+  pusch_decoder_factory_sw_configuration pusch_decoder_factory_sw_config;
+  pusch_decoder_factory_sw_config.crc_factory               = crc_calc_factory;
+  pusch_decoder_factory_sw_config.decoder_factory           = ldpc_decoder_factory;
+  pusch_decoder_factory_sw_config.dematcher_factory         = ldpc_rate_dematcher_factory;
+  pusch_decoder_factory_sw_config.segmenter_factory         = segmenter_rx_factory;
+  pusch_decoder_factory_sw_config.nof_pusch_decoder_threads = 0;
+  pusch_decoder_factory_sw_config.executor                  = nullptr;
+  pusch_decoder_factory_sw_config.nof_prb                   = MAX_RB;
+  pusch_decoder_factory_sw_config.nof_layers                = pusch_constants::MAX_NOF_LAYERS;
+
+  std::shared_ptr<pusch_decoder_factory> pusch_dec_factory =
+      create_pusch_decoder_factory_sw(pusch_decoder_factory_sw_config);
+  TESTASSERT(pusch_dec_factory);
+
+  // Create polar decoder factory.
+  std::shared_ptr<polar_factory> polar_dec_factory = create_polar_factory_sw();
+  TESTASSERT(polar_dec_factory);
+
+  // Create UCI decoder factory.
+  std::shared_ptr<uci_decoder_factory> uci_dec_factory =
+      create_uci_decoder_factory_generic(short_block_det_factory, polar_dec_factory, crc_calc_factory);
+  TESTASSERT(uci_dec_factory);
+
+  // Create PUSCH processor.
+  pusch_processor_factory_sw_configuration pusch_proc_factory_config;
+  pusch_proc_factory_config.estimator_factory                    = dmrs_pusch_chan_estimator_factory;
+  pusch_proc_factory_config.demodulator_factory                  = pusch_demod_factory;
+  pusch_proc_factory_config.demux_factory                        = demux_factory;
+  pusch_proc_factory_config.decoder_factory                      = pusch_dec_factory;
+  pusch_proc_factory_config.uci_dec_factory                      = uci_dec_factory;
+  pusch_proc_factory_config.ch_estimate_dimensions.nof_prb       = MAX_RB;
+  pusch_proc_factory_config.ch_estimate_dimensions.nof_symbols   = MAX_NSYMB_PER_SLOT;
+  pusch_proc_factory_config.ch_estimate_dimensions.nof_rx_ports  = selected_profile.nof_rx_ports;
+  pusch_proc_factory_config.ch_estimate_dimensions.nof_tx_layers = pusch_constants::MAX_NOF_LAYERS;
+  pusch_proc_factory_config.dec_nof_iterations                   = 2;
+  pusch_proc_factory_config.dec_enable_early_stop                = true;
+  pusch_proc_factory_config.max_nof_concurrent_threads           = 1;
+
+  std::shared_ptr<pusch_processor_factory> pusch_proc_factory =
+      create_pusch_processor_factory_sw(pusch_proc_factory_config);
+  TESTASSERT(pusch_proc_factory);
+
+  std::unique_ptr<pusch_processor> processor = pusch_proc_factory->create();
+  TESTASSERT(processor);
+
+  std::unique_ptr<pusch_pdu_validator> validator = pusch_proc_factory->create_validator();
+  TESTASSERT(validator);
+
+  return std::make_tuple(std::move(processor), std::move(validator));
+}
+
+// Creates a resource grid.
+static std::unique_ptr<resource_grid> create_resource_grid(unsigned nof_ports, unsigned nof_symbols, unsigned nof_subc)
+{
+  std::shared_ptr<channel_precoder_factory> precoding_factory = create_channel_precoder_factory("generic");
+  TESTASSERT(precoding_factory != nullptr, "Invalid channel precoder factory.");
+  std::shared_ptr<resource_grid_factory> rg_factory = create_resource_grid_factory(precoding_factory);
+  TESTASSERT(rg_factory != nullptr, "Invalid resource grid factory.");
+
+  return rg_factory->create(nof_ports, nof_symbols, nof_subc);
+}
+
+// Processes a single UE transmission and waits for the data result.
+static void process_ue(pusch_processor&            processor,
+                       rx_buffer_pool&             buffer_pool,
+                       const ue_transmission&      ue,
+                       const resource_grid_reader& grid,
+                       span<uint8_t>               data)
+{
+  pusch_processor_result_notifier_adaptor result_notifier;
+
+  unique_rx_buffer buffer =
+      buffer_pool.reserve(ue.config.slot, trx_buffer_identifier(ue.config.rnti, 0), ue.nof_codeblocks, true);
+
+  processor.process(data.first(ue.tbs / 8), std::move(buffer), result_notifier, grid, ue.config);
+
+  result_notifier.wait_for_completion();
+}
+
+int main(int argc, char** argv)
+{
+  int ret = parse_args(argc, argv);
+  if (ret < 0) {
+    return ret;
+  }
+
+  // Generate the slot transmissions.
+  std::vector<ue_transmission> transmissions = generate_slot_transmissions(selected_profile);
+
+  // Pseudo-random generator.
+  std::mt19937 rgen(0);
+
+  // Grid dimensions for all test cases.
+  unsigned grid_nof_symbols = get_nsymb_per_slot(cyclic_prefix::NORMAL);
+  unsigned grid_nof_subcs   = selected_profile.nof_prb * NRE;
+
+  // Create the resource grid and fill it with random RE.
+  std::unique_ptr<resource_grid> grid =
+      create_resource_grid(selected_profile.nof_rx_ports, grid_nof_symbols, grid_nof_subcs);
+  TESTASSERT(grid);
+
+  std::vector<cf_t>                 random_re(grid_nof_subcs);
+  complex_normal_distribution<cf_t> c_normal_dist = {};
+  bounded_bitset<NRE* MAX_RB>       re_mask       = ~bounded_bitset<NRE * MAX_RB>(grid_nof_subcs);
+  for (unsigned i_rx_port = 0; i_rx_port != selected_profile.nof_rx_ports; ++i_rx_port) {
+    for (unsigned i_symbol = 0; i_symbol != grid_nof_symbols; ++i_symbol) {
+      std::generate(random_re.begin(), random_re.end(), [&rgen, &c_normal_dist]() { return c_normal_dist(rgen); });
+      grid->get_writer().put(i_rx_port, i_symbol, 0, re_mask, random_re);
+    }
+  }
+
+  // Create processor and validator.
+  std::unique_ptr<pusch_processor>     processor;
+  std::unique_ptr<pusch_pdu_validator> validator;
+  std::tie(processor, validator) = create_processor();
+
+  // Create a buffer pool large enough for all the UEs of the slot.
+  unsigned max_nof_codeblocks = 0;
+  for (const ue_transmission& ue : transmissions) {
+    TESTASSERT(validator->is_valid(ue.config));
+    max_nof_codeblocks = std::max(max_nof_codeblocks, ue.nof_codeblocks);
+  }
+
+  rx_buffer_pool_config buffer_pool_config = {};
+  buffer_pool_config.nof_buffers           = transmissions.size();
+  buffer_pool_config.nof_codeblocks        = transmissions.size() * max_nof_codeblocks;
+  buffer_pool_config.max_codeblock_size    = ldpc::MAX_CODEBLOCK_SIZE;
+  buffer_pool_config.expire_timeout_slots =
+      100 * get_nof_slots_per_subframe(to_subcarrier_spacing(transmissions.front().config.slot.numerology()));
+  buffer_pool_config.external_soft_bits = false;
+
+  std::unique_ptr<rx_buffer_pool_controller> buffer_pool = create_rx_buffer_pool(buffer_pool_config);
+  TESTASSERT(buffer_pool);
+
+  // Receive data buffer, shared among UEs.
+  std::vector<uint8_t> data(ldpc::MAX_CODEBLOCK_SIZE / 8 * max_nof_codeblocks * transmissions.size());
+
+  // Benchmark every UE of the slot individually.
+  benchmarker perf_meas_ue("PUSCH chain per UE", nof_repetitions);
+  for (unsigned i_ue = 0; i_ue != transmissions.size(); ++i_ue) {
+    const ue_transmission& ue = transmissions[i_ue];
+
+    fmt::memory_buffer meas_description;
+    fmt::format_to(meas_description,
+                   "UE#{:<2} RB={:<3} Mod={:<6} R={:<5.3f}",
+                   i_ue,
+                   ue.config.freq_alloc.get_nof_rb(),
+                   to_string(ue.config.mcs_descr.modulation),
+                   ue.config.mcs_descr.get_normalised_target_code_rate());
+
+    perf_meas_ue.new_measure(to_string(meas_description), ue.tbs, [&]() {
+      process_ue(*processor, buffer_pool->get_pool(), ue, grid->get_reader(), data);
+    });
+  }
+
+  // Benchmark the complete slot, processing all the UEs back to back, and track the slot processing time for the
+  // feasibility report.
+  uint64_t slot_time_sum_ns = 0;
+  uint64_t slot_time_max_ns = 0;
+  unsigned slot_tbs_sum     = std::accumulate(
+      transmissions.begin(), transmissions.end(), 0U, [](unsigned sum, const ue_transmission& ue) {
+        return sum + ue.tbs;
+      });
+
+  benchmarker perf_meas_slot("PUSCH chain per slot", nof_repetitions);
+  perf_meas_slot.new_measure(selected_profile.name, slot_tbs_sum, [&]() {
+    auto start = std::chrono::steady_clock::now();
+    for (const ue_transmission& ue : transmissions) {
+      process_ue(*processor, buffer_pool->get_pool(), ue, grid->get_reader(), data);
+    }
+    auto elapsed_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    slot_time_sum_ns += elapsed_ns;
+    slot_time_max_ns = std::max<uint64_t>(slot_time_max_ns, elapsed_ns);
+  });
+
+  if (!silent) {
+    fmt::print("\n--- Per-UE processing time ---\n");
+    perf_meas_ue.print_percentiles_time();
+
+    fmt::print("\n--- Slot processing time ---\n");
+    perf_meas_slot.print_percentiles_time();
+
+    // Slot feasibility: the slot processing time must stay below the slot duration for the composition to be
+    // sustainable in real time on a single chain.
+    double slot_duration_us =
+        1e3 / static_cast<double>(pow2(transmissions.front().config.slot.numerology()));
+    double mean_us = static_cast<double>(slot_time_sum_ns) * 1e-3 / static_cast<double>(nof_repetitions);
+    double max_us  = static_cast<double>(slot_time_max_ns) * 1e-3;
+
+    fmt::print("\n--- Slot feasibility ---\n");
+    fmt::print("Slot duration:        {:>8.1f} us\n", slot_duration_us);
+    fmt::print("Mean processing time: {:>8.1f} us ({:.1f}% of the slot)\n",
+               mean_us,
+               100.0 * mean_us / slot_duration_us);
+    fmt::print("Max processing time:  {:>8.1f} us ({:.1f}% of the slot)\n",
+               max_us,
+               100.0 * max_us / slot_duration_us);
+  }
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/srsvec/add.h"
+#include "srsran/srsvec/aligned_vec.h"
+#include "srsran/srsvec/dot_prod.h"
+#include "srsran/srsvec/prod.h"
+#include "srsran/support/benchmark_utils.h"
+#include <getopt.h>
+#include <random>
+
+using namespace srsran;
+
+// Random generator.
+static std::mt19937 rgen(0);
+
+static unsigned nof_repetitions = 1000;
+static bool     silent          = false;
+
+// Vector lengths to benchmark, covering small control-channel sizes up to a full carrier symbol.
+static const std::vector<unsigned> vector_lengths = {64, 300, 1024, 3276, 8192};
+
+// Offsets applied to the vector start, to measure SIMD-aligned and unaligned accesses.
+static const std::vector<unsigned> offsets = {0, 1};
+
+static void usage(const char* prog)
+{
+  fmt::print("Usage: {} [-R repetitions] [-s silent]\n", prog);
+  fmt::print("\t-R Repetitions [Default {}]\n", nof_repetitions);
+  fmt::print("\t-s Toggle silent operation [Default {}]\n", silent);
+  fmt::print("\t-h Show this message\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "R:sh")) != -1) {
+    switch (opt) {
+      case 'R':
+        nof_repetitions = std::strtol(optarg, nullptr, 10);
+        break;
+      case 's':
+        silent = (!silent);
+        break;
+      case 'h':
+      default:
+        usage(argv[0]);
+        exit(0);
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+
+  // Maximum buffer size, including room for the largest offset.
+  unsigned max_size = vector_lengths.back() + offsets.back();
+
+  // Input and output buffers. The buffers are SIMD aligned, an offset of zero results in aligned accesses.
+  srsvec::aligned_vec<cf_t> x(max_size);
+  srsvec::aligned_vec<cf_t> y(max_size);
+  srsvec::aligned_vec<cf_t> z(max_size);
+
+  std::generate(x.begin(), x.end(), [&dist]() { return cf_t(dist(rgen), dist(rgen)); });
+  std::generate(y.begin(), y.end(), [&dist]() { return cf_t(dist(rgen), dist(rgen)); });
+
+  benchmarker perf_meas("srsvec", nof_repetitions);
+
+  for (unsigned offset : offsets) {
+    for (unsigned length : vector_lengths) {
+      span<const cf_t> x_view = span<const cf_t>(x).subspan(offset, length);
+      span<const cf_t> y_view = span<const cf_t>(y).subspan(offset, length);
+      span<cf_t>       z_view = span<cf_t>(z).subspan(offset, length);
+
+      std::string meas_suffix = fmt::format("length={} offset={}", length, offset);
+
+      perf_meas.new_measure("dot_prod " + meas_suffix, length, [&x_view, &y_view]() {
+        cf_t result = srsvec::dot_prod(x_view, y_view);
+        do_not_optimize(result);
+      });
+
+      perf_meas.new_measure("average_power " + meas_suffix, length, [&x_view]() {
+        float result = srsvec::average_power(x_view);
+        do_not_optimize(result);
+      });
+
+      perf_meas.new_measure(
+          "prod " + meas_suffix, length, [&x_view, &y_view, &z_view]() { srsvec::prod(x_view, y_view, z_view); });
+
+      perf_meas.new_measure("prod_conj " + meas_suffix, length, [&x_view, &y_view, &z_view]() {
+        srsvec::prod_conj(x_view, y_view, z_view);
+      });
+
+      perf_meas.new_measure(
+          "add " + meas_suffix, length, [&x_view, &y_view, &z_view]() { srsvec::add(x_view, y_view, z_view); });
+    }
+  }
+
+  if (!silent) {
+    perf_meas.print_percentiles_throughput("samples");
+  }
+
+  return 0;
+}
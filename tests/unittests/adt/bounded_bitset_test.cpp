@@ -1002,3 +1002,52 @@ TEST(bounded_bitset_test, to_packed_bits_two_byte)
   std::array<uint8_t, 2> expected_packed_bits2 = {0b11000000, 0b01000000};
   ASSERT_TRUE(std::equal(expected_packed_bits2.begin(), expected_packed_bits2.end(), packed_bits2.begin()));
 }
+
+TEST(bounded_bitset_test, count_range)
+{
+  bounded_bitset<100> bitset(95);
+  bitset.fill(10, 20);
+  bitset.set(64);
+  bitset.set(70);
+
+  ASSERT_EQ(bitset.count(0, 95), bitset.count());
+  ASSERT_EQ(bitset.count(0, 10), 0);
+  ASSERT_EQ(bitset.count(10, 20), 10);
+  ASSERT_EQ(bitset.count(15, 65), 6);
+  ASSERT_EQ(bitset.count(65, 95), 1);
+  ASSERT_EQ(bitset.count(30, 30), 0);
+}
+
+TEST(bounded_bitset_test, find_lowest_run)
+{
+  bounded_bitset<100> bitset(95);
+  bitset.fill(0, 5);
+  bitset.fill(8, 10);
+  bitset.fill(80, 95);
+
+  // Gaps of zeros are [5, 8) and [10, 80).
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 1, false), 5);
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 3, false), 5);
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 4, false), 10);
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 70, false), 10);
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 71, false), -1);
+  ASSERT_EQ(bitset.find_lowest_run(11, 95, 30, false), 11);
+
+  // Runs of ones are [0, 5), [8, 10) and [80, 95).
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 5, true), 0);
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 6, true), 80);
+  ASSERT_EQ(bitset.find_lowest_run(0, 95, 16, true), -1);
+  ASSERT_EQ(bitset.find_lowest_run(85, 95, 10, true), 85);
+}
+
+TEST(bounded_bitset_test, find_lowest_run_empty_and_full)
+{
+  bounded_bitset<64> empty_bitset(60);
+  ASSERT_EQ(empty_bitset.find_lowest_run(0, 60, 60, false), 0);
+  ASSERT_EQ(empty_bitset.find_lowest_run(0, 60, 1, true), -1);
+
+  bounded_bitset<64> full_bitset(60);
+  full_bitset.fill(0, 60);
+  ASSERT_EQ(full_bitset.find_lowest_run(0, 60, 1, false), -1);
+  ASSERT_EQ(full_bitset.find_lowest_run(0, 60, 60, true), 0);
+}
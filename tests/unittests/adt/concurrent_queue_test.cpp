@@ -69,6 +69,10 @@ using concurrent_queue_types = ::testing::Types<
     concurrent_queue<moveonly_test_object, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::sleep>,
     concurrent_queue<int, concurrent_queue_policy::locking_mpsc, concurrent_queue_wait_policy::sleep>,
     concurrent_queue<moveonly_test_object, concurrent_queue_policy::locking_mpsc, concurrent_queue_wait_policy::sleep>,
+    concurrent_queue<int, concurrent_queue_policy::lockfree_spsc, concurrent_queue_wait_policy::spin>,
+    concurrent_queue<int, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::spin>,
+    concurrent_queue<int, concurrent_queue_policy::lockfree_spsc, concurrent_queue_wait_policy::adaptive_sleep>,
+    concurrent_queue<int, concurrent_queue_policy::lockfree_mpmc, concurrent_queue_wait_policy::adaptive_sleep>,
     concurrent_queue<int, concurrent_queue_policy::locking_mpsc, concurrent_queue_wait_policy::condition_variable>,
     concurrent_queue<moveonly_test_object,
                      concurrent_queue_policy::locking_mpsc,
@@ -351,6 +351,61 @@ TEST_P(rlc_tx_am_test, tx_without_segmentation)
   tx_full_pdus(n_pdus, 5);
 }
 
+TEST_P(rlc_tx_am_test, tx_batched_pull)
+{
+  const uint32_t n_pdus   = 5;
+  const uint32_t sdu_size = 4;
+
+  // Writer that assembles consecutive PDUs into a fixed-size buffer, as the MAC does during TB assembly.
+  class test_pdu_writer : public rlc_pdu_writer
+  {
+  public:
+    explicit test_pdu_writer(uint32_t buf_size) { buf.resize(buf_size); }
+
+    span<uint8_t> begin_pdu(unsigned max_pdu_size) override
+    {
+      unsigned pdu_size = std::min(static_cast<unsigned>(buf.size() - offset), max_pdu_size);
+      return span<uint8_t>(buf).subspan(offset, pdu_size);
+    }
+
+    unsigned commit_pdu(unsigned nof_bytes) override
+    {
+      offset += nof_bytes;
+      nof_pdus += nof_bytes > 0 ? 1 : 0;
+      return nof_bytes;
+    }
+
+    std::vector<uint8_t> buf;
+    uint32_t             offset   = 0;
+    uint32_t             nof_pdus = 0;
+  };
+
+  // Push "n_pdus" SDUs into RLC
+  auto sdu_bufs = std::vector<byte_buffer>(n_pdus);
+  for (uint32_t i = 0; i < n_pdus; i++) {
+    sdu_bufs[i] = test_helpers::create_pdcp_pdu(config.pdcp_sn_len, /* is_srb = */ false, i, sdu_size, i);
+    rlc->handle_sdu(sdu_bufs[i].deep_copy().value(), false); // keep local copy for later comparison
+  }
+  pcell_worker.run_pending_tasks();
+
+  uint32_t header_size   = sn_size == rlc_am_sn_size::size12bits ? 2 : 3;
+  uint32_t data_pdu_size = header_size + sdu_size;
+  EXPECT_EQ(rlc->get_buffer_state(), n_pdus * data_pdu_size);
+
+  // Pull all PDUs in a single batched call
+  test_pdu_writer writer(n_pdus * data_pdu_size);
+  size_t          total_bytes = rlc->pull_pdus(writer);
+  EXPECT_EQ(total_bytes, n_pdus * data_pdu_size);
+  EXPECT_EQ(writer.nof_pdus, n_pdus);
+  EXPECT_EQ(rlc->get_buffer_state(), 0);
+
+  // Check PDU payloads
+  for (uint32_t i = 0; i < n_pdus; i++) {
+    span<uint8_t> pdu = span<uint8_t>(writer.buf).subspan(i * data_pdu_size, data_pdu_size);
+    EXPECT_TRUE(std::equal(pdu.begin() + header_size, pdu.end(), sdu_bufs[i].begin(), sdu_bufs[i].end()));
+  }
+}
+
 TEST_P(rlc_tx_am_test, tx_small_grant_)
 {
   const uint32_t n_sdus   = 5;
@@ -121,3 +121,23 @@ TEST(ul_logical_channel_test, total_pending_bytes_equal_sum_of_logical_channel_p
     ASSERT_EQ(lch_mng.pending_bytes(lcgid), bsrs[i]);
   }
 }
+
+TEST(ul_logical_channel_test, lcg_deactivation_clears_pending_bytes_and_reactivation_restores_them)
+{
+  ul_logical_channel_manager lch_mng;
+  lcg_id_t                   lcgid = (lcg_id_t)get_random_uint(0, MAX_LCG_ID);
+  unsigned                   bsr   = get_random_uint(1, 10000);
+  lch_mng.set_status(lcgid, true);
+  lch_mng.handle_bsr_indication(make_sbsr(lcgid, bsr));
+
+  lch_mng.deactivate();
+
+  ASSERT_EQ(lch_mng.pending_bytes(), 0);
+  ASSERT_FALSE(lch_mng.has_pending_bytes());
+
+  // The last BSR is not forgotten when the LCG is reactivated.
+  lch_mng.set_status(lcgid, true);
+
+  ASSERT_EQ(lch_mng.pending_bytes(), add_header_bytes(lcgid, bsr));
+  ASSERT_TRUE(lch_mng.has_pending_bytes());
+}
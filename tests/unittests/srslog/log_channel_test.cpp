@@ -147,7 +147,7 @@ static bool when_logging_then_filled_in_log_entry_is_pushed_into_the_backend()
   ASSERT_EQ(entry.metadata.context.value64, uint64_t(ctx1) << 32 | ctx2);
   ASSERT_EQ(entry.metadata.context.enabled, true);
   ASSERT_EQ(entry.metadata.fmtstring, std::string("test"));
-  ASSERT_EQ(entry.metadata.log_name, name);
+  ASSERT_EQ(*entry.metadata.log_name, name);
   ASSERT_EQ(entry.metadata.log_tag, tag);
   ASSERT_EQ(entry.metadata.hex_dump.empty(), true);
 
@@ -181,7 +181,7 @@ static bool when_logging_with_hex_dump_then_filled_in_log_entry_is_pushed_into_t
   ASSERT_EQ(entry.metadata.context.value64, uint64_t(ctx1) << 32 | ctx2);
   ASSERT_EQ(entry.metadata.context.enabled, true);
   ASSERT_EQ(entry.metadata.fmtstring, std::string("test"));
-  ASSERT_EQ(entry.metadata.log_name, name);
+  ASSERT_EQ(*entry.metadata.log_name, name);
   ASSERT_EQ(entry.metadata.log_tag, tag);
   ASSERT_EQ(entry.metadata.hex_dump.size(), 4);
   ASSERT_EQ(std::equal(entry.metadata.hex_dump.begin(), entry.metadata.hex_dump.end(), std::begin(hex)), true);
@@ -244,7 +244,7 @@ static bool when_logging_with_context_then_filled_in_log_entry_is_pushed_into_th
   ASSERT_NE(entry.metadata.tp.time_since_epoch().count(), 0);
   ASSERT_EQ(entry.metadata.context.value64, uint64_t(ctx1) << 32 | ctx2);
   ASSERT_EQ(entry.metadata.context.enabled, true);
-  ASSERT_EQ(entry.metadata.log_name, name);
+  ASSERT_EQ(*entry.metadata.log_name, name);
   ASSERT_EQ(entry.metadata.log_tag, tag);
   ASSERT_EQ(entry.metadata.hex_dump.empty(), true);
 
@@ -277,7 +277,7 @@ static bool when_logging_with_context_and_message_then_filled_in_log_entry_is_pu
   ASSERT_EQ(entry.metadata.context.value64, uint64_t(ctx1) << 32 | ctx2);
   ASSERT_EQ(entry.metadata.context.enabled, true);
   ASSERT_EQ(entry.metadata.fmtstring, std::string("test"));
-  ASSERT_EQ(entry.metadata.log_name, name);
+  ASSERT_EQ(*entry.metadata.log_name, name);
   ASSERT_EQ(entry.metadata.log_tag, tag);
   ASSERT_EQ(entry.metadata.hex_dump.empty(), true);
 
@@ -39,7 +39,7 @@ static detail::log_entry_metadata build_log_entry_metadata(fmt::dynamic_format_a
   }
 
   uint64_t ctx_value = ((uint64_t(99) << 32) | uint64_t(99));
-  return {tp, {ctx_value, true}, "Text {}", store, "ABC", 'Z'};
+  return {tp, {ctx_value, true}, "Text {}", store, std::make_shared<const std::string>("ABC"), 'Z'};
 }
 
 static bool when_fully_filled_log_entry_then_everything_is_formatted()
@@ -59,7 +59,7 @@ static bool when_log_entry_without_name_is_passed_then_name_is_not_formatted()
 {
   fmt::dynamic_format_arg_store<fmt::format_context> store;
   auto                                               entry = build_log_entry_metadata(&store);
-  entry.log_name                                           = "";
+  entry.log_name                                           = nullptr;
 
   fmt::memory_buffer buffer;
   text_formatter{}.format(std::move(entry), buffer);
@@ -161,6 +161,37 @@ TEST(event_tracing_test, deactivated_file_event_tracer)
   ASSERT_EQ(line, "]");
 }
 
+TEST(event_tracing_test, runtime_disabled_trace_category)
+{
+  open_trace_file("/tmp/event_tracing_test3.json");
+
+  file_event_tracer<> tracer{trace_category::l1};
+
+  ASSERT_TRUE(is_trace_category_enabled(trace_category::l1));
+  set_trace_category_enabled(trace_category::l1, false);
+  ASSERT_FALSE(is_trace_category_enabled(trace_category::l1));
+
+  trace_point tp = tracer.now();
+
+  tracer << trace_event("test_event1", tp);
+  tracer << instant_trace_event("test_event2", instant_trace_event::cpu_scope::global);
+  tracer << trace_thres_event("test_event3", tp, trace_duration{0});
+
+  set_trace_category_enabled(trace_category::l1, true);
+  ASSERT_TRUE(is_trace_category_enabled(trace_category::l1));
+
+  close_trace_file();
+
+  std::ifstream fptr("/tmp/event_tracing_test3.json");
+  ASSERT_TRUE(fptr.is_open());
+  std::string line;
+
+  ASSERT_TRUE(std::getline(fptr, line));
+  ASSERT_EQ(line, "[");
+  ASSERT_TRUE(std::getline(fptr, line));
+  ASSERT_EQ(line, "]");
+}
+
 TEST(trace_executor_test, enqueue_and_run_traces)
 {
   manual_task_worker worker{128};
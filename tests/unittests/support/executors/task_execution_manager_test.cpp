@@ -73,6 +73,33 @@ TEST_F(task_execution_manager_test, creation_of_task_worker_pool)
   ASSERT_EQ(thread_name.find("WORKER_POOL#"), 0);
 }
 
+TEST_F(task_execution_manager_test, executor_with_metrics_enabled_records_task_latencies)
+{
+  using namespace execution_config_helper;
+  single_worker cfg{"WORKER", {concurrent_queue_policy::lockfree_spsc, 8}, {{"EXEC"}}, std::chrono::microseconds{100}};
+  cfg.executors[0].report_metrics = true;
+
+  task_execution_manager mng;
+  ASSERT_TRUE(mng.add_execution_context(create_execution_context(cfg)));
+
+  // Run single task in created execution environment.
+  std::promise<void> p;
+  std::future<void>  f = p.get_future();
+  ASSERT_TRUE(mng.executors().at("EXEC")->execute([&p]() { p.set_value(); }));
+  f.get();
+
+  // Collecting the metrics returns the recorded sample and resets the accumulators.
+  auto metrics = mng.collect_executor_metrics();
+  ASSERT_EQ(metrics.size(), 1);
+  ASSERT_EQ(metrics[0].first, "EXEC");
+  ASSERT_EQ(metrics[0].second.enqueue_latency.nof_samples, 1);
+  ASSERT_EQ(metrics[0].second.execution_latency.nof_samples, 1);
+
+  metrics = mng.collect_executor_metrics();
+  ASSERT_EQ(metrics.size(), 1);
+  ASSERT_EQ(metrics[0].second.enqueue_latency.nof_samples, 0);
+}
+
 TEST_F(task_execution_manager_test, worker_with_queues_of_different_priorities)
 {
   using namespace execution_config_helper;
@@ -92,7 +92,8 @@ protected:
   pool_type pool;
 };
 using worker_pool_types = ::testing::Types<task_worker_pool<concurrent_queue_policy::lockfree_mpmc>,
-                                           task_worker_pool<concurrent_queue_policy::locking_mpmc>>;
+                                           task_worker_pool<concurrent_queue_policy::locking_mpmc>,
+                                           work_stealing_task_worker_pool>;
 TYPED_TEST_SUITE(task_worker_pool_test, worker_pool_types);
 
 TYPED_TEST(task_worker_pool_test, correct_initialization)
@@ -209,6 +210,32 @@ TEST_P(prio_task_worker_pool_test, prio_worker_pool_executor_can_run_inline)
   ASSERT_TRUE(f.get());
 }
 
+TEST_P(prio_task_worker_pool_test, task_with_expired_deadline_is_discarded)
+{
+  std::promise<void> p;
+  std::future<void>  f = p.get_future();
+  std::atomic<bool>  task_ran{false};
+  this->pool.set_missed_deadline_handler([&p](enqueue_priority) { p.set_value(); });
+
+  ASSERT_TRUE(this->pool.push_task(enqueue_priority::max,
+                                   std::chrono::steady_clock::now() - std::chrono::seconds{1},
+                                   [&task_ran]() { task_ran = true; }));
+
+  // The missed deadline handler runs instead of the task.
+  f.get();
+  ASSERT_FALSE(task_ran);
+}
+
+TEST_P(prio_task_worker_pool_test, task_with_pending_deadline_is_run)
+{
+  std::promise<void> p;
+  std::future<void>  f = p.get_future();
+
+  ASSERT_TRUE(this->pool.push_task(
+      enqueue_priority::max, std::chrono::steady_clock::now() + std::chrono::minutes{1}, [&p]() { p.set_value(); }));
+  f.get();
+}
+
 TEST(spsc_task_worker_test, correct_initialization)
 {
   general_task_worker<concurrent_queue_policy::lockfree_spsc, concurrent_queue_wait_policy::sleep> worker{
@@ -0,0 +1,82 @@
+/*
+ *
+ * Copyright 2021-2024 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/support/memory_pool/slot_arena.h"
+#include "srsran/support/test_utils.h"
+#include <gtest/gtest.h>
+
+using namespace srsran;
+
+TEST(slot_arena, consecutive_allocations_do_not_overlap_and_respect_alignment)
+{
+  slot_arena arena(4096);
+
+  auto* first  = static_cast<uint8_t*>(arena.allocate(slot_arena::client::other, 24, 8));
+  auto* second = static_cast<uint8_t*>(arena.allocate(slot_arena::client::other, 48, 16));
+  ASSERT_NE(first, nullptr);
+  ASSERT_GE(second, first + 24) << "Allocations should not overlap";
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(first) % 8, 0U);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(second) % 16, 0U);
+}
+
+TEST(slot_arena, reset_reclaims_all_bytes)
+{
+  slot_arena arena(4096);
+
+  for (unsigned slot = 0; slot != 16; ++slot) {
+    // Without the reset, this loop would deplete the arena.
+    arena.reset();
+    unsigned sz = test_rgen::uniform_int<unsigned>(1, 1024);
+    arena.allocate(slot_arena::client::other, sz, 1);
+    arena.allocate(slot_arena::client::other, 1024, 1);
+  }
+}
+
+TEST(slot_arena, high_watermark_tracks_maximum_bytes_drawn_within_a_slot)
+{
+  slot_arena arena(4096);
+
+  arena.allocate(slot_arena::client::scheduler, 100, 1);
+  arena.allocate(slot_arena::client::fapi, 200, 1);
+  ASSERT_EQ(arena.high_watermark(slot_arena::client::scheduler), 100U);
+  ASSERT_EQ(arena.high_watermark(slot_arena::client::fapi), 200U);
+
+  arena.reset();
+  arena.allocate(slot_arena::client::scheduler, 50, 1);
+  ASSERT_EQ(arena.high_watermark(slot_arena::client::scheduler), 100U)
+      << "High-water mark should survive slots that draw fewer bytes";
+  ASSERT_EQ(arena.high_watermark(slot_arena::client::fapi), 200U);
+}
+
+TEST(slot_arena, arena_backed_vector_supports_growth_and_modification)
+{
+  slot_arena arena(4096);
+
+  slot_arena_vector<unsigned> vec(arena.make_allocator<unsigned>(slot_arena::client::scheduler));
+  for (unsigned i = 0; i != 64; ++i) {
+    vec.push_back(i);
+  }
+  vec.erase(vec.begin(), vec.begin() + 32);
+  ASSERT_EQ(vec.size(), 32U);
+  ASSERT_EQ(vec.front(), 32U);
+  ASSERT_GT(arena.nof_bytes_allocated(), 0U);
+}